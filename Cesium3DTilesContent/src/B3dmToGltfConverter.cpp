@@ -14,6 +14,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <span>
 #include <utility>
 
@@ -189,6 +190,7 @@ void convertB3dmMetadataToGltfStructuralMetadata(
     const std::span<const std::byte>& b3dmBinary,
     const B3dmHeader& header,
     uint32_t headerLength,
+    bool deferJsonProperties,
     GltfConverterResult& result) {
   if (result.model && header.featureTableJsonByteLength > 0) {
     CesiumGltf::Model& gltf = result.model.value();
@@ -214,7 +216,9 @@ void convertB3dmMetadataToGltfStructuralMetadata(
                   batchTableStart + header.batchTableJsonByteLength),
               header.batchTableBinaryByteLength);
 
-      rapidjson::Document batchTableJson;
+      std::shared_ptr<rapidjson::Document> pBatchTableJson =
+          std::make_shared<rapidjson::Document>();
+      rapidjson::Document& batchTableJson = *pBatchTableJson;
       batchTableJson.Parse(
           reinterpret_cast<const char*>(batchTableJsonData.data()),
           batchTableJsonData.size());
@@ -229,11 +233,21 @@ void convertB3dmMetadataToGltfStructuralMetadata(
       }
 
       // upgrade batch table to glTF structural metadata and append the result
-      result.errors.merge(BatchTableToGltfStructuralMetadata::convertFromB3dm(
-          featureTableJson,
-          batchTableJson,
-          batchTableBinaryData,
-          gltf));
+      if (deferJsonProperties) {
+        result.errors.merge(
+            BatchTableToGltfStructuralMetadata::convertFromB3dmDeferred(
+                featureTableJson,
+                pBatchTableJson,
+                batchTableBinaryData,
+                gltf));
+      } else {
+        result.errors.merge(
+            BatchTableToGltfStructuralMetadata::convertFromB3dm(
+                featureTableJson,
+                batchTableJson,
+                batchTableBinaryData,
+                gltf));
+      }
     }
   }
 }
@@ -258,12 +272,17 @@ CesiumAsync::Future<GltfConverterResult> B3dmToGltfConverter::convert(
              options,
              assetFetcher)
       .thenImmediately(
-          [b3dmBinary, header, headerLength](GltfConverterResult&& glbResult) {
+          [b3dmBinary,
+           header,
+           headerLength,
+           deferJsonProperties = options.deferBatchTableConversion](
+              GltfConverterResult&& glbResult) {
             if (!glbResult.errors) {
               convertB3dmMetadataToGltfStructuralMetadata(
                   b3dmBinary,
                   header,
                   headerLength,
+                  deferJsonProperties,
                   glbResult);
             }
             return std::move(glbResult);
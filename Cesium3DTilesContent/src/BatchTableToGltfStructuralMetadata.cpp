@@ -9,6 +9,7 @@
 #include <CesiumGltf/BufferView.h>
 #include <CesiumGltf/Class.h>
 #include <CesiumGltf/ClassProperty.h>
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
 #include <CesiumGltf/ExtensionExtInstanceFeatures.h>
 #include <CesiumGltf/ExtensionExtMeshFeatures.h>
 #include <CesiumGltf/ExtensionExtMeshGpuInstancing.h>
@@ -41,6 +42,7 @@
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
@@ -1747,8 +1749,77 @@ void updateExtensionWithBatchTableHierarchy(
   }
 }
 
+// Finds the class property of a property in a property table of the model,
+// or returns nullptr if there is none.
+ClassProperty* findClassProperty(
+    CesiumGltf::Model& gltf,
+    const PropertyTable& propertyTable,
+    const std::string& propertyId) {
+  ExtensionModelExtStructuralMetadata* pExtension =
+      gltf.getExtension<ExtensionModelExtStructuralMetadata>();
+  if (!pExtension || !pExtension->schema) {
+    return nullptr;
+  }
+
+  const auto classIt =
+      pExtension->schema->classes.find(propertyTable.classProperty);
+  if (classIt == pExtension->schema->classes.end()) {
+    return nullptr;
+  }
+
+  const auto propertyIt = classIt->second.properties.find(propertyId);
+  if (propertyIt == classIt->second.properties.end()) {
+    return nullptr;
+  }
+
+  return &propertyIt->second;
+}
+
+// Converts a JSON batch table property whose conversion was deferred, and
+// replaces its provisional class property with the inferred one. The class
+// property is updated in place, so that views iterating the class stay valid.
+void convertDeferredJsonProperty(
+    const rapidjson::Document& batchTableJson,
+    const std::string& propertyId,
+    CesiumGltf::Model& gltf,
+    PropertyTable& propertyTable) {
+  const auto propertyIt = batchTableJson.FindMember(propertyId.c_str());
+  if (propertyIt == batchTableJson.MemberEnd() ||
+      !propertyIt->value.IsArray()) {
+    return;
+  }
+
+  ClassProperty scratchClassProperty;
+  ClassProperty* pClassProperty =
+      findClassProperty(gltf, propertyTable, propertyId);
+  if (!pClassProperty) {
+    pClassProperty = &scratchClassProperty;
+  }
+  *pClassProperty = ClassProperty();
+  pClassProperty->name = propertyId;
+
+  PropertyTableProperty& propertyTableProperty =
+      propertyTable.properties.emplace(propertyId, PropertyTableProperty())
+          .first->second;
+  updateExtensionWithJsonProperty(
+      gltf,
+      *pClassProperty,
+      propertyTable,
+      propertyTableProperty,
+      ArrayOfPropertyValues(propertyIt->value));
+
+  if (propertyTableProperty.values < 0) {
+    // Don't include properties without _any_ values.
+    propertyTable.properties.erase(propertyId);
+  }
+}
+
+// Converts the batch table to EXT_structural_metadata. If
+// `pDeferredBatchTableJson` is not nullptr, it must point to `batchTableJson`,
+// and the values of JSON properties are only converted when first needed.
 void convertBatchTableToGltfStructuralMetadataExtension(
     const rapidjson::Document& batchTableJson,
+    const std::shared_ptr<rapidjson::Document>& pDeferredBatchTableJson,
     const std::span<const std::byte>& batchTableBinaryData,
     CesiumGltf::Model& gltf,
     const int64_t featureCount,
@@ -1780,6 +1851,7 @@ void convertBatchTableToGltfStructuralMetadataExtension(
   propertyTable.classProperty = "default";
 
   // Convert each regular property in the batch table
+  std::vector<std::string> deferredPropertyIds;
   for (auto propertyIt = batchTableJson.MemberBegin();
        propertyIt != batchTableJson.MemberEnd();
        ++propertyIt) {
@@ -1794,10 +1866,18 @@ void convertBatchTableToGltfStructuralMetadataExtension(
         classDefinition.properties.emplace(name, ClassProperty()).first->second;
     classProperty.name = name;
 
+    const rapidjson::Value& propertyValue = propertyIt->value;
+    if (pDeferredBatchTableJson && propertyValue.IsArray()) {
+      // The type is only inferred from the values when the property is
+      // converted. Until then, the class property is a string placeholder.
+      classProperty.type = ClassProperty::Type::STRING;
+      deferredPropertyIds.emplace_back(std::move(name));
+      continue;
+    }
+
     PropertyTableProperty& propertyTableProperty =
         propertyTable.properties.emplace(name, PropertyTableProperty())
             .first->second;
-    const rapidjson::Value& propertyValue = propertyIt->value;
     if (propertyValue.IsArray()) {
       updateExtensionWithJsonProperty(
           gltf,
@@ -1827,6 +1907,26 @@ void convertBatchTableToGltfStructuralMetadataExtension(
     }
   }
 
+  if (!deferredPropertyIds.empty()) {
+    const int64_t batchTableJsonSizeBytes = int64_t(
+        sizeof(rapidjson::Document) +
+        pDeferredBatchTableJson->GetAllocator().Capacity());
+    propertyTable.addExtension<DeferredPropertyTableProperties>(
+        std::move(deferredPropertyIds),
+        [pBatchTableJson = std::shared_ptr<const rapidjson::Document>(
+             pDeferredBatchTableJson)](
+            const std::string& propertyId,
+            Model& model,
+            PropertyTable& table) {
+          convertDeferredJsonProperty(
+              *pBatchTableJson,
+              propertyId,
+              model,
+              table);
+        },
+        batchTableJsonSizeBytes);
+  }
+
   // Convert 3DTILES_batch_table_hierarchy
   auto extensionsIt = batchTableJson.FindMember("extensions");
   if (extensionsIt != batchTableJson.MemberEnd()) {
@@ -1858,9 +1958,11 @@ void convertBatchTableToGltfStructuralMetadataExtension(
 
 } // namespace
 
-ErrorList BatchTableToGltfStructuralMetadata::convertFromB3dm(
+namespace {
+ErrorList convertB3dmBatchTable(
     const rapidjson::Document& featureTableJson,
     const rapidjson::Document& batchTableJson,
+    const std::shared_ptr<rapidjson::Document>& pDeferredBatchTableJson,
     const std::span<const std::byte>& batchTableBinaryData,
     CesiumGltf::Model& gltf) {
   // Check to make sure a char of rapidjson is 1 byte
@@ -1889,6 +1991,7 @@ ErrorList BatchTableToGltfStructuralMetadata::convertFromB3dm(
 
   convertBatchTableToGltfStructuralMetadataExtension(
       batchTableJson,
+      pDeferredBatchTableJson,
       batchTableBinaryData,
       gltf,
       batchLength,
@@ -1936,6 +2039,34 @@ ErrorList BatchTableToGltfStructuralMetadata::convertFromB3dm(
 
   return result;
 }
+} // namespace
+
+ErrorList BatchTableToGltfStructuralMetadata::convertFromB3dm(
+    const rapidjson::Document& featureTableJson,
+    const rapidjson::Document& batchTableJson,
+    const std::span<const std::byte>& batchTableBinaryData,
+    CesiumGltf::Model& gltf) {
+  return convertB3dmBatchTable(
+      featureTableJson,
+      batchTableJson,
+      nullptr,
+      batchTableBinaryData,
+      gltf);
+}
+
+ErrorList BatchTableToGltfStructuralMetadata::convertFromB3dmDeferred(
+    const rapidjson::Document& featureTableJson,
+    const std::shared_ptr<rapidjson::Document>& pBatchTableJson,
+    const std::span<const std::byte>& batchTableBinaryData,
+    CesiumGltf::Model& gltf) {
+  CESIUM_ASSERT(pBatchTableJson);
+  return convertB3dmBatchTable(
+      featureTableJson,
+      *pBatchTableJson,
+      pBatchTableJson,
+      batchTableBinaryData,
+      gltf);
+}
 
 ErrorList BatchTableToGltfStructuralMetadata::convertFromPnts(
     const rapidjson::Document& featureTableJson,
@@ -1983,6 +2114,7 @@ ErrorList BatchTableToGltfStructuralMetadata::convertFromPnts(
 
   convertBatchTableToGltfStructuralMetadataExtension(
       batchTableJson,
+      nullptr,
       batchTableBinaryData,
       gltf,
       featureCount,
@@ -2224,6 +2356,7 @@ ErrorList BatchTableToGltfStructuralMetadata::convertFromI3dm(
 
   convertBatchTableToGltfStructuralMetadataExtension(
       batchTableJson,
+      nullptr,
       batchTableBinaryData,
       gltf,
       featureCount,
@@ -6,6 +6,7 @@
 #include <rapidjson/document.h>
 
 #include <cstddef>
+#include <memory>
 #include <span>
 
 namespace Cesium3DTilesContent {
@@ -16,6 +17,16 @@ struct BatchTableToGltfStructuralMetadata {
       const std::span<const std::byte>& batchTableBinaryData,
       CesiumGltf::Model& gltf);
 
+  // Like convertFromB3dm, but the values of JSON array properties are only
+  // converted when first needed. See
+  // CesiumGltf::DeferredPropertyTableProperties. The model keeps the batch
+  // table JSON alive until then.
+  static CesiumUtility::ErrorList convertFromB3dmDeferred(
+      const rapidjson::Document& featureTableJson,
+      const std::shared_ptr<rapidjson::Document>& pBatchTableJson,
+      const std::span<const std::byte>& batchTableBinaryData,
+      CesiumGltf::Model& gltf);
+
   static CesiumUtility::ErrorList convertFromPnts(
       const rapidjson::Document& featureTableJson,
       const rapidjson::Document& batchTableJson,
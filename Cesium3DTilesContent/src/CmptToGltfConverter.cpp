@@ -2,6 +2,7 @@
 #include <Cesium3DTilesContent/GltfConverterResult.h>
 #include <Cesium3DTilesContent/GltfConverters.h>
 #include <CesiumAsync/Future.h>
+#include <CesiumGltf/Model.h>
 #include <CesiumGltfReader/GltfReader.h>
 
 #include <fmt/format.h>
@@ -29,6 +30,57 @@ struct InnerHeader {
 
 static_assert(sizeof(CmptHeader) == 16);
 static_assert(sizeof(InnerHeader) == 12);
+
+// Reserves room in one of the model's arrays for its own elements plus those
+// of the inner models that are still to be merged into it, so that merging
+// moves each element once instead of reallocating the array for every inner
+// tile.
+template <typename T, typename Owner>
+void reserveForMerge(
+    CesiumGltf::Model& model,
+    std::span<const GltfConverterResult> remainingResults,
+    std::vector<T> Owner::*pElements) {
+  size_t count = (model.*pElements).size();
+  for (const GltfConverterResult& innerResult : remainingResults) {
+    if (innerResult.model) {
+      count += ((*innerResult.model).*pElements).size();
+    }
+  }
+  (model.*pElements).reserve(count);
+}
+
+GltfConverterResult
+mergeInnerResults(std::vector<GltfConverterResult>&& innerResults) {
+  if (innerResults.size() == 1) {
+    return std::move(innerResults[0]);
+  }
+
+  GltfConverterResult cmptResult;
+  for (size_t i = 0; i < innerResults.size(); ++i) {
+    GltfConverterResult& innerTile = innerResults[i];
+    if (innerTile.model) {
+      if (cmptResult.model) {
+        cmptResult.model->merge(std::move(*innerTile.model));
+      } else {
+        cmptResult.model = std::move(innerTile.model);
+
+        CesiumGltf::Model& model = *cmptResult.model;
+        const std::span<const GltfConverterResult> remaining =
+            std::span<const GltfConverterResult>(innerResults).subspan(i + 1);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::accessors);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::buffers);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::bufferViews);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::images);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::materials);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::meshes);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::nodes);
+        reserveForMerge(model, remaining, &CesiumGltf::Model::textures);
+      }
+    }
+    cmptResult.errors.merge(std::move(innerTile.errors));
+  }
+  return cmptResult;
+}
 } // namespace
 
 CesiumAsync::Future<GltfConverterResult> CmptToGltfConverter::convert(
@@ -88,8 +140,13 @@ CesiumAsync::Future<GltfConverterResult> CmptToGltfConverter::convert(
 
     pos += pInner->byteLength;
 
-    innerTiles.emplace_back(
-        GltfConverters::convert(innerData, options, assetFetcher));
+    // Convert each inner tile in its own worker task as soon as it is found,
+    // so that the inner tiles are converted in parallel. The caller keeps
+    // cmptBinary alive until the returned future resolves.
+    innerTiles.emplace_back(assetFetcher.asyncSystem.runInWorkerThread(
+        [innerData, options, assetFetcher]() {
+          return GltfConverters::convert(innerData, options, assetFetcher);
+        }));
   }
 
   uint32_t tilesLength = pHeader->tilesLength;
@@ -103,21 +160,11 @@ CesiumAsync::Future<GltfConverterResult> CmptToGltfConverter::convert(
   }
 
   return assetFetcher.asyncSystem.all(std::move(innerTiles))
-      .thenImmediately([](std::vector<GltfConverterResult>&& innerResults) {
-        if (innerResults.size() == 1) {
-          return innerResults[0];
-        }
-        GltfConverterResult cmptResult;
-        for (auto& innerTile : innerResults) {
-          if (innerTile.model) {
-            if (cmptResult.model) {
-              cmptResult.model->merge(std::move(*innerTile.model));
-            } else {
-              cmptResult.model = std::move(innerTile.model);
-            }
-          }
-          cmptResult.errors.merge(innerTile.errors);
-        }
+      .thenImmediately([errors = std::move(result.errors)](
+                           std::vector<GltfConverterResult>&& innerResults) {
+        GltfConverterResult cmptResult =
+            mergeInnerResults(std::move(innerResults));
+        cmptResult.errors.merge(errors);
         return cmptResult;
       });
 }
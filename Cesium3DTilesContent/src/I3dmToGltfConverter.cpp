@@ -6,7 +6,9 @@
 #include <Cesium3DTilesContent/GltfConverterUtility.h>
 #include <Cesium3DTilesContent/GltfConverters.h>
 #include <Cesium3DTilesContent/I3dmToGltfConverter.h>
+#include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/Future.h>
+#include <CesiumAsync/processBatches.h>
 #include <CesiumGeospatial/LocalHorizontalCoordinateSystem.h>
 #include <CesiumGltf/Accessor.h>
 #include <CesiumGltf/AccessorUtility.h>
@@ -22,7 +24,9 @@
 #include <CesiumUtility/Uri.h>
 
 #include <fmt/format.h>
+#include <glm/common.hpp>
 #include <glm/detail/setup.hpp>
+#include <glm/ext/matrix_double3x3.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/vector_double3.hpp>
@@ -33,13 +37,18 @@
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtx/matrix_decompose.hpp>
 #include <glm/matrix.hpp>
+#include <glm/vector_relational.hpp>
 #include <rapidjson/document.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -76,6 +85,24 @@ struct DecodedInstances {
   std::optional<glm::dvec3> rtcCenter;
 };
 
+// The number of instances whose transforms are decoded or written together.
+// Batches are the unit of work given to worker threads.
+constexpr size_t INSTANCES_PER_BATCH = 4096;
+
+// Calls `process` with the range [begin, end) of each batch of instances,
+// spreading the batches across the async system's worker threads.
+void forEachInstanceBatch(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    size_t numInstances,
+    const std::function<void(size_t, size_t)>& process) {
+  const size_t batchCount =
+      (numInstances + INSTANCES_PER_BATCH - 1) / INSTANCES_PER_BATCH;
+  CesiumAsync::processBatches(&asyncSystem, batchCount, [&](size_t batch) {
+    const size_t begin = batch * INSTANCES_PER_BATCH;
+    process(begin, std::min(begin + INSTANCES_PER_BATCH, numInstances));
+  });
+}
+
 // Instance positions may arrive in ECEF coordinates or with other large
 // displacements that will cause problems during rendering. Determine the mean
 // position of the instances and reposition them relative to it, thus creating
@@ -523,12 +550,15 @@ CesiumAsync::Future<ConvertedI3dm> convertI3dmContent(
         reinterpret_cast<const glm::vec3*>(
             pBinaryData + *parsedContent.normalRight),
         numInstances);
-    std::transform(
-        rawUp.begin(),
-        rawUp.end(),
-        rawRight.begin(),
-        decodedInstances.rotations.begin(),
-        rotationFromUpRight);
+    forEachInstanceBatch(
+        assetFetcher.asyncSystem,
+        numInstances,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            decodedInstances.rotations[i] =
+                rotationFromUpRight(rawUp[i], rawRight[i]);
+          }
+        });
 
   } else if (
       parsedContent.normalUpOct32p.has_value() &&
@@ -542,15 +572,15 @@ CesiumAsync::Future<ConvertedI3dm> convertI3dmContent(
         reinterpret_cast<const uint16_t(*)[2]>(
             pBinaryData + *parsedContent.normalRightOct32p),
         numInstances);
-    std::transform(
-        rawUpOct.begin(),
-        rawUpOct.end(),
-        rawRightOct.begin(),
-        decodedInstances.rotations.begin(),
-        [](auto&& upOct, auto&& rightOct) {
-          return rotationFromUpRight(
-              decodeOct32P(upOct),
-              decodeOct32P(rightOct));
+    forEachInstanceBatch(
+        assetFetcher.asyncSystem,
+        numInstances,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            decodedInstances.rotations[i] = rotationFromUpRight(
+                decodeOct32P(rawUpOct[i]),
+                decodeOct32P(rawRightOct[i]));
+          }
         });
   } else if (decodedInstances.rotationENU) {
     glm::dmat4 worldTransform = assetFetcher.tileTransform;
@@ -558,22 +588,25 @@ CesiumAsync::Future<ConvertedI3dm> convertI3dmContent(
       worldTransform = translate(worldTransform, *decodedInstances.rtcCenter);
     }
     auto worldTransformInv = inverse(worldTransform);
-    std::transform(
-        decodedInstances.positions.begin(),
-        decodedInstances.positions.end(),
-        decodedInstances.rotations.begin(),
-        [&](const glm::vec3& position) {
-          // Find the ENU transform using global coordinates.
-          glm::dvec4 worldPos = worldTransform * glm::dvec4(position, 1.0);
-          CesiumGeospatial::LocalHorizontalCoordinateSystem enu(
-              (glm::dvec3(worldPos)));
-          const glm::dmat4& ecef = enu.getLocalToEcefTransformation();
-          // Express the rotation in the tile's coordinate system, just like
-          // explicit i3dm instance rotations.
-          glm::dmat4 tileFrame = worldTransformInv * ecef;
-          return rotationFromUpRight(
-              glm::vec3(tileFrame[1]),
-              glm::vec3(tileFrame[0]));
+    forEachInstanceBatch(
+        assetFetcher.asyncSystem,
+        numInstances,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            // Find the ENU transform using global coordinates.
+            glm::dvec4 worldPos =
+                worldTransform *
+                glm::dvec4(decodedInstances.positions[i], 1.0);
+            CesiumGeospatial::LocalHorizontalCoordinateSystem enu(
+                (glm::dvec3(worldPos)));
+            const glm::dmat4& ecef = enu.getLocalToEcefTransformation();
+            // Express the rotation in the tile's coordinate system, just like
+            // explicit i3dm instance rotations.
+            glm::dmat4 tileFrame = worldTransformInv * ecef;
+            decodedInstances.rotations[i] = rotationFromUpRight(
+                glm::vec3(tileFrame[1]),
+                glm::vec3(tileFrame[0]));
+          }
         });
   }
   decodedInstances.scales.resize(numInstances, glm::vec3(1.0, 1.0, 1.0));
@@ -815,6 +848,116 @@ bool copyInstanceTransformToBuffer(
   return result;
 }
 
+// A transform from a mesh node's coordinate system to the tile's that is only
+// a rotation followed by a translation. Instance transforms can be moved into
+// the coordinate system of such a node without composing and decomposing a
+// matrix for each instance.
+struct RigidTransform {
+  glm::dquat rotation;
+  glm::dvec3 translation;
+  // If the rotation only permutes and flips axes, the tile axis that each node
+  // axis is mapped to. Non-uniform instance scales can only be moved into the
+  // node's coordinate system when this is known.
+  std::optional<std::array<glm::length_t, 3>> axisPermutation;
+};
+
+std::optional<RigidTransform> getRigidTransform(const glm::dmat4& transform) {
+  constexpr double epsilon = 1e-9;
+  const glm::dvec4 lastRow(
+      transform[0][3],
+      transform[1][3],
+      transform[2][3],
+      transform[3][3]);
+  if (glm::any(glm::greaterThan(
+          glm::abs(lastRow - glm::dvec4(0.0, 0.0, 0.0, 1.0)),
+          glm::dvec4(epsilon)))) {
+    return std::nullopt;
+  }
+
+  const glm::dmat3 linear(transform);
+  const glm::dmat3 orthonormalError =
+      glm::transpose(linear) * linear - glm::dmat3(1.0);
+  for (glm::length_t j = 0; j < 3; ++j) {
+    if (glm::any(glm::greaterThan(
+            glm::abs(orthonormalError[j]),
+            glm::dvec3(epsilon)))) {
+      return std::nullopt;
+    }
+  }
+  if (glm::determinant(linear) <= 0.0) {
+    return std::nullopt;
+  }
+
+  RigidTransform result{
+      glm::quat_cast(linear),
+      glm::dvec3(transform[3]),
+      std::nullopt};
+
+  std::array<glm::length_t, 3> permutation{};
+  for (glm::length_t j = 0; j < 3; ++j) {
+    glm::length_t axis = -1;
+    for (glm::length_t k = 0; k < 3; ++k) {
+      const double component = std::abs(linear[j][k]);
+      if (component > 1.0 - epsilon) {
+        axis = k;
+      } else if (component > epsilon) {
+        return result;
+      }
+    }
+    if (axis < 0) {
+      return result;
+    }
+    permutation[static_cast<size_t>(j)] = axis;
+  }
+  result.axisPermutation = permutation;
+  return result;
+}
+
+// Writes the transform of an instance, moved from the tile's coordinate system
+// into a mesh node's, to the instance buffer. If `toTile` is the node-to-tile
+// transform M, the instance transform in the node's coordinate system is
+// M^-1 * T * R * S * M, whose translation, rotation and scale follow directly
+// from those of the instance and M. Returns false without writing anything if
+// the instance's scale can't be moved into the node's coordinate system this
+// way, and the matrix must be decomposed instead.
+bool copyInstanceTransformToBuffer(
+    const RigidTransform& toTile,
+    const glm::dvec3& position,
+    const glm::dquat& rotation,
+    const glm::dvec3& scale,
+    std::byte* pBufferData,
+    size_t i) {
+  if (scale.x <= 0.0 || scale.y <= 0.0 || scale.z <= 0.0) {
+    return false;
+  }
+
+  glm::dvec3 nodeScale;
+  if (toTile.axisPermutation) {
+    const std::array<glm::length_t, 3>& permutation = *toTile.axisPermutation;
+    nodeScale = glm::dvec3(
+        scale[permutation[0]],
+        scale[permutation[1]],
+        scale[permutation[2]]);
+  } else if (scale.x == scale.y && scale.y == scale.z) {
+    nodeScale = scale;
+  } else {
+    return false;
+  }
+
+  const glm::dquat toNode = glm::conjugate(toTile.rotation);
+  const glm::dquat nodeRotation = toNode * rotation * toTile.rotation;
+  const glm::dvec3 nodePosition =
+      toNode * (position + rotation * (scale * toTile.translation) -
+                toTile.translation);
+  copyInstanceTransformToBuffer(
+      nodePosition,
+      nodeRotation,
+      nodeScale,
+      pBufferData,
+      i);
+  return true;
+}
+
 struct GltfAccessorCreator {
   Model& gltf;
   const int32_t instanceBufferViewId;
@@ -930,7 +1073,8 @@ void instantiateWithExistingInstances(
 
 void instantiateGltfInstances(
     GltfConverterResult& result,
-    const DecodedInstances& decodedInstances) {
+    const DecodedInstances& decodedInstances,
+    const CesiumAsync::AsyncSystem& asyncSystem) {
   assert(result.model.has_value());
   std::set<CesiumGltf::Node*> meshNodes;
   int32_t instanceBufferId = createBufferInGltf(*result.model);
@@ -973,21 +1117,45 @@ void instantiateGltfInstances(
               static_cast<uint32_t>(instanceBuffer.cesium.data.size());
           instanceBuffer.cesium.data.resize(dataBaseOffset + instanceDataSize);
           // Transform instance transform into local glTF coordinate system.
+          // When the node's transform is rigid, which it almost always is,
+          // this doesn't need a matrix for each instance.
           const glm::dmat4 toTile = upToZ * transform;
           const glm::dmat4 toTileInv = inverse(toTile);
-          size_t destInstanceIndx = 0;
-          for (unsigned i = 0; i < numInstances; ++i) {
-            const glm::dmat4 instanceTransform =
-                toTileInv * composeInstanceTransform(i, decodedInstances) *
-                toTile;
-            if (!copyInstanceTransformToBuffer(
-                    instanceTransform,
-                    &instanceBuffer.cesium.data[dataBaseOffset],
-                    destInstanceIndx++)) {
-              result.errors.emplaceWarning(
-                  "Matrix decompose failed. Default identity values copied to "
-                  "instance buffer.");
-            }
+          const std::optional<RigidTransform> rigidToTile =
+              getRigidTransform(toTile);
+          std::byte* const pInstanceData =
+              &instanceBuffer.cesium.data[dataBaseOffset];
+          std::atomic<bool> decomposeFailed{false};
+          forEachInstanceBatch(
+              asyncSystem,
+              numInstances,
+              [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                  if (rigidToTile &&
+                      copyInstanceTransformToBuffer(
+                          *rigidToTile,
+                          glm::dvec3(decodedInstances.positions[i]),
+                          glm::dquat(decodedInstances.rotations[i]),
+                          glm::dvec3(decodedInstances.scales[i]),
+                          pInstanceData,
+                          i)) {
+                    continue;
+                  }
+                  const glm::dmat4 instanceTransform =
+                      toTileInv *
+                      composeInstanceTransform(i, decodedInstances) * toTile;
+                  if (!copyInstanceTransformToBuffer(
+                          instanceTransform,
+                          pInstanceData,
+                          i)) {
+                    decomposeFailed = true;
+                  }
+                }
+              });
+          if (decomposeFailed) {
+            result.errors.emplaceWarning(
+                "Matrix decompose failed. Default identity values copied to "
+                "instance buffer.");
           }
           GltfAccessorCreator accessorCreator{
               gltf,
@@ -1029,11 +1197,13 @@ CesiumAsync::Future<GltfConverterResult> I3dmToGltfConverter::convert(
              options,
              assetFetcher,
              convertedI3dm)
-      .thenImmediately([](ConvertedI3dm&& convertedI3dm) {
+      .thenImmediately([asyncSystem = assetFetcher.asyncSystem](
+                           ConvertedI3dm&& convertedI3dm) {
         if (convertedI3dm.gltfResult.model) {
           instantiateGltfInstances(
               convertedI3dm.gltfResult,
-              convertedI3dm.decodedInstances);
+              convertedI3dm.decodedInstances,
+              asyncSystem);
           if (!convertedI3dm.pBatchTableJson->IsObject() ||
               convertedI3dm.pBatchTableJson->HasParseError()) {
             return convertedI3dm.gltfResult;
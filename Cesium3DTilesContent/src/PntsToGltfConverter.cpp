@@ -37,6 +37,7 @@
 #include <glm/ext/vector_uint4_sized.hpp>
 #include <rapidjson/rapidjson.h>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
@@ -144,6 +145,66 @@ template <typename TColor> TColor srgbToLinear(const TColor srgb) {
   }
 }
 
+// Tables of the linear value of every possible 8-bit, 6-bit and 5-bit sRGB
+// channel. Each entry is computed with srgbToLinear, so colors converted
+// through these tables are identical to colors converted one at a time, but
+// without three calls to std::pow per point.
+struct SrgbToLinearTables {
+  std::array<float, 256> channel8;
+  std::array<float, 256> alpha8;
+  std::array<float, 64> channel6;
+  std::array<float, 32> channel5;
+};
+
+const SrgbToLinearTables& getSrgbToLinearTables() {
+  static const SrgbToLinearTables tables = []() {
+    SrgbToLinearTables result{};
+    for (size_t i = 0; i < result.channel8.size(); ++i) {
+      result.channel8[i] =
+          srgbToLinear(glm::vec3(static_cast<float>(i)) / 255.0f).x;
+      result.alpha8[i] = static_cast<float>(i) / 255.0f;
+    }
+    for (size_t i = 0; i < result.channel6.size(); ++i) {
+      // Green is the only 6-bit channel.
+      const glm::vec3 rgb = glm::vec3(
+          AttributeCompression::decodeRGB565(static_cast<uint16_t>(i << 5)));
+      result.channel6[i] = srgbToLinear(rgb).y;
+    }
+    for (size_t i = 0; i < result.channel5.size(); ++i) {
+      // Red and blue are 5-bit channels normalized the same way.
+      const glm::vec3 rgb = glm::vec3(
+          AttributeCompression::decodeRGB565(static_cast<uint16_t>(i)));
+      result.channel5[i] = srgbToLinear(rgb).z;
+    }
+    return result;
+  }();
+  return tables;
+}
+
+glm::vec4
+rgbaToLinear(const glm::u8vec4& rgba, const SrgbToLinearTables& tables) {
+  return glm::vec4(
+      tables.channel8[rgba.r],
+      tables.channel8[rgba.g],
+      tables.channel8[rgba.b],
+      tables.alpha8[rgba.a]);
+}
+
+glm::vec3
+rgbToLinear(const glm::u8vec3& rgb, const SrgbToLinearTables& tables) {
+  return glm::vec3(
+      tables.channel8[rgb.r],
+      tables.channel8[rgb.g],
+      tables.channel8[rgb.b]);
+}
+
+glm::vec3 rgb565ToLinear(uint16_t rgb565, const SrgbToLinearTables& tables) {
+  return glm::vec3(
+      tables.channel5[rgb565 >> 11],
+      tables.channel6[(rgb565 >> 5) & 0x3f],
+      tables.channel5[rgb565 & 0x1f]);
+}
+
 struct PntsContent {
   uint32_t pointsLength = 0;
   std::optional<glm::dvec3> rtcCenter;
@@ -951,12 +1012,13 @@ void decodeDraco(
         draco::DataBuffer* decodedBuffer = pColorAttribute->buffer();
         int64_t decodedByteOffset = pColorAttribute->byte_offset();
         int64_t decodedByteStride = pColorAttribute->byte_stride();
+        const SrgbToLinearTables& tables = getSrgbToLinearTables();
 
         for (uint32_t i = 0; i < pointsLength; ++i) {
           const glm::u8vec4 rgbaColor = *reinterpret_cast<const glm::u8vec4*>(
               decodedBuffer->data() + decodedByteOffset +
               decodedByteStride * i);
-          outColors[i] = srgbToLinear(glm::vec4(rgbaColor) / 255.0f);
+          outColors[i] = rgbaToLinear(rgbaColor, tables);
         }
       } else if (
           parsedContent.colorType == PntsColorType::RGB &&
@@ -970,12 +1032,13 @@ void decodeDraco(
         draco::DataBuffer* decodedBuffer = pColorAttribute->buffer();
         int64_t decodedByteOffset = pColorAttribute->byte_offset();
         int64_t decodedByteStride = pColorAttribute->byte_stride();
+        const SrgbToLinearTables& tables = getSrgbToLinearTables();
 
         for (uint32_t i = 0; i < pointsLength; ++i) {
           const glm::u8vec3 rgbColor = *reinterpret_cast<const glm::u8vec3*>(
               decodedBuffer->data() + decodedByteOffset +
               decodedByteStride * i);
-          outColors[i] = srgbToLinear(glm::vec3(rgbColor) / 255.0f);
+          outColors[i] = rgbToLinear(rgbColor, tables);
         }
       } else {
         parsedContent.errors.emplaceWarning(
@@ -1141,6 +1204,7 @@ void parseColorsFromFeatureTableBinary(
   const size_t colorsByteLength = pointsLength * colorsByteStride;
   colorData.resize(colorsByteLength);
 
+  const SrgbToLinearTables& tables = getSrgbToLinearTables();
   if (parsedContent.colorType == PntsColorType::RGBA) {
     const std::span<const glm::u8vec4> rgbaColors(
         reinterpret_cast<const glm::u8vec4*>(
@@ -1151,8 +1215,7 @@ void parseColorsFromFeatureTableBinary(
         pointsLength);
 
     for (size_t i = 0; i < pointsLength; i++) {
-      glm::vec4 normalizedColor = glm::vec4(rgbaColors[i]) / 255.0f;
-      outColors[i] = srgbToLinear(normalizedColor);
+      outColors[i] = rgbaToLinear(rgbaColors[i], tables);
     }
   } else if (parsedContent.colorType == PntsColorType::RGB) {
     const std::span<const glm::u8vec3> rgbColors(
@@ -1164,8 +1227,7 @@ void parseColorsFromFeatureTableBinary(
         pointsLength);
 
     for (size_t i = 0; i < pointsLength; i++) {
-      glm::vec3 normalizedColor = glm::vec3(rgbColors[i]) / 255.0f;
-      outColors[i] = srgbToLinear(normalizedColor);
+      outColors[i] = rgbToLinear(rgbColors[i], tables);
     }
   } else if (parsedContent.colorType == PntsColorType::RGB565) {
 
@@ -1178,10 +1240,7 @@ void parseColorsFromFeatureTableBinary(
         pointsLength);
 
     for (size_t i = 0; i < pointsLength; i++) {
-      const uint16_t compressedColor = compressedColors[i];
-      glm::vec3 decompressedColor =
-          glm::vec3(AttributeCompression::decodeRGB565(compressedColor));
-      outColors[i] = srgbToLinear(decompressedColor);
+      outColors[i] = rgb565ToLinear(compressedColors[i], tables);
     }
   }
 }
@@ -1212,11 +1271,12 @@ void parseNormalsFromFeatureTableBinary(
         reinterpret_cast<glm::vec3*>(normalData.data()),
         pointsLength);
 
+    const std::vector<glm::vec3>& decodedNormals =
+        AttributeCompression::getOctDecodeTable();
     for (size_t i = 0; i < pointsLength; i++) {
       const glm::u8vec2 encodedNormal = encodedNormals[i];
-      outNormals[i] = glm::vec3(CesiumUtility::AttributeCompression::octDecode(
-          encodedNormal.x,
-          encodedNormal.y));
+      outNormals[i] = decodedNormals[size_t(encodedNormal.y) * 256 +
+                                     size_t(encodedNormal.x)];
     }
   } else {
     std::memcpy(
@@ -1,6 +1,7 @@
 #include "ConvertTileToGltf.h"
 
 #include <Cesium3DTilesContent/B3dmToGltfConverter.h>
+#include <Cesium3DTilesContent/CmptToGltfConverter.h>
 #include <Cesium3DTilesContent/GltfConverterResult.h>
 #include <Cesium3DTilesContent/I3dmToGltfConverter.h>
 #include <Cesium3DTilesContent/PntsToGltfConverter.h>
@@ -54,6 +55,14 @@ GltfConverterResult ConvertTileToGltf::fromPnts(
   return future.wait();
 }
 
+GltfConverterResult ConvertTileToGltf::fromPnts(
+    const std::span<const std::byte>& bytes,
+    const CesiumGltfReader::GltfReaderOptions& options) {
+  AssetFetcher assetFetcher = makeAssetFetcher("");
+  auto future = PntsToGltfConverter::convert(bytes, options, assetFetcher);
+  return future.wait();
+}
+
 GltfConverterResult ConvertTileToGltf::fromI3dm(
     const std::filesystem::path& filePath,
     const CesiumGltfReader::GltfReaderOptions& options) {
@@ -63,4 +72,20 @@ GltfConverterResult ConvertTileToGltf::fromI3dm(
   return future.wait();
 }
 
+GltfConverterResult ConvertTileToGltf::fromI3dm(
+    const std::span<const std::byte>& bytes,
+    const CesiumGltfReader::GltfReaderOptions& options) {
+  AssetFetcher assetFetcher = makeAssetFetcher("");
+  auto future = I3dmToGltfConverter::convert(bytes, options, assetFetcher);
+  return future.wait();
+}
+
+GltfConverterResult ConvertTileToGltf::fromCmpt(
+    const std::span<const std::byte>& bytes,
+    const CesiumGltfReader::GltfReaderOptions& options) {
+  AssetFetcher assetFetcher = makeAssetFetcher("");
+  auto future = CmptToGltfConverter::convert(bytes, options, assetFetcher);
+  return future.wait();
+}
+
 } // namespace Cesium3DTilesContent
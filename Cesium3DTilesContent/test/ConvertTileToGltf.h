@@ -5,7 +5,9 @@
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumNativeTests/readFile.h>
 
+#include <cstddef>
 #include <filesystem>
+#include <span>
 
 namespace Cesium3DTilesContent {
 
@@ -17,9 +19,18 @@ public:
   static GltfConverterResult fromPnts(
       const std::filesystem::path& filePath,
       const CesiumGltfReader::GltfReaderOptions& options = {});
+  static GltfConverterResult fromPnts(
+      const std::span<const std::byte>& bytes,
+      const CesiumGltfReader::GltfReaderOptions& options = {});
   static GltfConverterResult fromI3dm(
       const std::filesystem::path& filePath,
       const CesiumGltfReader::GltfReaderOptions& options = {});
+  static GltfConverterResult fromI3dm(
+      const std::span<const std::byte>& bytes,
+      const CesiumGltfReader::GltfReaderOptions& options = {});
+  static GltfConverterResult fromCmpt(
+      const std::span<const std::byte>& bytes,
+      const CesiumGltfReader::GltfReaderOptions& options = {});
 
 private:
   static CesiumAsync::AsyncSystem asyncSystem;
@@ -0,0 +1,102 @@
+#include "CreateTileContent.h"
+
+#include <CesiumNativeTests/readFile.h>
+
+#include <glm/ext/vector_float3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace Cesium3DTilesContent {
+
+namespace {
+// Gets the embedded glTF of an i3dm with `gltfFormat` 1.
+std::vector<std::byte> getEmbeddedGlb(const std::vector<std::byte>& i3dm) {
+  uint32_t header[7];
+  std::memcpy(header, i3dm.data() + 4, sizeof(header));
+  const size_t gltfStart =
+      32 + size_t(header[2]) + header[3] + header[4] + header[5];
+  return std::vector<std::byte>(
+      i3dm.begin() + static_cast<std::ptrdiff_t>(gltfStart),
+      i3dm.end());
+}
+} // namespace
+
+std::vector<std::byte>
+createCmpt(const std::vector<std::vector<std::byte>>& innerTiles) {
+  std::vector<std::byte> cmpt(16);
+  for (const std::vector<std::byte>& innerTile : innerTiles) {
+    cmpt.insert(cmpt.end(), innerTile.begin(), innerTile.end());
+  }
+
+  const uint32_t header[] = {
+      1,
+      uint32_t(cmpt.size()),
+      uint32_t(innerTiles.size())};
+  std::memcpy(cmpt.data(), "cmpt", 4);
+  std::memcpy(cmpt.data() + 4, header, sizeof(header));
+  return cmpt;
+}
+
+std::vector<std::byte> createI3dm(
+    const std::vector<std::byte>& glb,
+    const std::vector<glm::vec3>& positions,
+    const std::vector<glm::vec3>& ups,
+    const std::vector<glm::vec3>& rights,
+    const std::vector<glm::vec3>& scales) {
+  const size_t count = positions.size();
+  const size_t arrayByteLength = count * sizeof(glm::vec3);
+  std::string featureTableJson =
+      "{\"INSTANCES_LENGTH\":" + std::to_string(count) +
+      ",\"POSITION\":{\"byteOffset\":0}"
+      ",\"NORMAL_UP\":{\"byteOffset\":" +
+      std::to_string(arrayByteLength) +
+      "},\"NORMAL_RIGHT\":{\"byteOffset\":" +
+      std::to_string(2 * arrayByteLength) +
+      "},\"SCALE_NON_UNIFORM\":{\"byteOffset\":" +
+      std::to_string(3 * arrayByteLength) + "}}";
+  constexpr size_t headerLength = 32;
+  while ((headerLength + featureTableJson.size()) % 8 != 0) {
+    featureTableJson += ' ';
+  }
+  const size_t featureTableBinaryLength = (4 * arrayByteLength + 7) & ~7U;
+
+  std::vector<std::byte> i3dm(
+      headerLength + featureTableJson.size() + featureTableBinaryLength);
+  const uint32_t header[] = {
+      1,
+      uint32_t(i3dm.size() + glb.size()),
+      uint32_t(featureTableJson.size()),
+      uint32_t(featureTableBinaryLength),
+      0,
+      0,
+      1};
+  std::memcpy(i3dm.data(), "i3dm", 4);
+  std::memcpy(i3dm.data() + 4, header, sizeof(header));
+  std::memcpy(
+      i3dm.data() + headerLength,
+      featureTableJson.data(),
+      featureTableJson.size());
+
+  std::byte* pBinary = i3dm.data() + headerLength + featureTableJson.size();
+  std::memcpy(pBinary, positions.data(), arrayByteLength);
+  std::memcpy(pBinary + arrayByteLength, ups.data(), arrayByteLength);
+  std::memcpy(pBinary + 2 * arrayByteLength, rights.data(), arrayByteLength);
+  std::memcpy(pBinary + 3 * arrayByteLength, scales.data(), arrayByteLength);
+
+  i3dm.insert(i3dm.end(), glb.begin(), glb.end());
+  return i3dm;
+}
+
+std::vector<std::byte> getOrientationTestGlb() {
+  std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  testFilePath = testFilePath / "i3dm" / "InstancedOrientation" /
+                 "instancedOrientation.i3dm";
+  return getEmbeddedGlb(readFile(testFilePath));
+}
+
+} // namespace Cesium3DTilesContent
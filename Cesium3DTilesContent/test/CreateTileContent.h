@@ -0,0 +1,25 @@
+#pragma once
+
+#include <glm/ext/vector_float3.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Cesium3DTilesContent {
+
+// Creates a composite tile that holds the given inner tiles.
+std::vector<std::byte>
+createCmpt(const std::vector<std::vector<std::byte>>& innerTiles);
+
+// Creates an i3dm with the given instances and embedded glTF.
+std::vector<std::byte> createI3dm(
+    const std::vector<std::byte>& glb,
+    const std::vector<glm::vec3>& positions,
+    const std::vector<glm::vec3>& ups,
+    const std::vector<glm::vec3>& rights,
+    const std::vector<glm::vec3>& scales);
+
+// Gets the glTF embedded in the InstancedOrientation test i3dm.
+std::vector<std::byte> getOrientationTestGlb();
+
+} // namespace Cesium3DTilesContent
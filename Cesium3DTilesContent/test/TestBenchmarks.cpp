@@ -0,0 +1,194 @@
+#include "ConvertTileToGltf.h"
+#include "CreateTileContent.h"
+
+#include <Cesium3DTilesContent/CmptToGltfConverter.h>
+#include <Cesium3DTilesContent/GltfConverterResult.h>
+#include <Cesium3DTilesContent/GltfConverters.h>
+#include <Cesium3DTilesContent/registerAllTileContentTypes.h>
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumGeometry/Axis.h>
+#include <CesiumNativeTests/FileAccessor.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumNativeTests/readFile.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_float3.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Cesium3DTilesContent;
+using namespace CesiumAsync;
+
+namespace {
+double timeCmptConversion(
+    const std::shared_ptr<ITaskProcessor>& pTaskProcessor,
+    const std::vector<std::byte>& cmpt,
+    int iterations) {
+  AsyncSystem asyncSystem(pTaskProcessor);
+  AssetFetcher assetFetcher(
+      asyncSystem,
+      std::make_shared<CesiumNativeTests::FileAccessor>(),
+      "",
+      glm::dmat4(1.0),
+      std::vector<IAssetAccessor::THeader>(),
+      CesiumGeometry::Axis::Y);
+
+  std::chrono::steady_clock::duration total{};
+  for (int i = 0; i < iterations; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    GltfConverterResult result =
+        CmptToGltfConverter::convert(cmpt, {}, assetFetcher).wait();
+    total += std::chrono::steady_clock::now() - start;
+    REQUIRE(result.model);
+    REQUIRE(!result.errors.hasErrors());
+  }
+
+  return std::chrono::duration<double>(total).count() / double(iterations);
+}
+} // namespace
+
+TEST_CASE("Benchmark converting a composite with many inner tiles" *
+          doctest::skip(true)) {
+  registerAllTileContentTypes();
+
+  constexpr size_t innerTileCount = 32;
+  constexpr int iterations = 20;
+
+  std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  testFilePath =
+      testFilePath / "BatchTables" / "batchedWithBatchTable-draco.b3dm";
+  const std::vector<std::byte> b3dm = readFile(testFilePath);
+  const std::vector<std::byte> cmpt =
+      createCmpt(std::vector<std::vector<std::byte>>(innerTileCount, b3dm));
+
+  const double sequentialSeconds = timeCmptConversion(
+      std::make_shared<CesiumNativeTests::SimpleTaskProcessor>(),
+      cmpt,
+      iterations);
+  const double parallelSeconds = timeCmptConversion(
+      std::make_shared<CesiumNativeTests::ThreadTaskProcessor>(),
+      cmpt,
+      iterations);
+
+  std::cout << "Converted a composite of " << innerTileCount
+            << " inner tiles in " << sequentialSeconds * 1000.0
+            << "ms on one thread and " << parallelSeconds * 1000.0
+            << "ms on worker threads" << std::endl;
+}
+
+TEST_CASE("Benchmark converting an i3dm with many instances" *
+          doctest::skip(true)) {
+  constexpr size_t instanceCount = 500000;
+  constexpr int iterations = 5;
+
+  std::vector<glm::vec3> positions(instanceCount);
+  std::vector<glm::vec3> ups(instanceCount);
+  std::vector<glm::vec3> rights(instanceCount);
+  std::vector<glm::vec3> scales(instanceCount);
+  for (size_t i = 0; i < instanceCount; ++i) {
+    const float angle = float(i) * 0.001f;
+    positions[i] = glm::vec3(float(i % 1000), float(i / 1000), 0.0f);
+    ups[i] = glm::vec3(0.0f, 0.0f, 1.0f);
+    rights[i] = glm::vec3(std::cos(angle), std::sin(angle), 0.0f);
+    scales[i] = glm::vec3(1.0f + float(i % 7) * 0.1f);
+  }
+
+  const std::vector<std::byte> i3dm =
+      createI3dm(getOrientationTestGlb(), positions, ups, rights, scales);
+
+  std::chrono::steady_clock::duration total{};
+  for (int i = 0; i < iterations; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    GltfConverterResult result = ConvertTileToGltf::fromI3dm(i3dm);
+    total += std::chrono::steady_clock::now() - start;
+    REQUIRE(result.model);
+    REQUIRE(!result.errors.hasErrors());
+  }
+
+  const double seconds =
+      std::chrono::duration<double>(total).count() / double(iterations);
+  std::cout << "Converted " << instanceCount << " instances in "
+            << seconds * 1000.0 << "ms ("
+            << double(instanceCount) / seconds << " instances/sec)"
+            << std::endl;
+}
+
+TEST_CASE("Benchmark converting a large point cloud to glTF" *
+          doctest::skip(true)) {
+  constexpr uint32_t pointsLength = 4 * 1024 * 1024;
+  constexpr int iterations = 5;
+
+  // Quantized positions, RGB colors, and oct-encoded normals, one after
+  // another in the feature table binary.
+  const uint32_t colorsByteOffset = pointsLength * 3 * 2;
+  const uint32_t normalsByteOffset = colorsByteOffset + pointsLength * 3;
+  uint32_t featureTableBinaryLength = normalsByteOffset + pointsLength * 2;
+  featureTableBinaryLength = (featureTableBinaryLength + 7) & ~7U;
+
+  std::string featureTableJson =
+      "{\"POINTS_LENGTH\":" + std::to_string(pointsLength) +
+      ",\"POSITION_QUANTIZED\":{\"byteOffset\":0}"
+      ",\"QUANTIZED_VOLUME_OFFSET\":[-100.0,-100.0,-100.0]"
+      ",\"QUANTIZED_VOLUME_SCALE\":[200.0,200.0,200.0]"
+      ",\"RGB\":{\"byteOffset\":" +
+      std::to_string(colorsByteOffset) +
+      "},\"NORMAL_OCT16P\":{\"byteOffset\":" +
+      std::to_string(normalsByteOffset) + "}}";
+  constexpr size_t headerLength = 28;
+  while ((headerLength + featureTableJson.size()) % 8 != 0) {
+    featureTableJson += ' ';
+  }
+
+  const uint32_t featureTableJsonLength = uint32_t(featureTableJson.size());
+  const uint32_t byteLength = uint32_t(headerLength) +
+                              featureTableJsonLength + featureTableBinaryLength;
+  const uint32_t header[] = {
+      1,
+      byteLength,
+      featureTableJsonLength,
+      featureTableBinaryLength,
+      0,
+      0};
+
+  std::vector<std::byte> pnts(byteLength);
+  std::memcpy(pnts.data(), "pnts", 4);
+  std::memcpy(pnts.data() + 4, header, sizeof(header));
+  std::memcpy(
+      pnts.data() + headerLength,
+      featureTableJson.data(),
+      featureTableJson.size());
+
+  // Fill the binary with arbitrary, deterministic values.
+  uint32_t state = 12345;
+  for (size_t i = headerLength + featureTableJsonLength; i < pnts.size(); ++i) {
+    state = state * 1664525U + 1013904223U;
+    pnts[i] = std::byte(state >> 24);
+  }
+
+  std::chrono::steady_clock::duration total{};
+  for (int i = 0; i < iterations; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    GltfConverterResult result = ConvertTileToGltf::fromPnts(pnts);
+    total += std::chrono::steady_clock::now() - start;
+    REQUIRE(result.model);
+    REQUIRE(result.errors.errors.empty());
+  }
+
+  const double seconds =
+      std::chrono::duration<double>(total).count() / double(iterations);
+  std::cout << "Converted " << pointsLength << " points in " << seconds * 1000.0
+            << "ms (" << double(pointsLength) / seconds << " points/sec)"
+            << std::endl;
+}
@@ -0,0 +1,84 @@
+#include "ConvertTileToGltf.h"
+#include "CreateTileContent.h"
+
+#include <Cesium3DTilesContent/GltfConverterResult.h>
+#include <Cesium3DTilesContent/registerAllTileContentTypes.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/readFile.h>
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <vector>
+
+using namespace Cesium3DTilesContent;
+using namespace CesiumGltf;
+
+TEST_CASE("CmptToGltfConverter") {
+  registerAllTileContentTypes();
+
+  std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  testFilePath = testFilePath / "BatchTables" / "batchedWithJson.b3dm";
+  const std::vector<std::byte> b3dm = readFile(testFilePath);
+  GltfConverterResult b3dmResult = ConvertTileToGltf::fromB3dm(testFilePath);
+  REQUIRE(b3dmResult.model);
+  const Model& b3dmModel = *b3dmResult.model;
+
+  SUBCASE("merges the models of every inner tile") {
+    constexpr size_t innerTileCount = 3;
+    const std::vector<std::byte> cmpt =
+        createCmpt(std::vector<std::vector<std::byte>>(innerTileCount, b3dm));
+
+    GltfConverterResult result = ConvertTileToGltf::fromCmpt(cmpt);
+    REQUIRE(result.model);
+    CHECK(!result.errors.hasErrors());
+
+    const Model& model = *result.model;
+    CHECK(model.meshes.size() == innerTileCount * b3dmModel.meshes.size());
+    CHECK(model.nodes.size() == innerTileCount * b3dmModel.nodes.size());
+    CHECK(model.buffers.size() == innerTileCount * b3dmModel.buffers.size());
+    CHECK(
+        model.accessors.size() ==
+        innerTileCount * b3dmModel.accessors.size());
+
+    // The arrays are reserved once for the elements of all inner tiles, so
+    // merging never grows them beyond that.
+    CHECK(model.meshes.capacity() == model.meshes.size());
+    CHECK(model.buffers.capacity() == model.buffers.size());
+    CHECK(model.accessors.capacity() == model.accessors.size());
+
+    // Each inner tile keeps its own buffers, in the order of the tiles.
+    for (size_t i = 0; i < model.buffers.size(); ++i) {
+      const size_t b3dmBuffer = i % b3dmModel.buffers.size();
+      CHECK(
+          model.buffers[i].cesium.data ==
+          b3dmModel.buffers[b3dmBuffer].cesium.data);
+    }
+  }
+
+  SUBCASE("returns a single inner tile as is") {
+    GltfConverterResult result =
+        ConvertTileToGltf::fromCmpt(createCmpt({b3dm}));
+    REQUIRE(result.model);
+    CHECK(!result.errors.hasErrors());
+    CHECK(result.model->meshes.size() == b3dmModel.meshes.size());
+    CHECK(result.model->buffers.size() == b3dmModel.buffers.size());
+  }
+
+  SUBCASE("warns when an inner tile is truncated") {
+    std::vector<std::byte> cmpt = createCmpt({b3dm, b3dm});
+    cmpt.resize(cmpt.size() - 1);
+    const uint32_t byteLength = uint32_t(cmpt.size());
+    std::memcpy(cmpt.data() + 8, &byteLength, sizeof(byteLength));
+
+    GltfConverterResult result = ConvertTileToGltf::fromCmpt(cmpt);
+    REQUIRE(result.model);
+    CHECK(result.model->meshes.size() == b3dmModel.meshes.size());
+    CHECK(
+        result.errors.warnings.size() ==
+        b3dmResult.errors.warnings.size() + 1);
+  }
+}
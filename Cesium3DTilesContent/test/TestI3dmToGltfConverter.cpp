@@ -1,4 +1,5 @@
 #include "ConvertTileToGltf.h"
+#include "CreateTileContent.h"
 
 #include <Cesium3DTilesContent/GltfConverterResult.h>
 #include <CesiumGltf/AccessorUtility.h>
@@ -6,12 +7,21 @@
 #include <CesiumGltf/ExtensionExtInstanceFeatures.h>
 #include <CesiumGltf/ExtensionExtMeshGpuInstancing.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
+#include <CesiumGltfContent/GltfUtilities.h>
 
 #include <doctest/doctest.h>
+#include <glm/ext/matrix_double3x3.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_double3.hpp>
 #include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_float4.hpp>
+#include <glm/geometric.hpp>
+#include <glm/gtc/quaternion.hpp>
 
+#include <cstddef>
 #include <filesystem>
+#include <vector>
 
 using namespace Cesium3DTilesContent;
 using namespace CesiumGltf;
@@ -76,6 +86,89 @@ TEST_CASE("I3dmToGltfConverter") {
     CHECK(rotations.size() == 25);
   }
 
+  SUBCASE("writes instance transforms in the mesh node's coordinates") {
+    const std::vector<glm::vec3> positions{
+        {10.0f, 20.0f, 30.0f},
+        {-5.0f, 2.0f, 1.0f},
+        {0.0f, 0.0f, 0.0f}};
+    const std::vector<glm::vec3> ups{
+        {0.0f, 0.0f, 1.0f},
+        {0.0f, 1.0f, 0.0f},
+        {0.6f, 0.0f, 0.8f}};
+    const std::vector<glm::vec3> rights{
+        {1.0f, 0.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f},
+        {0.8f, 0.0f, -0.6f}};
+    const std::vector<glm::vec3> scales{
+        {1.0f, 1.0f, 1.0f},
+        {2.0f, 3.0f, 4.0f},
+        {0.5f, 0.5f, 0.5f}};
+
+    GltfConverterResult result = ConvertTileToGltf::fromI3dm(createI3dm(
+        getOrientationTestGlb(),
+        positions,
+        ups,
+        rights,
+        scales));
+    REQUIRE(result.model);
+    CHECK(!result.errors.hasErrors());
+
+    ExtensionExtMeshGpuInstancing* pExtension =
+        result.model->nodes[0].getExtension<ExtensionExtMeshGpuInstancing>();
+    REQUIRE(pExtension);
+    AccessorView<glm::vec3> translations(
+        *result.model,
+        pExtension->attributes.at("TRANSLATION"));
+    AccessorView<glm::vec4> rotations(
+        *result.model,
+        pExtension->attributes.at("ROTATION"));
+    AccessorView<glm::vec3> nodeScales(
+        *result.model,
+        pExtension->attributes.at("SCALE"));
+    REQUIRE(translations.size() == 3);
+    REQUIRE(rotations.size() == 3);
+    REQUIRE(nodeScales.size() == 3);
+
+    // The instances are positioned relative to their mean.
+    glm::dvec3 center(0.0);
+    for (const glm::vec3& position : positions) {
+      center += glm::dvec3(position);
+    }
+    center /= double(positions.size());
+
+    // Applying an instance's transform in the node's coordinates must be the
+    // same as applying the i3dm instance transform in the tile's.
+    const glm::dmat4 toTile =
+        CesiumGltfContent::GltfUtilities::applyGltfUpAxisTransform(
+            *result.model,
+            glm::dmat4(1.0));
+    for (int64_t i = 0; i < 3; ++i) {
+      const size_t index = size_t(i);
+      const glm::dvec3 up(ups[index]);
+      const glm::dvec3 right(rights[index]);
+      const glm::dmat4 rotation(glm::dmat3(right, up, glm::cross(right, up)));
+      const glm::dvec3 translation = glm::dvec3(positions[index]) - center;
+      const glm::dmat4 expected =
+          glm::translate(glm::dmat4(1.0), translation) * rotation *
+          glm::scale(glm::dmat4(1.0), glm::dvec3(scales[index])) * toTile;
+
+      const glm::vec4 q = rotations[i];
+      const glm::dmat4 nodeInstance =
+          glm::translate(glm::dmat4(1.0), glm::dvec3(translations[i])) *
+          glm::mat4_cast(glm::dquat(q.w, q.x, q.y, q.z)) *
+          glm::scale(glm::dmat4(1.0), glm::dvec3(nodeScales[i]));
+      const glm::dmat4 actual = toTile * nodeInstance;
+
+      for (glm::length_t column = 0; column < 4; ++column) {
+        for (glm::length_t row = 0; row < 4; ++row) {
+          CHECK(
+              actual[column][row] ==
+              doctest::Approx(expected[column][row]).epsilon(1e-5));
+        }
+      }
+    }
+  }
+
   SUBCASE("reports an error if the glTF is v1, which is unsupported") {
     std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
     testFilePath =
@@ -5,6 +5,7 @@
 #include <CesiumGltf/Accessor.h>
 #include <CesiumGltf/Class.h>
 #include <CesiumGltf/ClassProperty.h>
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
 #include <CesiumGltf/ExtensionExtMeshFeatures.h>
 #include <CesiumGltf/ExtensionKhrDracoMeshCompression.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
@@ -601,6 +602,109 @@ TEST_CASE("Converts JSON B3DM batch table to EXT_structural_metadata") {
   }
 }
 
+TEST_CASE("Defers converting JSON B3DM batch table properties until accessed") {
+  std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  testFilePath = testFilePath / "BatchTables" / "batchedWithJson.b3dm";
+
+  CesiumGltfReader::GltfReaderOptions options;
+  options.deferBatchTableConversion = true;
+  GltfConverterResult deferredResult =
+      ConvertTileToGltf::fromB3dm(testFilePath, options);
+  GltfConverterResult eagerResult = ConvertTileToGltf::fromB3dm(testFilePath);
+  REQUIRE(deferredResult.model);
+  REQUIRE(eagerResult.model);
+
+  Model& deferredGltf = *deferredResult.model;
+  ExtensionModelExtStructuralMetadata* pDeferredExtension =
+      deferredGltf.getExtension<ExtensionModelExtStructuralMetadata>();
+  REQUIRE(pDeferredExtension);
+  REQUIRE(pDeferredExtension->schema);
+  REQUIRE(pDeferredExtension->propertyTables.size() == 1);
+
+  const ExtensionModelExtStructuralMetadata* pEagerExtension =
+      eagerResult.model->getExtension<ExtensionModelExtStructuralMetadata>();
+  REQUIRE(pEagerExtension);
+  REQUIRE(pEagerExtension->schema);
+
+  // The schema has a placeholder for every property up front, but no types
+  // are inferred and no values are converted yet.
+  const Class& deferredClass =
+      pDeferredExtension->schema->classes.at("default");
+  const Class& eagerClass = pEagerExtension->schema->classes.at("default");
+  REQUIRE(deferredClass.properties.size() == eagerClass.properties.size());
+  for (const auto& [name, eagerProperty] : eagerClass.properties) {
+    const auto it = deferredClass.properties.find(name);
+    REQUIRE(it != deferredClass.properties.end());
+    CHECK(it->second.type == ClassProperty::Type::STRING);
+    CHECK(!it->second.componentType);
+  }
+
+  PropertyTable& deferredTable = pDeferredExtension->propertyTables[0];
+  CHECK(deferredTable.properties.empty());
+  const size_t bufferCountBeforeConversion = deferredGltf.buffers.size();
+
+  const DeferredPropertyTableProperties* pDeferredProperties =
+      deferredTable.getExtension<DeferredPropertyTableProperties>();
+  REQUIRE(pDeferredProperties);
+  CHECK(pDeferredProperties->getPropertyIds().size() == 4);
+  CHECK(pDeferredProperties->getSizeBytes() > 0);
+
+  PropertyTableView eagerView(
+      *eagerResult.model,
+      pEagerExtension->propertyTables[0]);
+  PropertyTableView deferredView(deferredGltf, deferredTable);
+  REQUIRE(deferredView.status() == PropertyTableViewStatus::Valid);
+  CHECK(deferredView.size() == eagerView.size());
+
+  // Each property converts to the same values as eager conversion, in the
+  // buffers of the model itself.
+  const std::vector<std::string> names{"Longitude", "Latitude", "Height"};
+  for (const std::string& name : names) {
+    PropertyTablePropertyView<double> deferredProperty =
+        deferredView.getPropertyView<double>(name);
+    PropertyTablePropertyView<double> eagerProperty =
+        eagerView.getPropertyView<double>(name);
+    REQUIRE(
+        deferredProperty.status() == PropertyTablePropertyViewStatus::Valid);
+    REQUIRE(deferredProperty.size() == eagerProperty.size());
+    for (int64_t i = 0; i < deferredProperty.size(); ++i) {
+      CHECK(deferredProperty.getRaw(i) == eagerProperty.getRaw(i));
+    }
+  }
+
+  CHECK(deferredTable.properties.size() == names.size());
+  CHECK(deferredGltf.buffers.size() > bufferCountBeforeConversion);
+  CHECK(pDeferredProperties->getPropertyIds().size() == 1);
+
+  // Converting the rest releases the batch table JSON.
+  DeferredPropertyTableProperties::convertAll(deferredGltf);
+  CHECK(pDeferredProperties->getPropertyIds().empty());
+  CHECK(pDeferredProperties->getSizeBytes() == 0);
+  CHECK(
+      deferredTable.properties.size() ==
+      pEagerExtension->propertyTables[0].properties.size());
+
+  // Conversion finished each class property exactly like eager conversion.
+  for (const auto& [name, eagerProperty] : eagerClass.properties) {
+    const ClassProperty& deferredProperty = deferredClass.properties.at(name);
+    CHECK(deferredProperty.type == eagerProperty.type);
+    CHECK(deferredProperty.componentType == eagerProperty.componentType);
+    CHECK(deferredProperty.array == eagerProperty.array);
+    CHECK(deferredProperty.count == eagerProperty.count);
+    CHECK(deferredProperty.noData == eagerProperty.noData);
+  }
+
+  PropertyTablePropertyView<int8_t> deferredIds =
+      deferredView.getPropertyView<int8_t>("id");
+  PropertyTablePropertyView<int8_t> eagerIds =
+      eagerView.getPropertyView<int8_t>("id");
+  REQUIRE(deferredIds.status() == PropertyTablePropertyViewStatus::Valid);
+  REQUIRE(deferredIds.size() == eagerIds.size());
+  for (int64_t i = 0; i < deferredIds.size(); ++i) {
+    CHECK(deferredIds.getRaw(i) == eagerIds.getRaw(i));
+  }
+}
+
 TEST_CASE("Convert binary B3DM batch table to EXT_structural_metadata") {
   std::filesystem::path testFilePath = Cesium3DTilesSelection_TEST_DATA_DIR;
   testFilePath =
@@ -13,6 +13,7 @@
 #include <glm/common.hpp>
 
 #include <atomic>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -704,6 +705,11 @@ private:
   TileLoadState _loadState;
   bool _mightHaveLatentChildren;
 
+  // The number of bytes of this tile that the TilesetContentManager added to
+  // its total data used. The size of the tile may change while it is loaded,
+  // so exactly this amount is subtracted again when the tile is unloaded.
+  int64_t _dataUsedBytes;
+
   // mapped raster overlay
   std::vector<RasterMappedTo3DTile> _rasterTiles;
 
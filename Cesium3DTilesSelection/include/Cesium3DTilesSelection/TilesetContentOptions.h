@@ -19,6 +19,20 @@ struct CESIUM3DTILESSELECTION_API TilesetContentOptions {
    */
   bool enableWaterMask = false;
 
+  /**
+   * @brief Whether to add skirts to the edges of terrain tiles to hide cracks
+   * between adjacent tiles.
+   *
+   * When false, the indices of the vertices on each edge of a tile are stored
+   * in the `CESIUM_tile_edges` extension of its primitive instead, which uses
+   * fewer vertices and triangles but leaves it to the renderer to stitch or
+   * clamp the edges. Tiles upsampled for raster overlays follow the tile they
+   * are upsampled from.
+   *
+   * Currently only applicable for quantized-mesh tilesets.
+   */
+  bool generateTerrainSkirts = true;
+
   /**
    * @brief Whether to generate smooth normals when normals are missing in the
    * original Gltf.
@@ -51,6 +65,18 @@ struct CESIUM3DTILESSELECTION_API TilesetContentOptions {
    */
   CesiumGltfReader::MeshPrimitiveModeOptions primitiveModeOptions;
 
+  /**
+   * @brief Whether to upsample all four children of a tile at once when
+   * raster overlays need more detail than the tile's geometry provides.
+   *
+   * When true, the first upsampled child to be loaded splits the parent's
+   * geometry into all four quadrants in a single pass, and the other three
+   * children are held in memory until they are loaded or the parent is
+   * unloaded. This is faster when, as is typical, all siblings are needed, but
+   * uses more memory when only some of them are.
+   */
+  bool upsampleChildrenTogether = false;
+
   /**
    * @brief Extracts options related to loading glTFs to a new instance of @ref
    * CesiumGltfReader::GltfReaderOptions .
@@ -21,6 +21,8 @@
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/S2CellBoundingVolume.h>
+#include <CesiumGeospatial/S2CellID.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/IntrusivePointer.h>
@@ -29,6 +31,7 @@
 #include <spdlog/logger.h>
 #include <spdlog/spdlog.h>
 
+#include <array>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -83,6 +86,38 @@ BoundingVolume subdivideBoundingVolume(
       rootBoundingVolume);
 }
 
+// An implicit S2 tile's children subdivide the tile's own cell, so all four of
+// their bounding volumes can be derived from the tile's at once.
+std::optional<std::array<CesiumGeospatial::S2CellBoundingVolume, 4>>
+computeS2Children(
+    const Tile& tile,
+    const ImplicitQuadtreeBoundingVolume& rootBoundingVolume,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  const CesiumGeospatial::S2CellBoundingVolume* pRoot =
+      std::get_if<CesiumGeospatial::S2CellBoundingVolume>(&rootBoundingVolume);
+  const CesiumGeospatial::S2CellBoundingVolume* pParent =
+      std::get_if<CesiumGeospatial::S2CellBoundingVolume>(
+          &tile.getBoundingVolume());
+  if (pRoot == nullptr || pParent == nullptr) {
+    return std::nullopt;
+  }
+
+  // Only use the tile's volume if it is the one subdivision would produce.
+  const CesiumGeometry::QuadtreeTileID& quadtreeID =
+      std::get<CesiumGeometry::QuadtreeTileID>(tile.getTileID());
+  const CesiumGeospatial::S2CellID expectedCellID =
+      CesiumGeospatial::S2CellID::fromQuadtreeTileID(
+          pRoot->getCellID().getFace(),
+          quadtreeID);
+  if (pParent->getCellID().getID() != expectedCellID.getID() ||
+      pParent->getMinimumHeight() != pRoot->getMinimumHeight() ||
+      pParent->getMaximumHeight() != pRoot->getMaximumHeight()) {
+    return std::nullopt;
+  }
+
+  return pParent->computeChildren(ellipsoid);
+}
+
 std::vector<Tile> populateSubtree(
     const SubtreeAvailability& subtreeAvailability,
     uint32_t subtreeLevels,
@@ -103,6 +138,36 @@ std::vector<Tile> populateSubtree(
   std::vector<Tile> children;
   children.reserve(childIDs.size());
 
+  std::optional<std::array<CesiumGeospatial::S2CellBoundingVolume, 4>>
+      s2Children;
+  bool s2ChildrenComputed = false;
+  auto computeChildBoundingVolume =
+      [&](const CesiumGeometry::QuadtreeTileID& childID) -> BoundingVolume {
+    if (!s2ChildrenComputed) {
+      s2Children =
+          computeS2Children(tile, loader.getBoundingVolume(), ellipsoid);
+      s2ChildrenComputed = true;
+    }
+
+    if (s2Children) {
+      const CesiumGeospatial::S2CellID childCellID =
+          CesiumGeospatial::S2CellID::fromQuadtreeTileID(
+              s2Children->front().getCellID().getFace(),
+              childID);
+      for (const CesiumGeospatial::S2CellBoundingVolume& s2Child :
+           *s2Children) {
+        if (s2Child.getCellID().getID() == childCellID.getID()) {
+          return s2Child;
+        }
+      }
+    }
+
+    return subdivideBoundingVolume(
+        childID,
+        loader.getBoundingVolume(),
+        ellipsoid);
+  };
+
   for (const CesiumGeometry::QuadtreeTileID& childID : childIDs) {
     uint64_t relativeChildMortonID =
         ImplicitTilingUtilities::computeRelativeMortonIndex(
@@ -114,10 +179,7 @@ std::vector<Tile> populateSubtree(
       if (subtreeAvailability.isSubtreeAvailable(relativeChildMortonID)) {
         Tile& child = children.emplace_back(&loader);
         child.setTransform(tile.getTransform());
-        child.setBoundingVolume(subdivideBoundingVolume(
-            childID,
-            loader.getBoundingVolume(),
-            ellipsoid));
+        child.setBoundingVolume(computeChildBoundingVolume(childID));
         child.setGeometricError(tile.getGeometricError() * 0.5);
         child.setRefine(tile.getRefine());
         child.setTileID(childID);
@@ -137,10 +199,7 @@ std::vector<Tile> populateSubtree(
 
         Tile& child = children.back();
         child.setTransform(tile.getTransform());
-        child.setBoundingVolume(subdivideBoundingVolume(
-            childID,
-            loader.getBoundingVolume(),
-            ellipsoid));
+        child.setBoundingVolume(computeChildBoundingVolume(childID));
         child.setGeometricError(tile.getGeometricError() * 0.5);
         child.setRefine(tile.getRefine());
       }
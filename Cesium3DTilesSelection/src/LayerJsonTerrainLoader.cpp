@@ -707,6 +707,7 @@ Future<QuantizedMeshLoadResult> requestTileContent(
     const LayerJsonTerrainLoader::Layer& layer,
     const std::vector<IAssetAccessor::THeader>& requestHeaders,
     bool enableWaterMask,
+    bool generateSkirts,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   std::string url = resolveTileUrl(tileID, layer);
   return pAssetAccessor->get(asyncSystem, url, requestHeaders)
@@ -715,7 +716,8 @@ Future<QuantizedMeshLoadResult> requestTileContent(
                            pLogger,
                            tileID,
                            boundingRegion,
-                           enableWaterMask](
+                           enableWaterMask,
+                           generateSkirts](
                               std::shared_ptr<IAssetRequest>&& pRequest) {
         const IAssetResponse* pResponse = pRequest->response();
         if (!pResponse) {
@@ -744,6 +746,7 @@ Future<QuantizedMeshLoadResult> requestTileContent(
             pRequest->url(),
             pResponse->data(),
             enableWaterMask,
+            generateSkirts,
             ellipsoid);
       });
 }
@@ -872,6 +875,7 @@ LayerJsonTerrainLoader::loadTileContent(const TileLoadInput& loadInput) {
       currentLayer,
       requestHeaders,
       contentOptions.enableWaterMask,
+      contentOptions.generateTerrainSkirts,
       ellipsoid);
 
   // determine if this tile is at the availability level of the current layer
@@ -6,10 +6,13 @@
 #include <Cesium3DTilesSelection/TileLoadResult.h>
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <CesiumAsync/Future.h>
+#include <CesiumAsync/IAssetAccessor.h>
+#include <CesiumAsync/SharedFuture.h>
 #include <CesiumGeometry/Axis.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/Projection.h>
+#include <CesiumGltf/Model.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
 #include <CesiumRasterOverlays/RasterOverlayTileProvider.h>
 #include <CesiumRasterOverlays/RasterOverlayUtilities.h>
@@ -18,7 +21,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <optional>
+#include <span>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -26,6 +31,40 @@
 using namespace CesiumRasterOverlays;
 
 namespace Cesium3DTilesSelection {
+namespace {
+TileLoadResult createUpsampledLoadResult(
+    std::optional<CesiumGltf::Model>&& model,
+    const std::shared_ptr<CesiumAsync::IAssetAccessor>& pAssetAccessor,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  if (!model) {
+    return TileLoadResult::createFailedResult(pAssetAccessor, nullptr);
+  }
+
+  // Adopt the glTF up axis from the glTF itself.
+  // It came from the parent, which by this point has already been
+  // populated from the Tile, if necessary.
+  CesiumGeometry::Axis upAxis = CesiumGeometry::Axis::Y;
+
+  auto upIt = model->extras.find("gltfUpAxis");
+  if (upIt != model->extras.end()) {
+    upAxis = CesiumGeometry::Axis(
+        upIt->second.getInt64OrDefault(int64_t(CesiumGeometry::Axis::Y)));
+  }
+
+  return TileLoadResult{
+      std::move(*model),
+      upAxis,
+      std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      nullptr,
+      nullptr,
+      {},
+      TileLoadResultState::Success,
+      ellipsoid};
+}
+} // namespace
+
 CesiumAsync::Future<TileLoadResult>
 RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
   const Tile* pParent = loadInput.tile.getParent();
@@ -79,49 +118,108 @@ RasterOverlayUpsampler::loadTileContent(const TileLoadInput& loadInput) {
       getProjectionEllipsoid(projection);
 
   const CesiumGltf::Model& parentModel = pParentRenderContent->getModel();
+
+  // When enabled, upsample all four siblings the first time any of them is
+  // loaded, and hand the others their models when they are requested.
+  const std::span<const Tile> siblings = pParent->getChildren();
+  if (loadInput.contentOptions.upsampleChildrenTogether &&
+      siblings.size() == 4 && pTileID->tileID.level > 0) {
+    const size_t childIndex =
+        static_cast<size_t>(&loadInput.tile - siblings.data());
+    CESIUM_ASSERT(childIndex < 4);
+
+    // Only upsample the siblings together when none of them have been loaded
+    // yet. Otherwise, such as when one child is reloaded after being unloaded,
+    // the models of its loaded siblings would be computed for nothing.
+    auto isOtherSiblingUnloaded = [&loadInput](const Tile& sibling) {
+      return &sibling == &loadInput.tile ||
+             sibling.getState() == TileLoadState::Unloaded;
+    };
+
+    auto it = this->_upsampledSiblings.find(pParent);
+    if (it == this->_upsampledSiblings.end() &&
+        std::all_of(siblings.begin(), siblings.end(), isOtherSiblingUnloaded)) {
+      const CesiumGeometry::QuadtreeTileID parentTileID(
+          pTileID->tileID.level - 1,
+          pTileID->tileID.x >> 1,
+          pTileID->tileID.y >> 1);
+      auto upsampleSiblings = [&parentModel,
+                               parentTileID,
+                               ellipsoid,
+                               textureCoordinateIndex = index]() {
+        auto pSiblings = std::make_shared<UpsampledSiblings>();
+        pSiblings->models =
+            RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+                parentModel,
+                parentTileID,
+                false,
+                RasterOverlayUtilities::DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+                static_cast<int32_t>(textureCoordinateIndex),
+                ellipsoid);
+        return pSiblings;
+      };
+      CesiumAsync::SharedFuture<std::shared_ptr<UpsampledSiblings>> future =
+          loadInput.asyncSystem.runInWorkerThread(std::move(upsampleSiblings))
+              .share();
+      it = this->_upsampledSiblings
+               .emplace(
+                   pParent,
+                   UpsampledSiblingsEntry{std::move(future), index, {}})
+               .first;
+    }
+
+    if (it != this->_upsampledSiblings.end() &&
+        !it->second.requested[childIndex] &&
+        it->second.textureCoordinateIndex == index) {
+      UpsampledSiblingsEntry& entry = it->second;
+      entry.requested[childIndex] = true;
+      CesiumAsync::Future<TileLoadResult> result =
+          entry.future.thenImmediately(
+              [childIndex,
+               ellipsoid,
+               pAssetAccessor = loadInput.pAssetAccessor](
+                  const std::shared_ptr<UpsampledSiblings>& pSiblings) {
+                return createUpsampledLoadResult(
+                    std::move(pSiblings->models[childIndex]),
+                    pAssetAccessor,
+                    ellipsoid);
+              });
+      if (std::all_of(
+              entry.requested.begin(),
+              entry.requested.end(),
+              [](bool requested) { return requested; })) {
+        this->_upsampledSiblings.erase(it);
+      }
+      return result;
+    }
+
+    // Otherwise, upsample this child on its own.
+  }
+
   return loadInput.asyncSystem.runInWorkerThread(
       [&parentModel,
        ellipsoid,
-       transform = loadInput.tile.getTransform(),
        textureCoordinateIndex = index,
        tileID = *pTileID,
        pAssetAccessor = loadInput.pAssetAccessor]() mutable {
-        auto model = RasterOverlayUtilities::upsampleGltfForRasterOverlays(
-            parentModel,
-            tileID,
-            false,
-            RasterOverlayUtilities::DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
-            static_cast<int32_t>(textureCoordinateIndex),
+        return createUpsampledLoadResult(
+            RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+                parentModel,
+                tileID,
+                false,
+                RasterOverlayUtilities::DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+                static_cast<int32_t>(textureCoordinateIndex),
+                ellipsoid),
+            pAssetAccessor,
             ellipsoid);
-        if (!model) {
-          return TileLoadResult::createFailedResult(pAssetAccessor, nullptr);
-        }
-
-        // Adopt the glTF up axis from the glTF itself.
-        // It came from the parent, which by this point has already been
-        // populated from the Tile, if necessary.
-        CesiumGeometry::Axis upAxis = CesiumGeometry::Axis::Y;
-
-        auto upIt = model->extras.find("gltfUpAxis");
-        if (upIt != model->extras.end()) {
-          upAxis = CesiumGeometry::Axis(
-              upIt->second.getInt64OrDefault(int64_t(CesiumGeometry::Axis::Y)));
-        }
-
-        return TileLoadResult{
-            std::move(*model),
-            upAxis,
-            std::nullopt,
-            std::nullopt,
-            std::nullopt,
-            nullptr,
-            nullptr,
-            {},
-            TileLoadResultState::Success,
-            ellipsoid};
       });
 }
 
+void RasterOverlayUpsampler::discardUpsampledChildren(
+    const Tile& parent) noexcept {
+  this->_upsampledSiblings.erase(&parent);
+}
+
 TileChildrenResult RasterOverlayUpsampler::createTileChildren(
     [[maybe_unused]] const Tile& tile,
     [[maybe_unused]] const CesiumGeospatial::Ellipsoid& ellipsoid) {
@@ -1,6 +1,14 @@
 #pragma once
 
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
+#include <CesiumAsync/SharedFuture.h>
+#include <CesiumGltf/Model.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 
 namespace Cesium3DTilesSelection {
 class RasterOverlayUpsampler : public TilesetContentLoader {
@@ -12,5 +20,31 @@ public:
       const Tile& tile,
       const CesiumGeospatial::Ellipsoid& ellipsoid
           CESIUM_DEFAULT_ELLIPSOID) override;
+
+  /**
+   * @brief Discards any upsampled children of the given tile that were
+   * computed along with a sibling but have not been loaded yet.
+   *
+   * This must be called before the parent tile's content is unloaded.
+   *
+   * @param parent The parent tile.
+   */
+  void discardUpsampledChildren(const Tile& parent) noexcept;
+
+private:
+  struct UpsampledSiblings {
+    std::array<std::optional<CesiumGltf::Model>, 4> models;
+  };
+
+  struct UpsampledSiblingsEntry {
+    CesiumAsync::SharedFuture<std::shared_ptr<UpsampledSiblings>> future;
+    size_t textureCoordinateIndex;
+    std::array<bool, 4> requested;
+  };
+
+  // The children of each parent tile that were upsampled together when the
+  // first of them was loaded, and that are waiting for their siblings to be
+  // requested. Only accessed from the main thread.
+  std::unordered_map<const Tile*, UpsampledSiblingsEntry> _upsampledSiblings;
 };
 } // namespace Cesium3DTilesSelection
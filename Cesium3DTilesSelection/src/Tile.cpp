@@ -10,8 +10,11 @@
 #include <Cesium3DTilesSelection/TilesetContentLoader.h>
 #include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
+#include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Image.h>
 #include <CesiumGltf/Model.h>
+#include <CesiumGltf/PropertyTable.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
 #include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
@@ -102,6 +105,7 @@ Tile::Tile(
       _pLoader{pLoader},
       _loadState{loadState},
       _mightHaveLatentChildren{true},
+      _dataUsedBytes(0),
       _rasterTiles(),
       _referenceCount(0) {
   if (this->hasReferencingContent()) {
@@ -125,6 +129,7 @@ Tile::Tile(Tile&& rhs) noexcept
       _pLoader{rhs._pLoader},
       _loadState{rhs._loadState},
       _mightHaveLatentChildren{rhs._mightHaveLatentChildren},
+      _dataUsedBytes(rhs._dataUsedBytes),
       _rasterTiles(std::move(rhs._rasterTiles)),
       _referenceCount(0) {
   if (this->hasReferencingContent()) {
@@ -194,6 +199,21 @@ int64_t Tile::computeByteSize() const noexcept {
       bytes += int64_t(buffer.cesium.data.size());
     }
 
+    // Add the source data kept for converting deferred metadata properties
+    const CesiumGltf::ExtensionModelExtStructuralMetadata* pMetadata =
+        model.getExtension<CesiumGltf::ExtensionModelExtStructuralMetadata>();
+    if (pMetadata) {
+      for (const CesiumGltf::PropertyTable& propertyTable :
+           pMetadata->propertyTables) {
+        const CesiumGltf::DeferredPropertyTableProperties* pDeferred =
+            propertyTable
+                .getExtension<CesiumGltf::DeferredPropertyTableProperties>();
+        if (pDeferred) {
+          bytes += pDeferred->getSizeBytes();
+        }
+      }
+    }
+
     const std::vector<CesiumGltf::BufferView>& bufferViews = model.bufferViews;
     for (const CesiumGltf::Image& image : model.images) {
       const int32_t bufferView = image.bufferView;
@@ -2,6 +2,7 @@
 
 #include <Cesium3DTilesSelection/BoundingVolume.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 
 #include <vector>
@@ -35,5 +36,31 @@ bool outsidePolygons(
         cartographicPolygons,
     const CesiumGeospatial::Ellipsoid& ellipsoid
         CESIUM_DEFAULT_ELLIPSOID) noexcept;
+
+/**
+ * @brief Returns whether the tile is completely inside a polygon.
+ *
+ * @param boundingVolume The {@link Cesium3DTilesSelection::BoundingVolume} of the tile.
+ * @param polygonIndex The spatial index of the polygons to check.
+ * @return Whether the tile is completely inside a polygon.
+ */
+bool withinPolygons(
+    const BoundingVolume& boundingVolume,
+    const CesiumGeospatial::CartographicPolygonIndex& polygonIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid
+        CESIUM_DEFAULT_ELLIPSOID) noexcept;
+
+/**
+ * @brief Returns whether the tile is completely outside all the polygons.
+ *
+ * @param boundingVolume The {@link Cesium3DTilesSelection::BoundingVolume} of the tile.
+ * @param polygonIndex The spatial index of the polygons to check.
+ * @return Whether the tile is completely outside all the polygons.
+ */
+bool outsidePolygons(
+    const BoundingVolume& boundingVolume,
+    const CesiumGeospatial::CartographicPolygonIndex& polygonIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid
+        CESIUM_DEFAULT_ELLIPSOID) noexcept;
 } // namespace CesiumImpl
 } // namespace Cesium3DTilesSelection
@@ -446,6 +446,7 @@ void calcRasterOverlayDetailsInWorkerThread(
   // the existing one
   auto overlayDetails =
       RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          tileLoadInfo.asyncSystem,
           model,
           tileLoadInfo.tileTransform,
           pRegion ? std::make_optional(pRegion->getRectangle()) : std::nullopt,
@@ -1465,6 +1466,7 @@ UnloadTileContentResult TilesetContentManager::unloadTileContent(Tile& tile) {
   }
 
   // If we make it this far, the tile's content will be fully unloaded.
+  this->_upsampler.discardUpsampledChildren(tile);
   notifyTileUnloading(&tile);
   tile.setState(TileLoadState::Unloaded);
   if (!content.isUnknownContent()) {
@@ -2193,7 +2195,7 @@ void TilesetContentManager::notifyTileStartLoading(
   ++this->_tileLoadsInProgress;
 }
 
-void TilesetContentManager::notifyTileDoneLoading(const Tile* pTile) noexcept {
+void TilesetContentManager::notifyTileDoneLoading(Tile* pTile) noexcept {
   CESIUM_ASSERT(
       this->_tileLoadsInProgress > 0 &&
       "There are no tile loads currently in flight");
@@ -2201,13 +2203,18 @@ void TilesetContentManager::notifyTileDoneLoading(const Tile* pTile) noexcept {
   ++this->_loadedTilesCount;
 
   if (pTile) {
-    this->_tilesDataUsed += pTile->computeByteSize();
+    // The size of the tile can change before it is unloaded, e.g. when its
+    // deferred metadata properties are converted, so remember what is added.
+    const int64_t bytes = pTile->computeByteSize();
+    pTile->_dataUsedBytes += bytes;
+    this->_tilesDataUsed += bytes;
   }
 }
 
-void TilesetContentManager::notifyTileUnloading(const Tile* pTile) noexcept {
+void TilesetContentManager::notifyTileUnloading(Tile* pTile) noexcept {
   if (pTile) {
-    this->_tilesDataUsed -= pTile->computeByteSize();
+    this->_tilesDataUsed -= pTile->_dataUsedBytes;
+    pTile->_dataUsedBytes = 0;
   }
 
   --this->_loadedTilesCount;
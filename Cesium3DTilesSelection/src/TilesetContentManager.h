@@ -210,9 +210,9 @@ private:
 
   void notifyTileStartLoading(const Tile* pTile) noexcept;
 
-  void notifyTileDoneLoading(const Tile* pTile) noexcept;
+  void notifyTileDoneLoading(Tile* pTile) noexcept;
 
-  void notifyTileUnloading(const Tile* pTile) noexcept;
+  void notifyTileUnloading(Tile* pTile) noexcept;
 
   void reapplyGltfModifier(
       Tile& tile,
@@ -28,10 +28,13 @@
 #include <CesiumGltf/AccessorWriter.h>
 #include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
+#include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Mesh.h>
 #include <CesiumGltf/MeshPrimitive.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumGltf/Node.h>
+#include <CesiumGltf/PropertyTable.h>
 #include <CesiumGltf/Scene.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumImage/ImageAsset.h>
@@ -2050,3 +2053,91 @@ TEST_CASE("Test glTF modifier state machine") {
     CHECK(pMockedPrepareRendererResources->totalAllocation == 0);
   }
 }
+
+TEST_CASE("Test the data used by a tile with deferred metadata properties") {
+  // create mock tileset externals
+  auto pMockedAssetAccessor = std::make_shared<SimpleAssetAccessor>(
+      std::map<std::string, std::shared_ptr<SimpleAssetRequest>>{});
+  auto pMockedPrepareRendererResources =
+      std::make_shared<SimplePrepareRendererResource>();
+  CesiumAsync::AsyncSystem asyncSystem{std::make_shared<SimpleTaskProcessor>()};
+  auto pMockedCreditSystem = std::make_shared<CreditSystem>();
+
+  TilesetExternals externals{
+      pMockedAssetAccessor,
+      pMockedPrepareRendererResources,
+      asyncSystem,
+      pMockedCreditSystem};
+
+  // A model that retains 1000 bytes of source data until its only property is
+  // converted into a 400 byte buffer.
+  CesiumGltf::Model model;
+  CesiumGltf::PropertyTable& propertyTable =
+      model.addExtension<CesiumGltf::ExtensionModelExtStructuralMetadata>()
+          .propertyTables.emplace_back();
+  propertyTable.count = 100;
+  propertyTable.addExtension<CesiumGltf::DeferredPropertyTableProperties>(
+      std::vector<std::string>{"Deferred"},
+      [](const std::string& propertyId,
+         CesiumGltf::Model& convertedModel,
+         CesiumGltf::PropertyTable& convertedTable) {
+        CesiumGltf::Buffer& buffer = convertedModel.buffers.emplace_back();
+        buffer.cesium.data.resize(400);
+        buffer.byteLength = 400;
+
+        CesiumGltf::BufferView& bufferView =
+            convertedModel.bufferViews.emplace_back();
+        bufferView.buffer = int32_t(convertedModel.buffers.size() - 1);
+        bufferView.byteLength = buffer.byteLength;
+
+        convertedTable.properties[propertyId].values =
+            int32_t(convertedModel.bufferViews.size() - 1);
+      },
+      1000);
+
+  auto pMockedLoader = std::make_unique<SimpleTilesetContentLoader>();
+  pMockedLoader->mockLoadTileContent = {
+      std::move(model),
+      CesiumGeometry::Axis::Y,
+      std::nullopt,
+      std::nullopt,
+      std::nullopt,
+      nullptr,
+      nullptr,
+      {},
+      TileLoadResultState::Success,
+      Ellipsoid::WGS84};
+  pMockedLoader->mockCreateTileChildren = {{}, TileLoadResultState::Failed};
+
+  auto pRootTile = std::make_unique<Tile>(pMockedLoader.get());
+
+  // Give the tile an ID so it is eligible for unloading.
+  pRootTile->setTileID("foo");
+
+  IntrusivePointer<TilesetContentManager> pManager =
+      TilesetContentManager::createFromLoader(
+          externals,
+          {},
+          std::move(pMockedLoader),
+          std::move(pRootTile));
+
+  pManager->waitUntilIdle(5000.0);
+  const int64_t initialDataUsed = pManager->getTotalDataUsed();
+
+  Tile& tile = *pManager->getRootTile();
+  pManager->loadTileContent(tile, {});
+  pManager->waitUntilIdle(5000.0);
+  REQUIRE(tile.getState() == TileLoadState::ContentLoaded);
+  CHECK(tile.computeByteSize() == 1000);
+  CHECK(pManager->getTotalDataUsed() == initialDataUsed + 1000);
+
+  // Converting the property while the tile is loaded changes its size.
+  CesiumGltf::DeferredPropertyTableProperties::convertAll(
+      tile.getContent().getRenderContent()->getModel());
+  CHECK(tile.computeByteSize() == 400);
+
+  // Unloading the tile subtracts what was added when it was loaded.
+  pManager->unloadTileContent(tile);
+  CHECK(tile.getState() == TileLoadState::Unloaded);
+  CHECK(pManager->getTotalDataUsed() == initialDataUsed);
+}
@@ -3,6 +3,12 @@
 #include <Cesium3DTilesWriter/Library.h>
 #include <CesiumJsonWriter/ExtensionWriterContext.h>
 
+#include <cstddef>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
 // forward declarations
 namespace Cesium3DTiles {
 struct Tileset;
@@ -39,8 +45,26 @@ struct CESIUM3DTILESWRITER_API TilesetWriterOptions {
    * @brief If the tileset JSON should be pretty printed.
    */
   bool prettyPrint = false;
+
+  /**
+   * @brief If the tileset JSON should be written with a
+   * {@link CesiumJsonWriter::BufferedJsonWriter}, which is faster for large
+   * tilesets but formats some floating-point numbers differently. Ignored if
+   * {@link prettyPrint} is true.
+   */
+  bool useBufferedJsonWriter = false;
 };
 
+/**
+ * @brief A function that receives consecutive chunks of a tileset as it is
+ * written by {@link TilesetWriter::writeTilesetToSink}.
+ *
+ * The bytes are only valid for the duration of the call. Return false to stop
+ * writing, for example because the destination is full.
+ */
+using TilesetWriterSink =
+    std::function<bool(std::span<const std::byte> bytes)>;
+
 /**
  * @brief Writes tilesets.
  */
@@ -73,6 +97,26 @@ public:
       const Cesium3DTiles::Tileset& tileset,
       const TilesetWriterOptions& options = TilesetWriterOptions()) const;
 
+  /**
+   * @brief Serializes the provided tileset object, passing it in chunks to a
+   * sink as it is written instead of gathering it in a byte vector.
+   *
+   * The JSON is always written compactly by a
+   * {@link CesiumJsonWriter::BufferedJsonWriter}, as if
+   * {@link TilesetWriterOptions::useBufferedJsonWriter} were set.
+   *
+   * The returned {@link TilesetWriterResult::tilesetBytes} is always empty. If
+   * the sink returns false, the rest of the JSON is discarded and an error is
+   * reported.
+   *
+   * @param tileset The tileset.
+   * @param sink The function that receives the chunks of the JSON, in order.
+   * @return The result of writing the tileset.
+   */
+  TilesetWriterResult writeTilesetToSink(
+      const Cesium3DTiles::Tileset& tileset,
+      const TilesetWriterSink& sink) const;
+
 private:
   CesiumJsonWriter::ExtensionWriterContext _context;
 };
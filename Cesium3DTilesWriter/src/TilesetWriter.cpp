@@ -2,11 +2,14 @@
 #include "registerWriterExtensions.h"
 
 #include <Cesium3DTilesWriter/TilesetWriter.h>
+#include <CesiumJsonWriter/BufferedJsonWriter.h>
 #include <CesiumJsonWriter/JsonWriter.h>
 #include <CesiumJsonWriter/PrettyJsonWriter.h>
 #include <CesiumUtility/Tracing.h>
 
+#include <cstddef>
 #include <memory>
+#include <span>
 
 namespace Cesium3DTilesWriter {
 
@@ -34,6 +37,8 @@ TilesetWriterResult TilesetWriter::writeTileset(
 
   if (options.prettyPrint) {
     pWriter = std::make_unique<CesiumJsonWriter::PrettyJsonWriter>();
+  } else if (options.useBufferedJsonWriter) {
+    pWriter = std::make_unique<CesiumJsonWriter::BufferedJsonWriter>();
   } else {
     pWriter = std::make_unique<CesiumJsonWriter::JsonWriter>();
   }
@@ -45,4 +50,35 @@ TilesetWriterResult TilesetWriter::writeTileset(
 
   return result;
 }
+
+TilesetWriterResult TilesetWriter::writeTilesetToSink(
+    const Cesium3DTiles::Tileset& tileset,
+    const TilesetWriterSink& sink) const {
+  CESIUM_TRACE("TilesetWriter::writeTilesetToSink");
+
+  const CesiumJsonWriter::ExtensionWriterContext& context =
+      this->getExtensions();
+
+  TilesetWriterResult result;
+  bool sinkAccepting = true;
+  CesiumJsonWriter::BufferedJsonWriter writer(
+      [&sink, &sinkAccepting](std::span<const std::byte> chunk) {
+        if (sinkAccepting) {
+          sinkAccepting = sink(chunk);
+        }
+      });
+
+  TilesetJsonWriter::write(tileset, writer, context);
+  writer.flush();
+  result.errors = writer.getErrors();
+  result.warnings = writer.getWarnings();
+
+  if (!sinkAccepting) {
+    result.errors.emplace_back(
+        "The tileset sink stopped accepting data before the tileset was "
+        "complete.");
+  }
+
+  return result;
+}
 } // namespace Cesium3DTilesWriter
@@ -12,7 +12,10 @@
 #include <vector>
 
 namespace {
-void check(const std::string& input, const std::string& expectedOutput) {
+void check(
+    const std::string& input,
+    const std::string& expectedOutput,
+    const Cesium3DTilesWriter::TilesetWriterOptions& options = {}) {
   Cesium3DTilesReader::TilesetReader reader;
   auto readResult = reader.readFromJson(std::span(
       reinterpret_cast<const std::byte*>(input.c_str()),
@@ -25,7 +28,7 @@ void check(const std::string& input, const std::string& expectedOutput) {
 
   Cesium3DTilesWriter::TilesetWriter writer;
   Cesium3DTilesWriter::TilesetWriterResult writeResult =
-      writer.writeTileset(tileset);
+      writer.writeTileset(tileset, options);
   const auto tilesetBytes = writeResult.tilesetBytes;
 
   REQUIRE(writeResult.errors.empty());
@@ -112,6 +115,51 @@ TEST_CASE("Writes tileset JSON") {
   )";
 
   check(string, string);
+
+  SUBCASE("with the buffered JSON writer") {
+    Cesium3DTilesWriter::TilesetWriterOptions options;
+    options.useBufferedJsonWriter = true;
+    check(string, string, options);
+  }
+
+  SUBCASE("to a sink") {
+    Cesium3DTilesReader::TilesetReader reader;
+    auto readResult = reader.readFromJson(std::span(
+        reinterpret_cast<const std::byte*>(string.c_str()),
+        string.size()));
+    REQUIRE(readResult.value.has_value());
+
+    Cesium3DTilesWriter::TilesetWriter writer;
+    std::string tilesetString;
+    Cesium3DTilesWriter::TilesetWriterResult writeResult =
+        writer.writeTilesetToSink(
+            *readResult.value,
+            [&tilesetString](std::span<const std::byte> bytes) {
+              tilesetString.append(
+                  reinterpret_cast<const char*>(bytes.data()),
+                  bytes.size());
+              return true;
+            });
+    REQUIRE(writeResult.errors.empty());
+    REQUIRE(writeResult.warnings.empty());
+    CHECK(writeResult.tilesetBytes.empty());
+
+    rapidjson::Document tilesetJson;
+    tilesetJson.Parse(tilesetString.c_str());
+    rapidjson::Document expectedJson;
+    expectedJson.Parse(string.c_str());
+    CHECK(tilesetJson == expectedJson);
+
+    size_t callCount = 0;
+    writeResult = writer.writeTilesetToSink(
+        *readResult.value,
+        [&callCount](std::span<const std::byte> /*bytes*/) {
+          ++callCount;
+          return false;
+        });
+    CHECK(callCount == 1);
+    CHECK(writeResult.errors.size() == 1);
+  }
 }
 
 TEST_CASE("Writes tileset JSON with extras") {
@@ -9,13 +9,17 @@
 #include <CesiumUtility/ReferenceCounted.h>
 #include <CesiumUtility/Result.h>
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace CesiumUtility {
 template <typename T> class SharedAsset;
@@ -68,6 +72,11 @@ public:
    * At that point, assets are cleaned up in the order that they were marked for
    * deletion until the total dips below this threshold again.
    *
+   * In a depot with more than one shard, this limit applies to the depot as a
+   * whole. When it is exceeded, all of the shards are locked and deletion
+   * candidates are cleaned up across all of them, still in the order they were
+   * marked.
+   *
    * Default is 16MiB.
    */
   std::atomic<int64_t> inactiveAssetSizeLimitBytes =
@@ -101,6 +110,22 @@ public:
    */
   SharedAssetDepot(std::function<FactorySignature> factory);
 
+  /**
+   * @brief Creates a new `SharedAssetDepot` whose assets are split between
+   * several independently-locked shards.
+   *
+   * Each asset is assigned to a shard by the hash of its key. Every shard has
+   * its own mutex and its own list of deletion candidates, so threads that get
+   * or release assets in different shards do not contend with each other. This
+   * is useful for depots that are accessed by many threads at once.
+   *
+   * @param factory The factory to use to fetch and create assets that don't
+   * already exist in the depot. See \ref FactorySignature.
+   * @param shardCount The number of shards. A depot with a single shard behaves
+   * exactly like one created without this parameter. Zero is treated as one.
+   */
+  SharedAssetDepot(std::function<FactorySignature> factory, size_t shardCount);
+
   virtual ~SharedAssetDepot();
 
   /**
@@ -147,6 +172,11 @@ public:
    */
   bool invalidate(TAssetType& asset);
 
+  /**
+   * @brief Gets the number of independently-locked shards in this depot.
+   */
+  size_t getShardCount() const noexcept { return this->_shards.size(); }
+
   /**
    * @brief Returns the total number of distinct assets contained in this depot,
    * including both active and inactive assets.
@@ -177,13 +207,19 @@ public:
 
 private:
   struct LockHolder;
+  struct Shard;
 
   /**
-   * @brief Locks the shared asset depot for thread-safe access. It will remain
-   * locked until the returned object is destroyed or the `unlock` method is
-   * called on it.
+   * @brief Gets the index of the shard that owns assets with the given key.
    */
-  LockHolder lock() const;
+  size_t getShardIndex(const TAssetKey& assetKey) const;
+
+  /**
+   * @brief Locks a shard of the shared asset depot for thread-safe access. It
+   * will remain locked until the returned object is destroyed or the `unlock`
+   * method is called on it.
+   */
+  LockHolder lock(Shard& shard) const;
 
   /**
    * @brief Marks the given asset as a candidate for deletion.
@@ -191,12 +227,36 @@ private:
    *
    * @param asset The asset to mark for deletion.
    * @param threadOwnsDepotLock True if the calling thread already owns the
-   * depot lock; otherwise, false.
+   * lock of the asset's shard; otherwise, false.
    */
   void markDeletionCandidate(const TAssetType& asset, bool threadOwnsDepotLock)
       override;
 
-  void markDeletionCandidateUnderLock(const TAssetType& asset);
+  /**
+   * @brief Marks the given asset as a candidate for deletion while the lock of
+   * its shard is held.
+   *
+   * In a depot with a single shard, this also deletes the oldest deletion
+   * candidates if the depot is over its inactive size limit. In a depot with
+   * more than one shard, that requires locking the other shards, so this
+   * method returns true instead and the caller must call
+   * {@link evictDeletionCandidates} once the shard's lock is released.
+   */
+  bool markDeletionCandidateUnderLock(Shard& shard, const TAssetType& asset);
+
+  /**
+   * @brief Deletes the given shard's oldest deletion candidate. The shard's
+   * lock must be held, and its deletion candidates list must not be empty.
+   */
+  void evictOldestDeletionCandidateUnderLock(Shard& shard);
+
+  /**
+   * @brief Deletes the oldest deletion candidates of all shards, in the order
+   * they were marked, until the depot is within its inactive size limit. Locks
+   * every shard in index order, so the calling thread must not hold any shard
+   * lock.
+   */
+  void evictDeletionCandidates();
 
   /**
    * @brief Unmarks the given asset as a candidate for deletion.
@@ -204,21 +264,30 @@ private:
    *
    * @param asset The asset to unmark for deletion.
    * @param threadOwnsDepotLock True if the calling thread already owns the
-   * depot lock; otherwise, false.
+   * lock of the asset's shard; otherwise, false.
    */
   void unmarkDeletionCandidate(
       const TAssetType& asset,
       bool threadOwnsDepotLock) override;
 
-  void unmarkDeletionCandidateUnderLock(const TAssetType& asset);
+  void unmarkDeletionCandidateUnderLock(Shard& shard, const TAssetType& asset);
 
   /**
    * @brief Invalidates the asset with the given key.
    *
-   * The depot lock must be held when this is called, and it will be released by
-   * the time this method returns.
+   * The lock of the shard owning the key must be held when this is called, and
+   * it will be released by the time this method returns.
    */
-  bool invalidateUnderLock(LockHolder&& lock, const TAssetKey& assetKey);
+  bool invalidateUnderLock(
+      LockHolder&& lock,
+      Shard& shard,
+      const TAssetKey& assetKey);
+
+  /**
+   * @brief Updates whether the given shard is managing live assets, and so
+   * whether it needs to keep the depot alive. The shard's lock must be held.
+   */
+  void updateKeepAliveUnderLock(Shard& shard);
 
   /**
    * @brief An entry for an asset owned by this depot. This is reference counted
@@ -233,6 +302,7 @@ private:
           maybePendingAsset(),
           errorsAndWarnings(),
           sizeInDeletionList(0),
+          deletionOrder(0),
           deletionListPointers() {}
 
     AssetEntry(const TAssetKey& key_) : AssetEntry(TAssetKey(key_)) {}
@@ -265,26 +335,66 @@ private:
 
     /**
      * @brief The size of this asset when it was added to the
-     * _deletionCandidates list. This is stored so that the exact same size can
+     * deletionCandidates list. This is stored so that the exact same size can
      * be subtracted later. The value of this field is undefined if the asset is
-     * not currently in the _deletionCandidates list.
+     * not currently in the deletionCandidates list.
      */
     int64_t sizeInDeletionList;
 
+    /**
+     * @brief The order in which this asset was added to the deletionCandidates
+     * list of its shard, relative to the assets in the lists of all shards. The
+     * value of this field is undefined if the asset is not currently in a
+     * deletionCandidates list.
+     */
+    uint64_t deletionOrder;
+
     /**
      * @brief The next and previous pointers to entries in the
-     * _deletionCandidates list.
+     * deletionCandidates list.
      */
     CesiumUtility::DoublyLinkedListPointers<AssetEntry> deletionListPointers;
 
     CesiumUtility::ResultPointer<TAssetType> toResultUnderLock() const;
   };
 
-  // Manages the depot's mutex. Also ensures, via IntrusivePointer, that the
+  // The assets with keys that hash to one shard, along with the mutex that
+  // serializes access to them.
+  struct Shard {
+    // Maps asset keys to AssetEntry instances. This collection owns the asset
+    // entries.
+    std::unordered_map<TAssetKey, CesiumUtility::IntrusivePointer<AssetEntry>>
+        assets;
+
+    // Maps asset pointers to AssetEntry instances. The values in this map refer
+    // to instances owned by the assets map.
+    std::unordered_map<TAssetType*, AssetEntry*> assetsByPointer;
+
+    // List of assets that are being considered for deletion, in the order that
+    // they became unused.
+    CesiumUtility::
+        DoublyLinkedList<AssetEntry, &AssetEntry::deletionListPointers>
+            deletionCandidates;
+
+    // The number of assets that have been invalidated but that have not been
+    // deleted yet. Such assets hold a pointer to the depot, so the depot must
+    // be kept alive for their entire lifetime.
+    int64_t liveInvalidatedAssets = 0;
+
+    // Whether this shard is counted in the depot's _liveShards.
+    bool isLive = false;
+
+    // Mutex serializing access to all of the above, and to any AssetEntry owned
+    // by this shard.
+    std::mutex mutex;
+  };
+
+  // Manages a shard's mutex. Also ensures, via IntrusivePointer, that the
   // depot won't be destroyed while the lock is held.
   struct LockHolder {
     LockHolder(
-        const CesiumUtility::IntrusivePointer<const SharedAssetDepot>& pDepot);
+        const CesiumUtility::IntrusivePointer<const SharedAssetDepot>& pDepot,
+        Shard& shard);
     ~LockHolder();
     void unlock();
 
@@ -297,39 +407,31 @@ private:
     std::unique_lock<std::mutex> lock;
   };
 
-  // Maps asset keys to AssetEntry instances. This collection owns the asset
-  // entries.
-  std::unordered_map<TAssetKey, CesiumUtility::IntrusivePointer<AssetEntry>>
-      _assets;
+  // The shards holding this depot's assets. Shards are never added or removed
+  // after construction.
+  std::vector<std::unique_ptr<Shard>> _shards;
 
-  // Maps asset pointers to AssetEntry instances. The values in this map refer
-  // to instances owned by the _assets map.
-  std::unordered_map<TAssetType*, AssetEntry*> _assetsByPointer;
+  // The total amount of memory used by all assets in the deletionCandidates
+  // lists of all shards.
+  std::atomic<int64_t> _totalDeletionCandidateMemoryUsage;
 
-  // List of assets that are being considered for deletion, in the order that
-  // they became unused.
-  CesiumUtility::DoublyLinkedList<AssetEntry, &AssetEntry::deletionListPointers>
-      _deletionCandidates;
-
-  // The total amount of memory used by all assets in the _deletionCandidates
-  // list.
-  int64_t _totalDeletionCandidateMemoryUsage;
-
-  // The number of assets that have been invalidated but that have not been
-  // deleted yet. Such assets hold a pointer to the depot, so the depot must be
-  // kept alive for their entire lifetime.
-  int64_t _liveInvalidatedAssets;
-
-  // Mutex serializing access to _assets, _assetsByPointer, _deletionCandidates,
-  // and any AssetEntry owned by this depot.
-  mutable std::mutex _mutex;
+  // The deletionOrder to assign to the next asset that becomes a deletion
+  // candidate.
+  std::atomic<uint64_t> _nextDeletionOrder;
 
   // The factory used to create new AssetType instances.
   std::function<FactorySignature> _factory;
 
-  // This instance keeps a reference to itself whenever it is managing active
-  // assets, preventing it from being destroyed even if all other references to
-  // it are dropped.
+  // Mutex serializing access to _liveShards and _pKeepAlive. A thread may lock
+  // it while holding a shard lock, but never the other way around.
+  std::mutex _keepAliveMutex;
+
+  // The number of shards that are managing live assets.
+  size_t _liveShards;
+
+  // This instance keeps a reference to itself whenever any of its shards is
+  // managing active assets, preventing it from being destroyed even if all
+  // other references to it are dropped.
   CesiumUtility::IntrusivePointer<
       SharedAssetDepot<TAssetType, TAssetKey, TContext>>
       _pKeepAlive;
@@ -338,14 +440,25 @@ private:
 template <typename TAssetType, typename TAssetKey, typename TContext>
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::SharedAssetDepot(
     std::function<FactorySignature> factory)
-    : _assets(),
-      _assetsByPointer(),
-      _deletionCandidates(),
+    : SharedAssetDepot(std::move(factory), 1) {}
+
+template <typename TAssetType, typename TAssetKey, typename TContext>
+SharedAssetDepot<TAssetType, TAssetKey, TContext>::SharedAssetDepot(
+    std::function<FactorySignature> factory,
+    size_t shardCount)
+    : _shards(),
       _totalDeletionCandidateMemoryUsage(0),
-      _liveInvalidatedAssets(0),
-      _mutex(),
+      _nextDeletionOrder(0),
       _factory(std::move(factory)),
-      _pKeepAlive(nullptr) {}
+      _keepAliveMutex(),
+      _liveShards(0),
+      _pKeepAlive(nullptr) {
+  const size_t count = std::max(shardCount, size_t(1));
+  this->_shards.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    this->_shards.emplace_back(std::make_unique<Shard>());
+  }
+}
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::~SharedAssetDepot() {
@@ -368,10 +481,13 @@ SharedAssetDepot<TAssetType, TAssetKey, TContext>::~SharedAssetDepot() {
   // To avoid this, we use the _pKeepAlive field to maintain an artificial
   // reference to this depot whenever it owns live assets. This should keep
   // this destructor from being called except when all of its assets are also
-  // in the _deletionCandidates list.
+  // in the deletionCandidates lists.
 
-  CESIUM_ASSERT(this->_liveInvalidatedAssets == 0);
-  CESIUM_ASSERT(this->_assets.size() == this->_deletionCandidates.size());
+  CESIUM_ASSERT(this->_liveShards == 0);
+  for ([[maybe_unused]] const std::unique_ptr<Shard>& pShard : this->_shards) {
+    CESIUM_ASSERT(pShard->liveInvalidatedAssets == 0);
+    CESIUM_ASSERT(pShard->assets.size() == pShard->deletionCandidates.size());
+  }
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
@@ -379,12 +495,15 @@ SharedFuture<CesiumUtility::ResultPointer<TAssetType>>
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::getOrCreate(
     const TContext& context,
     const TAssetKey& assetKey) {
+  const size_t shardIndex = this->getShardIndex(assetKey);
+  Shard& shard = *this->_shards[shardIndex];
+
   // We need to take care here to avoid two assets starting to load before the
   // first asset has added an entry and set its maybePendingAsset field.
-  LockHolder lock = this->lock();
+  LockHolder lock = this->lock(shard);
 
-  auto existingIt = this->_assets.find(assetKey);
-  if (existingIt != this->_assets.end()) {
+  auto existingIt = shard.assets.find(assetKey);
+  if (existingIt != shard.assets.end()) {
     // We've already loaded (or are loading) an asset with this ID - we can
     // just use that.
     const AssetEntry& entry = *existingIt->second;
@@ -421,14 +540,16 @@ SharedAssetDepot<TAssetType, TAssetKey, TContext>::getOrCreate(
             return pDepot->_factory(context, pEntry->key);
           })
           .thenInWorkerThread(
-              [pDepot,
-               pEntry](CesiumUtility::Result<
-                       CesiumUtility::IntrusivePointer<TAssetType>>&& result) {
-                LockHolder lock = pDepot->lock();
+              [pDepot, pEntry, shardIndex](
+                  CesiumUtility::Result<
+                      CesiumUtility::IntrusivePointer<TAssetType>>&& result) {
+                Shard& shard = *pDepot->_shards[shardIndex];
+                LockHolder lock = pDepot->lock(shard);
 
                 if (result.pValue) {
                   result.pValue->_pDepot = pDepot.get();
-                  pDepot->_assetsByPointer[result.pValue.get()] = pEntry.get();
+                  result.pValue->_depotShard = uint32_t(shardIndex);
+                  shard.assetsByPointer[result.pValue.get()] = pEntry.get();
                 }
 
                 // Now that this asset is owned by the depot, we exclusively
@@ -441,16 +562,18 @@ SharedAssetDepot<TAssetType, TAssetKey, TContext>::getOrCreate(
                 // The asset is initially live because we have an
                 // IntrusivePointer to it right here. So make sure the depot
                 // stays alive, too.
-                pDepot->_pKeepAlive = pDepot;
+                pDepot->updateKeepAliveUnderLock(shard);
 
                 return pEntry->toResultUnderLock();
               })
-          .catchImmediately([pDepot, pEntry](std::exception&& e) {
+          .catchImmediately([pDepot, pEntry, shardIndex](std::exception&& e) {
             // This asset has failed _with an exception_. We don't want to cache
             // this type of error.
             {
-              LockHolder lock = pDepot->lock();
-              pDepot->_assets.erase(pEntry->key);
+              Shard& shard = *pDepot->_shards[shardIndex];
+              LockHolder lock = pDepot->lock(shard);
+              shard.assets.erase(pEntry->key);
+              pDepot->updateKeepAliveUnderLock(shard);
             }
 
             return CesiumUtility::Result<
@@ -465,7 +588,7 @@ SharedAssetDepot<TAssetType, TAssetKey, TContext>::getOrCreate(
 
   pEntry->maybePendingAsset = sharedFuture;
 
-  [[maybe_unused]] bool added = this->_assets.emplace(assetKey, pEntry).second;
+  [[maybe_unused]] bool added = shard.assets.emplace(assetKey, pEntry).second;
 
   // Should always be added successfully, because we checked above that the
   // asset key doesn't exist in the map yet.
@@ -481,191 +604,277 @@ SharedAssetDepot<TAssetType, TAssetKey, TContext>::getOrCreate(
 template <typename TAssetType, typename TAssetKey, typename TContext>
 bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::invalidate(
     const TAssetKey& assetKey) {
-  LockHolder lock = this->lock();
-  return this->invalidateUnderLock(std::move(lock), assetKey);
+  Shard& shard = *this->_shards[this->getShardIndex(assetKey)];
+  LockHolder lock = this->lock(shard);
+  return this->invalidateUnderLock(std::move(lock), shard, assetKey);
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::invalidate(
     TAssetType& asset) {
-  LockHolder lock = this->lock();
+  // An asset's depot and shard are set before the asset is shared with any
+  // other thread, and never change afterward.
+  if (asset._pDepot != this || asset._depotShard >= this->_shards.size())
+    return false;
+
+  Shard& shard = *this->_shards[asset._depotShard];
+  LockHolder lock = this->lock(shard);
 
-  auto it = this->_assetsByPointer.find(&asset);
-  if (it == this->_assetsByPointer.end())
+  auto it = shard.assetsByPointer.find(&asset);
+  if (it == shard.assetsByPointer.end())
     return false;
 
   AssetEntry* pEntry = it->second;
   CESIUM_ASSERT(pEntry);
 
-  return this->invalidateUnderLock(std::move(lock), pEntry->key);
+  return this->invalidateUnderLock(std::move(lock), shard, pEntry->key);
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 size_t
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::getAssetCount() const {
-  LockHolder lock = this->lock();
-  return this->_assets.size();
+  size_t count = 0;
+  for (const std::unique_ptr<Shard>& pShard : this->_shards) {
+    LockHolder lock = this->lock(*pShard);
+    count += pShard->assets.size();
+  }
+  return count;
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 size_t
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::getActiveAssetCount() const {
-  LockHolder lock = this->lock();
-  return this->_assets.size() - this->_deletionCandidates.size();
+  size_t count = 0;
+  for (const std::unique_ptr<Shard>& pShard : this->_shards) {
+    LockHolder lock = this->lock(*pShard);
+    count += pShard->assets.size() - pShard->deletionCandidates.size();
+  }
+  return count;
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 size_t
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::getInactiveAssetCount()
     const {
-  LockHolder lock = this->lock();
-  return this->_deletionCandidates.size();
+  size_t count = 0;
+  for (const std::unique_ptr<Shard>& pShard : this->_shards) {
+    LockHolder lock = this->lock(*pShard);
+    count += pShard->deletionCandidates.size();
+  }
+  return count;
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 int64_t SharedAssetDepot<TAssetType, TAssetKey, TContext>::
     getInactiveAssetTotalSizeBytes() const {
-  LockHolder lock = this->lock();
   return this->_totalDeletionCandidateMemoryUsage;
 }
 
+template <typename TAssetType, typename TAssetKey, typename TContext>
+size_t SharedAssetDepot<TAssetType, TAssetKey, TContext>::getShardIndex(
+    const TAssetKey& assetKey) const {
+  if (this->_shards.size() == 1) {
+    return 0;
+  }
+  return std::hash<TAssetKey>{}(assetKey) % this->_shards.size();
+}
+
 template <typename TAssetType, typename TAssetKey, typename TContext>
 typename SharedAssetDepot<TAssetType, TAssetKey, TContext>::LockHolder
-SharedAssetDepot<TAssetType, TAssetKey, TContext>::lock() const {
-  return LockHolder{this};
+SharedAssetDepot<TAssetType, TAssetKey, TContext>::lock(Shard& shard) const {
+  return LockHolder{this, shard};
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 void SharedAssetDepot<TAssetType, TAssetKey, TContext>::markDeletionCandidate(
     const TAssetType& asset,
     bool threadOwnsDepotLock) {
+  CESIUM_ASSERT(asset._depotShard < this->_shards.size());
+  Shard& shard = *this->_shards[asset._depotShard];
   if (threadOwnsDepotLock) {
-    this->markDeletionCandidateUnderLock(asset);
+    if (this->markDeletionCandidateUnderLock(shard, asset)) {
+      // The other shards can't be locked while this one is held, so only
+      // delete this shard's candidates for now. The depot is brought back
+      // within the limit by the next asset marked without a lock held.
+      while (shard.deletionCandidates.size() > 0 &&
+             this->_totalDeletionCandidateMemoryUsage >
+                 this->inactiveAssetSizeLimitBytes) {
+        this->evictOldestDeletionCandidateUnderLock(shard);
+      }
+    }
   } else {
-    LockHolder lock = this->lock();
-    this->markDeletionCandidateUnderLock(asset);
+    LockHolder lock = this->lock(shard);
+    if (this->markDeletionCandidateUnderLock(shard, asset)) {
+      // Keep the LockHolder, and with it the depot, alive while evicting.
+      lock.unlock();
+      this->evictDeletionCandidates();
+    }
   }
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
-void SharedAssetDepot<TAssetType, TAssetKey, TContext>::
-    markDeletionCandidateUnderLock(const TAssetType& asset) {
+bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::
+    markDeletionCandidateUnderLock(Shard& shard, const TAssetType& asset) {
   if (asset._isInvalidated) {
     // This asset is no longer tracked by the depot, so delete it.
-    --this->_liveInvalidatedAssets;
+    --shard.liveInvalidatedAssets;
     delete &asset;
 
-    // If this depot is not managing any live assets, then we no longer need to
-    // keep it alive.
-    if (this->_assets.size() == this->_deletionCandidates.size() &&
-        this->_liveInvalidatedAssets == 0) {
-      this->_pKeepAlive.reset();
-    }
-
-    return;
+    // If this shard is not managing any live assets, then it no longer needs
+    // to keep the depot alive.
+    this->updateKeepAliveUnderLock(shard);
+    return false;
   }
 
   // Verify that the reference count is still zero.
   // See: https://github.com/CesiumGS/cesium-native/issues/1073
   if (asset._referenceCount != 0) {
-    return;
+    return false;
   }
 
-  auto it = this->_assetsByPointer.find(const_cast<TAssetType*>(&asset));
-  CESIUM_ASSERT(it != this->_assetsByPointer.end());
-  if (it == this->_assetsByPointer.end()) {
-    return;
+  auto it = shard.assetsByPointer.find(const_cast<TAssetType*>(&asset));
+  CESIUM_ASSERT(it != shard.assetsByPointer.end());
+  if (it == shard.assetsByPointer.end()) {
+    return false;
   }
 
   CESIUM_ASSERT(it->second != nullptr);
 
   AssetEntry& entry = *it->second;
   entry.sizeInDeletionList = asset.getSizeBytes();
-  this->_totalDeletionCandidateMemoryUsage += entry.sizeInDeletionList;
+  entry.deletionOrder = this->_nextDeletionOrder++;
+  const int64_t totalUsage =
+      (this->_totalDeletionCandidateMemoryUsage += entry.sizeInDeletionList);
 
-  this->_deletionCandidates.insertAtTail(entry);
+  shard.deletionCandidates.insertAtTail(entry);
 
-  if (this->_totalDeletionCandidateMemoryUsage >
-      this->inactiveAssetSizeLimitBytes) {
-    // Delete the deletion candidates until we're below the limit.
-    while (this->_deletionCandidates.size() > 0 &&
+  const bool isOverLimit = totalUsage > this->inactiveAssetSizeLimitBytes;
+  if (isOverLimit && this->_shards.size() == 1) {
+    // With a single shard, its deletion candidates are all of the depot's, so
+    // delete them here until the depot is below the limit.
+    while (shard.deletionCandidates.size() > 0 &&
            this->_totalDeletionCandidateMemoryUsage >
                this->inactiveAssetSizeLimitBytes) {
-      AssetEntry* pOldEntry = this->_deletionCandidates.head();
-      this->_deletionCandidates.remove(*pOldEntry);
+      this->evictOldestDeletionCandidateUnderLock(shard);
+    }
+  }
+
+  // If this shard is not managing any live assets, then it no longer needs to
+  // keep the depot alive.
+  this->updateKeepAliveUnderLock(shard);
+
+  return isOverLimit && this->_shards.size() > 1;
+}
+
+template <typename TAssetType, typename TAssetKey, typename TContext>
+void SharedAssetDepot<TAssetType, TAssetKey, TContext>::
+    evictOldestDeletionCandidateUnderLock(Shard& shard) {
+  AssetEntry* pOldEntry = shard.deletionCandidates.head();
+  CESIUM_ASSERT(pOldEntry != nullptr);
+  shard.deletionCandidates.remove(*pOldEntry);
 
-      this->_totalDeletionCandidateMemoryUsage -= pOldEntry->sizeInDeletionList;
+  this->_totalDeletionCandidateMemoryUsage -= pOldEntry->sizeInDeletionList;
 
-      CESIUM_ASSERT(
-          pOldEntry->pAsset == nullptr ||
-          pOldEntry->pAsset->_referenceCount == 0);
+  CESIUM_ASSERT(
+      pOldEntry->pAsset == nullptr || pOldEntry->pAsset->_referenceCount == 0);
 
-      if (pOldEntry->pAsset) {
-        this->_assetsByPointer.erase(pOldEntry->pAsset.get());
+  if (pOldEntry->pAsset) {
+    shard.assetsByPointer.erase(pOldEntry->pAsset.get());
+  }
+
+  // This will actually delete the asset.
+  shard.assets.erase(pOldEntry->key);
+}
+
+template <typename TAssetType, typename TAssetKey, typename TContext>
+void SharedAssetDepot<TAssetType, TAssetKey, TContext>::
+    evictDeletionCandidates() {
+  // Lock the shards in index order, so that two threads evicting at the same
+  // time can't deadlock.
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(this->_shards.size());
+  for (const std::unique_ptr<Shard>& pShard : this->_shards) {
+    locks.emplace_back(pShard->mutex);
+  }
+
+  // Each shard's list is in the order its assets were marked, so the oldest
+  // candidate in the depot is at the head of one of the lists.
+  while (this->_totalDeletionCandidateMemoryUsage >
+         this->inactiveAssetSizeLimitBytes) {
+    Shard* pOldestShard = nullptr;
+    for (const std::unique_ptr<Shard>& pShard : this->_shards) {
+      const AssetEntry* pHead = pShard->deletionCandidates.head();
+      if (pHead != nullptr &&
+          (pOldestShard == nullptr ||
+           pHead->deletionOrder <
+               pOldestShard->deletionCandidates.head()->deletionOrder)) {
+        pOldestShard = pShard.get();
       }
+    }
 
-      // This will actually delete the asset.
-      this->_assets.erase(pOldEntry->key);
+    if (pOldestShard == nullptr) {
+      break;
     }
-  }
 
-  // If this depot is not managing any live assets, then we no longer need to
-  // keep it alive.
-  if (this->_assets.size() == this->_deletionCandidates.size() &&
-      this->_liveInvalidatedAssets == 0) {
-    this->_pKeepAlive.reset();
+    this->evictOldestDeletionCandidateUnderLock(*pOldestShard);
   }
+
+  // Only inactive assets were deleted, so no shard's live state changed.
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 void SharedAssetDepot<TAssetType, TAssetKey, TContext>::unmarkDeletionCandidate(
     const TAssetType& asset,
     bool threadOwnsDepotLock) {
+  CESIUM_ASSERT(asset._depotShard < this->_shards.size());
+  Shard& shard = *this->_shards[asset._depotShard];
   if (threadOwnsDepotLock) {
-    this->unmarkDeletionCandidateUnderLock(asset);
+    this->unmarkDeletionCandidateUnderLock(shard, asset);
   } else {
-    LockHolder lock = this->lock();
-    this->unmarkDeletionCandidateUnderLock(asset);
+    LockHolder lock = this->lock(shard);
+    this->unmarkDeletionCandidateUnderLock(shard, asset);
   }
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 void SharedAssetDepot<TAssetType, TAssetKey, TContext>::
-    unmarkDeletionCandidateUnderLock(const TAssetType& asset) {
+    unmarkDeletionCandidateUnderLock(Shard& shard, const TAssetType& asset) {
   // This asset better not already be invalidated. That would imply this asset
   // was resurrected after its reference count hit zero. This should only be
   // possible if the asset depot returned a pointer to the asset, which it
   // will not do for one that is invalidated.
   CESIUM_ASSERT(!asset._isInvalidated);
 
-  auto it = this->_assetsByPointer.find(const_cast<TAssetType*>(&asset));
-  CESIUM_ASSERT(it != this->_assetsByPointer.end());
-  if (it == this->_assetsByPointer.end()) {
+  auto it = shard.assetsByPointer.find(const_cast<TAssetType*>(&asset));
+  CESIUM_ASSERT(it != shard.assetsByPointer.end());
+  if (it == shard.assetsByPointer.end()) {
     return;
   }
 
   CESIUM_ASSERT(it->second != nullptr);
 
   AssetEntry& entry = *it->second;
-  bool isFound = this->_deletionCandidates.contains(entry);
+  bool isFound = shard.deletionCandidates.contains(entry);
 
   // The asset won't necessarily be found in the deletionCandidates set.
   // See: https://github.com/CesiumGS/cesium-native/issues/1073
   if (isFound) {
     this->_totalDeletionCandidateMemoryUsage -= entry.sizeInDeletionList;
-    this->_deletionCandidates.remove(entry);
+    shard.deletionCandidates.remove(entry);
   }
 
-  // This depot is now managing at least one live asset, so keep it alive.
-  this->_pKeepAlive = this;
+  // This shard is now managing at least one live asset, so keep the depot
+  // alive.
+  this->updateKeepAliveUnderLock(shard);
 }
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::invalidateUnderLock(
     LockHolder&& lock,
+    Shard& shard,
     const TAssetKey& assetKey) {
-  auto it = this->_assets.find(assetKey);
-  if (it == this->_assets.end())
+  auto it = shard.assets.find(assetKey);
+  if (it == shard.assets.end())
     return false;
 
   AssetEntry* pEntry = it->second.get();
@@ -682,9 +891,9 @@ bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::invalidateUnderLock(
     if (!assetResult.pValue->_isInvalidated) {
       wasInvalidated = true;
       assetResult.pValue->_isInvalidated = true;
-      ++this->_liveInvalidatedAssets;
+      ++shard.liveInvalidatedAssets;
     }
-    this->_assetsByPointer.erase(assetResult.pValue.get());
+    shard.assetsByPointer.erase(assetResult.pValue.get());
   }
 
   // Detach the asset from the AssetEntry, so that its lifetime is controlled by
@@ -694,7 +903,8 @@ bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::invalidateUnderLock(
   // Remove the asset entry. This won't immediately delete the asset, because
   // `assetResult` above still holds a reference to it. But once that goes out
   // of scope, too, the asset _may_ be destroyed.
-  this->_assets.erase(it);
+  shard.assets.erase(it);
+  this->updateKeepAliveUnderLock(shard);
 
   // Unlock the mutex before allowing `assetResult` to go out of scope. When it
   // goes out of scope, the asset may be destroyed. If it is, that would cause
@@ -704,13 +914,40 @@ bool SharedAssetDepot<TAssetType, TAssetKey, TContext>::invalidateUnderLock(
   return wasInvalidated;
 }
 
+template <typename TAssetType, typename TAssetKey, typename TContext>
+void SharedAssetDepot<TAssetType, TAssetKey, TContext>::
+    updateKeepAliveUnderLock(Shard& shard) {
+  const bool isLive =
+      shard.assets.size() != shard.deletionCandidates.size() ||
+      shard.liveInvalidatedAssets != 0;
+  if (isLive == shard.isLive) {
+    return;
+  }
+
+  shard.isLive = isLive;
+
+  // The calling thread holds a LockHolder, so releasing _pKeepAlive here can
+  // never destroy the depot.
+  std::lock_guard<std::mutex> keepAliveLock(this->_keepAliveMutex);
+  if (isLive) {
+    if (this->_liveShards++ == 0) {
+      this->_pKeepAlive = this;
+    }
+  } else {
+    CESIUM_ASSERT(this->_liveShards > 0);
+    if (--this->_liveShards == 0) {
+      this->_pKeepAlive.reset();
+    }
+  }
+}
+
 template <typename TAssetType, typename TAssetKey, typename TContext>
 CesiumUtility::ResultPointer<TAssetType>
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::AssetEntry::
     toResultUnderLock() const {
-  // This method is called while the calling thread already owns the depot
-  // mutex. So we must take care not to lock it again, which could happen if
-  // the asset is currently unreferenced and we naively create an
+  // This method is called while the calling thread already owns the lock of
+  // the asset's shard. So we must take care not to lock it again, which could
+  // happen if the asset is currently unreferenced and we naively create an
   // IntrusivePointer for it.
   CesiumUtility::IntrusivePointer<TAssetType> p = nullptr;
   if (pAsset) {
@@ -723,8 +960,9 @@ SharedAssetDepot<TAssetType, TAssetKey, TContext>::AssetEntry::
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::LockHolder::LockHolder(
-    const CesiumUtility::IntrusivePointer<const SharedAssetDepot>& pDepot_)
-    : pDepot(pDepot_), lock(pDepot_->_mutex) {}
+    const CesiumUtility::IntrusivePointer<const SharedAssetDepot>& pDepot_,
+    Shard& shard)
+    : pDepot(pDepot_), lock(shard.mutex) {}
 
 template <typename TAssetType, typename TAssetKey, typename TContext>
 SharedAssetDepot<TAssetType, TAssetKey, TContext>::LockHolder::~LockHolder() =
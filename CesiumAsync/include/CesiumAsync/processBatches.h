@@ -0,0 +1,37 @@
+#pragma once
+
+#include <CesiumAsync/Library.h>
+
+#include <cstddef>
+#include <functional>
+
+namespace CesiumAsync {
+
+class AsyncSystem;
+
+/**
+ * @brief Calls a function for each batch index in `[0, batchCount)`, using
+ * worker threads to process batches in parallel, and returns once every batch
+ * has been processed.
+ *
+ * The calling thread takes part in the work. Batches are claimed from a shared
+ * counter, so the calling thread never waits for a worker task that has not
+ * started yet, and tasks that start late simply find no work. This makes it
+ * safe to call from a worker thread.
+ *
+ * If `process` throws, on the calling thread or on a worker thread, batches
+ * that have not started yet are skipped, and once the batches already in
+ * progress have finished, the first exception is rethrown to the caller.
+ *
+ * @param pAsyncSystem The async system whose worker threads help process the
+ * batches, or `nullptr` to process every batch on the calling thread.
+ * @param batchCount The number of batches.
+ * @param process The function to call with each batch index. It may be called
+ * from several threads at once, but never twice for the same batch.
+ */
+CESIUMASYNC_API void processBatches(
+    const AsyncSystem* pAsyncSystem,
+    size_t batchCount,
+    std::function<void(size_t)>&& process);
+
+} // namespace CesiumAsync
@@ -0,0 +1,103 @@
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/processBatches.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace CesiumAsync {
+
+namespace {
+
+struct BatchState {
+  size_t batchCount;
+  std::function<void(size_t)> process;
+  std::atomic<size_t> nextBatch{0};
+  std::mutex mutex;
+  std::condition_variable finished;
+  size_t remainingBatches;
+  // The first exception thrown by `process`, guarded by `mutex`.
+  std::exception_ptr pException;
+  std::atomic<bool> failed{false};
+};
+
+// Processes batches until there are none left to claim. Every claimed batch is
+// counted as finished, even if `process` throws, so the calling thread is never
+// left waiting. Once a batch has thrown, the remaining batches are claimed
+// without being processed.
+void processRemainingBatches(BatchState& state) {
+  size_t claimed = 0;
+  std::exception_ptr pException;
+  for (size_t batch = state.nextBatch++; batch < state.batchCount;
+       batch = state.nextBatch++) {
+    ++claimed;
+    if (state.failed) {
+      continue;
+    }
+
+    try {
+      state.process(batch);
+    } catch (...) {
+      pException = std::current_exception();
+      state.failed = true;
+    }
+  }
+
+  if (claimed > 0) {
+    std::lock_guard<std::mutex> lock(state.mutex);
+    if (pException && !state.pException) {
+      state.pException = pException;
+    }
+    state.remainingBatches -= claimed;
+    if (state.remainingBatches == 0) {
+      state.finished.notify_all();
+    }
+  }
+}
+
+} // namespace
+
+void processBatches(
+    const AsyncSystem* pAsyncSystem,
+    size_t batchCount,
+    std::function<void(size_t)>&& process) {
+  if (pAsyncSystem == nullptr || batchCount < 2) {
+    for (size_t batch = 0; batch < batchCount; ++batch) {
+      process(batch);
+    }
+    return;
+  }
+
+  auto pState = std::make_shared<BatchState>();
+  pState->batchCount = batchCount;
+  pState->process = std::move(process);
+  pState->remainingBatches = batchCount;
+
+  const size_t threads =
+      std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+  const size_t helpers = std::min(batchCount - 1, threads - 1);
+  for (size_t i = 0; i < helpers; ++i) {
+    pAsyncSystem->runInWorkerThread(
+        [pState]() { processRemainingBatches(*pState); });
+  }
+
+  processRemainingBatches(*pState);
+
+  std::unique_lock<std::mutex> lock(pState->mutex);
+  pState->finished.wait(lock, [&pState]() {
+    return pState->remainingBatches == 0;
+  });
+
+  if (pState->pException) {
+    std::rethrow_exception(pState->pException);
+  }
+}
+
+} // namespace CesiumAsync
@@ -0,0 +1,107 @@
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/ITaskProcessor.h>
+#include <CesiumAsync/processBatches.h>
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CesiumAsync;
+
+namespace {
+
+class ThreadTaskProcessor : public ITaskProcessor {
+public:
+  virtual void startTask(std::function<void()> f) override {
+    std::thread(f).detach();
+  }
+};
+
+} // namespace
+
+TEST_CASE("processBatches") {
+  constexpr size_t batchCount = 1000;
+
+  SUBCASE("processes every batch once on the calling thread") {
+    std::vector<int> counts(batchCount, 0);
+    processBatches(nullptr, batchCount, [&](size_t batch) {
+      ++counts[batch];
+    });
+    for (int count : counts) {
+      CHECK(count == 1);
+    }
+  }
+
+  SUBCASE("processes every batch once with worker threads") {
+    AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+    std::vector<std::atomic<int>> counts(batchCount);
+    processBatches(&asyncSystem, batchCount, [&](size_t batch) {
+      ++counts[batch];
+    });
+    for (const std::atomic<int>& count : counts) {
+      CHECK(count == 1);
+    }
+  }
+
+  SUBCASE("rethrows an exception from a batch") {
+    AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+    std::atomic<size_t> processed = 0;
+    CHECK_THROWS_AS(
+        processBatches(
+            &asyncSystem,
+            batchCount,
+            [&](size_t batch) {
+              ++processed;
+              if (batch == 7) {
+                throw std::runtime_error("batch failed");
+              }
+            }),
+        std::runtime_error);
+    CHECK(processed <= batchCount);
+  }
+
+  SUBCASE("returns to the caller when a batch throws on a worker thread") {
+    // Without a second hardware thread, no worker threads are used.
+    if (std::thread::hardware_concurrency() < 2) {
+      return;
+    }
+
+    AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+    const std::thread::id callingThread = std::this_thread::get_id();
+    std::atomic<bool> workerThrew = false;
+
+    auto process = [&](size_t) {
+      if (std::this_thread::get_id() != callingThread) {
+        workerThrew = true;
+        throw std::runtime_error("batch failed on a worker thread");
+      }
+
+      // Leave batches for the worker threads to claim.
+      const auto start = std::chrono::steady_clock::now();
+      while (!workerThrew &&
+             std::chrono::steady_clock::now() - start <
+                 std::chrono::seconds(5)) {
+        std::this_thread::yield();
+      }
+    };
+
+    CHECK_THROWS_AS(
+        processBatches(&asyncSystem, batchCount, process),
+        std::runtime_error);
+    CHECK(workerThrew);
+  }
+
+  SUBCASE("does nothing when there are no batches") {
+    AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+    bool called = false;
+    processBatches(&asyncSystem, 0, [&](size_t) { called = true; });
+    CHECK(!called);
+  }
+}
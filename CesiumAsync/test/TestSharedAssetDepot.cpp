@@ -7,10 +7,19 @@
 #include <CesiumUtility/SharedAsset.h>
 
 #include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <random>
 #include <string>
+#include <thread>
+#include <vector>
 
 using namespace CesiumAsync;
 using namespace CesiumNativeTests;
@@ -34,10 +43,11 @@ struct JustAsyncSystemContext {
 
 std::optional<Future<ResultPointer<TestAsset>>> maybeFuture{};
 
-IntrusivePointer<
-    SharedAssetDepot<TestAsset, std::string, JustAsyncSystemContext>>
-createDepot() {
-  return new SharedAssetDepot<TestAsset, std::string, JustAsyncSystemContext>(
+using TestDepot =
+    SharedAssetDepot<TestAsset, std::string, JustAsyncSystemContext>;
+
+IntrusivePointer<TestDepot> createDepot(size_t shardCount = 1) {
+  return new TestDepot(
       [](const JustAsyncSystemContext& context, const std::string& assetKey) {
         if (maybeFuture) {
           Future<ResultPointer<TestAsset>> localFuture =
@@ -50,7 +60,52 @@ createDepot() {
           return context.asyncSystem.createResolvedFuture(
               ResultPointer<TestAsset>(p));
         }
-      });
+      },
+      shardCount);
+}
+
+// Gets, holds, releases, and invalidates random assets from many threads at
+// once. Returns the number of assets that were successfully retrieved.
+size_t runConcurrentWorkload(
+    TestDepot& depot,
+    const JustAsyncSystemContext& context,
+    size_t threadCount,
+    size_t iterationsPerThread,
+    size_t keyCount) {
+  std::atomic<size_t> retrieved = 0;
+
+  std::vector<std::thread> threads;
+  threads.reserve(threadCount);
+  for (size_t t = 0; t < threadCount; ++t) {
+    threads.emplace_back([&, t]() {
+      std::default_random_engine rand(uint32_t(t + 1));
+      std::uniform_int_distribution<size_t> keyDist(0, keyCount - 1);
+
+      // Each thread holds on to a few assets at a time, so assets are
+      // constantly moving between the active and inactive states.
+      std::vector<IntrusivePointer<TestAsset>> held(4);
+      for (size_t i = 0; i < iterationsPerThread; ++i) {
+        const std::string key = "asset" + std::to_string(keyDist(rand));
+        IntrusivePointer<TestAsset> pAsset =
+            depot.getOrCreate(context, key).wait().pValue;
+        if (pAsset) {
+          ++retrieved;
+        }
+
+        if (i % 97 == 0) {
+          depot.invalidate(key);
+        }
+
+        held[i % held.size()] = std::move(pAsset);
+      }
+    });
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  return retrieved;
 }
 
 } // namespace
@@ -261,8 +316,7 @@ TEST_CASE("SharedAssetDepot") {
 
   SUBCASE("is kept alive until all of its assets are unreferenced") {
     auto pDepot = createDepot();
-    SharedAssetDepot<TestAsset, std::string, JustAsyncSystemContext>*
-        pDepotRaw = pDepot.get();
+    TestDepot* pDepotRaw = pDepot.get();
 
     ResultPointer<TestAsset> assetOne =
         pDepot->getOrCreate(context, "one").waitInMainThread();
@@ -301,8 +355,7 @@ TEST_CASE("SharedAssetDepot") {
 
   SUBCASE("is kept alive for as long as invalidated assets are alive") {
     auto pDepot = createDepot();
-    SharedAssetDepot<TestAsset, std::string, JustAsyncSystemContext>*
-        pDepotRaw = pDepot.get();
+    TestDepot* pDepotRaw = pDepot.get();
 
     ResultPointer<TestAsset> assetOne =
         pDepot->getOrCreate(context, "one").waitInMainThread();
@@ -350,3 +403,200 @@ TEST_CASE("SharedAssetDepot") {
     pDepot->invalidate("one");
   }
 }
+
+TEST_CASE("SharedAssetDepot with shards") {
+  std::shared_ptr<SimpleTaskProcessor> pTaskProcessor =
+      std::make_shared<SimpleTaskProcessor>();
+  AsyncSystem asyncSystem(pTaskProcessor);
+  JustAsyncSystemContext context{asyncSystem};
+
+  SUBCASE("zero shards is treated as one") {
+    auto pDepot = createDepot(0);
+    CHECK(pDepot->getShardCount() == 1);
+  }
+
+  SUBCASE("counts assets across all shards") {
+    auto pDepot = createDepot(4);
+    REQUIRE(pDepot->getShardCount() == 4);
+
+    std::vector<ResultPointer<TestAsset>> assets;
+    for (int i = 0; i < 20; ++i) {
+      assets.emplace_back(
+          pDepot->getOrCreate(context, std::to_string(i)).waitInMainThread());
+      REQUIRE(assets.back().pValue != nullptr);
+    }
+
+    CHECK(pDepot->getAssetCount() == 20);
+    CHECK(pDepot->getActiveAssetCount() == 20);
+    CHECK(pDepot->getInactiveAssetCount() == 0);
+
+    // Getting the same key again returns the same asset.
+    ResultPointer<TestAsset> again =
+        pDepot->getOrCreate(context, "7").waitInMainThread();
+    CHECK(again.pValue == assets[7].pValue);
+    again.pValue.reset();
+
+    for (size_t i = 0; i < 10; ++i) {
+      assets[i].pValue.reset();
+    }
+
+    CHECK(pDepot->getAssetCount() == 20);
+    CHECK(pDepot->getActiveAssetCount() == 10);
+    CHECK(pDepot->getInactiveAssetCount() == 10);
+  }
+
+  SUBCASE("size threshold applies to the whole depot") {
+    auto pDepot = createDepot(4);
+    pDepot->inactiveAssetSizeLimitBytes = 10;
+
+    std::vector<ResultPointer<TestAsset>> assets;
+    for (int i = 10; i < 30; ++i) {
+      assets.emplace_back(
+          pDepot->getOrCreate(context, std::to_string(i)).waitInMainThread());
+    }
+
+    // Every asset is two bytes, so at most five can stay inactive, no matter
+    // which shards they are in.
+    for (ResultPointer<TestAsset>& asset : assets) {
+      asset.pValue.reset();
+      CHECK(pDepot->getInactiveAssetTotalSizeBytes() <= 10);
+    }
+
+    CHECK(pDepot->getActiveAssetCount() == 0);
+    CHECK(pDepot->getInactiveAssetCount() > 0);
+    CHECK(pDepot->getInactiveAssetCount() <= 5);
+  }
+
+  SUBCASE("evicts the oldest inactive assets of all shards") {
+    auto pDepot = createDepot(2);
+    pDepot->inactiveAssetSizeLimitBytes = 10;
+
+    // Find two-character keys, which are two-byte assets, in each shard.
+    std::vector<std::string> keysInShard[2];
+    for (char a = 'a'; a <= 'z'; ++a) {
+      for (char b = 'a'; b <= 'z'; ++b) {
+        const std::string key{a, b};
+        keysInShard[std::hash<std::string>{}(key) % 2].emplace_back(key);
+      }
+    }
+    REQUIRE(keysInShard[0].size() >= 2);
+    REQUIRE(keysInShard[1].size() >= 5);
+
+    auto release = [&](const std::string& key) {
+      ResultPointer<TestAsset> asset =
+          pDepot->getOrCreate(context, key).waitInMainThread();
+      REQUIRE(asset.pValue != nullptr);
+    };
+
+    // Fill shard 1 up to the limit.
+    for (size_t i = 0; i < 5; ++i) {
+      release(keysInShard[1][i]);
+    }
+    CHECK(pDepot->getInactiveAssetTotalSizeBytes() == 10);
+
+    // Overflowing from shard 0 evicts the oldest asset, which is in shard 1,
+    // rather than the newer asset in shard 0.
+    release(keysInShard[0][0]);
+    CHECK(pDepot->getInactiveAssetTotalSizeBytes() == 10);
+    CHECK(pDepot->getInactiveAssetCount() == 5);
+
+    // Lowering the limit is enforced even though shard 0 holds fewer bytes
+    // than needed to get back within it.
+    pDepot->inactiveAssetSizeLimitBytes = 4;
+    release(keysInShard[0][1]);
+    CHECK(pDepot->getInactiveAssetTotalSizeBytes() <= 4);
+    CHECK(pDepot->getInactiveAssetCount() == 2);
+
+    // The two newest assets are the ones that were kept.
+    CHECK(pDepot->invalidate(keysInShard[0][0]));
+    CHECK(pDepot->invalidate(keysInShard[0][1]));
+    CHECK(!pDepot->invalidate(keysInShard[1][4]));
+  }
+
+  SUBCASE("is kept alive until all of its assets are unreferenced") {
+    auto pDepot = createDepot(4);
+    TestDepot* pDepotRaw = pDepot.get();
+
+    std::vector<ResultPointer<TestAsset>> assets;
+    for (int i = 0; i < 8; ++i) {
+      assets.emplace_back(
+          pDepot->getOrCreate(context, std::to_string(i)).waitInMainThread());
+    }
+
+    pDepot.reset();
+
+    for (size_t i = 1; i < assets.size(); ++i) {
+      assets[i].pValue.reset();
+    }
+
+    REQUIRE(assets[0].pValue->getDepot() == pDepotRaw);
+    CHECK(pDepotRaw->getActiveAssetCount() == 1);
+    CHECK(pDepotRaw->getInactiveAssetCount() == 7);
+
+    assets[0].pValue.reset();
+  }
+
+  SUBCASE("can invalidate an asset by pointer") {
+    auto pDepot = createDepot(4);
+    auto pOtherDepot = createDepot(4);
+
+    ResultPointer<TestAsset> assetOne =
+        pDepot->getOrCreate(context, "one").waitInMainThread();
+    REQUIRE(assetOne.pValue != nullptr);
+
+    CHECK(!pOtherDepot->invalidate(*assetOne.pValue));
+    CHECK(pDepot->invalidate(*assetOne.pValue));
+    CHECK(!pDepot->invalidate(*assetOne.pValue));
+
+    ResultPointer<TestAsset> assetOne2 =
+        pDepot->getOrCreate(context, "one").waitInMainThread();
+    CHECK(assetOne.pValue != assetOne2.pValue);
+  }
+
+  SUBCASE("can be used from many threads at once") {
+    auto pDepot = createDepot(8);
+    pDepot->inactiveAssetSizeLimitBytes = 100;
+
+    const size_t retrieved =
+        runConcurrentWorkload(*pDepot, context, 8, 2000, 64);
+
+    CHECK(retrieved == 8 * 2000);
+    CHECK(pDepot->getActiveAssetCount() == 0);
+    CHECK(pDepot->getInactiveAssetTotalSizeBytes() <= 100);
+  }
+}
+
+TEST_CASE("SharedAssetDepot concurrency benchmark" * doctest::skip(true)) {
+  std::shared_ptr<SimpleTaskProcessor> pTaskProcessor =
+      std::make_shared<SimpleTaskProcessor>();
+  AsyncSystem asyncSystem(pTaskProcessor);
+  JustAsyncSystemContext context{asyncSystem};
+
+  const size_t threadCount =
+      std::max(size_t(std::thread::hardware_concurrency()), size_t(2));
+  const size_t iterationsPerThread = 200000;
+
+  for (const size_t shardCount : {size_t(1), size_t(4), size_t(16)}) {
+    auto pDepot = createDepot(shardCount);
+    pDepot->inactiveAssetSizeLimitBytes = 4096;
+
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    const size_t retrieved = runConcurrentWorkload(
+        *pDepot,
+        context,
+        threadCount,
+        iterationsPerThread,
+        4096);
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+
+    spdlog::info(
+        "{} shards, {} threads: {:.2f} million gets/sec",
+        shardCount,
+        threadCount,
+        double(retrieved) / seconds / 1000000.0);
+  }
+}
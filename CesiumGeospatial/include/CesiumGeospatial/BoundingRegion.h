@@ -1,11 +1,14 @@
 #pragma once
 
+#include <CesiumGeometry/BoundingSphere.h>
 #include <CesiumGeometry/CullingResult.h>
 #include <CesiumGeometry/OrientedBoundingBox.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/Library.h>
 
+#include <glm/ext/vector_double3.hpp>
+
 namespace CesiumGeometry {
 class Plane;
 }
@@ -57,9 +60,21 @@ public:
     return this->_boundingBox;
   }
 
+  /**
+   * @brief Gets a bounding sphere enclosing {@link getBoundingBox}.
+   *
+   * The sphere's radius is computed once when the region is constructed.
+   */
+  CesiumGeometry::BoundingSphere getBoundingSphere() const noexcept;
+
   /**
    * @brief Determines on which side of a plane the bounding region is located.
    *
+   * The plane is first tested against {@link getBoundingSphere}, which
+   * resolves most regions with a single dot product. Only regions whose sphere
+   * straddles the plane are tested against the oriented bounding box. The
+   * result is always identical to testing the box directly.
+   *
    * @param plane The plane to test against.
    * @return The {@link CesiumGeometry::CullingResult}
    *  * `Inside` if the entire region is on the side of the plane the normal is
@@ -173,6 +188,9 @@ private:
   glm::dvec3 _southNormal;
   glm::dvec3 _northNormal;
   bool _planesAreInvalid;
+  // The radius of the sphere centered on _boundingBox that encloses it. All
+  // other culling data is read from _boundingBox when it is needed.
+  double _boundingSphereRadius;
 };
 
 } // namespace CesiumGeospatial
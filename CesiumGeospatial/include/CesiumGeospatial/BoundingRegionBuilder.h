@@ -4,6 +4,8 @@
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/Library.h>
 
+#include <span>
+
 namespace CesiumGeospatial {
 
 /**
@@ -71,6 +73,28 @@ public:
    */
   bool expandToIncludePosition(const Cartographic& position);
 
+  /**
+   * @brief Expands the bounding region to include many positions, given as
+   * separate arrays of longitudes, latitudes, and heights.
+   *
+   * The result is the same as calling {@link expandToIncludePosition} for each
+   * position, but the latitude and height ranges are computed with a single
+   * vectorizable pass over the arrays. NaN coordinates, such as those produced
+   * by the batch version of {@link Ellipsoid::cartesianToCartographic} for
+   * positions at the center of the ellipsoid, are ignored. All spans must have
+   * the same size.
+   *
+   * @param longitudes The longitudes of the positions, in radians.
+   * @param latitudes The latitudes of the positions, in radians.
+   * @param heights The heights of the positions, in meters.
+   * @returns True if the region was modified, or false if the region already
+   * contained all of the positions.
+   */
+  bool expandToIncludePositions(
+      std::span<const double> longitudes,
+      std::span<const double> latitudes,
+      std::span<const double> heights);
+
   /**
    * @brief Expands the bounding region to include the given globe rectangle.
    *
@@ -94,6 +118,12 @@ public:
   bool expandToIncludeBoundingRegion(const BoundingRegion& region);
 
 private:
+  /**
+   * @brief Expands only the longitude range of the region to include the
+   * given longitude, which must not be too close to either pole.
+   */
+  bool expandLongitudeRangeToInclude(double longitude);
+
   /**
    * @brief When a position's latitude is within this distance in radians from
    * the North or South pole, its longitude should be considered unreliable and
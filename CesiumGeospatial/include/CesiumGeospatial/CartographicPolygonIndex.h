@@ -0,0 +1,138 @@
+#pragma once
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/Library.h>
+
+#include <glm/vec2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace CesiumGeospatial {
+
+/**
+ * @brief A spatial index over the triangles and edges of a list of
+ * {@link CartographicPolygon} instances, used to quickly classify rectangles
+ * against all of the polygons at once.
+ *
+ * The triangles, perimeter edges, and first vertices of the polygons are
+ * sorted into a uniform longitude/latitude grid covering the polygons, so a
+ * query only tests the few that are near the rectangle. The answers are the
+ * same as those of {@link CartographicPolygon::rectangleIsWithinPolygons} and
+ * {@link CartographicPolygon::rectangleIsOutsidePolygons} for the same list of
+ * polygons.
+ */
+class CESIUMGEOSPATIAL_API CartographicPolygonIndex final {
+public:
+  /**
+   * @brief Creates an empty index, which contains no polygons.
+   */
+  CartographicPolygonIndex() noexcept;
+
+  /**
+   * @brief Creates an index over the given polygons.
+   *
+   * The index does not reference the polygons after construction.
+   *
+   * @param polygons The polygons to index.
+   */
+  explicit CartographicPolygonIndex(
+      const std::vector<CartographicPolygon>& polygons);
+
+  /**
+   * @brief Gets the number of polygons in this index.
+   */
+  size_t getPolygonCount() const noexcept {
+    return this->_boundingRectangles.size();
+  }
+
+  /**
+   * @brief Determines whether a globe rectangle is completely inside any of the
+   * indexed polygons.
+   *
+   * @param rectangle The {@link CesiumGeospatial::GlobeRectangle} of the tile.
+   * @return True if the rectangle is completely inside a polygon; otherwise,
+   * false.
+   */
+  bool rectangleIsWithinPolygons(
+      const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept;
+
+  /**
+   * @brief Determines whether a globe rectangle is completely outside all the
+   * indexed polygons.
+   *
+   * @param rectangle The {@link CesiumGeospatial::GlobeRectangle} of the tile.
+   * @return True if the rectangle is completely outside all the polygons;
+   * otherwise, false.
+   */
+  bool rectangleIsOutsidePolygons(
+      const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept;
+
+private:
+  struct CellRange {
+    uint32_t west;
+    uint32_t south;
+    uint32_t east;
+    uint32_t north;
+  };
+
+  std::optional<CellRange>
+  getCellRange(double west, double south, double east, double north)
+      const noexcept;
+
+  bool boundingRectangleIntersects(
+      uint32_t polygon,
+      const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept;
+
+  template <typename Callback>
+  bool forEachTriangleContaining(const glm::dvec2& point, Callback&& callback)
+      const;
+
+  // The bounding rectangle of each polygon, which is std::nullopt for polygons
+  // with fewer than three vertices.
+  std::vector<std::optional<CesiumGeospatial::GlobeRectangle>>
+      _boundingRectangles;
+
+  // The grid covers [_gridWest, _gridEast] x [_gridSouth, _gridNorth] with
+  // _gridColumns x _gridRows cells. There are no cells in an empty index.
+  double _gridWest;
+  double _gridSouth;
+  double _gridEast;
+  double _gridNorth;
+  double _inverseCellWidth;
+  double _inverseCellHeight;
+  uint32_t _gridColumns;
+  uint32_t _gridRows;
+
+  // Triangles, sorted by cell, as separate coordinate arrays. The items in
+  // cell i are [_triangleCellOffsets[i], _triangleCellOffsets[i + 1]). A
+  // triangle is stored in every cell its bounds overlap.
+  std::vector<uint32_t> _triangleCellOffsets;
+  std::vector<double> _triangleAX;
+  std::vector<double> _triangleAY;
+  std::vector<double> _triangleCX;
+  std::vector<double> _triangleCY;
+  std::vector<double> _triangleABPerpX;
+  std::vector<double> _triangleABPerpY;
+  std::vector<double> _triangleBCPerpX;
+  std::vector<double> _triangleBCPerpY;
+  std::vector<double> _triangleCAPerpX;
+  std::vector<double> _triangleCAPerpY;
+  std::vector<uint32_t> _trianglePolygons;
+
+  // Perimeter edges from a to b, sorted by cell in the same way.
+  std::vector<uint32_t> _edgeCellOffsets;
+  std::vector<glm::dvec2> _edgeA;
+  std::vector<glm::dvec2> _edgeB;
+  std::vector<uint32_t> _edgePolygons;
+
+  // The first vertex of each polygon, sorted by cell in the same way.
+  std::vector<uint32_t> _pointCellOffsets;
+  std::vector<glm::dvec2> _points;
+  std::vector<uint32_t> _pointPolygons;
+};
+
+} // namespace CesiumGeospatial
@@ -2,11 +2,11 @@
 
 #include <CesiumGeospatial/Library.h>
 
-#include <cstdint>
+#include <cstddef>
+#include <memory>
 #include <optional>
 #include <span>
 #include <string>
-#include <vector>
 
 namespace CesiumGeospatial {
 
@@ -35,6 +35,23 @@ public:
   static std::optional<EarthGravitationalModel1996Grid>
   fromBuffer(const std::span<const std::byte>& buffer);
 
+  /**
+   * @brief Attempts to create a {@link EarthGravitationalModel1996Grid} by
+   * memory-mapping a WW15MGH.DAC file.
+   *
+   * The file is mapped read-only and sampled in place, so the operating system
+   * can share the ~2 MB grid between every process that maps the same file,
+   * and pages that are never sampled are never read from disk. On platforms
+   * without memory-mapped files, such as WebAssembly, the file is read into
+   * memory instead.
+   *
+   * @param path The path of the WW15MGH.DAC file.
+   * @returns The instance created from the file, or `std::nullopt` if the file
+   * cannot be opened or cannot be interpreted as an EGM96 grid.
+   */
+  static std::optional<EarthGravitationalModel1996Grid>
+  fromMemoryMappedFile(const std::string& path);
+
   /**
    * @brief Samples the height at the given position.
    *
@@ -46,15 +63,66 @@ public:
    */
   double sampleHeight(const Cartographic& position) const;
 
+  /**
+   * @brief Samples the heights at many positions, given as separate arrays of
+   * longitudes and latitudes.
+   *
+   * Each result is identical to the result of {@link sampleHeight} for the
+   * same position. All spans must have the same size.
+   *
+   * When `sortByGridCell` is true, the positions are bucketed by grid row
+   * before sampling so that the grid is read from top to bottom rather than in
+   * input order. This helps with large batches of widely scattered positions,
+   * such as a point cloud covering a continent, but only adds cost for
+   * spatially coherent positions like the vertices of a single terrain tile.
+   *
+   * @param longitudes The longitudes of the positions, in radians.
+   * @param latitudes The latitudes of the positions, in radians.
+   * @param heights Receives the height (in meters) of the EGM96 surface above
+   * the WGS84 ellipsoid at each position.
+   * @param sortByGridCell Whether to sample the positions in grid order.
+   */
+  void sampleHeights(
+      std::span<const double> longitudes,
+      std::span<const double> latitudes,
+      std::span<double> heights,
+      bool sortByGridCell = false) const;
+
+  /**
+   * @brief Samples the heights at many positions.
+   *
+   * This is equivalent to the overload taking separate longitude and latitude
+   * arrays. The `height` of each position is ignored.
+   *
+   * @param positions The positions to sample.
+   * @param heights Receives the height (in meters) of the EGM96 surface above
+   * the WGS84 ellipsoid at each position.
+   * @param sortByGridCell Whether to sample the positions in grid order.
+   */
+  void sampleHeights(
+      std::span<const Cartographic> positions,
+      std::span<double> heights,
+      bool sortByGridCell = false) const;
+
 private:
-  EarthGravitationalModel1996Grid(std::vector<int16_t>&& gridValues);
+  EarthGravitationalModel1996Grid(
+      std::shared_ptr<const void>&& pStorage,
+      std::span<const std::byte> bigEndianValues);
+
+  double sampleHeight(double longitude, double latitude) const;
 
   /**
    * Returns the height of the given grid value, in meters.
    */
-  double getHeightForIndices(size_t vertical, size_t horizontal) const;
+  double getHeightForIndices(size_t horizontal, size_t vertical) const;
+
+  // Keeps the memory viewed by _bigEndianValues alive. This is either a copy
+  // of the grid or a read-only mapping of the grid file.
+  std::shared_ptr<const void> _pStorage;
 
-  std::vector<int16_t> _gridValues;
+  // The grid values as big-endian 16-bit integers, exactly as they appear in
+  // WW15MGH.DAC, so that a mapped file can be sampled without a copy.
+  std::span<const std::byte> _bigEndianValues;
 };
 
 } // namespace CesiumGeospatial
@@ -7,6 +7,7 @@
 #include <glm/vec3.hpp>
 
 #include <optional>
+#include <span>
 
 // The comments are copied here so that the doc comment always shows up in
 // Intellisense whether the default is toggled or not.
@@ -141,6 +142,85 @@ public:
   std::optional<glm::dvec3>
   scaleToGeodeticSurface(const glm::dvec3& cartesian) const noexcept;
 
+  /**
+   * @brief Converts many {@link Cartographic} positions, given as separate
+   * arrays of longitudes, latitudes, and heights, to cartesian representation.
+   *
+   * This produces results equivalent, within floating-point tolerance, to
+   * calling {@link cartographicToCartesian(const Cartographic&) const} for
+   * each position, but processes the positions in blocks so that the compiler
+   * can vectorize the arithmetic. All spans must have the same size.
+   *
+   * @param longitudes The longitudes, in radians.
+   * @param latitudes The latitudes, in radians.
+   * @param heights The heights above the ellipsoid, in meters.
+   * @param result Receives the cartesian representation of each position.
+   */
+  void cartographicToCartesian(
+      std::span<const double> longitudes,
+      std::span<const double> latitudes,
+      std::span<const double> heights,
+      std::span<glm::dvec3> result) const noexcept;
+
+  /**
+   * @brief Converts many cartesian positions, given as separate arrays of X, Y,
+   * and Z coordinates, to {@link Cartographic} representation.
+   *
+   * This produces results equivalent, within floating-point tolerance, to
+   * calling {@link cartesianToCartographic(const glm::dvec3&) const} for each
+   * position, but the iterative solve is run in lockstep over blocks of
+   * positions so that the compiler can vectorize it. Positions that converge
+   * early keep iterating until the whole block has converged, so their results
+   * may differ slightly from those of the single-position overload. A
+   * position at the center of this ellipsoid, for which the single-position
+   * overload returns the empty optional, produces NaN for its longitude,
+   * latitude, and height. All spans must have the same size.
+   *
+   * @param x The X coordinates.
+   * @param y The Y coordinates.
+   * @param z The Z coordinates.
+   * @param longitudes Receives the longitude of each position, in radians.
+   * @param latitudes Receives the latitude of each position, in radians.
+   * @param heights Receives the height of each position, in meters.
+   */
+  void cartesianToCartographic(
+      std::span<const double> x,
+      std::span<const double> y,
+      std::span<const double> z,
+      std::span<double> longitudes,
+      std::span<double> latitudes,
+      std::span<double> heights) const noexcept;
+
+  /**
+   * @brief Scales many cartesian positions, given as separate arrays of X, Y,
+   * and Z coordinates, along the geodetic surface normal so that they are on
+   * the surface of this ellipsoid.
+   *
+   * This produces results equivalent, within floating-point tolerance, to
+   * calling {@link scaleToGeodeticSurface(const glm::dvec3&) const} for each
+   * position, but the iterative solve is run in lockstep over blocks of
+   * positions so that the compiler can vectorize it. Positions that converge
+   * early keep iterating until the whole block has converged, so their results
+   * may differ slightly from those of the single-position overload. A
+   * position at the center of this ellipsoid produces NaN for all three
+   * coordinates. All spans must have the same size. The output spans may alias
+   * the input spans.
+   *
+   * @param x The X coordinates.
+   * @param y The Y coordinates.
+   * @param z The Z coordinates.
+   * @param resultX Receives the X coordinate of each scaled position.
+   * @param resultY Receives the Y coordinate of each scaled position.
+   * @param resultZ Receives the Z coordinate of each scaled position.
+   */
+  void scaleToGeodeticSurface(
+      std::span<const double> x,
+      std::span<const double> y,
+      std::span<const double> z,
+      std::span<double> resultX,
+      std::span<double> resultY,
+      std::span<double> resultZ) const noexcept;
+
   /**
    * @brief Scales the provided cartesian position along the geocentric
    * surface normal so that it is on the surface of this ellipsoid.
@@ -8,6 +8,8 @@
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include <span>
+
 namespace CesiumGeospatial {
 
 class Cartographic;
@@ -93,6 +95,25 @@ public:
   CesiumGeometry::Rectangle
   project(const CesiumGeospatial::GlobeRectangle& rectangle) const noexcept;
 
+  /**
+   * @brief Converts many geodetic ellipsoid coordinates, given as separate
+   * arrays of longitudes and latitudes, to geographic X and Y coordinates.
+   *
+   * This produces the same X and Y coordinates as calling
+   * {@link project(const Cartographic&) const} for each position, in a loop
+   * that the compiler can vectorize. All spans must have the same size.
+   *
+   * @param longitudes The longitudes, in radians.
+   * @param latitudes The latitudes, in radians.
+   * @param x Receives the projected X coordinate of each position, in meters.
+   * @param y Receives the projected Y coordinate of each position, in meters.
+   */
+  void project(
+      std::span<const double> longitudes,
+      std::span<const double> latitudes,
+      std::span<double> x,
+      std::span<double> y) const noexcept;
+
   /**
    * @brief Converts geographic coordinates to geodetic ellipsoid coordinates.
    *
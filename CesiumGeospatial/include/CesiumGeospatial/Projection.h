@@ -9,6 +9,7 @@
 
 #include <glm/vec2.hpp>
 
+#include <span>
 #include <variant>
 
 namespace CesiumGeospatial {
@@ -35,6 +36,27 @@ typedef std::variant<GeographicProjection, WebMercatorProjection> Projection;
 glm::dvec3
 projectPosition(const Projection& projection, const Cartographic& position);
 
+/**
+ * @brief Projects many positions on the globe, given as separate arrays of
+ * longitudes and latitudes, using the given {@link Projection}.
+ *
+ * This produces the same X and Y coordinates as calling
+ * {@link projectPosition} for each position, but dispatches on the type of the
+ * projection only once. All spans must have the same size.
+ *
+ * @param projection The projection.
+ * @param longitudes The longitudes, in radians.
+ * @param latitudes The latitudes, in radians.
+ * @param x Receives the projected X coordinate of each position.
+ * @param y Receives the projected Y coordinate of each position.
+ */
+void projectPositions(
+    const Projection& projection,
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<double> x,
+    std::span<double> y);
+
 /**
  * @brief Unprojects a position from the globe using the given
  * {@link Projection}.
@@ -14,6 +14,8 @@
 
 namespace CesiumGeospatial {
 
+struct S2CellGeometry;
+
 /**
  * A tile bounding volume specified as an S2 cell token with minimum and maximum
  * heights. The bounding volume is a k DOP. A k-DOP is the Boolean intersection
@@ -22,6 +24,9 @@ namespace CesiumGeospatial {
 class CESIUMGEOSPATIAL_API S2CellBoundingVolume final {
 public:
   /** @brief Creates a new \ref S2CellBoundingVolume.
+   *
+   * The longitude/latitude positions of the cell's center and corners are
+   * cached, so creating another bounding volume for the same cell is cheaper.
    *
    * @param cellID The S2 cell ID.
    * @param minimumHeight The minimum height of the bounding volume.
@@ -34,6 +39,21 @@ public:
       double maximumHeight,
       const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
 
+  /**
+   * @brief Creates the bounding volumes of the four children of this cell,
+   * with the same heights as this volume.
+   *
+   * This is faster than constructing each child separately, because the
+   * children's corners are derived from this cell's corners and center rather
+   * than computed from scratch.
+   *
+   * @param ellipsoid The ellipsoid.
+   * @return The children, in the order given by {@link S2CellID::getChild}.
+   */
+  std::array<S2CellBoundingVolume, 4> computeChildren(
+      const CesiumGeospatial::Ellipsoid& ellipsoid
+          CESIUM_DEFAULT_ELLIPSOID) const;
+
   /**
    * @brief Gets this bounding volume's cell ID.
    */
@@ -106,6 +126,13 @@ public:
                             CESIUM_DEFAULT_ELLIPSOID) const noexcept;
 
 private:
+  S2CellBoundingVolume(
+      const S2CellID& cellID,
+      const S2CellGeometry& geometry,
+      double minimumHeight,
+      double maximumHeight,
+      const CesiumGeospatial::Ellipsoid& ellipsoid);
+
   S2CellID _cellID;
   double _minimumHeight;
   double _maximumHeight;
@@ -1,3 +1,4 @@
+#include <CesiumGeometry/BoundingSphere.h>
 #include <CesiumGeometry/CullingResult.h>
 #include <CesiumGeometry/IntersectionTests.h>
 #include <CesiumGeometry/Plane.h>
@@ -21,6 +22,16 @@ using namespace CesiumUtility;
 using namespace CesiumGeometry;
 
 namespace CesiumGeospatial {
+namespace {
+// The axes of a region's bounding box are orthogonal, so the corner farthest
+// from the center is at the sum of the half axes.
+double computeEnclosingSphereRadius(
+    const OrientedBoundingBox& boundingBox) noexcept {
+  const glm::dmat3& halfAxes = boundingBox.getHalfAxes();
+  return glm::length(halfAxes[0] + halfAxes[1] + halfAxes[2]);
+}
+} // namespace
+
 BoundingRegion::BoundingRegion(
     const GlobeRectangle& rectangle,
     double minimumHeight,
@@ -42,7 +53,9 @@ BoundingRegion::BoundingRegion(
       _eastNormal(),
       _southNormal(),
       _northNormal(),
-      _planesAreInvalid(false) {
+      _planesAreInvalid(false),
+      _boundingSphereRadius(
+          computeEnclosingSphereRadius(this->_boundingBox)) {
   // The middle latitude on the western edge.
   const glm::dvec3 westernMidpointCartesian =
       ellipsoid.cartographicToCartesian(Cartographic(
@@ -139,9 +152,40 @@ BoundingRegion::BoundingRegion(
       glm::normalize(glm::cross(westVector, northSurfaceNormal));
 }
 
+BoundingSphere BoundingRegion::getBoundingSphere() const noexcept {
+  return BoundingSphere(
+      this->_boundingBox.getCenter(),
+      this->_boundingSphereRadius);
+}
+
 CullingResult
 BoundingRegion::intersectPlane(const Plane& plane) const noexcept {
-  return this->_boundingBox.intersectPlane(plane);
+  const glm::dvec3& normal = plane.getNormal();
+
+  // The sphere and the box share a center, so the distance from the plane to
+  // the center serves both tests.
+  const double centerDistance =
+      glm::dot(normal, this->_boundingBox.getCenter()) + plane.getDistance();
+  const double sphereRadius = this->_boundingSphereRadius;
+  if (centerDistance <= -sphereRadius) {
+    return CullingResult::Outside;
+  }
+  if (centerDistance >= sphereRadius) {
+    return CullingResult::Inside;
+  }
+
+  const glm::dmat3& halfAxes = this->_boundingBox.getHalfAxes();
+  const double radEffective = glm::abs(glm::dot(halfAxes[0], normal)) +
+                              glm::abs(glm::dot(halfAxes[1], normal)) +
+                              glm::abs(glm::dot(halfAxes[2], normal));
+
+  if (centerDistance <= -radEffective) {
+    return CullingResult::Outside;
+  }
+  if (centerDistance >= radEffective) {
+    return CullingResult::Inside;
+  }
+  return CullingResult::Intersecting;
 }
 
 double BoundingRegion::computeDistanceSquaredToPosition(
@@ -220,9 +264,26 @@ double BoundingRegion::computeDistanceSquaredToPosition(
     }
   }
 
-  const double bboxDistanceSquared =
-      this->getBoundingBox().computeDistanceSquaredToPosition(
-          cartesianPosition);
+  // Equivalent to OrientedBoundingBox::computeDistanceSquaredToPosition, but
+  // using the box's stored lengths instead of measuring each axis again. Boxes
+  // with a zero-length axis need substitute axes, which only
+  // OrientedBoundingBox constructs.
+  const glm::dvec3 halfLengths = this->_boundingBox.getLengths() * 0.5;
+  if (!(halfLengths.x > 0.0 && halfLengths.y > 0.0 && halfLengths.z > 0.0)) {
+    return glm::max(
+        this->_boundingBox.computeDistanceSquaredToPosition(cartesianPosition),
+        result);
+  }
+
+  const glm::dmat3& halfAxes = this->_boundingBox.getHalfAxes();
+  const glm::dvec3 offset = cartesianPosition - this->_boundingBox.getCenter();
+  const glm::dvec3 local(
+      glm::dot(halfAxes[0], offset) / halfLengths.x,
+      glm::dot(halfAxes[1], offset) / halfLengths.y,
+      glm::dot(halfAxes[2], offset) / halfLengths.z);
+  const glm::dvec3 outside = glm::max(glm::abs(local) - halfLengths, 0.0);
+  const double bboxDistanceSquared = glm::dot(outside, outside);
+
   return glm::max(bboxDistanceSquared, result);
 }
 
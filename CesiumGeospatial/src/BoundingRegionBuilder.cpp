@@ -4,11 +4,16 @@
 #include <CesiumGeospatial/BoundingRegionBuilder.h>
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 #include <glm/common.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <limits>
+#include <span>
 
 using namespace CesiumUtility;
 
@@ -86,38 +91,73 @@ bool BoundingRegionBuilder::expandToIncludePosition(
 
   // Only update the longitude range if this position isn't too close to the
   // North or South pole.
-  if (!isCloseToPole(position.latitude, this->_poleTolerance)) {
-    if (this->_longitudeRangeIsEmpty) {
-      this->_rectangle.setWest(position.longitude);
-      this->_rectangle.setEast(position.longitude);
-      this->_longitudeRangeIsEmpty = false;
-      modified = true;
-    } else if (!this->_rectangle.contains(position)) {
-      double positionToWestDistance =
-          this->_rectangle.getWest() - position.longitude;
-      if (positionToWestDistance < 0.0) {
-        const double antiMeridianToWest =
-            this->_rectangle.getWest() - (-Math::OnePi);
-        const double positionToAntiMeridian = Math::OnePi - position.longitude;
-        positionToWestDistance = antiMeridianToWest + positionToAntiMeridian;
-      }
-
-      double eastToPositionDistance =
-          position.longitude - this->_rectangle.getEast();
-      if (eastToPositionDistance < 0.0) {
-        const double antiMeridianToPosition =
-            position.longitude - (-Math::OnePi);
-        const double eastToAntiMeridian =
-            Math::OnePi - this->_rectangle.getEast();
-        eastToPositionDistance = antiMeridianToPosition + eastToAntiMeridian;
-      }
-
-      if (positionToWestDistance < eastToPositionDistance) {
-        this->_rectangle.setWest(position.longitude);
-      } else {
-        this->_rectangle.setEast(position.longitude);
-      }
+  if (!isCloseToPole(position.latitude, this->_poleTolerance) &&
+      this->expandLongitudeRangeToInclude(position.longitude)) {
+    modified = true;
+  }
+
+  return modified;
+}
+
+bool BoundingRegionBuilder::expandToIncludePositions(
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<const double> heights) {
+  CESIUM_ASSERT(latitudes.size() == longitudes.size());
+  CESIUM_ASSERT(heights.size() == longitudes.size());
+
+  const size_t count =
+      std::min({longitudes.size(), latitudes.size(), heights.size()});
+
+  // The latitude and height ranges are plain reductions that the compiler can
+  // vectorize. Comparisons against NaN are false, so NaN values are skipped.
+  double south = this->_rectangle.getSouth();
+  double north = this->_rectangle.getNorth();
+  double minimumHeight = this->_minimumHeight;
+  double maximumHeight = this->_maximumHeight;
+
+  for (size_t i = 0; i < count; ++i) {
+    const double latitude = latitudes[i];
+    const double height = heights[i];
+    south = latitude < south ? latitude : south;
+    north = latitude > north ? latitude : north;
+    minimumHeight = height < minimumHeight ? height : minimumHeight;
+    maximumHeight = height > maximumHeight ? height : maximumHeight;
+  }
+
+  bool modified = false;
 
+  if (south < this->_rectangle.getSouth()) {
+    this->_rectangle.setSouth(south);
+    modified = true;
+  }
+
+  if (north > this->_rectangle.getNorth()) {
+    this->_rectangle.setNorth(north);
+    modified = true;
+  }
+
+  if (minimumHeight < this->_minimumHeight) {
+    this->_minimumHeight = minimumHeight;
+    modified = true;
+  }
+
+  if (maximumHeight > this->_maximumHeight) {
+    this->_maximumHeight = maximumHeight;
+    modified = true;
+  }
+
+  // The longitude range wraps at the anti-meridian, so it must be expanded one
+  // position at a time.
+  for (size_t i = 0; i < count; ++i) {
+    const double longitude = longitudes[i];
+    const double latitude = latitudes[i];
+    if (std::isnan(longitude) || std::isnan(latitude) ||
+        isCloseToPole(latitude, this->_poleTolerance)) {
+      continue;
+    }
+
+    if (this->expandLongitudeRangeToInclude(longitude)) {
       modified = true;
     }
   }
@@ -125,6 +165,46 @@ bool BoundingRegionBuilder::expandToIncludePosition(
   return modified;
 }
 
+bool BoundingRegionBuilder::expandLongitudeRangeToInclude(double longitude) {
+  if (this->_longitudeRangeIsEmpty) {
+    this->_rectangle.setWest(longitude);
+    this->_rectangle.setEast(longitude);
+    this->_longitudeRangeIsEmpty = false;
+    return true;
+  }
+
+  const double west = this->_rectangle.getWest();
+  const double east = this->_rectangle.getEast();
+  const bool contained = west <= east
+                             ? longitude >= west && longitude <= east
+                             : longitude >= west || longitude <= east;
+  if (contained) {
+    return false;
+  }
+
+  double positionToWestDistance = west - longitude;
+  if (positionToWestDistance < 0.0) {
+    const double antiMeridianToWest = west - (-Math::OnePi);
+    const double positionToAntiMeridian = Math::OnePi - longitude;
+    positionToWestDistance = antiMeridianToWest + positionToAntiMeridian;
+  }
+
+  double eastToPositionDistance = longitude - east;
+  if (eastToPositionDistance < 0.0) {
+    const double antiMeridianToPosition = longitude - (-Math::OnePi);
+    const double eastToAntiMeridian = Math::OnePi - east;
+    eastToPositionDistance = antiMeridianToPosition + eastToAntiMeridian;
+  }
+
+  if (positionToWestDistance < eastToPositionDistance) {
+    this->_rectangle.setWest(longitude);
+  } else {
+    this->_rectangle.setEast(longitude);
+  }
+
+  return true;
+}
+
 bool BoundingRegionBuilder::expandToIncludeGlobeRectangle(
     const GlobeRectangle& rectangle) {
   bool modified = false;
@@ -0,0 +1,554 @@
+#include <CesiumGeometry/IntersectionTests.h>
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <glm/common.hpp>
+#include <glm/exponential.hpp>
+#include <glm/ext/matrix_double2x2.hpp>
+#include <glm/ext/vector_double2.hpp>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+using namespace CesiumGeometry;
+
+namespace CesiumGeospatial {
+
+namespace {
+
+// The number of triangles tested together in a block the compiler can
+// vectorize.
+constexpr size_t batchLanes = 8;
+
+// The largest number of cells along either axis of the grid.
+constexpr uint32_t maximumGridDimension = 1024;
+
+// The average number of triangles and edges per cell the grid aims for.
+constexpr size_t itemsPerCell = 4;
+
+std::array<glm::dvec2, 4> computeCorners(const GlobeRectangle& rectangle) {
+  return {
+      glm::dvec2(rectangle.getWest(), rectangle.getSouth()),
+      glm::dvec2(rectangle.getWest(), rectangle.getNorth()),
+      glm::dvec2(rectangle.getEast(), rectangle.getNorth()),
+      glm::dvec2(rectangle.getEast(), rectangle.getSouth())};
+}
+
+std::array<glm::dvec2, 4>
+computeEdges(const std::array<glm::dvec2, 4>& corners) {
+  return {
+      corners[1] - corners[0],
+      corners[2] - corners[1],
+      corners[3] - corners[2],
+      corners[0] - corners[3]};
+}
+
+// Determines if the segment from a to b intersects any edge of a rectangle,
+// exactly as CartographicPolygon does.
+bool segmentIntersectsRectangle(
+    const glm::dvec2& a,
+    const glm::dvec2& b,
+    const std::array<glm::dvec2, 4>& rectangleCorners,
+    const std::array<glm::dvec2, 4>& rectangleEdges) {
+  const glm::dvec2 ba = a - b;
+
+  for (size_t k = 0; k < 4; ++k) {
+    const glm::dvec2& cd = rectangleEdges[k];
+    const glm::dmat2 lineSegmentMatrix(cd, ba);
+    const glm::dvec2 ca = a - rectangleCorners[k];
+
+    // s and t are calculated such that:
+    // line_intersection = a + t * ab = c + s * cd
+    const glm::dvec2 st = glm::inverse(lineSegmentMatrix) * ca;
+
+    // check that the intersection is within the line segments
+    if (st.x <= 1.0 && st.x >= 0.0 && st.y <= 1.0 && st.y >= 0.0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+struct Triangle {
+  uint32_t polygon;
+  glm::dvec2 a;
+  glm::dvec2 b;
+  glm::dvec2 c;
+};
+
+struct Edge {
+  uint32_t polygon;
+  glm::dvec2 a;
+  glm::dvec2 b;
+};
+
+struct Point {
+  uint32_t polygon;
+  glm::dvec2 position;
+};
+
+// Counts the items in each cell, then calls store(item, slot) for every cell
+// an item overlaps, with slots grouped by cell. Returns the offset of the first
+// slot of each cell, followed by the total number of slots.
+template <typename Item, typename GetCellRange, typename Resize, typename Store>
+std::vector<uint32_t> sortIntoCells(
+    const std::vector<Item>& items,
+    size_t cellCount,
+    uint32_t columns,
+    GetCellRange&& getCellRange,
+    Resize&& resize,
+    Store&& store) {
+  std::vector<uint32_t> offsets(cellCount + 1, 0);
+  for (const Item& item : items) {
+    const auto range = getCellRange(item);
+    for (uint32_t row = range.south; row <= range.north; ++row) {
+      for (uint32_t column = range.west; column <= range.east; ++column) {
+        ++offsets[size_t(row) * columns + column + 1];
+      }
+    }
+  }
+
+  for (size_t i = 1; i < offsets.size(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+
+  resize(size_t(offsets.back()));
+
+  std::vector<uint32_t> next(offsets.begin(), offsets.end() - 1);
+  for (const Item& item : items) {
+    const auto range = getCellRange(item);
+    for (uint32_t row = range.south; row <= range.north; ++row) {
+      for (uint32_t column = range.west; column <= range.east; ++column) {
+        store(item, size_t(next[size_t(row) * columns + column]++));
+      }
+    }
+  }
+
+  return offsets;
+}
+
+// Calls callback(i) for every item in the cells of a range, stopping when it
+// returns true. Returns true if it stopped early.
+template <typename CellRange, typename Callback>
+bool forEachItemInCells(
+    const std::vector<uint32_t>& offsets,
+    uint32_t columns,
+    const CellRange& range,
+    Callback&& callback) {
+  for (uint32_t row = range.south; row <= range.north; ++row) {
+    for (uint32_t column = range.west; column <= range.east; ++column) {
+      const size_t cell = size_t(row) * columns + column;
+      for (size_t i = offsets[cell]; i < offsets[cell + 1]; ++i) {
+        if (callback(i)) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+} // namespace
+
+CartographicPolygonIndex::CartographicPolygonIndex() noexcept
+    : _boundingRectangles(),
+      _gridWest(0.0),
+      _gridSouth(0.0),
+      _gridEast(0.0),
+      _gridNorth(0.0),
+      _inverseCellWidth(0.0),
+      _inverseCellHeight(0.0),
+      _gridColumns(0),
+      _gridRows(0) {}
+
+CartographicPolygonIndex::CartographicPolygonIndex(
+    const std::vector<CartographicPolygon>& polygons)
+    : CartographicPolygonIndex() {
+  std::vector<Triangle> triangles;
+  std::vector<Edge> edges;
+  std::vector<Point> points;
+
+  double west = std::numeric_limits<double>::max();
+  double south = std::numeric_limits<double>::max();
+  double east = std::numeric_limits<double>::lowest();
+  double north = std::numeric_limits<double>::lowest();
+
+  this->_boundingRectangles.reserve(polygons.size());
+  for (size_t i = 0; i < polygons.size(); ++i) {
+    const CartographicPolygon& polygon = polygons[i];
+    this->_boundingRectangles.emplace_back(polygon.getBoundingRectangle());
+    if (!polygon.getBoundingRectangle()) {
+      continue;
+    }
+
+    const uint32_t polygonIndex = uint32_t(i);
+    const std::vector<glm::dvec2>& vertices = polygon.getVertices();
+    const std::vector<uint32_t>& indices = polygon.getIndices();
+
+    for (size_t j = 2; j < indices.size(); j += 3) {
+      triangles.emplace_back(Triangle{
+          polygonIndex,
+          vertices[indices[j - 2]],
+          vertices[indices[j - 1]],
+          vertices[indices[j]]});
+    }
+
+    for (size_t j = 0; j < vertices.size(); ++j) {
+      const glm::dvec2& vertex = vertices[j];
+      edges.emplace_back(
+          Edge{polygonIndex, vertex, vertices[(j + 1) % vertices.size()]});
+
+      west = glm::min(west, vertex.x);
+      south = glm::min(south, vertex.y);
+      east = glm::max(east, vertex.x);
+      north = glm::max(north, vertex.y);
+    }
+
+    points.emplace_back(Point{polygonIndex, vertices[0]});
+  }
+
+  if (points.empty()) {
+    return;
+  }
+
+  // Choose roughly square cells, with a few triangles and edges in each.
+  const double width = east - west;
+  const double height = north - south;
+  const double targetCells = glm::max(
+      1.0,
+      double(triangles.size() + edges.size()) / double(itemsPerCell));
+  const double maximumDimension = double(maximumGridDimension);
+
+  double columns = 1.0;
+  double rows = 1.0;
+  if (width > 0.0 && height > 0.0) {
+    columns = glm::round(glm::sqrt(targetCells * width / height));
+    columns = glm::clamp(columns, 1.0, maximumDimension);
+    rows = glm::clamp(glm::ceil(targetCells / columns), 1.0, maximumDimension);
+  } else if (width > 0.0) {
+    columns = glm::clamp(glm::ceil(targetCells), 1.0, maximumDimension);
+  } else if (height > 0.0) {
+    rows = glm::clamp(glm::ceil(targetCells), 1.0, maximumDimension);
+  }
+
+  this->_gridWest = west;
+  this->_gridSouth = south;
+  this->_gridEast = east;
+  this->_gridNorth = north;
+  this->_gridColumns = uint32_t(columns);
+  this->_gridRows = uint32_t(rows);
+  this->_inverseCellWidth = width > 0.0 ? columns / width : 0.0;
+  this->_inverseCellHeight = height > 0.0 ? rows / height : 0.0;
+
+  const size_t cellCount = size_t(this->_gridColumns) * this->_gridRows;
+
+  auto getRange = [this](double x0, double y0, double x1, double y1) {
+    const std::optional<CellRange> maybeRange = this->getCellRange(
+        glm::min(x0, x1),
+        glm::min(y0, y1),
+        glm::max(x0, x1),
+        glm::max(y0, y1));
+    // Every item is within the grid, by construction.
+    return maybeRange.value_or(CellRange{0, 0, 0, 0});
+  };
+
+  this->_triangleCellOffsets = sortIntoCells(
+      triangles,
+      cellCount,
+      this->_gridColumns,
+      [&getRange](const Triangle& triangle) {
+        return getRange(
+            glm::min(glm::min(triangle.a.x, triangle.b.x), triangle.c.x),
+            glm::min(glm::min(triangle.a.y, triangle.b.y), triangle.c.y),
+            glm::max(glm::max(triangle.a.x, triangle.b.x), triangle.c.x),
+            glm::max(glm::max(triangle.a.y, triangle.b.y), triangle.c.y));
+      },
+      [this](size_t count) {
+        this->_triangleAX.resize(count);
+        this->_triangleAY.resize(count);
+        this->_triangleCX.resize(count);
+        this->_triangleCY.resize(count);
+        this->_triangleABPerpX.resize(count);
+        this->_triangleABPerpY.resize(count);
+        this->_triangleBCPerpX.resize(count);
+        this->_triangleBCPerpY.resize(count);
+        this->_triangleCAPerpX.resize(count);
+        this->_triangleCAPerpY.resize(count);
+        this->_trianglePolygons.resize(count);
+      },
+      [this](const Triangle& triangle, size_t slot) {
+        // The same quantities IntersectionTests::pointInTriangle computes.
+        const glm::dvec2 ab = triangle.b - triangle.a;
+        const glm::dvec2 bc = triangle.c - triangle.b;
+        const glm::dvec2 ca = triangle.a - triangle.c;
+        this->_triangleAX[slot] = triangle.a.x;
+        this->_triangleAY[slot] = triangle.a.y;
+        this->_triangleCX[slot] = triangle.c.x;
+        this->_triangleCY[slot] = triangle.c.y;
+        this->_triangleABPerpX[slot] = -ab.y;
+        this->_triangleABPerpY[slot] = ab.x;
+        this->_triangleBCPerpX[slot] = -bc.y;
+        this->_triangleBCPerpY[slot] = bc.x;
+        this->_triangleCAPerpX[slot] = -ca.y;
+        this->_triangleCAPerpY[slot] = ca.x;
+        this->_trianglePolygons[slot] = triangle.polygon;
+      });
+
+  this->_edgeCellOffsets = sortIntoCells(
+      edges,
+      cellCount,
+      this->_gridColumns,
+      [&getRange](const Edge& edge) {
+        return getRange(edge.a.x, edge.a.y, edge.b.x, edge.b.y);
+      },
+      [this](size_t count) {
+        this->_edgeA.resize(count);
+        this->_edgeB.resize(count);
+        this->_edgePolygons.resize(count);
+      },
+      [this](const Edge& edge, size_t slot) {
+        this->_edgeA[slot] = edge.a;
+        this->_edgeB[slot] = edge.b;
+        this->_edgePolygons[slot] = edge.polygon;
+      });
+
+  this->_pointCellOffsets = sortIntoCells(
+      points,
+      cellCount,
+      this->_gridColumns,
+      [&getRange](const Point& point) {
+        return getRange(
+            point.position.x,
+            point.position.y,
+            point.position.x,
+            point.position.y);
+      },
+      [this](size_t count) {
+        this->_points.resize(count);
+        this->_pointPolygons.resize(count);
+      },
+      [this](const Point& point, size_t slot) {
+        this->_points[slot] = point.position;
+        this->_pointPolygons[slot] = point.polygon;
+      });
+}
+
+bool CartographicPolygonIndex::rectangleIsWithinPolygons(
+    const GlobeRectangle& rectangle) const noexcept {
+  const std::array<glm::dvec2, 4> rectangleCorners = computeCorners(rectangle);
+
+  // The polygons containing an arbitrary point on the rectangle. The rectangle
+  // is within any of these whose perimeter does not cross the rectangle edges.
+  std::vector<uint32_t> candidates;
+  this->forEachTriangleContaining(rectangleCorners[0], [&](uint32_t polygon) {
+    if (std::find(candidates.begin(), candidates.end(), polygon) ==
+            candidates.end() &&
+        this->boundingRectangleIntersects(polygon, rectangle)) {
+      candidates.push_back(polygon);
+    }
+    return false;
+  });
+
+  if (candidates.empty()) {
+    return false;
+  }
+
+  // Only perimeter edges in the cells under the rectangle can cross its edges.
+  const std::optional<CellRange> maybeRange = this->getCellRange(
+      glm::min(rectangle.getWest(), rectangle.getEast()),
+      glm::min(rectangle.getSouth(), rectangle.getNorth()),
+      glm::max(rectangle.getWest(), rectangle.getEast()),
+      glm::max(rectangle.getSouth(), rectangle.getNorth()));
+  if (!maybeRange) {
+    return true;
+  }
+
+  const std::array<glm::dvec2, 4> rectangleEdges =
+      computeEdges(rectangleCorners);
+  const bool allCandidatesCrossed = forEachItemInCells(
+      this->_edgeCellOffsets,
+      this->_gridColumns,
+      *maybeRange,
+      [&](size_t i) {
+        auto it = std::find(
+            candidates.begin(),
+            candidates.end(),
+            this->_edgePolygons[i]);
+        if (it != candidates.end() &&
+            segmentIntersectsRectangle(
+                this->_edgeA[i],
+                this->_edgeB[i],
+                rectangleCorners,
+                rectangleEdges)) {
+          candidates.erase(it);
+        }
+        return candidates.empty();
+      });
+
+  return !allCandidatesCrossed;
+}
+
+bool CartographicPolygonIndex::rectangleIsOutsidePolygons(
+    const GlobeRectangle& rectangle) const noexcept {
+  const std::array<glm::dvec2, 4> rectangleCorners = computeCorners(rectangle);
+  const std::optional<CellRange> maybeRange = this->getCellRange(
+      glm::min(rectangle.getWest(), rectangle.getEast()),
+      glm::min(rectangle.getSouth(), rectangle.getNorth()),
+      glm::max(rectangle.getWest(), rectangle.getEast()),
+      glm::max(rectangle.getSouth(), rectangle.getNorth()));
+
+  // Check if an arbitrary point on any polygon is in the globe rectangle.
+  if (maybeRange && forEachItemInCells(
+                        this->_pointCellOffsets,
+                        this->_gridColumns,
+                        *maybeRange,
+                        [&](size_t i) {
+                          const glm::dvec2& point = this->_points[i];
+                          return (IntersectionTests::pointInTriangle(
+                                      point,
+                                      rectangleCorners[0],
+                                      rectangleCorners[1],
+                                      rectangleCorners[2]) ||
+                                  IntersectionTests::pointInTriangle(
+                                      point,
+                                      rectangleCorners[0],
+                                      rectangleCorners[2],
+                                      rectangleCorners[3])) &&
+                                 this->boundingRectangleIntersects(
+                                     this->_pointPolygons[i],
+                                     rectangle);
+                        })) {
+    return false;
+  }
+
+  // Check if an arbitrary point on the bounding globe rectangle is inside any
+  // polygon.
+  if (this->forEachTriangleContaining(
+          rectangleCorners[0],
+          [&](uint32_t polygon) {
+            return this->boundingRectangleIntersects(polygon, rectangle);
+          })) {
+    return false;
+  }
+
+  if (!maybeRange) {
+    return true;
+  }
+
+  // Check if any polygon perimeter intersects the bounding globe rectangle
+  // edges.
+  const std::array<glm::dvec2, 4> rectangleEdges =
+      computeEdges(rectangleCorners);
+  return !forEachItemInCells(
+      this->_edgeCellOffsets,
+      this->_gridColumns,
+      *maybeRange,
+      [&](size_t i) {
+        return segmentIntersectsRectangle(
+                   this->_edgeA[i],
+                   this->_edgeB[i],
+                   rectangleCorners,
+                   rectangleEdges) &&
+               this->boundingRectangleIntersects(
+                   this->_edgePolygons[i],
+                   rectangle);
+      });
+}
+
+std::optional<CartographicPolygonIndex::CellRange>
+CartographicPolygonIndex::getCellRange(
+    double west,
+    double south,
+    double east,
+    double north) const noexcept {
+  if (this->_gridColumns == 0 ||
+      !(east >= this->_gridWest && west <= this->_gridEast &&
+        north >= this->_gridSouth && south <= this->_gridNorth)) {
+    return std::nullopt;
+  }
+
+  auto column = [this](double longitude) {
+    const double cell = (longitude - this->_gridWest) * this->_inverseCellWidth;
+    return uint32_t(glm::clamp(cell, 0.0, double(this->_gridColumns - 1)));
+  };
+  auto row = [this](double latitude) {
+    const double cell =
+        (latitude - this->_gridSouth) * this->_inverseCellHeight;
+    return uint32_t(glm::clamp(cell, 0.0, double(this->_gridRows - 1)));
+  };
+
+  return CellRange{column(west), row(south), column(east), row(north)};
+}
+
+bool CartographicPolygonIndex::boundingRectangleIntersects(
+    uint32_t polygon,
+    const GlobeRectangle& rectangle) const noexcept {
+  const std::optional<GlobeRectangle>& boundingRectangle =
+      this->_boundingRectangles[polygon];
+  return boundingRectangle &&
+         rectangle.computeIntersection(*boundingRectangle).has_value();
+}
+
+template <typename Callback>
+bool CartographicPolygonIndex::forEachTriangleContaining(
+    const glm::dvec2& point,
+    Callback&& callback) const {
+  const std::optional<CellRange> maybeRange =
+      this->getCellRange(point.x, point.y, point.x, point.y);
+  if (!maybeRange) {
+    return false;
+  }
+
+  const size_t cell =
+      size_t(maybeRange->south) * this->_gridColumns + maybeRange->west;
+  const size_t begin = this->_triangleCellOffsets[cell];
+  const size_t end = this->_triangleCellOffsets[cell + 1];
+
+  for (size_t blockBegin = begin; blockBegin < end;
+       blockBegin += batchLanes) {
+    const size_t count = std::min(batchLanes, end - blockBegin);
+
+    // Test a block of triangles at once, the same way as
+    // IntersectionTests::pointInTriangle.
+    std::array<uint8_t, batchLanes> inside{};
+    for (size_t lane = 0; lane < count; ++lane) {
+      const size_t i = blockBegin + lane;
+      const double avX = point.x - this->_triangleAX[i];
+      const double avY = point.y - this->_triangleAY[i];
+      const double cvX = point.x - this->_triangleCX[i];
+      const double cvY = point.y - this->_triangleCY[i];
+
+      const double abProjection = avX * this->_triangleABPerpX[i] +
+                                  avY * this->_triangleABPerpY[i];
+      const double bcProjection = cvX * this->_triangleBCPerpX[i] +
+                                  cvY * this->_triangleBCPerpY[i];
+      const double caProjection = cvX * this->_triangleCAPerpX[i] +
+                                  cvY * this->_triangleCAPerpY[i];
+
+      const bool allNonNegative = abProjection >= 0.0 && caProjection >= 0.0 &&
+                                  bcProjection >= 0.0;
+      const bool allNonPositive = abProjection <= 0.0 && caProjection <= 0.0 &&
+                                  bcProjection <= 0.0;
+      inside[lane] = uint8_t(allNonNegative || allNonPositive);
+    }
+
+    for (size_t lane = 0; lane < count; ++lane) {
+      if (inside[lane] &&
+          callback(this->_trianglePolygons[blockBegin + lane])) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+} // namespace CesiumGeospatial
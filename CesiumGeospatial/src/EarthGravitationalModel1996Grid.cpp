@@ -1,14 +1,35 @@
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/EarthGravitationalModel1996Grid.h>
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <fstream>
+#include <ios>
+#include <memory>
 #include <optional>
 #include <span>
+#include <string>
 #include <utility>
 #include <vector>
 
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 using namespace CesiumUtility;
 
 namespace CesiumGeospatial {
@@ -26,6 +47,153 @@ constexpr size_t NUM_COLUMNS = 1440;
 constexpr size_t TOTAL_VALUES = NUM_ROWS * NUM_COLUMNS;
 constexpr size_t TOTAL_BYTES = TOTAL_VALUES * sizeof(int16_t);
 
+size_t computeVerticalIndex(double latitude) {
+  const double clampedLatitude =
+      Math::clamp(latitude, -Math::PiOverTwo, Math::PiOverTwo);
+  return static_cast<size_t>(
+      ((NUM_ROWS - 1) * (Math::PiOverTwo - clampedLatitude)) / Math::OnePi);
+}
+
+/**
+ * @brief A read-only view of a whole file, memory-mapped where the platform
+ * supports it.
+ */
+class MappedFile {
+public:
+  static std::shared_ptr<MappedFile> open(const std::string& path);
+
+  ~MappedFile() noexcept;
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  std::span<const std::byte> data() const noexcept {
+    return std::span<const std::byte>(this->_pData, this->_size);
+  }
+
+private:
+  MappedFile() = default;
+
+  const std::byte* _pData = nullptr;
+  size_t _size = 0;
+#if defined(_WIN32)
+  HANDLE _file = INVALID_HANDLE_VALUE;
+  HANDLE _mapping = nullptr;
+#elif !defined(__EMSCRIPTEN__)
+  void* _pMapping = nullptr;
+#else
+  std::vector<std::byte> _contents;
+#endif
+};
+
+std::shared_ptr<MappedFile> MappedFile::open(const std::string& path) {
+  std::shared_ptr<MappedFile> pResult(new MappedFile());
+
+#if defined(_WIN32)
+  pResult->_file = CreateFileA(
+      path.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+  if (pResult->_file == INVALID_HANDLE_VALUE) {
+    return nullptr;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(pResult->_file, &size) || size.QuadPart <= 0) {
+    return nullptr;
+  }
+
+  pResult->_mapping = CreateFileMappingA(
+      pResult->_file,
+      nullptr,
+      PAGE_READONLY,
+      0,
+      0,
+      nullptr);
+  if (pResult->_mapping == nullptr) {
+    return nullptr;
+  }
+
+  const void* pView = MapViewOfFile(pResult->_mapping, FILE_MAP_READ, 0, 0, 0);
+  if (pView == nullptr) {
+    return nullptr;
+  }
+
+  pResult->_pData = static_cast<const std::byte*>(pView);
+  pResult->_size = static_cast<size_t>(size.QuadPart);
+#elif !defined(__EMSCRIPTEN__)
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+
+  struct stat fileStat{};
+  if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+
+  const size_t size = static_cast<size_t>(fileStat.st_size);
+  void* pMapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+
+  if (pMapping == MAP_FAILED) {
+    return nullptr;
+  }
+
+  pResult->_pMapping = pMapping;
+  pResult->_pData = static_cast<const std::byte*>(pMapping);
+  pResult->_size = size;
+#else
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return nullptr;
+  }
+
+  const std::streamsize size = file.tellg();
+  if (size <= 0) {
+    return nullptr;
+  }
+
+  pResult->_contents.resize(static_cast<size_t>(size));
+  file.seekg(0, std::ios::beg);
+  if (!file.read(
+          reinterpret_cast<char*>(pResult->_contents.data()),
+          size)) {
+    return nullptr;
+  }
+
+  pResult->_pData = pResult->_contents.data();
+  pResult->_size = pResult->_contents.size();
+#endif
+
+  return pResult;
+}
+
+MappedFile::~MappedFile() noexcept {
+#if defined(_WIN32)
+  if (this->_pData != nullptr) {
+    UnmapViewOfFile(this->_pData);
+  }
+  if (this->_mapping != nullptr) {
+    CloseHandle(this->_mapping);
+  }
+  if (this->_file != INVALID_HANDLE_VALUE) {
+    CloseHandle(this->_file);
+  }
+#elif !defined(__EMSCRIPTEN__)
+  if (this->_pMapping != nullptr) {
+    munmap(this->_pMapping, this->_size);
+  }
+#endif
+}
+
 } // namespace
 
 std::optional<EarthGravitationalModel1996Grid>
@@ -36,32 +204,115 @@ CesiumGeospatial::EarthGravitationalModel1996Grid::fromBuffer(
     return std::nullopt;
   }
 
-  std::vector<int16_t> gridValues;
-  gridValues.resize(TOTAL_VALUES);
+  // WW15MGH.DAC is in big endian. Keep it that way, so that this and a
+  // memory-mapped file are sampled identically.
+  std::shared_ptr<std::vector<std::byte>> pGridValues =
+      std::make_shared<std::vector<std::byte>>(
+          buffer.begin(),
+          buffer.begin() + TOTAL_BYTES);
+  const std::span<const std::byte> values(*pGridValues);
 
-  const std::byte* pRead = buffer.data();
-  std::byte* pWrite = reinterpret_cast<std::byte*>(gridValues.data());
+  return EarthGravitationalModel1996Grid(std::move(pGridValues), values);
+}
 
-  for (size_t i = 0; i < TOTAL_BYTES; i += 2) {
-    // WW15MGH.DAC is in big endian, so we swap the bytes
-    pWrite[i] = pRead[i + 1];
-    pWrite[i + 1] = pRead[i];
+std::optional<EarthGravitationalModel1996Grid>
+EarthGravitationalModel1996Grid::fromMemoryMappedFile(const std::string& path) {
+  std::shared_ptr<MappedFile> pFile = MappedFile::open(path);
+  if (!pFile || pFile->data().size_bytes() < TOTAL_BYTES) {
+    // Not enough data - is this a valid WW15MGH.DAC?
+    return std::nullopt;
   }
 
-  return EarthGravitationalModel1996Grid(std::move(gridValues));
+  const std::span<const std::byte> values = pFile->data().first(TOTAL_BYTES);
+  return EarthGravitationalModel1996Grid(std::move(pFile), values);
 }
 
 double EarthGravitationalModel1996Grid::sampleHeight(
     const Cartographic& position) const {
-  const double longitude = Math::zeroToTwoPi(position.longitude);
-  const double latitude =
-      Math::clamp(position.latitude, -Math::PiOverTwo, Math::PiOverTwo);
+  return this->sampleHeight(position.longitude, position.latitude);
+}
+
+void EarthGravitationalModel1996Grid::sampleHeights(
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<double> heights,
+    bool sortByGridCell) const {
+  CESIUM_ASSERT(latitudes.size() == longitudes.size());
+  CESIUM_ASSERT(heights.size() == longitudes.size());
+
+  const size_t count =
+      std::min({longitudes.size(), latitudes.size(), heights.size()});
+
+  if (!sortByGridCell) {
+    for (size_t i = 0; i < count; ++i) {
+      heights[i] = this->sampleHeight(longitudes[i], latitudes[i]);
+    }
+    return;
+  }
+
+  // Counting sort of the positions by grid row. Each sample reads two
+  // adjacent rows, so visiting the rows in order reads the grid front to back.
+  std::vector<uint16_t> rows(count);
+  std::vector<size_t> rowStarts(NUM_ROWS + 1, 0);
+  for (size_t i = 0; i < count; ++i) {
+    const size_t row = computeVerticalIndex(latitudes[i]);
+    rows[i] = static_cast<uint16_t>(row);
+    ++rowStarts[row + 1];
+  }
+
+  for (size_t row = 1; row <= NUM_ROWS; ++row) {
+    rowStarts[row] += rowStarts[row - 1];
+  }
+
+  std::vector<size_t> order(count);
+  for (size_t i = 0; i < count; ++i) {
+    order[rowStarts[rows[i]]++] = i;
+  }
+
+  for (const size_t i : order) {
+    heights[i] = this->sampleHeight(longitudes[i], latitudes[i]);
+  }
+}
+
+void EarthGravitationalModel1996Grid::sampleHeights(
+    std::span<const Cartographic> positions,
+    std::span<double> heights,
+    bool sortByGridCell) const {
+  CESIUM_ASSERT(heights.size() == positions.size());
+
+  const size_t count = std::min(positions.size(), heights.size());
+  std::vector<double> longitudes(count);
+  std::vector<double> latitudes(count);
+  for (size_t i = 0; i < count; ++i) {
+    longitudes[i] = positions[i].longitude;
+    latitudes[i] = positions[i].latitude;
+  }
 
-  const double horizontalIndexDecimal = (NUM_COLUMNS * longitude) / Math::TwoPi;
+  this->sampleHeights(
+      longitudes,
+      latitudes,
+      heights.first(count),
+      sortByGridCell);
+}
+
+EarthGravitationalModel1996Grid::EarthGravitationalModel1996Grid(
+    std::shared_ptr<const void>&& pStorage,
+    std::span<const std::byte> bigEndianValues)
+    : _pStorage(std::move(pStorage)), _bigEndianValues(bigEndianValues) {}
+
+double EarthGravitationalModel1996Grid::sampleHeight(
+    double longitude,
+    double latitude) const {
+  const double wrappedLongitude = Math::zeroToTwoPi(longitude);
+  const double clampedLatitude =
+      Math::clamp(latitude, -Math::PiOverTwo, Math::PiOverTwo);
+
+  const double horizontalIndexDecimal =
+      (NUM_COLUMNS * wrappedLongitude) / Math::TwoPi;
   const size_t horizontalIndex = static_cast<size_t>(horizontalIndexDecimal);
 
   const double verticalIndexDecimal =
-      ((NUM_ROWS - 1) * (Math::PiOverTwo - latitude)) / Math::OnePi;
+      ((NUM_ROWS - 1) * (Math::PiOverTwo - clampedLatitude)) / Math::OnePi;
   const size_t verticalIndex = static_cast<size_t>(verticalIndexDecimal);
 
   // Get the normalized position of the coordinates within the grid tile
@@ -84,10 +335,6 @@ double EarthGravitationalModel1996Grid::sampleHeight(
   return result;
 }
 
-EarthGravitationalModel1996Grid::EarthGravitationalModel1996Grid(
-    std::vector<int16_t>&& gridValues)
-    : _gridValues(gridValues) {}
-
 double EarthGravitationalModel1996Grid::getHeightForIndices(
     const size_t horizontal,
     const size_t vertical) const {
@@ -97,8 +344,15 @@ double EarthGravitationalModel1996Grid::getHeightForIndices(
     clampedVertical = NUM_ROWS - 1;
   }
 
-  const size_t index = clampedVertical * NUM_COLUMNS + horizontal;
-  const double result = _gridValues[index] / 100.0;
+  // The grid wraps around at 360E.
+  const size_t wrappedHorizontal = horizontal % NUM_COLUMNS;
+
+  const size_t index =
+      (clampedVertical * NUM_COLUMNS + wrappedHorizontal) * sizeof(int16_t);
+  const int16_t value = static_cast<int16_t>(
+      (std::to_integer<uint16_t>(this->_bigEndianValues[index]) << 8) |
+      std::to_integer<uint16_t>(this->_bigEndianValues[index + 1]));
+  const double result = value / 100.0;
 
   return result;
 }
@@ -1,5 +1,6 @@
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 #include <glm/common.hpp>
@@ -7,11 +8,145 @@
 #include <glm/geometric.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
+#include <limits>
 #include <optional>
+#include <span>
 
 using namespace CesiumUtility;
 
+namespace {
+
+// The batch conversions below process positions in blocks of this many lanes.
+// The per-lane loops have no dependencies between lanes, so the compiler can
+// turn each of them into a handful of SIMD instructions.
+constexpr size_t batchLanes = 8;
+
+constexpr double quietNaN = std::numeric_limits<double>::quiet_NaN();
+
+/**
+ * @brief Scales up to `batchLanes` positions to the geodetic surface of an
+ * ellipsoid, running the Newton iteration of
+ * `Ellipsoid::scaleToGeodeticSurface` for all of them in lockstep.
+ *
+ * Positions near the center of the ellipsoid are not iterated, exactly like
+ * the single-position version. Positions at the center produce NaN.
+ */
+void scaleBlockToGeodeticSurface(
+    const glm::dvec3& oneOverRadii,
+    const glm::dvec3& oneOverRadiiSquared,
+    double centerToleranceSquared,
+    size_t count,
+    const double* pX,
+    const double* pY,
+    const double* pZ,
+    double* pResultX,
+    double* pResultY,
+    double* pResultZ) noexcept {
+  CESIUM_ASSERT(count <= batchLanes);
+
+  double x[batchLanes];
+  double y[batchLanes];
+  double z[batchLanes];
+
+  // Unused lanes are filled with a position that is already on the surface,
+  // so they converge immediately.
+  for (size_t i = 0; i < batchLanes; ++i) {
+    x[i] = i < count ? pX[i] : 1.0 / oneOverRadii.x;
+    y[i] = i < count ? pY[i] : 0.0;
+    z[i] = i < count ? pZ[i] : 0.0;
+  }
+
+  double x2[batchLanes];
+  double y2[batchLanes];
+  double z2[batchLanes];
+  double ratio[batchLanes];
+  double lambda[batchLanes];
+  bool nearCenter[batchLanes];
+
+  for (size_t i = 0; i < batchLanes; ++i) {
+    x2[i] = x[i] * x[i] * oneOverRadii.x * oneOverRadii.x;
+    y2[i] = y[i] * y[i] * oneOverRadii.y * oneOverRadii.y;
+    z2[i] = z[i] * z[i] * oneOverRadii.z * oneOverRadii.z;
+
+    const double squaredNorm = x2[i] + y2[i] + z2[i];
+    ratio[i] = std::sqrt(1.0 / squaredNorm);
+    nearCenter[i] = squaredNorm < centerToleranceSquared;
+
+    // Use the gradient at the radial intersection point in place of the true
+    // unit normal to compute the initial guess at the multiplier.
+    const double gradientX = x[i] * ratio[i] * oneOverRadiiSquared.x * 2.0;
+    const double gradientY = y[i] * ratio[i] * oneOverRadiiSquared.y * 2.0;
+    const double gradientZ = z[i] * ratio[i] * oneOverRadiiSquared.z * 2.0;
+    const double length = std::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    const double gradientLength = std::sqrt(
+        gradientX * gradientX + gradientY * gradientY + gradientZ * gradientZ);
+    lambda[i] = ((1.0 - ratio[i]) * length) / (0.5 * gradientLength);
+
+    // The iteration will not converge for positions near the center, so
+    // iterate a position on the surface instead and discard the result.
+    if (nearCenter[i]) {
+      x2[i] = 1.0;
+      y2[i] = 0.0;
+      z2[i] = 0.0;
+      lambda[i] = 0.0;
+    }
+  }
+
+  double correction[batchLanes]{};
+  double xMultiplier[batchLanes];
+  double yMultiplier[batchLanes];
+  double zMultiplier[batchLanes];
+  double maxFunc;
+
+  do {
+    maxFunc = 0.0;
+
+    for (size_t i = 0; i < batchLanes; ++i) {
+      lambda[i] -= correction[i];
+
+      xMultiplier[i] = 1.0 / (1.0 + lambda[i] * oneOverRadiiSquared.x);
+      yMultiplier[i] = 1.0 / (1.0 + lambda[i] * oneOverRadiiSquared.y);
+      zMultiplier[i] = 1.0 / (1.0 + lambda[i] * oneOverRadiiSquared.z);
+
+      const double xMultiplier2 = xMultiplier[i] * xMultiplier[i];
+      const double yMultiplier2 = yMultiplier[i] * yMultiplier[i];
+      const double zMultiplier2 = zMultiplier[i] * zMultiplier[i];
+
+      const double func = x2[i] * xMultiplier2 + y2[i] * yMultiplier2 +
+                          z2[i] * zMultiplier2 - 1.0;
+
+      const double denominator =
+          x2[i] * xMultiplier2 * xMultiplier[i] * oneOverRadiiSquared.x +
+          y2[i] * yMultiplier2 * yMultiplier[i] * oneOverRadiiSquared.y +
+          z2[i] * zMultiplier2 * zMultiplier[i] * oneOverRadiiSquared.z;
+
+      correction[i] = func / (-2.0 * denominator);
+
+      // NaN lanes compare false here, so they do not keep the loop running.
+      const double absFunc = glm::abs(func);
+      maxFunc = absFunc > maxFunc ? absFunc : maxFunc;
+    }
+  } while (maxFunc > Math::Epsilon12);
+
+  for (size_t i = 0; i < count; ++i) {
+    if (nearCenter[i]) {
+      const bool finite = std::isfinite(ratio[i]);
+      pResultX[i] = finite ? x[i] * ratio[i] : quietNaN;
+      pResultY[i] = finite ? y[i] * ratio[i] : quietNaN;
+      pResultZ[i] = finite ? z[i] * ratio[i] : quietNaN;
+    } else {
+      pResultX[i] = x[i] * xMultiplier[i];
+      pResultY[i] = y[i] * yMultiplier[i];
+      pResultZ[i] = z[i] * zMultiplier[i];
+    }
+  }
+}
+
+} // namespace
+
 namespace CesiumGeospatial {
 
 const Ellipsoid Ellipsoid::WGS84(6378137.0, 6378137.0, 6356752.3142451793);
@@ -151,6 +286,144 @@ Ellipsoid::scaleToGeodeticSurface(const glm::dvec3& cartesian) const noexcept {
       positionZ * zMultiplier);
 }
 
+void Ellipsoid::cartographicToCartesian(
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<const double> heights,
+    std::span<glm::dvec3> result) const noexcept {
+  CESIUM_ASSERT(latitudes.size() == longitudes.size());
+  CESIUM_ASSERT(heights.size() == longitudes.size());
+  CESIUM_ASSERT(result.size() == longitudes.size());
+
+  const size_t count = std::min(
+      {longitudes.size(), latitudes.size(), heights.size(), result.size()});
+
+  double nx[batchLanes];
+  double ny[batchLanes];
+  double nz[batchLanes];
+
+  for (size_t start = 0; start < count; start += batchLanes) {
+    const size_t blockSize = std::min(batchLanes, count - start);
+
+    // The trigonometric functions are library calls, so compute them in their
+    // own pass and keep the remaining arithmetic free of calls.
+    for (size_t i = 0; i < blockSize; ++i) {
+      const double longitude = longitudes[start + i];
+      const double latitude = latitudes[start + i];
+      const double cosLatitude = std::cos(latitude);
+      nx[i] = cosLatitude * std::cos(longitude);
+      ny[i] = cosLatitude * std::sin(longitude);
+      nz[i] = std::sin(latitude);
+    }
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      const double kx = this->_radiiSquared.x * nx[i];
+      const double ky = this->_radiiSquared.y * ny[i];
+      const double kz = this->_radiiSquared.z * nz[i];
+      const double oneOverGamma =
+          1.0 / std::sqrt(nx[i] * kx + ny[i] * ky + nz[i] * kz);
+      const double height = heights[start + i];
+      result[start + i] = glm::dvec3(
+          kx * oneOverGamma + nx[i] * height,
+          ky * oneOverGamma + ny[i] * height,
+          kz * oneOverGamma + nz[i] * height);
+    }
+  }
+}
+
+void Ellipsoid::cartesianToCartographic(
+    std::span<const double> x,
+    std::span<const double> y,
+    std::span<const double> z,
+    std::span<double> longitudes,
+    std::span<double> latitudes,
+    std::span<double> heights) const noexcept {
+  CESIUM_ASSERT(y.size() == x.size() && z.size() == x.size());
+  CESIUM_ASSERT(longitudes.size() == x.size());
+  CESIUM_ASSERT(latitudes.size() == x.size() && heights.size() == x.size());
+
+  const size_t count = std::min(
+      {x.size(),
+       y.size(),
+       z.size(),
+       longitudes.size(),
+       latitudes.size(),
+       heights.size()});
+
+  double px[batchLanes];
+  double py[batchLanes];
+  double pz[batchLanes];
+
+  for (size_t start = 0; start < count; start += batchLanes) {
+    const size_t blockSize = std::min(batchLanes, count - start);
+
+    scaleBlockToGeodeticSurface(
+        this->_oneOverRadii,
+        this->_oneOverRadiiSquared,
+        this->_centerToleranceSquared,
+        blockSize,
+        x.data() + start,
+        y.data() + start,
+        z.data() + start,
+        px,
+        py,
+        pz);
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      const size_t index = start + i;
+      if (std::isnan(px[i])) {
+        longitudes[index] = quietNaN;
+        latitudes[index] = quietNaN;
+        heights[index] = quietNaN;
+        continue;
+      }
+
+      const glm::dvec3 p(px[i], py[i], pz[i]);
+      const glm::dvec3 cartesian(x[index], y[index], z[index]);
+      const glm::dvec3 n = this->geodeticSurfaceNormal(p);
+      const glm::dvec3 h = cartesian - p;
+
+      longitudes[index] = glm::atan(n.y, n.x);
+      latitudes[index] = glm::asin(n.z);
+      heights[index] = Math::sign(glm::dot(h, cartesian)) * glm::length(h);
+    }
+  }
+}
+
+void Ellipsoid::scaleToGeodeticSurface(
+    std::span<const double> x,
+    std::span<const double> y,
+    std::span<const double> z,
+    std::span<double> resultX,
+    std::span<double> resultY,
+    std::span<double> resultZ) const noexcept {
+  CESIUM_ASSERT(y.size() == x.size() && z.size() == x.size());
+  CESIUM_ASSERT(resultX.size() == x.size());
+  CESIUM_ASSERT(resultY.size() == x.size() && resultZ.size() == x.size());
+
+  const size_t count = std::min(
+      {x.size(),
+       y.size(),
+       z.size(),
+       resultX.size(),
+       resultY.size(),
+       resultZ.size()});
+
+  for (size_t start = 0; start < count; start += batchLanes) {
+    scaleBlockToGeodeticSurface(
+        this->_oneOverRadii,
+        this->_oneOverRadiiSquared,
+        this->_centerToleranceSquared,
+        std::min(batchLanes, count - start),
+        x.data() + start,
+        y.data() + start,
+        z.data() + start,
+        resultX.data() + start,
+        resultY.data() + start,
+        resultZ.data() + start);
+  }
+}
+
 std::optional<glm::dvec3> Ellipsoid::scaleToGeocentricSurface(
     const glm::dvec3& cartesian) const noexcept {
 
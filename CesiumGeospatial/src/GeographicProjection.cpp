@@ -3,10 +3,14 @@
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GeographicProjection.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Assert.h>
 
 #include <glm/ext/vector_double2.hpp>
 #include <glm/ext/vector_double3.hpp>
 
+#include <cstddef>
+#include <span>
+
 namespace CesiumGeospatial {
 
 GeographicProjection::GeographicProjection(const Ellipsoid& ellipsoid) noexcept
@@ -30,6 +34,22 @@ CesiumGeometry::Rectangle GeographicProjection::project(
   return CesiumGeometry::Rectangle(sw.x, sw.y, ne.x, ne.y);
 }
 
+void GeographicProjection::project(
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<double> x,
+    std::span<double> y) const noexcept {
+  CESIUM_ASSERT(latitudes.size() == longitudes.size());
+  CESIUM_ASSERT(x.size() == longitudes.size());
+  CESIUM_ASSERT(y.size() == longitudes.size());
+
+  const double semimajorAxis = this->_semimajorAxis;
+  for (size_t i = 0; i < longitudes.size(); ++i) {
+    x[i] = longitudes[i] * semimajorAxis;
+    y[i] = latitudes[i] * semimajorAxis;
+  }
+}
+
 Cartographic GeographicProjection::unproject(
     const glm::dvec2& projectedCoordinates) const noexcept {
   const double oneOverEarthSemimajorAxis = this->_oneOverSemimajorAxis;
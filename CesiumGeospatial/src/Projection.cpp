@@ -13,6 +13,7 @@
 #include <glm/ext/vector_double3.hpp>
 #include <glm/geometric.hpp>
 
+#include <span>
 #include <variant>
 
 namespace CesiumGeospatial {
@@ -34,6 +35,30 @@ projectPosition(const Projection& projection, const Cartographic& position) {
   return std::visit(Operation{position}, projection);
 }
 
+void projectPositions(
+    const Projection& projection,
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<double> x,
+    std::span<double> y) {
+  struct Operation {
+    std::span<const double> longitudes;
+    std::span<const double> latitudes;
+    std::span<double> x;
+    std::span<double> y;
+
+    void operator()(const GeographicProjection& geographic) noexcept {
+      geographic.project(longitudes, latitudes, x, y);
+    }
+
+    void operator()(const WebMercatorProjection& webMercator) noexcept {
+      webMercator.project(longitudes, latitudes, x, y);
+    }
+  };
+
+  std::visit(Operation{longitudes, latitudes, x, y}, projection);
+}
+
 Cartographic
 unprojectPosition(const Projection& projection, const glm::dvec3& position) {
   struct Operation {
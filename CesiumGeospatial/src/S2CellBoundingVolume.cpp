@@ -1,10 +1,12 @@
+#include "S2CellGeometry.h"
+
 #include <CesiumGeometry/CullingResult.h>
 #include <CesiumGeometry/Plane.h>
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/S2CellBoundingVolume.h>
-#include <CesiumUtility/Assert.h>
+#include <CesiumGeospatial/S2CellID.h>
 
 #include <glm/ext/matrix_double3x3.hpp>
 #include <glm/ext/vector_double3.hpp>
@@ -15,7 +17,6 @@
 #include <array>
 #include <cstddef>
 #include <limits>
-#include <optional>
 #include <span>
 
 using namespace CesiumGeometry;
@@ -26,6 +27,7 @@ namespace {
 // Computes bounding planes of the kDOP.
 std::array<Plane, 6> computeBoundingPlanes(
     const S2CellBoundingVolume& s2Cell,
+    const S2CellGeometry& geometry,
     const Ellipsoid& ellipsoid) {
   std::array<Plane, 6> planes;
   glm::dvec3 centerPoint = s2Cell.getCenter();
@@ -35,10 +37,7 @@ std::array<Plane, 6> computeBoundingPlanes(
   // - Get center point at maximum height of bounding volume.
   // - Create top plane from surface normal and top point.
   glm::dvec3 centerSurfaceNormal = ellipsoid.geodeticSurfaceNormal(centerPoint);
-  std::optional<Cartographic> maybeTopCartographic =
-      ellipsoid.cartesianToCartographic(centerPoint);
-  CESIUM_ASSERT(maybeTopCartographic);
-  Cartographic& topCartographic = *maybeTopCartographic;
+  Cartographic topCartographic = geometry.center;
   topCartographic.height = s2Cell.getMaximumHeight();
   glm::dvec3 top = ellipsoid.cartographicToCartesian(topCartographic);
   planes[0] = Plane(top, centerSurfaceNormal);
@@ -49,8 +48,7 @@ std::array<Plane, 6> computeBoundingPlanes(
   //   - Get distance from vertex to top plane
   // - Find longest distance from vertex to top plane
   // - Translate top plane by the distance
-  std::array<Cartographic, 4> verticesCartographic =
-      s2Cell.getCellID().getVertices();
+  std::array<Cartographic, 4> verticesCartographic = geometry.vertices;
   glm::dvec3 verticesCartesian[4];
 
   double maxDistance = 0;
@@ -144,16 +142,46 @@ S2CellBoundingVolume::S2CellBoundingVolume(
     double minimumHeight,
     double maximumHeight,
     const Ellipsoid& ellipsoid)
+    : S2CellBoundingVolume(
+          cellID,
+          S2CellGeometryCache::get(cellID),
+          minimumHeight,
+          maximumHeight,
+          ellipsoid) {}
+
+S2CellBoundingVolume::S2CellBoundingVolume(
+    const S2CellID& cellID,
+    const S2CellGeometry& geometry,
+    double minimumHeight,
+    double maximumHeight,
+    const Ellipsoid& ellipsoid)
     : _cellID(cellID),
       _minimumHeight(minimumHeight),
       _maximumHeight(maximumHeight) {
-  Cartographic result = this->_cellID.getCenter();
+  Cartographic result = geometry.center;
   result.height = (this->_minimumHeight + this->_maximumHeight) * 0.5;
   this->_center = ellipsoid.cartographicToCartesian(result);
-  this->_boundingPlanes = computeBoundingPlanes(*this, ellipsoid);
+  this->_boundingPlanes = computeBoundingPlanes(*this, geometry, ellipsoid);
   this->_vertices = computeVertices(this->_boundingPlanes);
 }
 
+std::array<S2CellBoundingVolume, 4>
+S2CellBoundingVolume::computeChildren(const Ellipsoid& ellipsoid) const {
+  const std::array<S2CellGeometry, 4> geometry =
+      S2CellGeometryCache::getChildren(this->_cellID);
+
+  auto createChild = [&](size_t index) {
+    return S2CellBoundingVolume(
+        this->_cellID.getChild(index),
+        geometry[index],
+        this->_minimumHeight,
+        this->_maximumHeight,
+        ellipsoid);
+  };
+
+  return {createChild(0), createChild(1), createChild(2), createChild(3)};
+}
+
 glm::dvec3 S2CellBoundingVolume::getCenter() const noexcept {
   return this->_center;
 }
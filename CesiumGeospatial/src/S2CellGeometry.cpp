@@ -0,0 +1,167 @@
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4100 4127 4309 4996)
+
+#define _CHAR_UNSIGNED
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#define _USE_MATH_DEFINES
+#endif
+
+#include <s2/r2rect.h>
+#include <s2/s2cell_id.h>
+#include <s2/s2coords.h>
+#include <s2/s2latlng.h>
+#include <s2/s2point.h>
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#include "S2CellGeometry.h"
+
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/S2CellID.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+using namespace CesiumGeospatial;
+
+using GoogleS2CellID = S2CellId;
+
+namespace {
+
+// Enough for the cells a loader thread visits while loading the tiles near
+// the camera, at about 200 bytes per cell including the cache's own nodes.
+constexpr size_t maximumCachedCells = 4096;
+
+Cartographic toCartographic(const S2Point& p) {
+  S2LatLng ll(p);
+  return Cartographic(ll.lng().radians(), ll.lat().radians(), 0.0);
+}
+
+// Computes the position at the given (s, t) coordinates on a face, the same
+// way S2 computes cell corners and centers.
+Cartographic toCartographic(int face, double s, double t) {
+  return toCartographic(S2::FaceUVtoXYZ(face, S2::STtoUV(s), S2::STtoUV(t)));
+}
+
+// Each thread has its own cache, so loader threads never wait for each other.
+// A thread that loads a tile usually also loads its children, so most lookups
+// hit the thread's own cache anyway.
+class Cache {
+public:
+  std::optional<S2CellGeometry> find(uint64_t id) {
+    auto it = this->_index.find(id);
+    if (it == this->_index.end()) {
+      return std::nullopt;
+    }
+
+    // Move the cell to the front of the recently-used list.
+    this->_entries.splice(this->_entries.begin(), this->_entries, it->second);
+    return it->second->second;
+  }
+
+  void insert(uint64_t id, const S2CellGeometry& geometry) {
+    auto it = this->_index.find(id);
+    if (it != this->_index.end()) {
+      this->_entries.splice(this->_entries.begin(), this->_entries, it->second);
+      return;
+    }
+
+    this->_entries.emplace_front(id, geometry);
+    this->_index.emplace(id, this->_entries.begin());
+
+    if (this->_entries.size() > maximumCachedCells) {
+      this->_index.erase(this->_entries.back().first);
+      this->_entries.pop_back();
+    }
+  }
+
+private:
+  using Entry = std::pair<uint64_t, S2CellGeometry>;
+
+  std::list<Entry> _entries;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> _index;
+};
+
+Cache& getCache() {
+  thread_local Cache cache;
+  return cache;
+}
+
+} // namespace
+
+S2CellGeometry S2CellGeometryCache::get(const S2CellID& cellID) {
+  Cache& cache = getCache();
+  std::optional<S2CellGeometry> maybeGeometry = cache.find(cellID.getID());
+  if (maybeGeometry) {
+    return *maybeGeometry;
+  }
+
+  const S2CellGeometry geometry{cellID.getCenter(), cellID.getVertices()};
+  cache.insert(cellID.getID(), geometry);
+  return geometry;
+}
+
+std::array<S2CellGeometry, 4>
+S2CellGeometryCache::getChildren(const S2CellID& cellID) {
+  const S2CellGeometry parent = S2CellGeometryCache::get(cellID);
+
+  const GoogleS2CellID cell(cellID.getID());
+  const int face = cell.face();
+  const R2Rect bound = cell.GetBoundST();
+
+  // The parent's corners, edge midpoints, and center form a 3x3 grid of the
+  // children's corners. Halving an (s, t) interval is exact, so these are the
+  // same positions that S2CellID::getVertices computes for each child.
+  const std::array<double, 3> s{
+      bound[0][0],
+      (bound[0][0] + bound[0][1]) * 0.5,
+      bound[0][1]};
+  const std::array<double, 3> t{
+      bound[1][0],
+      (bound[1][0] + bound[1][1]) * 0.5,
+      bound[1][1]};
+
+  const std::array<Cartographic, 9> grid{
+      parent.vertices[0],
+      toCartographic(face, s[1], t[0]),
+      parent.vertices[1],
+      toCartographic(face, s[0], t[1]),
+      parent.center,
+      toCartographic(face, s[2], t[1]),
+      parent.vertices[3],
+      toCartographic(face, s[1], t[2]),
+      parent.vertices[2]};
+
+  auto computeChild = [&](int index) {
+    // The order of the children depends on the orientation of the Hilbert
+    // curve, so find the child's quadrant from its bounds.
+    const GoogleS2CellID child = cell.child(index);
+    const R2Rect childBound = child.GetBoundST();
+    const size_t i = childBound[0][0] < s[1] ? 0 : 1;
+    const size_t j = childBound[1][0] < t[1] ? 0 : 1;
+
+    const S2CellGeometry geometry{
+        toCartographic(
+            face,
+            (s[i] + s[i + 1]) * 0.5,
+            (t[j] + t[j + 1]) * 0.5),
+        {grid[j * 3 + i],
+         grid[j * 3 + i + 1],
+         grid[(j + 1) * 3 + i + 1],
+         grid[(j + 1) * 3 + i]}};
+    getCache().insert(child.id(), geometry);
+    return geometry;
+  };
+
+  return {computeChild(0), computeChild(1), computeChild(2), computeChild(3)};
+}
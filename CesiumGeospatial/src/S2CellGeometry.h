@@ -0,0 +1,62 @@
+#pragma once
+
+#include <CesiumGeospatial/Cartographic.h>
+
+#include <array>
+
+namespace CesiumGeospatial {
+
+class S2CellID;
+
+/**
+ * @brief The longitude/latitude positions of the center and corners of an S2
+ * cell.
+ *
+ * These depend only on the cell, not on the heights or the ellipsoid of a
+ * bounding volume, so they can be shared by every volume for the same cell.
+ */
+struct S2CellGeometry {
+  /**
+   * @brief The center of the cell, as returned by {@link S2CellID::getCenter}.
+   */
+  Cartographic center;
+
+  /**
+   * @brief The corners of the cell, as returned by
+   * {@link S2CellID::getVertices}.
+   */
+  std::array<Cartographic, 4> vertices;
+};
+
+/**
+ * @brief A bounded cache of {@link S2CellGeometry}, keyed by cell ID.
+ *
+ * Each thread has its own cache, so it can be used from any thread without
+ * locking. When a thread's cache is full, its least recently used cells are
+ * evicted.
+ */
+class S2CellGeometryCache {
+public:
+  /**
+   * @brief Gets the geometry of a cell, computing it if it is not cached.
+   *
+   * @param cellID The cell.
+   * @return The geometry of the cell.
+   */
+  static S2CellGeometry get(const S2CellID& cellID);
+
+  /**
+   * @brief Gets the geometry of the four children of a cell.
+   *
+   * The children's corners and centers are derived from the parent's corners
+   * and center, so only the five new corners and four new centers are
+   * computed. The results are added to the cache.
+   *
+   * @param cellID The parent cell.
+   * @return The geometry of the children, in the order given by
+   * {@link S2CellID::getChild}.
+   */
+  static std::array<S2CellGeometry, 4> getChildren(const S2CellID& cellID);
+};
+
+} // namespace CesiumGeospatial
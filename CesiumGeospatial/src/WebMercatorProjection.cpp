@@ -3,6 +3,7 @@
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/WebMercatorProjection.h>
+#include <CesiumUtility/Assert.h>
 #include <CesiumUtility/Math.h>
 
 #include <glm/exponential.hpp>
@@ -10,6 +11,9 @@
 #include <glm/ext/vector_double3.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <cstddef>
+#include <span>
+
 namespace CesiumGeospatial {
 
 /*static*/ const double WebMercatorProjection::MAXIMUM_LATITUDE =
@@ -47,6 +51,26 @@ CesiumGeometry::Rectangle WebMercatorProjection::project(
   return CesiumGeometry::Rectangle(sw.x, sw.y, ne.x, ne.y);
 }
 
+void WebMercatorProjection::project(
+    std::span<const double> longitudes,
+    std::span<const double> latitudes,
+    std::span<double> x,
+    std::span<double> y) const noexcept {
+  CESIUM_ASSERT(latitudes.size() == longitudes.size());
+  CESIUM_ASSERT(x.size() == longitudes.size());
+  CESIUM_ASSERT(y.size() == longitudes.size());
+
+  const double semimajorAxis = this->_semimajorAxis;
+  for (size_t i = 0; i < longitudes.size(); ++i) {
+    x[i] = longitudes[i] * semimajorAxis;
+  }
+  for (size_t i = 0; i < latitudes.size(); ++i) {
+    y[i] = WebMercatorProjection::geodeticLatitudeToMercatorAngle(
+               latitudes[i]) *
+           semimajorAxis;
+  }
+}
+
 Cartographic WebMercatorProjection::unproject(
     const glm::dvec2& projectedCoordinates) const noexcept {
   const double oneOverEarthSemimajorAxis = this->_oneOverSemimajorAxis;
@@ -0,0 +1,107 @@
+#include "RandomGeospatialData.h"
+
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Math.h>
+
+#include <glm/ext/vector_double2.hpp>
+#include <glm/ext/vector_double3.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+
+namespace CesiumNativeTests {
+
+SoaPositions createRandomCartesians(size_t count, uint32_t seed) {
+  std::default_random_engine rand(seed);
+  std::uniform_real_distribution<double> longitudeDist(
+      -Math::OnePi,
+      Math::OnePi);
+  std::uniform_real_distribution<double> latitudeDist(
+      -Math::PiOverTwo,
+      Math::PiOverTwo);
+  std::uniform_real_distribution<double> heightDist(-6000000.0, 20000000.0);
+
+  SoaPositions result;
+  result.x.reserve(count + 1);
+  result.y.reserve(count + 1);
+  result.z.reserve(count + 1);
+  for (size_t i = 0; i < count; ++i) {
+    const glm::dvec3 cartesian = Ellipsoid::WGS84.cartographicToCartesian(
+        Cartographic(
+            longitudeDist(rand),
+            latitudeDist(rand),
+            heightDist(rand)));
+    result.x.push_back(cartesian.x);
+    result.y.push_back(cartesian.y);
+    result.z.push_back(cartesian.z);
+  }
+
+  result.x.push_back(0.0);
+  result.y.push_back(0.0);
+  result.z.push_back(0.0);
+
+  return result;
+}
+
+std::vector<CartographicPolygon> createRandomPolygons(
+    size_t count,
+    const GlobeRectangle& area,
+    double maximumRadius,
+    uint32_t seed) {
+  std::default_random_engine rand(seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::uniform_int_distribution<size_t> vertexCount(3, 12);
+
+  std::vector<CartographicPolygon> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const glm::dvec2 center(
+        Math::lerp(area.getWest(), area.getEast(), unit(rand)),
+        Math::lerp(area.getSouth(), area.getNorth(), unit(rand)));
+    const size_t vertices = vertexCount(rand);
+
+    std::vector<glm::dvec2> polygon;
+    for (size_t j = 0; j < vertices; ++j) {
+      const double angle = Math::TwoPi * double(j) / double(vertices);
+      const double radius = maximumRadius * Math::lerp(0.3, 1.0, unit(rand));
+      polygon.emplace_back(
+          center.x + radius * std::cos(angle),
+          center.y + radius * std::sin(angle));
+    }
+    result.emplace_back(polygon);
+  }
+
+  return result;
+}
+
+std::vector<GlobeRectangle> createRandomRectangles(
+    size_t count,
+    const GlobeRectangle& area,
+    double maximumSize,
+    uint32_t seed) {
+  std::default_random_engine rand(seed);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  std::vector<GlobeRectangle> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const double west = Math::lerp(area.getWest(), area.getEast(), unit(rand));
+    const double south =
+        Math::lerp(area.getSouth(), area.getNorth(), unit(rand));
+    const double size = maximumSize * unit(rand) * unit(rand);
+    result.emplace_back(west, south, west + size, south + size);
+  }
+
+  return result;
+}
+
+} // namespace CesiumNativeTests
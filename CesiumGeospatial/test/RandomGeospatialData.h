@@ -0,0 +1,36 @@
+#pragma once
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CesiumNativeTests {
+
+struct SoaPositions {
+  std::vector<double> x;
+  std::vector<double> y;
+  std::vector<double> z;
+};
+
+// Random positions from deep inside the WGS84 ellipsoid to far above it, plus
+// the center, which cannot be converted.
+SoaPositions createRandomCartesians(size_t count, uint32_t seed);
+
+// Creates star-shaped polygons with between 3 and 12 vertices, scattered
+// over the given area.
+std::vector<CesiumGeospatial::CartographicPolygon> createRandomPolygons(
+    size_t count,
+    const CesiumGeospatial::GlobeRectangle& area,
+    double maximumRadius,
+    uint32_t seed);
+
+std::vector<CesiumGeospatial::GlobeRectangle> createRandomRectangles(
+    size_t count,
+    const CesiumGeospatial::GlobeRectangle& area,
+    double maximumSize,
+    uint32_t seed);
+
+} // namespace CesiumNativeTests
@@ -0,0 +1,442 @@
+#include "RandomGeospatialData.h"
+
+#include <CesiumGeometry/CullingResult.h>
+#include <CesiumGeometry/OrientedBoundingBox.h>
+#include <CesiumGeometry/Plane.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
+#include <CesiumGeospatial/EarthGravitationalModel1996Grid.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGeospatial/S2CellBoundingVolume.h>
+#include <CesiumGeospatial/S2CellID.h>
+#include <CesiumNativeTests/readFile.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/geometric.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumNativeTests;
+using namespace CesiumUtility;
+
+TEST_CASE(
+    "BoundingRegion culling and distance benchmark" * doctest::skip(true)) {
+  // Every tile of a global geographic terrain quadtree down to level 9.
+  std::vector<BoundingRegion> regions;
+  const int maximumLevel = 9;
+  for (int level = 0; level <= maximumLevel; ++level) {
+    const int columns = 2 << level;
+    const int rows = 1 << level;
+    const double tileWidth = Math::TwoPi / double(columns);
+    const double tileHeight = Math::OnePi / double(rows);
+    for (int y = 0; y < rows; ++y) {
+      for (int x = 0; x < columns; ++x) {
+        const double west = -Math::OnePi + double(x) * tileWidth;
+        const double south = -Math::PiOverTwo + double(y) * tileHeight;
+        regions.emplace_back(
+            GlobeRectangle(west, south, west + tileWidth, south + tileHeight),
+            -100.0,
+            3000.0,
+            Ellipsoid::WGS84);
+      }
+    }
+  }
+
+  std::default_random_engine rand(0xabcdabcd);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  std::vector<Cartographic> cameras;
+  for (int i = 0; i < 16; ++i) {
+    cameras.emplace_back(
+        Math::lerp(-Math::OnePi, Math::OnePi, unit(rand)),
+        Math::lerp(-1.4, 1.4, unit(rand)),
+        Math::lerp(100.0, 1000000.0, unit(rand)));
+  }
+
+  auto runBenchmark = [&](const char* name, auto&& visit) {
+    double checksum = 0.0;
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (const Cartographic& camera : cameras) {
+      const glm::dvec3 position =
+          Ellipsoid::WGS84.cartographicToCartesian(camera);
+      const glm::dvec3 direction = -glm::normalize(position);
+      const glm::dvec3 right =
+          glm::normalize(glm::cross(direction, glm::dvec3(0.0, 0.0, 1.0)));
+      const glm::dvec3 up = glm::cross(right, direction);
+      const Plane planes[4]{
+          Plane(position, glm::normalize(direction + right)),
+          Plane(position, glm::normalize(direction - right)),
+          Plane(position, glm::normalize(direction + up)),
+          Plane(position, glm::normalize(direction - up))};
+      for (const BoundingRegion& region : regions) {
+        checksum += visit(region, camera, position, planes);
+      }
+    }
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    spdlog::info(
+        "{}: {:.2f} million tiles/sec (checksum {})",
+        name,
+        double(regions.size() * cameras.size()) / seconds / 1000000.0,
+        checksum);
+  };
+
+  runBenchmark(
+      "oriented bounding box",
+      [](const BoundingRegion& region,
+         const Cartographic&,
+         const glm::dvec3& position,
+         const Plane(&planes)[4]) {
+        const OrientedBoundingBox& box = region.getBoundingBox();
+        for (const Plane& plane : planes) {
+          if (box.intersectPlane(plane) == CullingResult::Outside) {
+            return 0.0;
+          }
+        }
+        return box.computeDistanceSquaredToPosition(position);
+      });
+
+  runBenchmark(
+      "bounding region",
+      [](const BoundingRegion& region,
+         const Cartographic& camera,
+         const glm::dvec3& position,
+         const Plane(&planes)[4]) {
+        for (const Plane& plane : planes) {
+          if (region.intersectPlane(plane) == CullingResult::Outside) {
+            return 0.0;
+          }
+        }
+        return region.computeDistanceSquaredToPosition(camera, position);
+      });
+}
+
+TEST_CASE("CartographicPolygonIndex benchmark" * doctest::skip(true)) {
+  const GlobeRectangle area(-0.2, 0.6, 0.2, 0.9);
+  const std::vector<CartographicPolygon> polygons =
+      createRandomPolygons(1000, area, 0.005, 0x1357);
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  const CartographicPolygonIndex index(polygons);
+  spdlog::info(
+      "Indexed {} polygons in {:.2f} ms",
+      polygons.size(),
+      std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+          std::chrono::steady_clock::now() - start)
+          .count());
+
+  // Tile rectangles of all sizes, as visited during tile selection.
+  std::vector<GlobeRectangle> rectangles;
+  for (int level = 6; level < 14; ++level) {
+    const std::vector<GlobeRectangle> levelRectangles = createRandomRectangles(
+        2000,
+        area,
+        Math::OnePi / double(1 << level),
+        uint32_t(level));
+    rectangles.insert(
+        rectangles.end(),
+        levelRectangles.begin(),
+        levelRectangles.end());
+  }
+
+  auto runBenchmark = [&](const char* name, auto&& classify) {
+    size_t excluded = 0;
+    const std::chrono::steady_clock::time_point benchmarkStart =
+        std::chrono::steady_clock::now();
+    for (const GlobeRectangle& rectangle : rectangles) {
+      excluded += classify(rectangle) ? 1 : 0;
+    }
+    const double milliseconds =
+        std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+            std::chrono::steady_clock::now() - benchmarkStart)
+            .count();
+    spdlog::info(
+        "{}: {:.2f} ms for {} tiles ({} excluded)",
+        name,
+        milliseconds,
+        rectangles.size(),
+        excluded);
+  };
+
+  runBenchmark("rectangleIsWithinPolygons", [&](const GlobeRectangle& r) {
+    return CartographicPolygon::rectangleIsWithinPolygons(r, polygons);
+  });
+  runBenchmark("index rectangleIsWithinPolygons", [&](const GlobeRectangle& r) {
+    return index.rectangleIsWithinPolygons(r);
+  });
+  runBenchmark("rectangleIsOutsidePolygons", [&](const GlobeRectangle& r) {
+    return CartographicPolygon::rectangleIsOutsidePolygons(r, polygons);
+  });
+  runBenchmark(
+      "index rectangleIsOutsidePolygons",
+      [&](const GlobeRectangle& r) {
+        return index.rectangleIsOutsidePolygons(r);
+      });
+}
+
+TEST_CASE(
+    "EarthGravitationalModel1996Grid::sampleHeights benchmark" *
+    doctest::skip(true)) {
+  std::optional<EarthGravitationalModel1996Grid> grid =
+      EarthGravitationalModel1996Grid::fromBuffer(readFile(
+          std::filesystem::path(CESIUM_NATIVE_DATA_DIR) / "WW15MGH.DAC"));
+  REQUIRE(grid.has_value());
+
+  const size_t count = 10000000;
+  std::default_random_engine rand(0xabcdabcd);
+  std::uniform_real_distribution<double> longitudeDist(
+      -Math::OnePi,
+      Math::OnePi);
+  std::uniform_real_distribution<double> latitudeDist(
+      -Math::PiOverTwo,
+      Math::PiOverTwo);
+
+  std::vector<double> longitudes(count);
+  std::vector<double> latitudes(count);
+  for (size_t i = 0; i < count; ++i) {
+    longitudes[i] = longitudeDist(rand);
+    latitudes[i] = latitudeDist(rand);
+  }
+
+  std::vector<double> heights(count);
+
+  auto report = [count](
+                    const char* name,
+                    std::chrono::steady_clock::time_point start) {
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    spdlog::info(
+        "{}: {:.2f} million samples/sec",
+        name,
+        double(count) / seconds / 1000000.0);
+  };
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (size_t i = 0; i < count; ++i) {
+    heights[i] =
+        grid->sampleHeight(Cartographic(longitudes[i], latitudes[i], 0.0));
+  }
+  report("sampleHeight", start);
+
+  start = std::chrono::steady_clock::now();
+  grid->sampleHeights(longitudes, latitudes, heights, false);
+  report("sampleHeights", start);
+
+  start = std::chrono::steady_clock::now();
+  grid->sampleHeights(longitudes, latitudes, heights, true);
+  report("sampleHeights (sorted by grid cell)", start);
+}
+
+TEST_CASE("Ellipsoid batch conversion benchmark" * doctest::skip(true)) {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+  const size_t count = 4000000;
+  const SoaPositions positions = createRandomCartesians(count, 0xabcdabcd);
+  const size_t total = positions.x.size();
+
+  std::vector<double> longitudes(total);
+  std::vector<double> latitudes(total);
+  std::vector<double> heights(total);
+  std::vector<glm::dvec3> cartesians(total);
+
+  auto millionsPerSecond = [total](std::chrono::steady_clock::duration d) {
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(d).count();
+    return double(total) / seconds / 1000000.0;
+  };
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (size_t i = 0; i < total; ++i) {
+    const std::optional<Cartographic> cartographic =
+        ellipsoid.cartesianToCartographic(
+            glm::dvec3(positions.x[i], positions.y[i], positions.z[i]));
+    longitudes[i] = cartographic ? cartographic->longitude : 0.0;
+    latitudes[i] = cartographic ? cartographic->latitude : 0.0;
+    heights[i] = cartographic ? cartographic->height : 0.0;
+  }
+  spdlog::info(
+      "cartesianToCartographic (single): {:.2f} million points/sec",
+      millionsPerSecond(std::chrono::steady_clock::now() - start));
+
+  start = std::chrono::steady_clock::now();
+  ellipsoid.cartesianToCartographic(
+      positions.x,
+      positions.y,
+      positions.z,
+      longitudes,
+      latitudes,
+      heights);
+  spdlog::info(
+      "cartesianToCartographic (batch): {:.2f} million points/sec",
+      millionsPerSecond(std::chrono::steady_clock::now() - start));
+
+  // The center position produces NaN, which the single-position version would
+  // reject, so replace it before converting back.
+  longitudes.back() = latitudes.back() = heights.back() = 0.0;
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < total; ++i) {
+    cartesians[i] = ellipsoid.cartographicToCartesian(
+        Cartographic(longitudes[i], latitudes[i], heights[i]));
+  }
+  spdlog::info(
+      "cartographicToCartesian (single): {:.2f} million points/sec",
+      millionsPerSecond(std::chrono::steady_clock::now() - start));
+
+  start = std::chrono::steady_clock::now();
+  ellipsoid.cartographicToCartesian(longitudes, latitudes, heights, cartesians);
+  spdlog::info(
+      "cartographicToCartesian (batch): {:.2f} million points/sec",
+      millionsPerSecond(std::chrono::steady_clock::now() - start));
+}
+
+TEST_CASE("S2CellBoundingVolume children benchmark" * doctest::skip(true)) {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+
+  // Subdivides every cell of a face down to the given level.
+  auto subdivide = [&](auto&& createChildren) {
+    std::vector<S2CellBoundingVolume> cells{S2CellBoundingVolume(
+        S2CellID::fromFaceLevelPosition(1, 0, 0),
+        0.0,
+        1000.0,
+        ellipsoid)};
+    size_t count = 0;
+    for (int32_t level = 0; level < 8; ++level) {
+      std::vector<S2CellBoundingVolume> next;
+      next.reserve(cells.size() * 4);
+      for (const S2CellBoundingVolume& cell : cells) {
+        createChildren(cell, next);
+      }
+      count += next.size();
+      cells = std::move(next);
+    }
+    return count;
+  };
+
+  auto runBenchmark = [&](const char* name, auto&& createChildren) {
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    const size_t count = subdivide(createChildren);
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    spdlog::info(
+        "{}: {:.0f} thousand cells/sec",
+        name,
+        double(count) / seconds / 1000.0);
+  };
+
+  runBenchmark(
+      "constructor",
+      [&](const S2CellBoundingVolume& cell,
+          std::vector<S2CellBoundingVolume>& result) {
+        for (size_t i = 0; i < 4; ++i) {
+          result.emplace_back(
+              cell.getCellID().getChild(i),
+              cell.getMinimumHeight(),
+              cell.getMaximumHeight(),
+              ellipsoid);
+        }
+      });
+
+  runBenchmark(
+      "computeChildren",
+      [&](const S2CellBoundingVolume& cell,
+          std::vector<S2CellBoundingVolume>& result) {
+        for (const S2CellBoundingVolume& child :
+             cell.computeChildren(ellipsoid)) {
+          result.push_back(child);
+        }
+      });
+}
+
+TEST_CASE(
+    "S2CellBoundingVolume cell cache benchmark with multiple threads" *
+    doctest::skip(true)) {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+
+  // All the cells of one face at level 6, which fit in each thread's cache.
+  constexpr uint32_t level = 6;
+  constexpr uint64_t cellCount = uint64_t(1) << (2 * level);
+
+  // The first pass misses the cache and inserts every cell, the second finds
+  // every cell in the cache.
+  auto createCells = [&]() {
+    double sum = 0.0;
+    for (uint64_t i = 0; i < cellCount; ++i) {
+      const S2CellBoundingVolume volume(
+          S2CellID::fromFaceLevelPosition(2, level, i),
+          0.0,
+          1000.0,
+          ellipsoid);
+      sum += volume.getCenter().x;
+    }
+    return sum;
+  };
+
+  const uint32_t maximumThreadCount =
+      std::max(std::thread::hardware_concurrency(), 1U);
+  for (uint32_t threadCount : {1U, maximumThreadCount}) {
+    std::vector<std::thread> threads;
+    std::vector<std::array<double, 2>> threadSeconds(threadCount);
+    std::vector<double> threadSums(threadCount);
+    for (uint32_t i = 0; i < threadCount; ++i) {
+      threads.emplace_back([&createCells,
+                            &result = threadSeconds[i],
+                            &sum = threadSums[i]]() {
+        for (double& passSeconds : result) {
+          const std::chrono::steady_clock::time_point start =
+              std::chrono::steady_clock::now();
+          sum += createCells();
+          passSeconds =
+              std::chrono::duration_cast<std::chrono::duration<double>>(
+                  std::chrono::steady_clock::now() - start)
+                  .count();
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    // The slowest thread determines the throughput.
+    std::array<double, 2> seconds{};
+    for (const std::array<double, 2>& result : threadSeconds) {
+      seconds[0] = std::max(seconds[0], result[0]);
+      seconds[1] = std::max(seconds[1], result[1]);
+    }
+
+    const double totalCells = double(cellCount) * double(threadCount);
+    spdlog::info(
+        "{} threads: {:.0f} thousand cells/sec inserting, {:.0f} thousand "
+        "cells/sec finding",
+        threadCount,
+        totalCells / seconds[0] / 1000.0,
+        totalCells / seconds[1] / 1000.0);
+  }
+}
@@ -1,6 +1,7 @@
 #include <CesiumGeometry/CullingResult.h>
 #include <CesiumGeometry/Plane.h>
 #include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumUtility/Math.h>
@@ -158,3 +159,76 @@ TEST_CASE("BoundingRegion") {
     CHECK(region.intersectPlane(plane) == CullingResult::Intersecting);
   }
 }
+
+TEST_CASE("BoundingRegion precomputed culling data") {
+  std::default_random_engine rand(0x12345678);
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+  for (int i = 0; i < 200; ++i) {
+    const double west = Math::lerp(-Math::OnePi, Math::OnePi, unit(rand));
+    const double south =
+        Math::lerp(-Math::PiOverTwo, Math::PiOverTwo, unit(rand));
+    const double width = Math::lerp(0.0, Math::TwoPi, unit(rand) * unit(rand));
+    const double height = Math::lerp(0.0, Math::PiOverTwo - south, unit(rand));
+    const double minimumHeight = Math::lerp(-1000.0, 1000.0, unit(rand));
+    const double maximumHeight =
+        minimumHeight + Math::lerp(0.0, 10000.0, unit(rand));
+    const BoundingRegion region(
+        GlobeRectangle(
+            west,
+            south,
+            Math::convertLongitudeRange(west + width),
+            south + height),
+        minimumHeight,
+        maximumHeight,
+        Ellipsoid::WGS84);
+    const OrientedBoundingBox& box = region.getBoundingBox();
+
+    // The sphere encloses every corner of the box.
+    const glm::dmat3& halfAxes = box.getHalfAxes();
+    for (int corner = 0; corner < 8; ++corner) {
+      const glm::dvec3 position =
+          box.getCenter() + halfAxes[0] * ((corner & 1) ? 1.0 : -1.0) +
+          halfAxes[1] * ((corner & 2) ? 1.0 : -1.0) +
+          halfAxes[2] * ((corner & 4) ? 1.0 : -1.0);
+      CHECK(
+          glm::distance(position, region.getBoundingSphere().getCenter()) <=
+          region.getBoundingSphere().getRadius() * (1.0 + Math::Epsilon10));
+    }
+
+    for (int j = 0; j < 20; ++j) {
+      const Cartographic cartographic(
+          Math::lerp(-Math::OnePi, Math::OnePi, unit(rand)),
+          Math::lerp(-Math::PiOverTwo, Math::PiOverTwo, unit(rand)),
+          Math::lerp(-5000.0, 5000000.0, unit(rand)));
+      const glm::dvec3 position =
+          Ellipsoid::WGS84.cartographicToCartesian(cartographic);
+
+      // Culling is identical to culling the box.
+      const glm::dvec3 normal = glm::normalize(
+          glm::dvec3(unit(rand) - 0.5, unit(rand) - 0.5, unit(rand) - 0.5));
+      const Plane plane(position, normal);
+      CHECK(region.intersectPlane(plane) == box.intersectPlane(plane));
+
+      // The distance is never less than the distance to the box.
+      const double regionDistanceSquared =
+          region.computeDistanceSquaredToPosition(cartographic, position);
+      const double boxDistanceSquared =
+          box.computeDistanceSquaredToPosition(position);
+      CHECK(
+          regionDistanceSquared >=
+          boxDistanceSquared * (1.0 - Math::Epsilon10) - Math::Epsilon6);
+
+      // Inside the rectangle and height range, only the box contributes.
+      if (region.getRectangle().contains(cartographic) &&
+          cartographic.height >= minimumHeight &&
+          cartographic.height <= maximumHeight) {
+        CHECK(Math::equalsEpsilon(
+            regionDistanceSquared,
+            boxDistanceSquared,
+            Math::Epsilon10,
+            Math::Epsilon6));
+      }
+    }
+  }
+}
@@ -1,12 +1,17 @@
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/BoundingRegionBuilder.h>
+#include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumUtility/Math.h>
 
 #include <doctest/doctest.h>
 
+#include <cstddef>
 #include <cstring>
+#include <limits>
+#include <span>
+#include <vector>
 
 using namespace CesiumGeospatial;
 using namespace CesiumUtility;
@@ -288,3 +293,52 @@ TEST_CASE("BoundingRegionBuilder::expandToIncludeBoundingRegion") {
     }
   }
 }
+
+TEST_CASE("BoundingRegionBuilder::expandToIncludePositions") {
+  const std::vector<double> longitudes{0.0, 1.0, -1.0, Math::OnePi, 3.0, 0.5};
+  const std::vector<double> latitudes{0.0, 0.5, -0.25, 1.0, -1.0, 0.1};
+  const std::vector<double> heights{10.0, -5.0, 20.0, 0.0, 3.0, 1.0};
+
+  BoundingRegionBuilder scalar;
+  for (size_t i = 0; i < longitudes.size(); ++i) {
+    scalar.expandToIncludePosition(
+        Cartographic(longitudes[i], latitudes[i], heights[i]));
+  }
+
+  SUBCASE("matches expanding one position at a time") {
+    BoundingRegionBuilder batch;
+    CHECK(batch.expandToIncludePositions(longitudes, latitudes, heights));
+    CHECK(GlobeRectangle::equals(
+        batch.toGlobeRectangle(),
+        scalar.toGlobeRectangle()));
+    CHECK(BoundingRegion::equalsEpsilon(
+        batch.toRegion(Ellipsoid::WGS84),
+        scalar.toRegion(Ellipsoid::WGS84),
+        Math::Epsilon15));
+
+    CHECK_FALSE(batch.expandToIncludePositions(
+        std::span(longitudes).first(2),
+        std::span(latitudes).first(2),
+        std::span(heights).first(2)));
+  }
+
+  SUBCASE("ignores NaN positions") {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<double> longitudesWithNaN = longitudes;
+    std::vector<double> latitudesWithNaN = latitudes;
+    std::vector<double> heightsWithNaN = heights;
+    longitudesWithNaN.push_back(nan);
+    latitudesWithNaN.push_back(nan);
+    heightsWithNaN.push_back(nan);
+
+    BoundingRegionBuilder batch;
+    batch.expandToIncludePositions(
+        longitudesWithNaN,
+        latitudesWithNaN,
+        heightsWithNaN);
+    CHECK(BoundingRegion::equalsEpsilon(
+        batch.toRegion(Ellipsoid::WGS84),
+        scalar.toRegion(Ellipsoid::WGS84),
+        Math::Epsilon15));
+  }
+}
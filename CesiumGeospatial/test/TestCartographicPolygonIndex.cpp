@@ -0,0 +1,99 @@
+#include "RandomGeospatialData.h"
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/vector_double2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumNativeTests;
+using namespace CesiumUtility;
+
+TEST_CASE("CartographicPolygonIndex") {
+  SUBCASE("an empty index contains nothing") {
+    const CartographicPolygonIndex index;
+    const GlobeRectangle rectangle(0.0, 0.0, 0.1, 0.1);
+    CHECK(index.getPolygonCount() == 0);
+    CHECK(!index.rectangleIsWithinPolygons(rectangle));
+    CHECK(index.rectangleIsOutsidePolygons(rectangle));
+  }
+
+  SUBCASE("classifies a rectangle against a square") {
+    const std::vector<CartographicPolygon> polygons{
+        CartographicPolygon(std::vector<glm::dvec2>{
+            glm::dvec2(0.0, 0.0),
+            glm::dvec2(1.0, 0.0),
+            glm::dvec2(1.0, 1.0),
+            glm::dvec2(0.0, 1.0)})};
+    const CartographicPolygonIndex index(polygons);
+    CHECK(index.getPolygonCount() == 1);
+
+    const GlobeRectangle inside(0.25, 0.25, 0.5, 0.5);
+    CHECK(index.rectangleIsWithinPolygons(inside));
+    CHECK(!index.rectangleIsOutsidePolygons(inside));
+
+    const GlobeRectangle crossing(0.5, 0.5, 1.5, 1.5);
+    CHECK(!index.rectangleIsWithinPolygons(crossing));
+    CHECK(!index.rectangleIsOutsidePolygons(crossing));
+
+    const GlobeRectangle outside(1.5, 1.5, 2.0, 2.0);
+    CHECK(!index.rectangleIsWithinPolygons(outside));
+    CHECK(index.rectangleIsOutsidePolygons(outside));
+
+    const GlobeRectangle enclosing(-0.5, -0.5, 1.5, 1.5);
+    CHECK(!index.rectangleIsWithinPolygons(enclosing));
+    CHECK(!index.rectangleIsOutsidePolygons(enclosing));
+  }
+
+  SUBCASE("matches CartographicPolygon for many polygons") {
+    const GlobeRectangle area(-0.5, 0.2, 0.5, 0.8);
+    const std::vector<CartographicPolygon> polygons =
+        createRandomPolygons(300, area, 0.05, 0x1234);
+    const CartographicPolygonIndex index(polygons);
+
+    const std::vector<GlobeRectangle> rectangles =
+        createRandomRectangles(3000, area, 0.1, 0x5678);
+    size_t within = 0;
+    size_t outside = 0;
+    for (const GlobeRectangle& rectangle : rectangles) {
+      const bool expectedWithin =
+          CartographicPolygon::rectangleIsWithinPolygons(rectangle, polygons);
+      const bool expectedOutside =
+          CartographicPolygon::rectangleIsOutsidePolygons(rectangle, polygons);
+      CHECK(index.rectangleIsWithinPolygons(rectangle) == expectedWithin);
+      CHECK(index.rectangleIsOutsidePolygons(rectangle) == expectedOutside);
+      within += expectedWithin ? 1 : 0;
+      outside += expectedOutside ? 1 : 0;
+    }
+
+    // Make sure all of the cases were exercised.
+    CHECK(within > 0);
+    CHECK(outside > 0);
+    CHECK(within + outside < rectangles.size());
+  }
+
+  SUBCASE("matches CartographicPolygon near the antimeridian") {
+    const GlobeRectangle area(3.0, -0.2, Math::OnePi, 0.2);
+    const std::vector<CartographicPolygon> polygons =
+        createRandomPolygons(50, area, 0.1, 0x9abc);
+    const CartographicPolygonIndex index(polygons);
+
+    std::vector<GlobeRectangle> rectangles =
+        createRandomRectangles(500, area, 0.2, 0xdef0);
+    rectangles.emplace_back(3.1, -0.1, -3.1, 0.1);
+    for (const GlobeRectangle& rectangle : rectangles) {
+      CHECK(
+          index.rectangleIsWithinPolygons(rectangle) ==
+          CartographicPolygon::rectangleIsWithinPolygons(rectangle, polygons));
+      CHECK(
+          index.rectangleIsOutsidePolygons(rectangle) ==
+          CartographicPolygon::rectangleIsOutsidePolygons(rectangle, polygons));
+    }
+  }
+}
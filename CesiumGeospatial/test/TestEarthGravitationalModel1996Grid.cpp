@@ -5,6 +5,7 @@
 
 #include <doctest/doctest.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
 #include <optional>
@@ -248,3 +249,76 @@ TEST_CASE("EarthGravitationalModel1996Grid::sampleHeight") {
     }
   }
 }
+
+TEST_CASE("EarthGravitationalModel1996Grid::fromMemoryMappedFile") {
+  SUBCASE("Loads a valid WW15MGH.DAC from a file") {
+    std::optional<EarthGravitationalModel1996Grid> grid =
+        EarthGravitationalModel1996Grid::fromMemoryMappedFile(
+            testFilePath.string());
+    REQUIRE(grid.has_value());
+
+    for (const Egm96TestCase& testCase : testCases) {
+      CHECK(Math::equalsEpsilon(
+          testCase.expectedHeight,
+          grid->sampleHeight(testCase.cartographicPosition),
+          0.0,
+          Math::Epsilon2));
+    }
+  }
+
+  SUBCASE("Fails on a file that does not exist") {
+    std::optional<EarthGravitationalModel1996Grid> grid =
+        EarthGravitationalModel1996Grid::fromMemoryMappedFile(
+            (std::filesystem::path(CESIUM_NATIVE_DATA_DIR) / "nonexistent.dac")
+                .string());
+    CHECK(!grid.has_value());
+  }
+}
+
+TEST_CASE("EarthGravitationalModel1996Grid::sampleHeights") {
+  std::optional<EarthGravitationalModel1996Grid> grid =
+      EarthGravitationalModel1996Grid::fromBuffer(readFile(testFilePath));
+  REQUIRE(grid.has_value());
+
+  std::vector<Cartographic> positions;
+  for (const Egm96TestCase& testCase : testCases) {
+    positions.emplace_back(testCase.cartographicPosition);
+  }
+  for (const Egm96TestCase& testCase : boundsCases) {
+    positions.emplace_back(testCase.cartographicPosition);
+  }
+  // Just short of 360E, where the grid wraps around.
+  positions.emplace_back(Cartographic::fromDegrees(359.9, 45.0));
+
+  std::vector<double> longitudes;
+  std::vector<double> latitudes;
+  for (const Cartographic& position : positions) {
+    longitudes.emplace_back(position.longitude);
+    latitudes.emplace_back(position.latitude);
+  }
+
+  for (const bool sortByGridCell : {false, true}) {
+    CAPTURE(sortByGridCell);
+
+    std::vector<double> heights(positions.size());
+    grid->sampleHeights(longitudes, latitudes, heights, sortByGridCell);
+
+    std::vector<double> cartographicHeights(positions.size());
+    grid->sampleHeights(positions, cartographicHeights, sortByGridCell);
+
+    for (size_t i = 0; i < positions.size(); ++i) {
+      const double expected = grid->sampleHeight(positions[i]);
+      CHECK(heights[i] == expected);
+      CHECK(cartographicHeights[i] == expected);
+    }
+  }
+
+  // The grid wraps around at 360E, so a position just short of it is
+  // interpolated between the last column and the first column of the same row.
+  const double justShort = grid->sampleHeight(positions.back());
+  const double last =
+      grid->sampleHeight(Cartographic::fromDegrees(359.75, 45.0));
+  const double first = grid->sampleHeight(Cartographic::fromDegrees(0.0, 45.0));
+  CHECK(justShort >= std::min(last, first) - Math::Epsilon10);
+  CHECK(justShort <= std::max(last, first) + Math::Epsilon10);
+}
@@ -0,0 +1,210 @@
+#include "RandomGeospatialData.h"
+
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/vector_double3.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumNativeTests;
+using namespace CesiumUtility;
+
+TEST_CASE("Ellipsoid batch conversions") {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+
+  SUBCASE("cartographicToCartesian matches the single-position version") {
+    const std::vector<double> longitudes{0.0, 1.0, -2.5, Math::OnePi, 0.3};
+    const std::vector<double> latitudes{0.0, 0.5, -1.2, Math::PiOverTwo, -0.7};
+    const std::vector<double> heights{0.0, 1000.0, -50.0, 20000000.0, 3.5};
+    std::vector<glm::dvec3> result(longitudes.size());
+
+    ellipsoid.cartographicToCartesian(longitudes, latitudes, heights, result);
+
+    for (size_t i = 0; i < longitudes.size(); ++i) {
+      const glm::dvec3 expected = ellipsoid.cartographicToCartesian(
+          Cartographic(longitudes[i], latitudes[i], heights[i]));
+      CHECK(Math::equalsEpsilon(result[i], expected, 0.0, Math::Epsilon7));
+    }
+  }
+
+  SUBCASE("cartesianToCartographic matches the single-position version") {
+    const SoaPositions positions = createRandomCartesians(1000, 0x1234abcd);
+    const size_t count = positions.x.size();
+    std::vector<double> longitudes(count);
+    std::vector<double> latitudes(count);
+    std::vector<double> heights(count);
+
+    ellipsoid.cartesianToCartographic(
+        positions.x,
+        positions.y,
+        positions.z,
+        longitudes,
+        latitudes,
+        heights);
+
+    for (size_t i = 0; i < count; ++i) {
+      const std::optional<Cartographic> expected =
+          ellipsoid.cartesianToCartographic(
+              glm::dvec3(positions.x[i], positions.y[i], positions.z[i]));
+      if (!expected) {
+        CHECK(std::isnan(longitudes[i]));
+        CHECK(std::isnan(latitudes[i]));
+        CHECK(std::isnan(heights[i]));
+        continue;
+      }
+
+      CHECK(Math::equalsEpsilon(
+          longitudes[i],
+          expected->longitude,
+          0.0,
+          Math::Epsilon10));
+      CHECK(Math::equalsEpsilon(
+          latitudes[i],
+          expected->latitude,
+          0.0,
+          Math::Epsilon10));
+      CHECK(Math::equalsEpsilon(heights[i], expected->height, 0.0, 1e-4));
+    }
+
+    // The last position is the center of the ellipsoid.
+    CHECK(std::isnan(longitudes.back()));
+  }
+
+  SUBCASE("scaleToGeodeticSurface matches the single-position version") {
+    const SoaPositions positions = createRandomCartesians(1000, 0xabcd1234);
+    const size_t count = positions.x.size();
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+
+    ellipsoid
+        .scaleToGeodeticSurface(positions.x, positions.y, positions.z, x, y, z);
+
+    for (size_t i = 0; i < count; ++i) {
+      const std::optional<glm::dvec3> expected =
+          ellipsoid.scaleToGeodeticSurface(
+              glm::dvec3(positions.x[i], positions.y[i], positions.z[i]));
+      if (!expected) {
+        CHECK(std::isnan(x[i]));
+        continue;
+      }
+
+      CHECK(Math::equalsEpsilon(
+          glm::dvec3(x[i], y[i], z[i]),
+          *expected,
+          0.0,
+          1e-4));
+    }
+  }
+
+  SUBCASE("matches within tolerance when positions converge at different "
+          "rates") {
+    // Positions on or just above the surface converge at once, while those
+    // deep inside or far above the ellipsoid take many iterations. Mixing
+    // them in the same blocks makes the fast ones keep iterating.
+    const std::vector<Cartographic> cartographics{
+        Cartographic(0.3, 0.2, 0.0),
+        Cartographic(1.0, 0.5, 1.0e9),
+        Cartographic(-2.0, -0.4, -4.0e6),
+        Cartographic(0.7, 1.5707, 1.0e7),
+        Cartographic(2.5, -1.0, 0.001),
+        Cartographic(-0.1, 0.0, -3.5e6),
+        Cartographic(-3.0, -1.5707, 5.0e8),
+        Cartographic(1.2, 0.8, 10.0),
+        Cartographic(-1.7, 0.1, -2.0e6),
+        Cartographic(0.0, 0.0, 0.0),
+        Cartographic(2.9, 0.9, 1.0e8)};
+
+    SoaPositions positions;
+    for (const Cartographic& cartographic : cartographics) {
+      const glm::dvec3 cartesian =
+          ellipsoid.cartographicToCartesian(cartographic);
+      positions.x.push_back(cartesian.x);
+      positions.y.push_back(cartesian.y);
+      positions.z.push_back(cartesian.z);
+    }
+
+    const size_t count = positions.x.size();
+    std::vector<double> longitudes(count);
+    std::vector<double> latitudes(count);
+    std::vector<double> heights(count);
+    ellipsoid.cartesianToCartographic(
+        positions.x,
+        positions.y,
+        positions.z,
+        longitudes,
+        latitudes,
+        heights);
+
+    std::vector<double> x(count);
+    std::vector<double> y(count);
+    std::vector<double> z(count);
+    ellipsoid
+        .scaleToGeodeticSurface(positions.x, positions.y, positions.z, x, y, z);
+
+    for (size_t i = 0; i < count; ++i) {
+      CAPTURE(i);
+      const glm::dvec3 position(positions.x[i], positions.y[i], positions.z[i]);
+
+      const std::optional<Cartographic> expected =
+          ellipsoid.cartesianToCartographic(position);
+      REQUIRE(expected);
+      CHECK(Math::equalsEpsilon(
+          longitudes[i],
+          expected->longitude,
+          0.0,
+          Math::Epsilon11));
+      CHECK(Math::equalsEpsilon(
+          latitudes[i],
+          expected->latitude,
+          0.0,
+          Math::Epsilon11));
+      CHECK(Math::equalsEpsilon(
+          heights[i],
+          expected->height,
+          Math::Epsilon11,
+          1e-4));
+
+      const std::optional<glm::dvec3> expectedSurface =
+          ellipsoid.scaleToGeodeticSurface(position);
+      REQUIRE(expectedSurface);
+      CHECK(Math::equalsEpsilon(
+          glm::dvec3(x[i], y[i], z[i]),
+          *expectedSurface,
+          0.0,
+          1e-4));
+    }
+  }
+
+  SUBCASE("scaleToGeodeticSurface works in place") {
+    SoaPositions positions = createRandomCartesians(17, 0x5678);
+    const SoaPositions original = positions;
+
+    ellipsoid.scaleToGeodeticSurface(
+        positions.x,
+        positions.y,
+        positions.z,
+        positions.x,
+        positions.y,
+        positions.z);
+
+    for (size_t i = 0; i + 1 < positions.x.size(); ++i) {
+      const std::optional<glm::dvec3> expected =
+          ellipsoid.scaleToGeodeticSurface(
+              glm::dvec3(original.x[i], original.y[i], original.z[i]));
+      REQUIRE(expected);
+      CHECK(Math::equalsEpsilon(
+          glm::dvec3(positions.x[i], positions.y[i], positions.z[i]),
+          *expected,
+          0.0,
+          1e-4));
+    }
+  }
+}
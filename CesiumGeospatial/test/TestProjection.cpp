@@ -4,12 +4,17 @@
 #include <CesiumGeospatial/GeographicProjection.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/Projection.h>
+#include <CesiumGeospatial/WebMercatorProjection.h>
 #include <CesiumUtility/Math.h>
 
 #include <doctest/doctest.h>
 #include <glm/ext/vector_double2.hpp>
+#include <glm/ext/vector_double3.hpp>
 #include <glm/geometric.hpp>
 
+#include <cstddef>
+#include <vector>
+
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
 using namespace CesiumUtility;
@@ -125,3 +130,34 @@ TEST_CASE("computeProjectedRectangleSize") {
         1.0));
   }
 }
+
+TEST_CASE("projectPositions") {
+  const std::vector<double> longitudes{
+      Math::degreesToRadians(-180.0),
+      Math::degreesToRadians(-75.1),
+      0.0,
+      Math::degreesToRadians(45.5),
+      Math::degreesToRadians(180.0)};
+  const std::vector<double> latitudes{
+      Math::degreesToRadians(-90.0),
+      Math::degreesToRadians(39.9),
+      0.0,
+      Math::degreesToRadians(-12.25),
+      Math::degreesToRadians(89.0)};
+
+  for (const Projection& projection :
+       {Projection(GeographicProjection(Ellipsoid::WGS84)),
+        Projection(WebMercatorProjection(Ellipsoid::WGS84))}) {
+    std::vector<double> x(longitudes.size());
+    std::vector<double> y(longitudes.size());
+    projectPositions(projection, longitudes, latitudes, x, y);
+
+    for (size_t i = 0; i < longitudes.size(); ++i) {
+      const glm::dvec3 expected = projectPosition(
+          projection,
+          Cartographic(longitudes[i], latitudes[i], 0.0));
+      CHECK(x[i] == expected.x);
+      CHECK(y[i] == expected.y);
+    }
+  }
+}
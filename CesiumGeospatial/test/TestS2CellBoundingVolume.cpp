@@ -1,5 +1,6 @@
 #include <CesiumGeometry/CullingResult.h>
 #include <CesiumGeometry/Plane.h>
+#include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/S2CellBoundingVolume.h>
 #include <CesiumGeospatial/S2CellID.h>
@@ -9,6 +10,9 @@
 #include <glm/exponential.hpp>
 #include <glm/ext/vector_double3.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <span>
 
 using namespace CesiumGeometry;
@@ -148,3 +152,63 @@ TEST_CASE("S2CellBoundingVolume") {
     CHECK(face2Root.getCellID().getID() == 5764607523034234880U);
   }
 }
+
+TEST_CASE("S2CellBoundingVolume::computeChildren") {
+  const Ellipsoid& ellipsoid = Ellipsoid::WGS84;
+
+  for (uint8_t face = 0; face < 6; ++face) {
+    for (uint32_t level : {0U, 1U, 7U, 16U}) {
+      const uint64_t position = (uint64_t(1) << (2 * level)) / 3;
+      const S2CellBoundingVolume parent(
+          S2CellID::fromFaceLevelPosition(face, level, position),
+          -100.0,
+          5000.0,
+          ellipsoid);
+
+      const std::array<S2CellBoundingVolume, 4> children =
+          parent.computeChildren(ellipsoid);
+
+      for (size_t i = 0; i < children.size(); ++i) {
+        const S2CellBoundingVolume& child = children[i];
+        const S2CellID expectedID = parent.getCellID().getChild(i);
+        CHECK(child.getCellID().getID() == expectedID.getID());
+        CHECK(child.getMinimumHeight() == parent.getMinimumHeight());
+        CHECK(child.getMaximumHeight() == parent.getMaximumHeight());
+
+        Cartographic center = expectedID.getCenter();
+        center.height =
+            (child.getMinimumHeight() + child.getMaximumHeight()) * 0.5;
+        CHECK(Math::equalsEpsilon(
+            child.getCenter(),
+            ellipsoid.cartographicToCartesian(center),
+            0.0,
+            Math::Epsilon7));
+
+        // Each side plane passes through the corners of the cell it bounds.
+        const std::array<Cartographic, 4> corners = expectedID.getVertices();
+        std::span<const Plane> planes = child.getBoundingPlanes();
+        for (size_t j = 0; j < 4; ++j) {
+          Cartographic corner = corners[j];
+          corner.height = child.getMinimumHeight();
+          const glm::dvec3 cartesian =
+              ellipsoid.cartographicToCartesian(corner);
+          CHECK(Math::equalsEpsilon(
+              planes[2 + j].getPointDistance(cartesian),
+              0.0,
+              0.0,
+              Math::Epsilon5));
+        }
+
+        // A separately-constructed volume for the same cell is identical.
+        const S2CellBoundingVolume separate(
+            expectedID,
+            child.getMinimumHeight(),
+            child.getMaximumHeight(),
+            ellipsoid);
+        for (size_t j = 0; j < 8; ++j) {
+          CHECK(separate.getVertices()[j] == child.getVertices()[j]);
+        }
+      }
+    }
+  }
+}
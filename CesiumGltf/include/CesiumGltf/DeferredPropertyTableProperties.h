@@ -0,0 +1,134 @@
+#pragma once
+
+#include <CesiumGltf/Library.h>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace CesiumGltf {
+
+struct Model;
+struct PropertyTable;
+
+/**
+ * @brief Properties of a {@link PropertyTable} whose values are converted to
+ * the `EXT_structural_metadata` format only when they are first needed.
+ *
+ * This is attached to a property table as an extension, for loaders that
+ * need a lot of work to convert the values of a property or to infer its type.
+ * Each deferred property is already part of the class of the property table,
+ * but that class property may be a placeholder, and the property has no entry
+ * in the property table itself until it is converted.
+ * Converting a property adds its values to the buffers of the model and its
+ * entry to the property table, so a converted property cannot be told apart
+ * from one that was never deferred.
+ *
+ * Properties are converted by {@link convertProperty} or {@link convertAll},
+ * or by a {@link PropertyTableView} created from a non-const model the first
+ * time the values of a property are requested. Call {@link convertAll} before
+ * writing a model in order to write the deferred properties, too.
+ *
+ * Once all properties are converted, the source data retained for converting
+ * them is released.
+ */
+class CESIUMGLTF_API DeferredPropertyTableProperties final {
+public:
+  /**
+   * @brief The original name of this type.
+   */
+  static constexpr const char* TypeName = "DeferredPropertyTableProperties";
+
+  /**
+   * @brief The name of the extension under which this is attached to a
+   * {@link PropertyTable}. It is not an actual glTF extension.
+   */
+  static constexpr const char* ExtensionName =
+      "CESIUM_deferred_property_table_properties";
+
+  /**
+   * @brief A function that converts one deferred property.
+   *
+   * The function is given the ID of the property, the model, and the property
+   * table the property belongs to. It must add the values of the property to
+   * the buffers of the model and add a {@link PropertyTableProperty} with the
+   * same ID to the property table. It may also finish the
+   * {@link ClassProperty} with the same ID in place, but must not otherwise
+   * modify the schema of the model, which may be shared by copies of the
+   * model. A converter must give every copy the same class property.
+   */
+  using Converter = std::function<void(
+      const std::string& propertyId,
+      Model& model,
+      PropertyTable& propertyTable)>;
+
+  /**
+   * @brief Creates deferred properties.
+   *
+   * @param propertyIds The IDs of the deferred properties.
+   * @param converter The function that converts a property.
+   * @param sourceSizeBytes The number of bytes of source data that are
+   * retained by the converter until all properties are converted.
+   */
+  DeferredPropertyTableProperties(
+      std::vector<std::string>&& propertyIds,
+      Converter&& converter,
+      int64_t sourceSizeBytes);
+
+  /**
+   * @brief Gets the IDs of the properties that have not been converted yet.
+   */
+  const std::vector<std::string>& getPropertyIds() const noexcept;
+
+  /**
+   * @brief Determines if a property with the given ID has not been converted
+   * yet.
+   */
+  bool hasProperty(const std::string& propertyId) const noexcept;
+
+  /**
+   * @brief Gets the number of bytes of source data retained for converting
+   * the remaining properties, or 0 once all properties are converted.
+   */
+  int64_t getSizeBytes() const noexcept;
+
+  /**
+   * @brief Converts the property with the given ID if it has not been
+   * converted yet.
+   *
+   * @param propertyId The ID of the property.
+   * @param model The model that holds the property table.
+   * @param propertyTable The property table this is attached to.
+   * @returns True if the property was converted by this call.
+   */
+  bool convertProperty(
+      const std::string& propertyId,
+      Model& model,
+      PropertyTable& propertyTable);
+
+  /**
+   * @brief Converts all properties that have not been converted yet.
+   *
+   * @param model The model that holds the property table.
+   * @param propertyTable The property table this is attached to.
+   */
+  void convertAll(Model& model, PropertyTable& propertyTable);
+
+  /**
+   * @brief Converts the deferred properties of all property tables of a
+   * model.
+   *
+   * @param model The model.
+   */
+  static void convertAll(Model& model);
+
+private:
+  void releaseIfConverted() noexcept;
+
+  std::vector<std::string> _propertyIds;
+  Converter _converter;
+  int64_t _sourceSizeBytes;
+};
+
+} // namespace CesiumGltf
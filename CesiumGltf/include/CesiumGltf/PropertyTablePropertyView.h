@@ -7,8 +7,10 @@
 #include <CesiumGltf/PropertyView.h>
 #include <CesiumUtility/Assert.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <span>
 #include <string_view>
 
@@ -433,6 +435,94 @@ public:
     }
   }
 
+  /**
+   * @brief Get the values of a contiguous range of elements in the
+   * {@link PropertyTable}, with all value transforms applied.
+   *
+   * This gives the same values as calling \ref get for each element, but
+   * checks the view's status and the property's offset, scale, and "no data"
+   * value once for the whole range instead of once per element. Numeric values
+   * are copied and transformed in tight loops that the compiler can vectorize.
+   * Array properties are not supported.
+   *
+   * @param start The index of the first element.
+   * @param values Receives the values of the elements starting at `start`. The
+   * size of this span is the number of elements to get. An element for which
+   * \ref get would return std::nullopt receives a value-initialized
+   * `ElementType`.
+   * @param present If not empty, receives 1 for each element that has a value
+   * and 0 for each element for which \ref get would return std::nullopt. It
+   * must be the same size as `values`.
+   * @return The number of elements that have a value.
+   */
+  int64_t getRange(
+      int64_t start,
+      std::span<ElementType> values,
+      std::span<uint8_t> present = {}) const noexcept {
+    static_assert(
+        !IsMetadataArray<ElementType>::value,
+        "getRange does not support array properties");
+    CESIUM_ASSERT(start >= 0 && "start must be non-negative");
+    CESIUM_ASSERT(
+        start + static_cast<int64_t>(values.size()) <= this->_size &&
+        "the range must be within the size of the view");
+    CESIUM_ASSERT(
+        (present.empty() || present.size() == values.size()) &&
+        "present must be empty or the same size as values");
+
+    const int64_t count = static_cast<int64_t>(values.size());
+    if (this->_status ==
+        PropertyTablePropertyViewStatus::EmptyPropertyWithDefault) {
+      std::fill(values.begin(), values.end(), *this->defaultValue());
+      std::fill(present.begin(), present.end(), uint8_t(1));
+      return count;
+    }
+
+    if (count == 0) {
+      return 0;
+    }
+
+    const ElementType* pRawValues = nullptr;
+    if constexpr (IsMetadataNumeric<ElementType>::value) {
+      pRawValues =
+          reinterpret_cast<const ElementType*>(_values.data()) + start;
+      std::copy(pRawValues, pRawValues + count, values.begin());
+      transformValues<ElementType>(values, this->offset(), this->scale());
+    } else {
+      for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = getRaw(start + static_cast<int64_t>(i));
+      }
+    }
+
+    std::fill(present.begin(), present.end(), uint8_t(1));
+
+    const std::optional<ElementType> noData = this->noData();
+    if (!noData) {
+      return count;
+    }
+
+    // Numeric values were transformed in place, so compare the raw values in
+    // the buffer against the "no data" value.
+    const std::optional<ElementType> defaultValue = this->defaultValue();
+    int64_t presentCount = count;
+    for (size_t i = 0; i < values.size(); ++i) {
+      const ElementType& rawValue = pRawValues ? pRawValues[i] : values[i];
+      if (rawValue != *noData) {
+        continue;
+      }
+
+      values[i] = defaultValue.value_or(ElementType());
+      if (!defaultValue) {
+        --presentCount;
+        if (!present.empty()) {
+          present[i] = 0;
+        }
+      }
+    }
+
+    return presentCount;
+  }
+
   /**
    * @brief Get the number of elements in this
    * PropertyTablePropertyView. If the view is valid, this returns
@@ -822,6 +912,98 @@ public:
     }
   }
 
+  /**
+   * @brief Get the values of a contiguous range of elements in the
+   * {@link PropertyTable}, with normalization and other value transforms
+   * applied.
+   *
+   * This gives the same values as calling \ref get for each element, but
+   * checks the view's status and the property's offset, scale, and "no data"
+   * value once for the whole range instead of once per element, and normalizes
+   * the values in a tight loop that the compiler can vectorize. The values may
+   * be converted to a type other than `NormalizedType`, such as `float` or
+   * `glm::vec3`, so that they can be written directly into a buffer for the
+   * GPU. Array properties are not supported.
+   *
+   * @tparam TValue The type of the values to write. It must be possible to
+   * `static_cast` a `NormalizedType` to this type.
+   * @param start The index of the first element.
+   * @param values Receives the values of the elements starting at `start`. The
+   * size of this span is the number of elements to get. An element for which
+   * \ref get would return std::nullopt receives a value-initialized `TValue`.
+   * @param present If not empty, receives 1 for each element that has a value
+   * and 0 for each element for which \ref get would return std::nullopt. It
+   * must be the same size as `values`.
+   * @return The number of elements that have a value.
+   */
+  template <typename TValue = NormalizedType>
+  int64_t getRange(
+      int64_t start,
+      std::span<TValue> values,
+      std::span<uint8_t> present = {}) const noexcept {
+    static_assert(
+        !IsMetadataArray<ElementType>::value,
+        "getRange does not support array properties");
+    CESIUM_ASSERT(start >= 0 && "start must be non-negative");
+    CESIUM_ASSERT(
+        start + static_cast<int64_t>(values.size()) <= this->_size &&
+        "the range must be within the size of the view");
+    CESIUM_ASSERT(
+        (present.empty() || present.size() == values.size()) &&
+        "present must be empty or the same size as values");
+
+    const int64_t count = static_cast<int64_t>(values.size());
+    if (this->_status ==
+        PropertyTablePropertyViewStatus::EmptyPropertyWithDefault) {
+      std::fill(
+          values.begin(),
+          values.end(),
+          static_cast<TValue>(*this->defaultValue()));
+      std::fill(present.begin(), present.end(), uint8_t(1));
+      return count;
+    }
+
+    if (count == 0) {
+      return 0;
+    }
+
+    const std::span<const ElementType> rawValues(
+        reinterpret_cast<const ElementType*>(_values.data()) + start,
+        values.size());
+    transformNormalizedValues<ElementType, TValue>(
+        rawValues,
+        values,
+        this->offset(),
+        this->scale());
+
+    std::fill(present.begin(), present.end(), uint8_t(1));
+
+    const std::optional<ElementType> noData = this->noData();
+    if (!noData) {
+      return count;
+    }
+
+    const std::optional<NormalizedType> defaultValue = this->defaultValue();
+    int64_t presentCount = count;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (rawValues[i] != *noData) {
+        continue;
+      }
+
+      if (defaultValue) {
+        values[i] = static_cast<TValue>(*defaultValue);
+      } else {
+        values[i] = TValue();
+        --presentCount;
+        if (!present.empty()) {
+          present[i] = 0;
+        }
+      }
+    }
+
+    return presentCount;
+  }
+
   /**
    * @brief Get the number of elements in this
    * PropertyTablePropertyView. If the view is valid, this returns
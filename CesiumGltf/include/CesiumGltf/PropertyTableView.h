@@ -62,6 +62,24 @@ public:
    */
   PropertyTableView(const Model& model, const PropertyTable& propertyTable);
 
+  /**
+   * @brief Creates an instance of PropertyTableView that converts the
+   * {@link DeferredPropertyTableProperties} of the property table the first
+   * time their values are requested.
+   *
+   * Converting a property adds its values to the buffers of the model and may
+   * finish its class property in the schema, which is shared by copies of the
+   * model. So neither the model nor its copies may be accessed by other
+   * threads while this view is in use.
+   * Views of a const model report deferred properties that have not been
+   * converted yet as nonexistent.
+   *
+   * @param model The glTF Model that contains the property table data.
+   * @param propertyTable The {@link PropertyTable}
+   * from which the view will retrieve data.
+   */
+  PropertyTableView(Model& model, PropertyTable& propertyTable);
+
   /**
    * @brief Gets the status of this property table view.
    *
@@ -102,6 +120,11 @@ public:
   /**
    * @brief Finds the {@link ClassProperty} that
    * describes the type information of the property with the specified id.
+   *
+   * The class property of a {@link DeferredPropertyTableProperties} property
+   * may be provisional until the property is converted, for example by
+   * {@link getPropertyView}.
+   *
    * @param propertyId The id of the property to retrieve the class for.
    * @return A pointer to the {@link ClassProperty}. Returns nullptr if the
    * PropertyTableView is invalid or if no class property was found.
@@ -142,6 +165,9 @@ public:
           PropertyTablePropertyViewStatus::ErrorInvalidPropertyTable);
     }
 
+    // Converting a deferred property may finish its class property, so it must
+    // happen before the class property is read.
+    convertDeferredProperty(propertyId);
     const ClassProperty* pClassProperty = getClassProperty(propertyId);
     if (!pClassProperty) {
       return PropertyTablePropertyView<T, Normalized>(
@@ -184,6 +210,7 @@ public:
       return;
     }
 
+    convertDeferredProperty(propertyId);
     const ClassProperty* pClassProperty = getClassProperty(propertyId);
     if (!pClassProperty) {
       callback(
@@ -1375,6 +1402,10 @@ private:
       const ClassProperty& classProperty,
       const PropertyTableProperty& propertyTableProperty) const;
 
+  // Converts the given deferred property if this view was created from a
+  // non-const model. Returns true if the property was converted.
+  bool convertDeferredProperty(const std::string& propertyId) const;
+
   PropertyViewStatusType getBufferSafe(
       int32_t bufferView,
       std::span<const std::byte>& buffer) const noexcept;
@@ -1398,6 +1429,8 @@ private:
   const PropertyTable* _pPropertyTable;
   const Class* _pClass;
   const std::unordered_map<std::string, CesiumGltf::Enum>* _pEnumDefinitions;
+  Model* _pMutableModel;
+  PropertyTable* _pMutablePropertyTable;
   PropertyTableViewStatus _status;
 };
 } // namespace CesiumGltf
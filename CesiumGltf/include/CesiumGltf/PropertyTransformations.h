@@ -6,8 +6,10 @@
 #include <glm/common.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <span>
 
 namespace CesiumGltf {
 /**
@@ -245,4 +247,107 @@ PropertyArrayCopy<glm::mat<N, N, double>> transformNormalizedMatNArray(
 
   return PropertyArrayCopy(std::move(result));
 }
+
+/**
+ * @brief Transforms each of the given values in place by optional offset and
+ * scale factors. See \ref transformValue.
+ *
+ * The offset and scale are checked once for all of the values rather than once
+ * per value, so that the compiler can vectorize the loop over a column of
+ * scalars or vectors.
+ *
+ * @param values The values to transform.
+ * @param offset The amount to offset each value by, or `std::nullopt` to apply
+ * no offset.
+ * @param scale The amount to scale each value by, or `std::nullopt` to apply no
+ * scale. See \ref applyScale.
+ */
+template <typename T>
+void transformValues(
+    std::span<T> values,
+    const std::optional<T>& offset,
+    const std::optional<T>& scale) {
+  if (scale && offset) {
+    const T scaleValue = *scale;
+    const T offsetValue = *offset;
+    for (T& value : values) {
+      value = applyScale<T>(value, scaleValue);
+      value += offsetValue;
+    }
+  } else if (scale) {
+    const T scaleValue = *scale;
+    for (T& value : values) {
+      value = applyScale<T>(value, scaleValue);
+    }
+  } else if (offset) {
+    const T offsetValue = *offset;
+    for (T& value : values) {
+      value += offsetValue;
+    }
+  }
+}
+
+/**
+ * @brief Normalizes each of the given scalar, vector, or matrix values and
+ * transforms them by optional offset and scale factors. See \ref normalize and
+ * \ref transformValue.
+ *
+ * As with \ref transformValues, the offset and scale are checked once for all
+ * of the values, so that the compiler can vectorize the conversion.
+ *
+ * @param values The values to normalize.
+ * @param result Receives the normalized and transformed values, converted to
+ * `TResult`. This must be the same size as `values`.
+ * @param offset The amount to offset each value by, or `std::nullopt` to apply
+ * no offset. The offset will be applied after normalization.
+ * @param scale The amount to scale each value by, or `std::nullopt` to apply no
+ * scale factor. The scale will be applied after normalization.
+ */
+template <
+    typename T,
+    typename TResult,
+    typename NormalizedType = typename TypeToNormalizedType<T>::type>
+void transformNormalizedValues(
+    std::span<const T> values,
+    std::span<TResult> result,
+    const std::optional<NormalizedType>& offset,
+    const std::optional<NormalizedType>& scale) {
+  const auto normalizeValue = [](const T& value) -> NormalizedType {
+    if constexpr (IsMetadataScalar<T>::value) {
+      return normalize<T>(value);
+    } else {
+      constexpr glm::length_t N = T::length();
+      return normalize<N, typename T::value_type>(value);
+    }
+  };
+
+  const size_t count = std::min(values.size(), result.size());
+  if (scale && offset) {
+    const NormalizedType scaleValue = *scale;
+    const NormalizedType offsetValue = *offset;
+    for (size_t i = 0; i < count; ++i) {
+      NormalizedType value =
+          applyScale<NormalizedType>(normalizeValue(values[i]), scaleValue);
+      value += offsetValue;
+      result[i] = static_cast<TResult>(value);
+    }
+  } else if (scale) {
+    const NormalizedType scaleValue = *scale;
+    for (size_t i = 0; i < count; ++i) {
+      result[i] = static_cast<TResult>(
+          applyScale<NormalizedType>(normalizeValue(values[i]), scaleValue));
+    }
+  } else if (offset) {
+    const NormalizedType offsetValue = *offset;
+    for (size_t i = 0; i < count; ++i) {
+      NormalizedType value = normalizeValue(values[i]);
+      value += offsetValue;
+      result[i] = static_cast<TResult>(value);
+    }
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      result[i] = static_cast<TResult>(normalizeValue(values[i]));
+    }
+  }
+}
 } // namespace CesiumGltf
@@ -0,0 +1,101 @@
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
+#include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltf/PropertyTable.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace CesiumGltf {
+
+DeferredPropertyTableProperties::DeferredPropertyTableProperties(
+    std::vector<std::string>&& propertyIds,
+    Converter&& converter,
+    int64_t sourceSizeBytes)
+    : _propertyIds(std::move(propertyIds)),
+      _converter(std::move(converter)),
+      _sourceSizeBytes(sourceSizeBytes) {
+  this->releaseIfConverted();
+}
+
+const std::vector<std::string>&
+DeferredPropertyTableProperties::getPropertyIds() const noexcept {
+  return this->_propertyIds;
+}
+
+bool DeferredPropertyTableProperties::hasProperty(
+    const std::string& propertyId) const noexcept {
+  return std::find(
+             this->_propertyIds.begin(),
+             this->_propertyIds.end(),
+             propertyId) != this->_propertyIds.end();
+}
+
+int64_t DeferredPropertyTableProperties::getSizeBytes() const noexcept {
+  return this->_sourceSizeBytes;
+}
+
+bool DeferredPropertyTableProperties::convertProperty(
+    const std::string& propertyId,
+    Model& model,
+    PropertyTable& propertyTable) {
+  auto it = std::find(
+      this->_propertyIds.begin(),
+      this->_propertyIds.end(),
+      propertyId);
+  if (it == this->_propertyIds.end()) {
+    return false;
+  }
+
+  // The ID may refer to the element that is erased.
+  const std::string id = std::move(*it);
+  this->_propertyIds.erase(it);
+
+  // Keep the converter alive while it runs, even if it is released below.
+  const Converter converter = this->_converter;
+  this->releaseIfConverted();
+  converter(id, model, propertyTable);
+
+  return true;
+}
+
+void DeferredPropertyTableProperties::convertAll(
+    Model& model,
+    PropertyTable& propertyTable) {
+  const std::vector<std::string> propertyIds = std::move(this->_propertyIds);
+  this->_propertyIds.clear();
+
+  const Converter converter = this->_converter;
+  this->releaseIfConverted();
+  for (const std::string& propertyId : propertyIds) {
+    converter(propertyId, model, propertyTable);
+  }
+}
+
+/*static*/ void DeferredPropertyTableProperties::convertAll(Model& model) {
+  ExtensionModelExtStructuralMetadata* pMetadata =
+      model.getExtension<ExtensionModelExtStructuralMetadata>();
+  if (!pMetadata) {
+    return;
+  }
+
+  for (PropertyTable& propertyTable : pMetadata->propertyTables) {
+    DeferredPropertyTableProperties* pDeferred =
+        propertyTable.getExtension<DeferredPropertyTableProperties>();
+    if (pDeferred) {
+      pDeferred->convertAll(model, propertyTable);
+    }
+  }
+}
+
+void DeferredPropertyTableProperties::releaseIfConverted() noexcept {
+  if (this->_propertyIds.empty()) {
+    this->_converter = nullptr;
+    this->_sourceSizeBytes = 0;
+  }
+}
+
+} // namespace CesiumGltf
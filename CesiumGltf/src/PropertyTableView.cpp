@@ -1,6 +1,7 @@
 #include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/BufferView.h>
 #include <CesiumGltf/ClassProperty.h>
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumGltf/PropertyArrayView.h>
@@ -135,6 +136,8 @@ PropertyTableView::PropertyTableView(
       _pPropertyTable{&propertyTable},
       _pClass{nullptr},
       _pEnumDefinitions{},
+      _pMutableModel{nullptr},
+      _pMutablePropertyTable{nullptr},
       _status() {
   const ExtensionModelExtStructuralMetadata* pMetadata =
       model.getExtension<ExtensionModelExtStructuralMetadata>();
@@ -159,6 +162,14 @@ PropertyTableView::PropertyTableView(
   _pEnumDefinitions = &schema->enums;
 }
 
+PropertyTableView::PropertyTableView(Model& model, PropertyTable& propertyTable)
+    : PropertyTableView(
+          static_cast<const Model&>(model),
+          static_cast<const PropertyTable&>(propertyTable)) {
+  _pMutableModel = &model;
+  _pMutablePropertyTable = &propertyTable;
+}
+
 const ClassProperty*
 PropertyTableView::getClassProperty(const std::string& propertyId) const {
   if (_status != PropertyTableViewStatus::Valid) {
@@ -173,6 +184,20 @@ PropertyTableView::getClassProperty(const std::string& propertyId) const {
   return &propertyIter->second;
 }
 
+bool PropertyTableView::convertDeferredProperty(
+    const std::string& propertyId) const {
+  if (!_pMutableModel || !_pMutablePropertyTable) {
+    return false;
+  }
+
+  DeferredPropertyTableProperties* pDeferred =
+      _pMutablePropertyTable->getExtension<DeferredPropertyTableProperties>();
+  return pDeferred && pDeferred->convertProperty(
+                          propertyId,
+                          *_pMutableModel,
+                          *_pMutablePropertyTable);
+}
+
 PropertyViewStatusType PropertyTableView::getBufferSafe(
     int32_t bufferViewIdx,
     std::span<const std::byte>& buffer) const noexcept {
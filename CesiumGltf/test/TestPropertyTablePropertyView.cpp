@@ -19,9 +19,11 @@
 #include <glm/ext/vector_int3.hpp>
 #include <glm/ext/vector_int3_sized.hpp>
 #include <glm/ext/vector_uint2_sized.hpp>
+#include <glm/ext/vector_uint3_sized.hpp>
 #include <glm/ext/vector_uint4_sized.hpp>
 #include <glm/fwd.hpp>
 
+#include <chrono>
 #include <cstdint>
 #include <optional>
 #include <string_view>
@@ -38,6 +40,8 @@
 #include <climits>
 #include <cstddef>
 #include <cstring>
+#include <iostream>
+#include <memory>
 #include <ostream>
 #include <span>
 #include <string>
@@ -49,6 +53,42 @@ using namespace CesiumUtility;
 
 namespace {
 
+// Checks that getRange gives the same values as calling get for each element,
+// over the whole view and over a range that starts partway through it.
+template <typename T, bool Normalized>
+static void
+checkGetRange(const PropertyTablePropertyView<T, Normalized>& property) {
+  using ValueType = typename decltype(property.get(0))::value_type;
+  const size_t size = static_cast<size_t>(property.size());
+
+  std::unique_ptr<ValueType[]> values = std::make_unique<ValueType[]>(size);
+  std::vector<uint8_t> present(size);
+  const int64_t presentCount = property.getRange(
+      0,
+      std::span<ValueType>(values.get(), size),
+      std::span<uint8_t>(present));
+
+  int64_t expectedCount = 0;
+  for (int64_t i = 0; i < property.size(); ++i) {
+    const size_t ui = static_cast<size_t>(i);
+    const auto expected = property.get(i);
+    REQUIRE((present[ui] == 1) == expected.has_value());
+    if (expected) {
+      REQUIRE(values[ui] == *expected);
+      ++expectedCount;
+    }
+  }
+  REQUIRE(presentCount == expectedCount);
+
+  if (size > 1) {
+    std::unique_ptr<ValueType[]> tail = std::make_unique<ValueType[]>(size);
+    property.getRange(1, std::span<ValueType>(tail.get(), size - 1));
+    for (size_t i = 0; i < size - 1; ++i) {
+      REQUIRE(tail[i] == values[i + 1]);
+    }
+  }
+}
+
 template <typename T>
 static void
 checkArrayEqual(PropertyArrayView<T> arrayView, std::vector<T> expected) {
@@ -86,6 +126,8 @@ template <typename T> static void checkNumeric(const std::vector<T>& expected) {
     REQUIRE(property.getRaw(i) == expected[static_cast<size_t>(i)]);
     REQUIRE(property.get(i) == property.getRaw(i));
   }
+
+  checkGetRange(property);
 }
 
 template <typename T>
@@ -131,6 +173,8 @@ static void checkNumeric(
       REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
     }
   }
+
+  checkGetRange(property);
 }
 
 template <typename T, typename D = typename TypeToNormalizedType<T>::type>
@@ -174,6 +218,8 @@ static void checkNormalizedNumeric(
     REQUIRE(property.getRaw(i) == values[static_cast<size_t>(i)]);
     REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
   }
+
+  checkGetRange(property);
 }
 
 template <typename DataType, typename OffsetType>
@@ -1332,6 +1378,8 @@ TEST_CASE("Check boolean PropertyTablePropertyView") {
     REQUIRE(property.getRaw(i) == bits[static_cast<size_t>(i)]);
     REQUIRE(property.get(i) == property.getRaw(i));
   }
+
+  checkGetRange(property);
 }
 
 TEST_CASE("Check string PropertyTablePropertyView") {
@@ -1390,6 +1438,8 @@ TEST_CASE("Check string PropertyTablePropertyView") {
       REQUIRE(property.getRaw(i) == strings[static_cast<size_t>(i)]);
       REQUIRE(property.get(i) == strings[static_cast<size_t>(i)]);
     }
+
+    checkGetRange(property);
   }
 
   SUBCASE("Uses NoData value") {
@@ -1417,6 +1467,8 @@ TEST_CASE("Check string PropertyTablePropertyView") {
       REQUIRE(property.getRaw(i) == strings[static_cast<size_t>(i)]);
       REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
     }
+
+    checkGetRange(property);
   }
 
   SUBCASE("Uses NoData and Default value") {
@@ -1445,6 +1497,8 @@ TEST_CASE("Check string PropertyTablePropertyView") {
       REQUIRE(property.getRaw(i) == strings[static_cast<size_t>(i)]);
       REQUIRE(property.get(i) == expected[static_cast<size_t>(i)]);
     }
+
+    checkGetRange(property);
   }
 }
 
@@ -3746,6 +3800,190 @@ TEST_CASE("Check variable-length boolean array PropertyTablePropertyView") {
   }
 }
 
+TEST_CASE("Check PropertyTablePropertyView::getRange") {
+  SUBCASE("Converts normalized values to another type") {
+    std::vector<glm::u8vec3> values{
+        glm::u8vec3(0, 64, 255),
+        glm::u8vec3(255, 255, 255),
+        glm::u8vec3(128, 0, 32)};
+    std::vector<std::byte> data(values.size() * sizeof(glm::u8vec3));
+    std::memcpy(data.data(), values.data(), data.size());
+
+    PropertyTableProperty propertyTableProperty;
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::VEC3;
+    classProperty.componentType = ClassProperty::ComponentType::UINT8;
+    classProperty.normalized = true;
+    classProperty.noData = JsonValue::Array{255, 255, 255};
+    classProperty.scale = JsonValue::Array{2, 2, 2};
+
+    PropertyTablePropertyView<glm::u8vec3, true> property(
+        propertyTableProperty,
+        classProperty,
+        static_cast<int64_t>(values.size()),
+        std::span<const std::byte>(data.data(), data.size()));
+    REQUIRE(property.status() == PropertyTablePropertyViewStatus::Valid);
+
+    std::vector<glm::vec3> result(values.size(), glm::vec3(-1.0f));
+    std::vector<uint8_t> present(values.size());
+    CHECK(
+        property.getRange(
+            0,
+            std::span<glm::vec3>(result),
+            std::span<uint8_t>(present)) == 2);
+
+    CHECK(present == std::vector<uint8_t>{1, 0, 1});
+    CHECK(result[0] == glm::vec3(*property.get(0)));
+    CHECK(result[1] == glm::vec3(0.0f));
+    CHECK(result[2] == glm::vec3(*property.get(2)));
+  }
+
+  SUBCASE("Fills an empty property with its default value") {
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::FLOAT32;
+    classProperty.defaultProperty = 5.5;
+
+    PropertyTablePropertyView<float> property(classProperty, 3);
+    REQUIRE(
+        property.status() ==
+        PropertyTablePropertyViewStatus::EmptyPropertyWithDefault);
+
+    std::vector<float> result(3);
+    CHECK(property.getRange(0, std::span<float>(result)) == 3);
+    CHECK(result == std::vector<float>{5.5f, 5.5f, 5.5f});
+  }
+}
+
+TEST_CASE(
+    "PropertyTablePropertyView::getRange benchmark" * doctest::skip(true)) {
+  constexpr size_t count = 4 * 1024 * 1024;
+  constexpr int iterations = 20;
+
+  // Reports the rate at which `readAll` reads `count` elements.
+  const auto measure = [](const char* name, const auto& readAll) {
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      readAll();
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    std::cout << "  " << name << ": "
+              << double(count) * double(iterations) / seconds / 1.0e6
+              << " million elements/sec\n";
+  };
+
+  SUBCASE("Float scalars with offset, scale, and no data") {
+    std::vector<float> values(count);
+    for (size_t i = 0; i < count; ++i) {
+      values[i] = float(i % 1000);
+    }
+    std::vector<std::byte> data(count * sizeof(float));
+    std::memcpy(data.data(), values.data(), data.size());
+
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::FLOAT32;
+    classProperty.offset = 1.0;
+    classProperty.scale = 2.0;
+    classProperty.noData = 999.0;
+    classProperty.defaultProperty = 0.0;
+
+    PropertyTablePropertyView<float> property(
+        PropertyTableProperty(),
+        classProperty,
+        static_cast<int64_t>(count),
+        std::span<const std::byte>(data.data(), data.size()));
+    REQUIRE(property.status() == PropertyTablePropertyViewStatus::Valid);
+
+    std::vector<float> result(count);
+    std::cout << "float scalars:\n";
+    measure("get", [&]() {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] = property.get(static_cast<int64_t>(i)).value_or(0.0f);
+      }
+    });
+    measure("getRange", [&]() {
+      property.getRange(0, std::span<float>(result));
+    });
+  }
+
+  SUBCASE("Normalized uint8 vec3 to float vec3") {
+    std::vector<glm::u8vec3> values(count);
+    for (size_t i = 0; i < count; ++i) {
+      values[i] = glm::u8vec3(uint8_t(i), uint8_t(i >> 8), uint8_t(i >> 16));
+    }
+    std::vector<std::byte> data(count * sizeof(glm::u8vec3));
+    std::memcpy(data.data(), values.data(), data.size());
+
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::VEC3;
+    classProperty.componentType = ClassProperty::ComponentType::UINT8;
+    classProperty.normalized = true;
+
+    PropertyTablePropertyView<glm::u8vec3, true> property(
+        PropertyTableProperty(),
+        classProperty,
+        static_cast<int64_t>(count),
+        std::span<const std::byte>(data.data(), data.size()));
+    REQUIRE(property.status() == PropertyTablePropertyViewStatus::Valid);
+
+    std::vector<glm::vec3> result(count);
+    std::cout << "normalized uint8 vec3:\n";
+    measure("get", [&]() {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] = glm::vec3(*property.get(static_cast<int64_t>(i)));
+      }
+    });
+    measure("getRange", [&]() {
+      property.getRange(0, std::span<glm::vec3>(result));
+    });
+  }
+
+  SUBCASE("Strings") {
+    std::string buffer;
+    std::vector<uint32_t> offsets(count + 1);
+    for (size_t i = 0; i < count; ++i) {
+      offsets[i] = static_cast<uint32_t>(buffer.size());
+      buffer += std::to_string(i % 997);
+    }
+    offsets[count] = static_cast<uint32_t>(buffer.size());
+
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::STRING;
+    classProperty.noData = "0";
+
+    PropertyTablePropertyView<std::string_view> property(
+        PropertyTableProperty(),
+        classProperty,
+        static_cast<int64_t>(count),
+        std::span<const std::byte>(
+            reinterpret_cast<const std::byte*>(buffer.data()),
+            buffer.size()),
+        std::span<const std::byte>(),
+        std::span<const std::byte>(
+            reinterpret_cast<const std::byte*>(offsets.data()),
+            offsets.size() * sizeof(uint32_t)),
+        PropertyComponentType::None,
+        PropertyComponentType::Uint32);
+    REQUIRE(property.status() == PropertyTablePropertyViewStatus::Valid);
+
+    std::vector<std::string_view> result(count);
+    std::cout << "strings:\n";
+    measure("get", [&]() {
+      for (size_t i = 0; i < count; ++i) {
+        result[i] =
+            property.get(static_cast<int64_t>(i)).value_or(std::string_view());
+      }
+    });
+    measure("getRange", [&]() {
+      property.getRange(0, std::span<std::string_view>(result));
+    });
+  }
+}
+
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic pop
 #endif
@@ -4,6 +4,7 @@
 #include <CesiumGltf/BufferView.h>
 #include <CesiumGltf/Class.h>
 #include <CesiumGltf/ClassProperty.h>
+#include <CesiumGltf/DeferredPropertyTableProperties.h>
 #include <CesiumGltf/EnumValue.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Model.h>
@@ -33,6 +34,7 @@
 #include <cstdint>
 #include <cstring>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -5809,3 +5811,146 @@ TEST_CASE("Test callback for empty PropertyTableProperty with default value") {
 
   REQUIRE(invokedCallbackCount == 1);
 }
+
+TEST_CASE("Test deferred PropertyTableProperty") {
+  std::vector<uint8_t> values = {3, 1, 4, 1, 5};
+
+  Model model;
+  ExtensionModelExtStructuralMetadata& metadata =
+      model.addExtension<ExtensionModelExtStructuralMetadata>();
+  Schema& schema = metadata.schema.emplace();
+  ClassProperty& testClassProperty =
+      schema.classes["TestClass"].properties["DeferredProperty"];
+  testClassProperty.type = ClassProperty::Type::SCALAR;
+  testClassProperty.componentType = ClassProperty::ComponentType::UINT8;
+
+  PropertyTable& propertyTable = metadata.propertyTables.emplace_back();
+  propertyTable.classProperty = "TestClass";
+  propertyTable.count = static_cast<int64_t>(values.size());
+
+  uint32_t converterCallCount = 0;
+  propertyTable.addExtension<DeferredPropertyTableProperties>(
+      std::vector<std::string>{"DeferredProperty"},
+      [&values, &converterCallCount](
+          const std::string& propertyId,
+          Model& convertedModel,
+          PropertyTable& convertedTable) {
+        ++converterCallCount;
+        addBufferToModel(convertedModel, values);
+        convertedTable.properties[propertyId].values =
+            static_cast<int32_t>(convertedModel.bufferViews.size() - 1);
+
+        // Finish the class property, in case it was a placeholder.
+        ClassProperty& classProperty =
+            convertedModel.getExtension<ExtensionModelExtStructuralMetadata>()
+                ->schema->classes[convertedTable.classProperty]
+                .properties[propertyId];
+        classProperty.type = ClassProperty::Type::SCALAR;
+        classProperty.componentType = ClassProperty::ComponentType::UINT8;
+      },
+      1000);
+
+  SUBCASE("Views of a const model do not convert deferred properties") {
+    const Model& constModel = model;
+    const PropertyTable& constPropertyTable = propertyTable;
+    PropertyTableView view(constModel, constPropertyTable);
+    REQUIRE(view.status() == PropertyTableViewStatus::Valid);
+
+    const ClassProperty* classProperty =
+        view.getClassProperty("DeferredProperty");
+    REQUIRE(classProperty);
+    CHECK(classProperty->componentType == ClassProperty::ComponentType::UINT8);
+
+    PropertyTablePropertyView<uint8_t> property =
+        view.getPropertyView<uint8_t>("DeferredProperty");
+    CHECK(
+        property.status() ==
+        PropertyTablePropertyViewStatus::ErrorNonexistentProperty);
+    CHECK(converterCallCount == 0);
+  }
+
+  SUBCASE("Views of a non-const model convert deferred properties") {
+    PropertyTableView view(model, propertyTable);
+    REQUIRE(view.status() == PropertyTableViewStatus::Valid);
+    CHECK(view.getClassProperty("DeferredProperty") == &testClassProperty);
+    CHECK(converterCallCount == 0);
+
+    PropertyTablePropertyView<uint8_t> property =
+        view.getPropertyView<uint8_t>("DeferredProperty");
+    REQUIRE(property.status() == PropertyTablePropertyViewStatus::Valid);
+    REQUIRE(property.size() == static_cast<int64_t>(values.size()));
+    for (int64_t i = 0; i < property.size(); ++i) {
+      CHECK(property.get(i) == values[static_cast<size_t>(i)]);
+    }
+
+    // The values are stored in the buffers of the model itself.
+    CHECK(model.buffers.size() == 1);
+    CHECK(propertyTable.properties.count("DeferredProperty") == 1);
+    CHECK(converterCallCount == 1);
+
+    uint32_t invokedCallbackCount = 0;
+    view.forEachProperty([&invokedCallbackCount](
+                             const std::string& propertyId,
+                             auto propertyValue) {
+      ++invokedCallbackCount;
+      CHECK(propertyId == "DeferredProperty");
+      CHECK(propertyValue.status() == PropertyTablePropertyViewStatus::Valid);
+    });
+    CHECK(invokedCallbackCount == 1);
+    CHECK(converterCallCount == 1);
+  }
+
+  SUBCASE("Converting a deferred property finishes its class property") {
+    testClassProperty.type = ClassProperty::Type::STRING;
+    testClassProperty.componentType = std::nullopt;
+
+    PropertyTableView view(model, propertyTable);
+    REQUIRE(view.status() == PropertyTableViewStatus::Valid);
+
+    uint32_t invokedCallbackCount = 0;
+    view.getPropertyView(
+        "DeferredProperty",
+        [&values, &invokedCallbackCount](
+            const std::string& /*propertyId*/,
+            auto propertyValue) mutable {
+          ++invokedCallbackCount;
+          if constexpr (std::is_same_v<
+                            PropertyTablePropertyView<uint8_t>,
+                            decltype(propertyValue)>) {
+            REQUIRE(
+                propertyValue.status() ==
+                PropertyTablePropertyViewStatus::Valid);
+            REQUIRE(
+                propertyValue.size() == static_cast<int64_t>(values.size()));
+            for (int64_t i = 0; i < propertyValue.size(); ++i) {
+              CHECK(propertyValue.get(i) == values[static_cast<size_t>(i)]);
+            }
+          } else {
+            FAIL("getPropertyView returned PropertyTablePropertyView of "
+                 "incorrect type for DeferredProperty.");
+          }
+        });
+    CHECK(invokedCallbackCount == 1);
+    CHECK(converterCallCount == 1);
+    CHECK(testClassProperty.type == ClassProperty::Type::SCALAR);
+  }
+
+  SUBCASE("convertAll converts every deferred property") {
+    const DeferredPropertyTableProperties* pDeferred =
+        propertyTable.getExtension<DeferredPropertyTableProperties>();
+    REQUIRE(pDeferred);
+    CHECK(pDeferred->hasProperty("DeferredProperty"));
+    CHECK(pDeferred->getSizeBytes() == 1000);
+
+    DeferredPropertyTableProperties::convertAll(model);
+    CHECK(converterCallCount == 1);
+    CHECK(pDeferred->getPropertyIds().empty());
+    CHECK(pDeferred->getSizeBytes() == 0);
+
+    PropertyTableView view(model, propertyTable);
+    PropertyTablePropertyView<uint8_t> property =
+        view.getPropertyView<uint8_t>("DeferredProperty");
+    CHECK(property.status() == PropertyTablePropertyViewStatus::Valid);
+    CHECK(converterCallCount == 1);
+  }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <CesiumGltfContent/Library.h>
+
+#include <cstdint>
+#include <span>
+
+namespace CesiumGltf {
+struct MeshPrimitive;
+struct Model;
+} // namespace CesiumGltf
+
+namespace CesiumGltfContent {
+
+/**
+ * @brief Functions for the `CESIUM_tile_edges` extension, which lists the
+ * vertices on each edge of a terrain tile that has no skirts.
+ *
+ * Clients use these lists to stitch neighboring tiles together by sharing
+ * their edge vertices. Each edge is sorted in the order in which a skirt would
+ * be added along it; see {@link SkirtMeshMetadata}.
+ */
+struct CESIUMGLTFCONTENT_API TileEdges {
+  /**
+   * @brief Stores the indices of the vertices on each edge of a tile in a
+   * model, and references them from the `CESIUM_tile_edges` extension of a
+   * primitive.
+   *
+   * The indices of all four edges are stored in one new buffer, with one
+   * `UNSIGNED_INT` accessor for each edge. An edge without any vertices has no
+   * accessor, so its property of the extension is -1. If no edge has any
+   * vertices, no buffer is added.
+   *
+   * @param model The model to add the buffer, buffer view, and accessors to.
+   * @param primitive The primitive to add the extension to.
+   * @param west The indices of the vertices on the west edge.
+   * @param south The indices of the vertices on the south edge.
+   * @param east The indices of the vertices on the east edge.
+   * @param north The indices of the vertices on the north edge.
+   */
+  static void addToPrimitive(
+      CesiumGltf::Model& model,
+      CesiumGltf::MeshPrimitive& primitive,
+      std::span<const uint32_t> west,
+      std::span<const uint32_t> south,
+      std::span<const uint32_t> east,
+      std::span<const uint32_t> north);
+
+  /**
+   * @brief Stores the indices of the vertices on each edge of a tile in a
+   * model, and references them from the `CESIUM_tile_edges` extension of a
+   * primitive.
+   *
+   * The indices of all four edges are stored in one new buffer, with one
+   * `UNSIGNED_SHORT` accessor for each edge. An edge without any vertices has
+   * no accessor, so its property of the extension is -1. If no edge has any
+   * vertices, no buffer is added.
+   *
+   * @param model The model to add the buffer, buffer view, and accessors to.
+   * @param primitive The primitive to add the extension to.
+   * @param west The indices of the vertices on the west edge.
+   * @param south The indices of the vertices on the south edge.
+   * @param east The indices of the vertices on the east edge.
+   * @param north The indices of the vertices on the north edge.
+   */
+  static void addToPrimitive(
+      CesiumGltf::Model& model,
+      CesiumGltf::MeshPrimitive& primitive,
+      std::span<const uint16_t> west,
+      std::span<const uint16_t> south,
+      std::span<const uint16_t> east,
+      std::span<const uint16_t> north);
+};
+
+} // namespace CesiumGltfContent
@@ -0,0 +1,109 @@
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/ExtensionCesiumTileEdges.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/TileEdges.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+
+using namespace CesiumGltf;
+
+namespace CesiumGltfContent {
+
+namespace {
+template <typename E>
+void addTileEdges(
+    Model& model,
+    MeshPrimitive& primitive,
+    const std::span<const E> (&edges)[4],
+    int32_t componentType) {
+  size_t edgeIndicesCount = 0;
+  for (const std::span<const E>& edge : edges) {
+    edgeIndicesCount += edge.size();
+  }
+
+  // An edge without vertices has no accessor, because glTF does not allow
+  // accessors, buffer views, or buffers without any elements.
+  int32_t accessorIndices[4] = {-1, -1, -1, -1};
+  if (edgeIndicesCount > 0) {
+    const size_t bufferIndex = model.buffers.size();
+    Buffer& buffer = model.buffers.emplace_back();
+    buffer.cesium.data.resize(edgeIndicesCount * sizeof(E));
+    buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+    const size_t bufferViewIndex = model.bufferViews.size();
+    BufferView& bufferView = model.bufferViews.emplace_back();
+    bufferView.buffer = int32_t(bufferIndex);
+    bufferView.byteOffset = 0;
+    bufferView.byteLength = buffer.byteLength;
+
+    size_t byteOffset = 0;
+    for (size_t i = 0; i < 4; ++i) {
+      const std::span<const E>& edge = edges[i];
+      if (edge.empty()) {
+        continue;
+      }
+
+      std::memcpy(
+          buffer.cesium.data.data() + byteOffset,
+          edge.data(),
+          edge.size() * sizeof(E));
+
+      accessorIndices[i] = int32_t(model.accessors.size());
+      Accessor& accessor = model.accessors.emplace_back();
+      accessor.bufferView = int32_t(bufferViewIndex);
+      accessor.byteOffset = int64_t(byteOffset);
+      accessor.count = int64_t(edge.size());
+      accessor.componentType = componentType;
+      accessor.type = Accessor::Type::SCALAR;
+
+      byteOffset += edge.size() * sizeof(E);
+    }
+  }
+
+  ExtensionCesiumTileEdges& tileEdges =
+      primitive.addExtension<ExtensionCesiumTileEdges>();
+  tileEdges.left = accessorIndices[0];
+  tileEdges.bottom = accessorIndices[1];
+  tileEdges.right = accessorIndices[2];
+  tileEdges.top = accessorIndices[3];
+  model.addExtensionUsed(ExtensionCesiumTileEdges::ExtensionName);
+}
+} // namespace
+
+/*static*/ void TileEdges::addToPrimitive(
+    Model& model,
+    MeshPrimitive& primitive,
+    std::span<const uint32_t> west,
+    std::span<const uint32_t> south,
+    std::span<const uint32_t> east,
+    std::span<const uint32_t> north) {
+  const std::span<const uint32_t> edges[] = {west, south, east, north};
+  addTileEdges(
+      model,
+      primitive,
+      edges,
+      Accessor::ComponentType::UNSIGNED_INT);
+}
+
+/*static*/ void TileEdges::addToPrimitive(
+    Model& model,
+    MeshPrimitive& primitive,
+    std::span<const uint16_t> west,
+    std::span<const uint16_t> south,
+    std::span<const uint16_t> east,
+    std::span<const uint16_t> north) {
+  const std::span<const uint16_t> edges[] = {west, south, east, north};
+  addTileEdges(
+      model,
+      primitive,
+      edges,
+      Accessor::ComponentType::UNSIGNED_SHORT);
+}
+
+} // namespace CesiumGltfContent
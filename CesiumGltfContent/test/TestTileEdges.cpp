@@ -0,0 +1,95 @@
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/ExtensionCesiumTileEdges.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/TileEdges.h>
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using namespace CesiumGltf;
+using namespace CesiumGltfContent;
+
+TEST_CASE("TileEdges::addToPrimitive") {
+  Model model;
+  MeshPrimitive primitive;
+
+  SUBCASE("stores each edge in its own accessor") {
+    const std::vector<uint16_t> west{0, 3, 6};
+    const std::vector<uint16_t> south{6, 7, 8};
+    const std::vector<uint16_t> east{8, 5, 2};
+    const std::vector<uint16_t> north{2, 1, 0};
+    TileEdges::addToPrimitive(
+        model,
+        primitive,
+        std::span(west),
+        std::span(south),
+        std::span(east),
+        std::span(north));
+
+    const ExtensionCesiumTileEdges* pTileEdges =
+        primitive.getExtension<ExtensionCesiumTileEdges>();
+    REQUIRE(pTileEdges);
+    CHECK(model.isExtensionUsed(ExtensionCesiumTileEdges::ExtensionName));
+    CHECK(model.buffers.size() == 1);
+    CHECK(model.bufferViews.size() == 1);
+    CHECK(model.accessors.size() == 4);
+
+    AccessorView<uint16_t> eastView(model, pTileEdges->right);
+    REQUIRE(eastView.status() == AccessorViewStatus::Valid);
+    REQUIRE(eastView.size() == int64_t(east.size()));
+    for (int64_t i = 0; i < eastView.size(); ++i) {
+      CHECK(eastView[i] == east[size_t(i)]);
+    }
+  }
+
+  SUBCASE("skips an empty edge") {
+    const std::vector<uint32_t> west{0, 3, 6};
+    const std::vector<uint32_t> south;
+    const std::vector<uint32_t> east{8, 5, 2};
+    const std::vector<uint32_t> north{2, 1, 0};
+    TileEdges::addToPrimitive(
+        model,
+        primitive,
+        std::span(west),
+        std::span(south),
+        std::span(east),
+        std::span(north));
+
+    const ExtensionCesiumTileEdges* pTileEdges =
+        primitive.getExtension<ExtensionCesiumTileEdges>();
+    REQUIRE(pTileEdges);
+    CHECK(pTileEdges->bottom == -1);
+    REQUIRE(model.accessors.size() == 3);
+    for (const Accessor& accessor : model.accessors) {
+      CHECK(accessor.count > 0);
+    }
+
+    AccessorView<uint32_t> eastView(model, pTileEdges->right);
+    REQUIRE(eastView.status() == AccessorViewStatus::Valid);
+    REQUIRE(eastView.size() == int64_t(east.size()));
+    for (int64_t i = 0; i < eastView.size(); ++i) {
+      CHECK(eastView[i] == east[size_t(i)]);
+    }
+  }
+
+  SUBCASE("adds no buffer if every edge is empty") {
+    const std::span<const uint32_t> empty;
+    TileEdges::addToPrimitive(model, primitive, empty, empty, empty, empty);
+
+    const ExtensionCesiumTileEdges* pTileEdges =
+        primitive.getExtension<ExtensionCesiumTileEdges>();
+    REQUIRE(pTileEdges);
+    CHECK(pTileEdges->left == -1);
+    CHECK(pTileEdges->bottom == -1);
+    CHECK(pTileEdges->right == -1);
+    CHECK(pTileEdges->top == -1);
+    CHECK(model.buffers.empty());
+    CHECK(model.bufferViews.empty());
+    CHECK(model.accessors.empty());
+  }
+}
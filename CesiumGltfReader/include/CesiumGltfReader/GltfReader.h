@@ -157,6 +157,22 @@ struct CESIUMGLTFREADER_API GltfReaderOptions {
    */
   bool resolveExternalStructuralMetadata = true;
 
+  /**
+   * @brief Whether the values of the JSON properties of a B3DM batch table are
+   * converted to `EXT_structural_metadata` only when they are first needed.
+   *
+   * Inferring the type of JSON batch table properties and copying their
+   * values into binary buffers can take much of the time and memory needed to
+   * load a tile. When this is true, each JSON property is added to the schema
+   * class as a string placeholder, and the batch table JSON is kept with the
+   * model. The type of a property is only inferred, and its values only added
+   * to the model's buffers and property table, when they are first requested
+   * from a \ref CesiumGltf::PropertyTableView of the non-const model, or when
+   * \ref CesiumGltf::DeferredPropertyTableProperties::convertAll is called.
+   * The retained JSON counts towards the size of the tile until then.
+   */
+  bool deferBatchTableConversion = false;
+
   /**
    * @brief Options for handling values of @ref CesiumGltf::MeshPrimitive::Mode
    * that appear in a glTF mesh primitive.
@@ -4,6 +4,8 @@
 #include <CesiumGltfReader/NetworkImageAssetDescriptor.h>
 #include <CesiumGltfReader/NetworkSchemaAssetDescriptor.h>
 
+#include <cstddef>
+
 namespace CesiumGltf {
 struct Schema;
 }
@@ -23,6 +25,17 @@ public:
    */
   static CesiumUtility::IntrusivePointer<GltfSharedAssetSystem> getDefault();
 
+  /**
+   * @brief Creates a new `GltfSharedAssetSystem` with the default depots.
+   *
+   * @param imageDepotShardCount The number of independently-locked shards in
+   * the image depot. More than one shard reduces contention when many threads
+   * load images at once. See \ref CesiumAsync::SharedAssetDepot. The depot
+   * returned by \ref getDefault has a single shard.
+   */
+  static CesiumUtility::IntrusivePointer<GltfSharedAssetSystem>
+  create(size_t imageDepotShardCount = 1);
+
   virtual ~GltfSharedAssetSystem() = default;
 
   /**
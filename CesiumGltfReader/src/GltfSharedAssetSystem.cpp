@@ -9,6 +9,7 @@
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumUtility/Result.h>
 
+#include <cstddef>
 #include <functional>
 
 using namespace CesiumAsync;
@@ -17,18 +18,28 @@ using namespace CesiumGltfReader;
 using namespace CesiumImage;
 using namespace CesiumUtility;
 
-namespace {
+namespace CesiumGltfReader {
+
+/*static*/ CesiumUtility::IntrusivePointer<GltfSharedAssetSystem>
+GltfSharedAssetSystem::getDefault() {
+  static CesiumUtility::IntrusivePointer<GltfSharedAssetSystem> pDefault =
+      GltfSharedAssetSystem::create();
+  return pDefault;
+}
 
-CesiumUtility::IntrusivePointer<GltfSharedAssetSystem> createDefault() {
+/*static*/ CesiumUtility::IntrusivePointer<GltfSharedAssetSystem>
+GltfSharedAssetSystem::create(size_t imageDepotShardCount) {
   CesiumUtility::IntrusivePointer<GltfSharedAssetSystem> p =
       new GltfSharedAssetSystem();
 
-  p->pImage.emplace(std::function(
-      [](const SharedAssetContext& context,
-         const NetworkImageAssetDescriptor& key)
-          -> Future<ResultPointer<ImageAsset>> {
-        return key.load(context.asyncSystem, context.pAssetAccessor);
-      }));
+  p->pImage.emplace(
+      std::function(
+          [](const SharedAssetContext& context,
+             const NetworkImageAssetDescriptor& key)
+              -> Future<ResultPointer<ImageAsset>> {
+            return key.load(context.asyncSystem, context.pAssetAccessor);
+          }),
+      imageDepotShardCount);
 
   p->pExternalMetadataSchema.emplace(std::function(
       [](const SharedAssetContext& context,
@@ -40,15 +51,4 @@ CesiumUtility::IntrusivePointer<GltfSharedAssetSystem> createDefault() {
   return p;
 }
 
-} // namespace
-
-namespace CesiumGltfReader {
-
-/*static*/ CesiumUtility::IntrusivePointer<GltfSharedAssetSystem>
-GltfSharedAssetSystem::getDefault() {
-  static CesiumUtility::IntrusivePointer<GltfSharedAssetSystem> pDefault =
-      createDefault();
-  return pDefault;
-}
-
 } // namespace CesiumGltfReader
@@ -3,7 +3,12 @@
 #include <CesiumGltfWriter/Library.h>
 #include <CesiumJsonWriter/ExtensionWriterContext.h>
 
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
 #include <span>
+#include <string>
+#include <vector>
 
 // forward declarations
 namespace CesiumGltf {
@@ -48,8 +53,26 @@ struct CESIUMGLTFWRITER_API GltfWriterOptions {
    * EXT_mesh_features this value should be set to 8.
    */
   size_t binaryChunkByteAlignment = 4;
+
+  /**
+   * @brief If the glTF JSON should be written with a
+   * {@link CesiumJsonWriter::BufferedJsonWriter}, which is faster for large
+   * models but formats some floating-point numbers differently. Ignored if
+   * {@link prettyPrint} is true.
+   */
+  bool useBufferedJsonWriter = false;
 };
 
+/**
+ * @brief A function that receives consecutive pieces of a glTF or GLB as it is
+ * written by {@link GltfWriter::writeGltfToSink} or
+ * {@link GltfWriter::writeGlbToSink}.
+ *
+ * The bytes are only valid for the duration of the call. Return false to stop
+ * writing, for example because the destination is full.
+ */
+using GltfWriterSink = std::function<bool(std::span<const std::byte> bytes)>;
+
 /**
  * @brief Writes glTF.
  */
@@ -87,6 +110,28 @@ public:
       const CesiumGltf::Model& model,
       const GltfWriterOptions& options = GltfWriterOptions()) const;
 
+  /**
+   * @brief Serializes the provided model as glTF JSON, passing it in chunks to
+   * a sink as it is written instead of gathering it in a byte vector.
+   *
+   * The JSON is always written compactly by a
+   * {@link CesiumJsonWriter::BufferedJsonWriter}, as if
+   * {@link GltfWriterOptions::useBufferedJsonWriter} were set. Like
+   * {@link writeGltf}, this ignores internal data such as
+   * @ref CesiumGltf::BufferCesium.
+   *
+   * The returned {@link GltfWriterResult::gltfBytes} is always empty. If the
+   * sink returns false, the rest of the JSON is discarded and an error is
+   * reported.
+   *
+   * @param model The model.
+   * @param sink The function that receives the chunks of the JSON, in order.
+   * @return The result of writing the glTF.
+   */
+  GltfWriterResult writeGltfToSink(
+      const CesiumGltf::Model& model,
+      const GltfWriterSink& sink) const;
+
   /**
    * @brief Serializes the provided model into a glb byte vector.
    *
@@ -104,6 +149,50 @@ public:
       const std::span<const std::byte>& bufferData,
       const GltfWriterOptions& options = GltfWriterOptions()) const;
 
+  /**
+   * @brief Serializes the provided model as a GLB, passing it piece by piece
+   * to a sink instead of gathering it in a byte vector.
+   *
+   * Unlike {@link writeGlb}, the binary chunk is built from the data of the
+   * model's buffers, without first concatenating them. It is laid out the way
+   * {@link CesiumGltfContent::GltfUtilities::collapseToSingleBuffer} would lay
+   * out the buffers, and the written buffers and buffer views are adjusted to
+   * match, but the model itself is not modified. The data of each buffer is
+   * passed to the sink directly from the model, so it is never copied.
+   *
+   * Buffers with a URI and no data are written with their URI and are not
+   * part of the binary chunk. If the first buffer is such a buffer, the
+   * binary chunk is written as a new first buffer in front of it, instead of
+   * taking over the first buffer and dropping its URI.
+   *
+   * The returned {@link GltfWriterResult::gltfBytes} is always empty. If the
+   * sink returns false, writing stops and an error is reported.
+   *
+   * @param model The model.
+   * @param sink The function that receives the bytes of the GLB, in order.
+   * @param options Options for how to write the glb.
+   * @return The result of writing the glb.
+   */
+  GltfWriterResult writeGlbToSink(
+      const CesiumGltf::Model& model,
+      const GltfWriterSink& sink,
+      const GltfWriterOptions& options = GltfWriterOptions()) const;
+
+  /**
+   * @brief Serializes the provided model as a GLB directly to an output
+   * stream, such as a `std::ofstream`, like {@link writeGlbToSink}.
+   *
+   * @param model The model.
+   * @param stream The stream to write the GLB to. It should be opened in
+   * binary mode.
+   * @param options Options for how to write the glb.
+   * @return The result of writing the glb.
+   */
+  GltfWriterResult writeGlbToStream(
+      const CesiumGltf::Model& model,
+      std::ostream& stream,
+      const GltfWriterOptions& options = GltfWriterOptions()) const;
+
 private:
   CesiumJsonWriter::ExtensionWriterContext _context;
 };
@@ -1,17 +1,29 @@
 #include "ModelJsonWriter.h"
 #include "registerWriterExtensions.h"
 
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferSpec.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/ExtensionBufferExtMeshoptCompression.h>
+#include <CesiumGltf/ExtensionBufferViewExtMeshoptCompression.h>
+#include <CesiumGltf/Model.h>
 #include <CesiumGltfWriter/GltfWriter.h>
+#include <CesiumJsonWriter/BufferedJsonWriter.h>
 #include <CesiumJsonWriter/JsonWriter.h>
 #include <CesiumJsonWriter/PrettyJsonWriter.h>
 #include <CesiumUtility/Assert.h>
+#include <CesiumUtility/ExtensibleObject.h>
 #include <CesiumUtility/Tracing.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <ios>
 #include <limits>
 #include <memory>
+#include <ostream>
 #include <span>
 #include <vector>
 
@@ -27,10 +39,39 @@ getPadding(size_t byteCount, size_t byteAlignment) noexcept {
   return padding;
 }
 
-void writeGlbBuffer(
+// Zeros used to pad the binary chunk, which never needs more than 7 bytes of
+// padding at a time.
+const std::array<std::byte, 8> zeros{};
+
+std::unique_ptr<CesiumJsonWriter::JsonWriter>
+createJsonWriter(const GltfWriterOptions& options) {
+  if (options.prettyPrint) {
+    return std::make_unique<CesiumJsonWriter::PrettyJsonWriter>();
+  }
+  if (options.useBufferedJsonWriter) {
+    return std::make_unique<CesiumJsonWriter::BufferedJsonWriter>();
+  }
+  return std::make_unique<CesiumJsonWriter::JsonWriter>();
+}
+
+void appendChunkHeader(
+    std::vector<std::byte>& header,
+    uint32_t chunkLength,
+    const char* chunkType) {
+  size_t byteOffset = header.size();
+  header.resize(byteOffset + 8);
+  std::memcpy(header.data() + byteOffset, &chunkLength, 4);
+  std::memcpy(header.data() + byteOffset + 4, chunkType, 4);
+}
+
+// Writes a GLB with the given JSON to the sink, followed by a binary chunk
+// made of the concatenation of the binary pieces, if they are not empty.
+// Returns false if the GLB could not be written.
+bool writeGlbChunks(
     GltfWriterResult& result,
+    const GltfWriterSink& sink,
     const std::span<const std::byte>& jsonData,
-    const std::span<const std::byte>& bufferData,
+    const std::vector<std::span<const std::byte>>& binaryPieces,
     size_t binaryChunkByteAlignment) {
   CESIUM_ASSERT(
       binaryChunkByteAlignment > 0 && binaryChunkByteAlignment % 4 == 0);
@@ -38,6 +79,11 @@ void writeGlbBuffer(
   size_t headerSize = 12;
   size_t chunkHeaderSize = 8;
 
+  size_t binaryDataSize = 0;
+  for (const std::span<const std::byte>& piece : binaryPieces) {
+    binaryDataSize += piece.size();
+  }
+
   size_t jsonPaddingSize =
       getPadding(headerSize + chunkHeaderSize + jsonData.size(), 4);
   size_t jsonChunkDataSize = jsonData.size() + jsonPaddingSize;
@@ -46,7 +92,7 @@ void writeGlbBuffer(
   size_t binaryPaddingSize = 0;
   size_t binaryChunkDataSize = 0;
 
-  if (bufferData.size() > 0) {
+  if (binaryDataSize > 0) {
     size_t extraJsonPadding =
         getPadding(glbSize + chunkHeaderSize, binaryChunkByteAlignment);
     if (extraJsonPadding > 0) {
@@ -56,8 +102,8 @@ void writeGlbBuffer(
     }
 
     binaryPaddingSize =
-        getPadding(glbSize + chunkHeaderSize + bufferData.size(), 4);
-    binaryChunkDataSize = bufferData.size() + binaryPaddingSize;
+        getPadding(glbSize + chunkHeaderSize + binaryDataSize, 4);
+    binaryChunkDataSize = binaryDataSize + binaryPaddingSize;
     glbSize += chunkHeaderSize + binaryChunkDataSize;
   }
 
@@ -67,57 +113,173 @@ void writeGlbBuffer(
     result.errors.emplace_back(
         "glTF is too large to represent as a binary glTF (GLB). The total size "
         "of the GLB must be less than 4GB.");
-    return;
+    return false;
   }
 
-  std::vector<std::byte>& glb = result.gltfBytes;
-  glb.resize(glbSize);
-  uint8_t* glb8 = reinterpret_cast<uint8_t*>(glb.data());
-  uint32_t* glb32 = reinterpret_cast<uint32_t*>(glb.data());
-
-  // GLB header
-  size_t byteOffset = 0;
-  glb8[byteOffset++] = 'g';
-  glb8[byteOffset++] = 'l';
-  glb8[byteOffset++] = 'T';
-  glb8[byteOffset++] = 'F';
-  glb32[byteOffset / 4] = 2;
-  byteOffset += 4;
-  glb32[byteOffset / 4] = static_cast<uint32_t>(glbSize);
-  byteOffset += 4;
-
-  // JSON chunk header
-  glb32[byteOffset / 4] = static_cast<uint32_t>(jsonChunkDataSize);
-  byteOffset += 4;
-  glb8[byteOffset++] = 'J';
-  glb8[byteOffset++] = 'S';
-  glb8[byteOffset++] = 'O';
-  glb8[byteOffset++] = 'N';
-
-  // JSON chunk
-  memcpy(glb8 + byteOffset, jsonData.data(), jsonData.size());
-  byteOffset += jsonData.size();
-
-  // JSON chunk padding
-  memset(glb8 + byteOffset, ' ', jsonPaddingSize);
-  byteOffset += jsonPaddingSize;
-
-  if (bufferData.size() > 0) {
-    // Binary chunk header
-    glb32[byteOffset / 4] = static_cast<uint32_t>(binaryChunkDataSize);
-    byteOffset += 4;
-    glb8[byteOffset++] = 'B';
-    glb8[byteOffset++] = 'I';
-    glb8[byteOffset++] = 'N';
-    glb8[byteOffset++] = 0;
-
-    // Binary chunk
-    memcpy(glb8 + byteOffset, bufferData.data(), bufferData.size());
-    byteOffset += bufferData.size();
-
-    // Binary chunk padding
-    memset(glb8 + byteOffset, 0, binaryPaddingSize);
+  auto write = [&result, &sink](const std::span<const std::byte>& bytes) {
+    if (bytes.empty() || sink(bytes)) {
+      return true;
+    }
+    result.errors.emplace_back(
+        "The GLB sink stopped accepting data before the GLB was complete.");
+    return false;
+  };
+
+  // GLB header and JSON chunk header
+  std::vector<std::byte> header(headerSize);
+  const uint32_t version = 2;
+  const uint32_t length = static_cast<uint32_t>(glbSize);
+  std::memcpy(header.data(), "glTF", 4);
+  std::memcpy(header.data() + 4, &version, 4);
+  std::memcpy(header.data() + 8, &length, 4);
+  appendChunkHeader(
+      header,
+      static_cast<uint32_t>(jsonChunkDataSize),
+      "JSON");
+
+  // JSON chunk, padded with spaces
+  const std::vector<std::byte> jsonPadding(jsonPaddingSize, std::byte(' '));
+  if (!write(header) || !write(jsonData) || !write(jsonPadding)) {
+    return false;
+  }
+
+  if (binaryDataSize == 0) {
+    return true;
+  }
+
+  // Binary chunk header
+  header.clear();
+  appendChunkHeader(
+      header,
+      static_cast<uint32_t>(binaryChunkDataSize),
+      "BIN");
+  if (!write(header)) {
+    return false;
   }
+
+  // Binary chunk, padded with zeros
+  for (const std::span<const std::byte>& piece : binaryPieces) {
+    if (!write(piece)) {
+      return false;
+    }
+  }
+
+  return write(std::span(zeros).first(binaryPaddingSize));
+}
+
+// Determines if a buffer is left out of the GLB binary chunk, because it has a
+// URI and no data, or is a meshopt fallback buffer without any data.
+bool isExternalBuffer(const CesiumGltf::Buffer& buffer) {
+  const CesiumGltf::ExtensionBufferExtMeshoptCompression* pMeshOpt =
+      buffer.getExtension<CesiumGltf::ExtensionBufferExtMeshoptCompression>();
+  bool isMeshOptFallback = pMeshOpt && pMeshOpt->fallback;
+  return buffer.cesium.data.empty() && (buffer.uri || isMeshOptFallback);
+}
+
+// Lays out the data of the model's buffers in the GLB binary chunk the way
+// GltfUtilities::collapseToSingleBuffer would, and returns a copy of the model
+// without any buffer data whose buffers and buffer views describe that layout.
+// Unlike collapseToSingleBuffer, a first buffer with a URI and no data is kept
+// like any other external buffer, and the binary chunk becomes a new first
+// buffer in front of it.
+CesiumGltf::Model layOutBinaryChunk(
+    const CesiumGltf::Model& model,
+    std::vector<std::span<const std::byte>>& binaryPieces) {
+  CesiumGltf::Model jsonModel;
+
+  // Copy everything except the buffers, which may be large. This must list
+  // every property of the generated CesiumGltf::ModelSpec except `buffers`.
+  static_cast<CesiumUtility::ExtensibleObject&>(jsonModel) = model;
+  jsonModel.extensionsUsed = model.extensionsUsed;
+  jsonModel.extensionsRequired = model.extensionsRequired;
+  jsonModel.accessors = model.accessors;
+  jsonModel.animations = model.animations;
+  jsonModel.asset = model.asset;
+  jsonModel.bufferViews = model.bufferViews;
+  jsonModel.cameras = model.cameras;
+  jsonModel.images = model.images;
+  jsonModel.materials = model.materials;
+  jsonModel.meshes = model.meshes;
+  jsonModel.nodes = model.nodes;
+  jsonModel.samplers = model.samplers;
+  jsonModel.scene = model.scene;
+  jsonModel.scenes = model.scenes;
+  jsonModel.skins = model.skins;
+  jsonModel.textures = model.textures;
+
+  if (model.buffers.empty()) {
+    return jsonModel;
+  }
+
+  // The binary chunk is the first buffer. Buffers with data are appended to
+  // it, each aligned to an 8-byte boundary, and external buffers are left
+  // intact. If the first buffer is external itself, a new first buffer is
+  // added for the binary chunk, unless no buffer has to go in it.
+  const bool firstIsExternal = isExternalBuffer(model.buffers[0]);
+  const bool hasBinaryChunk =
+      !firstIsExternal || std::any_of(
+                              model.buffers.begin() + 1,
+                              model.buffers.end(),
+                              [](const CesiumGltf::Buffer& buffer) {
+                                return !isExternalBuffer(buffer);
+                              });
+  if (hasBinaryChunk) {
+    jsonModel.buffers.emplace_back();
+  }
+
+  std::vector<int64_t> bufferStarts(model.buffers.size(), 0);
+  std::vector<int32_t> indexMap(model.buffers.size(), 0);
+  size_t binaryDataSize = 0;
+
+  for (size_t i = 0; i < model.buffers.size(); ++i) {
+    const CesiumGltf::Buffer& buffer = model.buffers[i];
+
+    if (isExternalBuffer(buffer)) {
+      indexMap[i] = int32_t(jsonModel.buffers.size());
+      static_cast<CesiumGltf::BufferSpec&>(jsonModel.buffers.emplace_back()) =
+          buffer;
+      continue;
+    }
+
+    size_t padding = getPadding(binaryDataSize, 8);
+    binaryPieces.emplace_back(std::span(zeros).first(padding));
+    binaryPieces.emplace_back(buffer.cesium.data);
+    bufferStarts[i] = int64_t(binaryDataSize + padding);
+    binaryDataSize += padding + buffer.cesium.data.size();
+  }
+
+  if (!firstIsExternal) {
+    CesiumGltf::Buffer& binaryBuffer = jsonModel.buffers[0];
+    static_cast<CesiumGltf::BufferSpec&>(binaryBuffer) = model.buffers[0];
+    binaryBuffer.byteLength = int64_t(binaryDataSize);
+    if (binaryDataSize > 0) {
+      binaryBuffer.uri.reset();
+    }
+  } else if (hasBinaryChunk) {
+    jsonModel.buffers[0].byteLength = int64_t(binaryDataSize);
+  }
+
+  for (CesiumGltf::BufferView& bufferView : jsonModel.bufferViews) {
+    int32_t& bufferIndex = bufferView.buffer;
+    if (bufferIndex >= 0 && size_t(bufferIndex) < indexMap.size()) {
+      bufferView.byteOffset += bufferStarts[size_t(bufferIndex)];
+      bufferIndex = indexMap[size_t(bufferIndex)];
+    }
+
+    using CesiumGltf::ExtensionBufferViewExtMeshoptCompression;
+    ExtensionBufferViewExtMeshoptCompression* pMeshOpt =
+        bufferView.getExtension<ExtensionBufferViewExtMeshoptCompression>();
+    if (pMeshOpt) {
+      int32_t& meshOptBufferIndex = pMeshOpt->buffer;
+      if (meshOptBufferIndex >= 0 &&
+          size_t(meshOptBufferIndex) < indexMap.size()) {
+        pMeshOpt->byteOffset += bufferStarts[size_t(meshOptBufferIndex)];
+        meshOptBufferIndex = indexMap[size_t(meshOptBufferIndex)];
+      }
+    }
+  }
+
+  return jsonModel;
 }
 } // namespace
 
@@ -141,13 +303,8 @@ GltfWriterResult GltfWriter::writeGltf(
       this->getExtensions();
 
   GltfWriterResult result;
-  std::unique_ptr<CesiumJsonWriter::JsonWriter> pWriter;
-
-  if (options.prettyPrint) {
-    pWriter = std::make_unique<CesiumJsonWriter::PrettyJsonWriter>();
-  } else {
-    pWriter = std::make_unique<CesiumJsonWriter::JsonWriter>();
-  }
+  std::unique_ptr<CesiumJsonWriter::JsonWriter> pWriter =
+      createJsonWriter(options);
 
   ModelJsonWriter::write(model, *pWriter, context);
   result.gltfBytes = pWriter->toBytes();
@@ -157,6 +314,36 @@ GltfWriterResult GltfWriter::writeGltf(
   return result;
 }
 
+GltfWriterResult GltfWriter::writeGltfToSink(
+    const CesiumGltf::Model& model,
+    const GltfWriterSink& sink) const {
+  CESIUM_TRACE("GltfWriter::writeGltfToSink");
+
+  const CesiumJsonWriter::ExtensionWriterContext& context =
+      this->getExtensions();
+
+  GltfWriterResult result;
+  bool sinkAccepting = true;
+  CesiumJsonWriter::BufferedJsonWriter writer(
+      [&sink, &sinkAccepting](std::span<const std::byte> chunk) {
+        if (sinkAccepting) {
+          sinkAccepting = sink(chunk);
+        }
+      });
+
+  ModelJsonWriter::write(model, writer, context);
+  writer.flush();
+  result.errors = writer.getErrors();
+  result.warnings = writer.getWarnings();
+
+  if (!sinkAccepting) {
+    result.errors.emplace_back(
+        "The glTF sink stopped accepting data before the glTF was complete.");
+  }
+
+  return result;
+}
+
 GltfWriterResult GltfWriter::writeGlb(
     const CesiumGltf::Model& model,
     const std::span<const std::byte>& bufferData,
@@ -167,21 +354,65 @@ GltfWriterResult GltfWriter::writeGlb(
       this->getExtensions();
 
   GltfWriterResult result;
-  std::unique_ptr<CesiumJsonWriter::JsonWriter> pWriter;
+  std::unique_ptr<CesiumJsonWriter::JsonWriter> pWriter =
+      createJsonWriter(options);
 
-  if (options.prettyPrint) {
-    pWriter = std::make_unique<CesiumJsonWriter::PrettyJsonWriter>();
-  } else {
-    pWriter = std::make_unique<CesiumJsonWriter::JsonWriter>();
+  ModelJsonWriter::write(model, *pWriter, context);
+  std::vector<std::byte> jsonData = pWriter->toBytes();
+
+  std::vector<std::byte>& glb = result.gltfBytes;
+  glb.reserve(jsonData.size() + bufferData.size() + 64);
+  const bool written = writeGlbChunks(
+      result,
+      [&glb](std::span<const std::byte> bytes) {
+        glb.insert(glb.end(), bytes.begin(), bytes.end());
+        return true;
+      },
+      std::span(jsonData),
+      {bufferData},
+      options.binaryChunkByteAlignment);
+  if (!written) {
+    glb.clear();
   }
 
-  ModelJsonWriter::write(model, *pWriter, context);
+  result.errors.insert(
+      result.errors.end(),
+      pWriter->getErrors().begin(),
+      pWriter->getErrors().end());
+
+  result.warnings.insert(
+      result.warnings.end(),
+      pWriter->getWarnings().begin(),
+      pWriter->getWarnings().end());
+
+  return result;
+}
+
+GltfWriterResult GltfWriter::writeGlbToSink(
+    const CesiumGltf::Model& model,
+    const GltfWriterSink& sink,
+    const GltfWriterOptions& options) const {
+  CESIUM_TRACE("GltfWriter::writeGlbToSink");
+
+  const CesiumJsonWriter::ExtensionWriterContext& context =
+      this->getExtensions();
+
+  GltfWriterResult result;
+  std::unique_ptr<CesiumJsonWriter::JsonWriter> pWriter =
+      createJsonWriter(options);
+
+  std::vector<std::span<const std::byte>> binaryPieces;
+  ModelJsonWriter::write(
+      layOutBinaryChunk(model, binaryPieces),
+      *pWriter,
+      context);
   std::vector<std::byte> jsonData = pWriter->toBytes();
 
-  writeGlbBuffer(
+  writeGlbChunks(
       result,
+      sink,
       std::span(jsonData),
-      bufferData,
+      binaryPieces,
       options.binaryChunkByteAlignment);
 
   result.errors.insert(
@@ -197,4 +428,19 @@ GltfWriterResult GltfWriter::writeGlb(
   return result;
 }
 
+GltfWriterResult GltfWriter::writeGlbToStream(
+    const CesiumGltf::Model& model,
+    std::ostream& stream,
+    const GltfWriterOptions& options) const {
+  return this->writeGlbToSink(
+      model,
+      [&stream](std::span<const std::byte> bytes) {
+        stream.write(
+            reinterpret_cast<const char*>(bytes.data()),
+            static_cast<std::streamsize>(bytes.size()));
+        return stream.good();
+      },
+      options);
+}
+
 } // namespace CesiumGltfWriter
@@ -1,4 +1,9 @@
+#include <CesiumGltf/Accessor.h>
 #include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltf/Node.h>
+#include <CesiumGltfContent/GltfUtilities.h>
 #include <CesiumGltfReader/GltfReader.h>
 #include <CesiumGltfWriter/GltfWriter.h>
 #include <CesiumJsonWriter/ExtensionWriterContext.h>
@@ -9,10 +14,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <ios>
+#include <iostream>
 #include <limits>
 #include <span>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -48,6 +57,33 @@ void check(const std::string& input, const std::string& expectedOutput) {
   REQUIRE(gltfJson == expectedJson);
 }
 
+// Creates a model with many nodes and accessors, whose JSON is mostly made of
+// floating-point numbers, like the JSON of large models.
+CesiumGltf::Model createLargeModel(size_t nodeCount) {
+  CesiumGltf::Model model;
+  model.asset.version = "2.0";
+  model.asset.generator = "cesium-native";
+
+  for (size_t i = 0; i < nodeCount; ++i) {
+    const double value = double(i) * 0.1;
+
+    CesiumGltf::Node& node = model.nodes.emplace_back();
+    node.name = "node " + std::to_string(i);
+    node.translation = {value, value + 1.0, value / 3.0};
+    node.rotation = {0.0, 0.7071067811865476, 0.0, 0.7071067811865476};
+    node.mesh = int32_t(i);
+
+    CesiumGltf::Accessor& accessor = model.accessors.emplace_back();
+    accessor.componentType = CesiumGltf::Accessor::ComponentType::FLOAT;
+    accessor.type = CesiumGltf::Accessor::Type::VEC3;
+    accessor.count = int64_t(i + 1);
+    accessor.min = {-value, -1.0, -value / 7.0};
+    accessor.max = {value, 1.0, value / 7.0};
+  }
+
+  return model;
+}
+
 bool hasSpaces(const std::string& input) {
   return std::count_if(input.begin(), input.end(), [](unsigned char c) {
     return std::isspace(c);
@@ -613,6 +649,121 @@ TEST_CASE("Writes glb with binaryChunkByteAlignment of 8") {
   REQUIRE(glbBytesExtraPadding.size() == 88);
 }
 
+TEST_CASE("Writes glTF with the buffered JSON writer") {
+  const CesiumGltf::Model model = createLargeModel(10);
+
+  CesiumGltfWriter::GltfWriter writer;
+  CesiumGltfWriter::GltfWriterResult expected = writer.writeGltf(model);
+  REQUIRE(expected.errors.empty());
+
+  CesiumGltfWriter::GltfWriterOptions options;
+  options.useBufferedJsonWriter = true;
+  CesiumGltfWriter::GltfWriterResult result = writer.writeGltf(model, options);
+  REQUIRE(result.errors.empty());
+  CHECK(result.warnings.empty());
+
+  // Some numbers are formatted differently, but they must read back as the
+  // same values.
+  rapidjson::Document expectedJson;
+  expectedJson.Parse<rapidjson::kParseFullPrecisionFlag>(
+      reinterpret_cast<const char*>(expected.gltfBytes.data()),
+      expected.gltfBytes.size());
+  rapidjson::Document json;
+  json.Parse<rapidjson::kParseFullPrecisionFlag>(
+      reinterpret_cast<const char*>(result.gltfBytes.data()),
+      result.gltfBytes.size());
+  REQUIRE(!json.HasParseError());
+  CHECK(json == expectedJson);
+}
+
+TEST_CASE("Writes glTF JSON to a sink") {
+  const CesiumGltf::Model model = createLargeModel(10);
+
+  CesiumGltfWriter::GltfWriter writer;
+  CesiumGltfWriter::GltfWriterOptions options;
+  options.useBufferedJsonWriter = true;
+  CesiumGltfWriter::GltfWriterResult expected =
+      writer.writeGltf(model, options);
+  REQUIRE(expected.errors.empty());
+
+  SUBCASE("matches writing to memory") {
+    std::vector<std::byte> json;
+    CesiumGltfWriter::GltfWriterResult result = writer.writeGltfToSink(
+        model,
+        [&json](std::span<const std::byte> bytes) {
+          json.insert(json.end(), bytes.begin(), bytes.end());
+          return true;
+        });
+    REQUIRE(result.errors.empty());
+    CHECK(result.warnings.empty());
+    CHECK(result.gltfBytes.empty());
+    CHECK(json == expected.gltfBytes);
+  }
+
+  SUBCASE("stops when the sink stops accepting data") {
+    size_t callCount = 0;
+    CesiumGltfWriter::GltfWriterResult result = writer.writeGltfToSink(
+        model,
+        [&callCount](std::span<const std::byte> /*bytes*/) {
+          ++callCount;
+          return false;
+        });
+    CHECK(callCount == 1);
+    CHECK(result.errors.size() == 1);
+  }
+}
+
+TEST_CASE("Benchmark writing the JSON of a large glTF" * doctest::skip(true)) {
+  constexpr size_t nodeCount = 200000;
+  constexpr int iterations = 5;
+
+  const CesiumGltf::Model model = createLargeModel(nodeCount);
+  CesiumGltfWriter::GltfWriter writer;
+
+  for (const bool useBufferedJsonWriter : {false, true}) {
+    CesiumGltfWriter::GltfWriterOptions options;
+    options.useBufferedJsonWriter = useBufferedJsonWriter;
+
+    size_t byteCount = 0;
+    std::chrono::steady_clock::duration total{};
+    for (int i = 0; i < iterations; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      CesiumGltfWriter::GltfWriterResult result =
+          writer.writeGltf(model, options);
+      total += std::chrono::steady_clock::now() - start;
+      REQUIRE(result.errors.empty());
+      byteCount = result.gltfBytes.size();
+    }
+
+    const double seconds =
+        std::chrono::duration<double>(total).count() / double(iterations);
+    std::cout << (useBufferedJsonWriter ? "BufferedJsonWriter" : "JsonWriter")
+              << " wrote " << double(byteCount) / 1.0e6 << "MB of JSON at "
+              << double(byteCount) / 1.0e6 / seconds << "MB/s" << std::endl;
+  }
+
+  size_t byteCount = 0;
+  std::chrono::steady_clock::duration total{};
+  for (int i = 0; i < iterations; ++i) {
+    byteCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    CesiumGltfWriter::GltfWriterResult result = writer.writeGltfToSink(
+        model,
+        [&byteCount](std::span<const std::byte> bytes) {
+          byteCount += bytes.size();
+          return true;
+        });
+    total += std::chrono::steady_clock::now() - start;
+    REQUIRE(result.errors.empty());
+  }
+
+  const double seconds =
+      std::chrono::duration<double>(total).count() / double(iterations);
+  std::cout << "BufferedJsonWriter to a sink wrote "
+            << double(byteCount) / 1.0e6 << "MB of JSON at "
+            << double(byteCount) / 1.0e6 / seconds << "MB/s" << std::endl;
+}
+
 #ifndef __EMSCRIPTEN__
 TEST_CASE("Reports an error if asked to write a GLB larger than 4GB") {
   CesiumGltf::Model model;
@@ -630,3 +781,220 @@ TEST_CASE("Reports an error if asked to write a GLB larger than 4GB") {
   CHECK(result.gltfBytes.empty());
 }
 #endif // __EMSCRIPTEN__
+
+TEST_CASE("Writes glb to a sink without concatenating buffers") {
+  CesiumGltf::Model model;
+  model.asset.version = "2.0";
+
+  for (size_t i = 0; i < 3; ++i) {
+    CesiumGltf::Buffer& buffer = model.buffers.emplace_back();
+    buffer.cesium.data.resize(3 + 2 * i);
+    for (size_t j = 0; j < buffer.cesium.data.size(); ++j) {
+      buffer.cesium.data[j] = std::byte(10 * i + j);
+    }
+    buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+    CesiumGltf::BufferView& bufferView = model.bufferViews.emplace_back();
+    bufferView.buffer = int32_t(i);
+    bufferView.byteOffset = 1;
+    bufferView.byteLength = 2;
+  }
+
+  CesiumGltf::Buffer& externalBuffer = model.buffers.emplace_back();
+  externalBuffer.uri = "external.bin";
+  externalBuffer.byteLength = 100;
+  CesiumGltf::BufferView& externalView = model.bufferViews.emplace_back();
+  externalView.buffer = 3;
+  externalView.byteLength = 100;
+
+  CesiumGltfWriter::GltfWriter writer;
+  std::vector<std::byte> streamed;
+  size_t callCount = 0;
+  CesiumGltfWriter::GltfWriterResult result = writer.writeGlbToSink(
+      model,
+      [&streamed, &callCount](std::span<const std::byte> bytes) {
+        streamed.insert(streamed.end(), bytes.begin(), bytes.end());
+        ++callCount;
+        return true;
+      });
+
+  REQUIRE(result.errors.empty());
+  CHECK(result.warnings.empty());
+  CHECK(result.gltfBytes.empty());
+  CHECK(callCount > 1);
+
+  // The model is not modified.
+  CHECK(model.buffers.size() == 4);
+  CHECK(model.bufferViews[2].buffer == 2);
+  CHECK(model.bufferViews[2].byteOffset == 1);
+
+  SUBCASE("matches writing a collapsed model") {
+    CesiumGltf::Model collapsed = model;
+    CesiumGltfContent::GltfUtilities::collapseToSingleBuffer(collapsed);
+    CesiumGltfWriter::GltfWriterResult expected =
+        writer.writeGlb(collapsed, collapsed.buffers[0].cesium.data);
+    REQUIRE(expected.errors.empty());
+    CHECK(streamed == expected.gltfBytes);
+  }
+
+  SUBCASE("can be read back") {
+    CesiumGltfReader::GltfReader reader;
+    CesiumGltfReader::GltfReaderResult readResult =
+        reader.readGltf(streamed);
+    REQUIRE(readResult.errors.empty());
+    REQUIRE(readResult.model);
+
+    const CesiumGltf::Model& readModel = *readResult.model;
+    REQUIRE(readModel.buffers.size() == 2);
+    CHECK(readModel.buffers[1].uri == "external.bin");
+    REQUIRE(readModel.bufferViews.size() == 4);
+    CHECK(readModel.bufferViews[3].buffer == 1);
+
+    for (size_t i = 0; i < 3; ++i) {
+      const CesiumGltf::BufferView& bufferView = readModel.bufferViews[i];
+      CHECK(bufferView.buffer == 0);
+      const std::byte* pData = readModel.buffers[0].cesium.data.data() +
+                               bufferView.byteOffset;
+      CHECK(pData[0] == std::byte(10 * i + 1));
+      CHECK(pData[1] == std::byte(10 * i + 2));
+    }
+  }
+
+  SUBCASE("stops when the sink stops accepting data") {
+    std::vector<std::byte> partial;
+    CesiumGltfWriter::GltfWriterResult stopped = writer.writeGlbToSink(
+        model,
+        [&partial](std::span<const std::byte> bytes) {
+          partial.insert(partial.end(), bytes.begin(), bytes.end());
+          return partial.size() < 20;
+        });
+    CHECK(stopped.errors.size() == 1);
+    CHECK(partial.size() < streamed.size());
+  }
+
+  SUBCASE("writes to a stream") {
+    std::ostringstream stream(std::ios::binary);
+    CesiumGltfWriter::GltfWriterResult streamResult =
+        writer.writeGlbToStream(model, stream);
+    REQUIRE(streamResult.errors.empty());
+    const std::string bytes = stream.str();
+    CHECK(bytes.size() == streamed.size());
+    CHECK(std::equal(
+        streamed.begin(),
+        streamed.end(),
+        reinterpret_cast<const std::byte*>(bytes.data())));
+  }
+}
+
+TEST_CASE("Writes glb to a sink when the first buffer is external") {
+  CesiumGltf::Model model;
+  model.asset.version = "2.0";
+
+  CesiumGltf::Buffer& externalBuffer = model.buffers.emplace_back();
+  externalBuffer.uri = "external.bin";
+  externalBuffer.byteLength = 100;
+  CesiumGltf::BufferView& externalView = model.bufferViews.emplace_back();
+  externalView.buffer = 0;
+  externalView.byteOffset = 10;
+  externalView.byteLength = 90;
+
+  CesiumGltfWriter::GltfWriter writer;
+
+  SUBCASE("keeps the URI and adds a buffer for the binary chunk") {
+    CesiumGltf::Buffer& buffer = model.buffers.emplace_back();
+    buffer.cesium.data = {std::byte(1), std::byte(2), std::byte(3)};
+    buffer.byteLength = 3;
+    CesiumGltf::BufferView& bufferView = model.bufferViews.emplace_back();
+    bufferView.buffer = 1;
+    bufferView.byteOffset = 1;
+    bufferView.byteLength = 2;
+
+    std::vector<std::byte> streamed;
+    CesiumGltfWriter::GltfWriterResult result = writer.writeGlbToSink(
+        model,
+        [&streamed](std::span<const std::byte> bytes) {
+          streamed.insert(streamed.end(), bytes.begin(), bytes.end());
+          return true;
+        });
+    REQUIRE(result.errors.empty());
+
+    CesiumGltfReader::GltfReader reader;
+    CesiumGltfReader::GltfReaderResult readResult =
+        reader.readGltf(streamed);
+    REQUIRE(readResult.errors.empty());
+    REQUIRE(readResult.model);
+
+    const CesiumGltf::Model& readModel = *readResult.model;
+    REQUIRE(readModel.buffers.size() == 2);
+    CHECK(!readModel.buffers[0].uri);
+    CHECK(readModel.buffers[0].byteLength == 3);
+    CHECK(readModel.buffers[1].uri == "external.bin");
+    CHECK(readModel.buffers[1].byteLength == 100);
+
+    REQUIRE(readModel.bufferViews.size() == 2);
+    CHECK(readModel.bufferViews[0].buffer == 1);
+    CHECK(readModel.bufferViews[0].byteOffset == 10);
+    CHECK(readModel.bufferViews[1].buffer == 0);
+    CHECK(readModel.bufferViews[1].byteOffset == 1);
+    const std::byte* pData = readModel.buffers[0].cesium.data.data() +
+                             readModel.bufferViews[1].byteOffset;
+    CHECK(pData[0] == std::byte(2));
+    CHECK(pData[1] == std::byte(3));
+  }
+
+  SUBCASE("writes no binary chunk if no buffer has data") {
+    std::vector<std::byte> streamed;
+    CesiumGltfWriter::GltfWriterResult result = writer.writeGlbToSink(
+        model,
+        [&streamed](std::span<const std::byte> bytes) {
+          streamed.insert(streamed.end(), bytes.begin(), bytes.end());
+          return true;
+        });
+    REQUIRE(result.errors.empty());
+
+    CesiumGltfWriter::GltfWriterResult expected =
+        writer.writeGlb(model, std::span<const std::byte>());
+    REQUIRE(expected.errors.empty());
+    CHECK(streamed == expected.gltfBytes);
+  }
+}
+
+TEST_CASE("Writes every property of a model to a glb sink") {
+  // Catches properties of ModelSpec that layOutBinaryChunk does not copy.
+  CesiumGltf::Model model;
+  model.asset.version = "2.0";
+  model.extras["key"] = "value";
+  model.extensionsUsed = {"PRIVATE_used"};
+  model.extensionsRequired = {"PRIVATE_required"};
+  model.accessors.emplace_back().count = 1;
+  model.animations.emplace_back().name = "animation";
+  model.cameras.emplace_back().name = "camera";
+  model.images.emplace_back().uri = "image.png";
+  model.materials.emplace_back().name = "material";
+  model.meshes.emplace_back().name = "mesh";
+  model.nodes.emplace_back().name = "node";
+  model.samplers.emplace_back().name = "sampler";
+  model.scene = 0;
+  model.scenes.emplace_back().name = "scene";
+  model.skins.emplace_back().name = "skin";
+  model.textures.emplace_back().name = "texture";
+
+  CesiumGltf::Buffer& buffer = model.buffers.emplace_back();
+  buffer.cesium.data = {std::byte(1), std::byte(2), std::byte(3)};
+  buffer.byteLength = 3;
+
+  CesiumGltfWriter::GltfWriter writer;
+  std::vector<std::byte> streamed;
+  CesiumGltfWriter::GltfWriterResult result = writer.writeGlbToSink(
+      model,
+      [&streamed](std::span<const std::byte> bytes) {
+        streamed.insert(streamed.end(), bytes.begin(), bytes.end());
+        return true;
+      });
+  REQUIRE(result.errors.empty());
+
+  CesiumGltfWriter::GltfWriterResult expected =
+      writer.writeGlb(model, buffer.cesium.data);
+  REQUIRE(expected.errors.empty());
+  CHECK(streamed == expected.gltfBytes);
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <CesiumImage/Ktx2TranscodeTargets.h>
+#include <CesiumImage/Library.h>
+
+namespace CesiumImage {
+
+struct ImageAsset;
+
+/**
+ * @brief Names the GPU compressed pixel formats into which uncompressed images
+ * should be compressed by {@link BlockCompression::compress}.
+ *
+ * When built with the constructor, these targets take into account
+ * platform-specific support for target formats as reported by the client.
+ */
+struct CESIUMIMAGE_API BlockCompressionTargets {
+  /**
+   * @brief The gpu pixel compression format to compress images into when all
+   * of their pixels are fully opaque. If NONE, such images are not compressed.
+   */
+  GpuCompressedPixelFormat opaque = GpuCompressedPixelFormat::NONE;
+
+  /**
+   * @brief The gpu pixel compression format to compress images into when any
+   * of their pixels are translucent. If NONE, such images are not compressed.
+   */
+  GpuCompressedPixelFormat translucent = GpuCompressedPixelFormat::NONE;
+
+  BlockCompressionTargets() = default;
+
+  /**
+   * @brief Determine ideal compression targets based on a list of supported gpu
+   * compressed formats.
+   *
+   * Only formats that {@link BlockCompression::canCompressTo} are considered.
+   *
+   * @param supportedFormats The supported gpu compressed pixel formats.
+   */
+  BlockCompressionTargets(
+      const SupportedGpuCompressedPixelFormats& supportedFormats);
+};
+
+/**
+ * @brief Compresses uncompressed images into GPU block compression formats on
+ * the CPU.
+ *
+ * The encoder favors speed over quality: the endpoints of each 4x4 block are
+ * chosen along the principal axis of the block's colors, with no further
+ * refinement. This makes it suitable for compressing images at load time, such
+ * as raster overlay tiles, to reduce their memory usage.
+ */
+class CESIUMIMAGE_API BlockCompression {
+public:
+  /**
+   * @brief Determines whether images can be compressed to the given format.
+   *
+   * Currently, {@link GpuCompressedPixelFormat::BC1_RGB} and
+   * {@link GpuCompressedPixelFormat::BC3_RGBA} are supported.
+   *
+   * @param format The format to check.
+   * @returns True if {@link compress} can produce the format; otherwise,
+   * false.
+   */
+  static bool canCompressTo(GpuCompressedPixelFormat format) noexcept;
+
+  /**
+   * @brief Compresses an image into the format given by the targets for its
+   * content.
+   *
+   * The image is examined to determine whether all of its pixels are opaque,
+   * and then compressed to either {@link BlockCompressionTargets::opaque} or
+   * {@link BlockCompressionTargets::translucent}.
+   *
+   * @param image The image to compress in place.
+   * @param targets The formats to compress to.
+   * @returns True if the image was compressed; otherwise, false. See the
+   * other overload for the reasons an image is not compressed.
+   */
+  static bool
+  compress(ImageAsset& image, const BlockCompressionTargets& targets);
+
+  /**
+   * @brief Compresses an image into the given format.
+   *
+   * Only uncompressed images without mipmaps, with four channels and one byte
+   * per channel, can be compressed. Images whose dimensions are not multiples
+   * of four are padded to whole blocks by repeating their edge pixels, but
+   * their `width` and `height` are unchanged.
+   *
+   * On success, the image's `pixelData` is replaced with the compressed
+   * blocks, in row-major order, and its `compressedPixelFormat` is set. The
+   * image is left unchanged if it cannot be compressed.
+   *
+   * @param image The image to compress in place.
+   * @param format The format to compress to.
+   * @returns True if the image was compressed; otherwise, false.
+   */
+  static bool compress(ImageAsset& image, GpuCompressedPixelFormat format);
+};
+
+} // namespace CesiumImage
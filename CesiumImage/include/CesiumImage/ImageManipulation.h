@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <vector>
 
 namespace CesiumImage {
@@ -35,6 +36,27 @@ struct PixelRectangle {
   int32_t height;
 };
 
+/**
+ * @brief Describes a copy of pixels from a source image to a target, as used
+ * by {@link ImageManipulation::compositeImages}.
+ */
+struct ImageBlit {
+  /**
+   * @brief The image from which to read pixels.
+   */
+  const ImageAsset* pSource;
+
+  /**
+   * @brief The pixels to read from the source.
+   */
+  PixelRectangle sourcePixels;
+
+  /**
+   * @brief The pixels to write in the target.
+   */
+  PixelRectangle targetPixels;
+};
+
 /**
  * @brief A collection of utility functions for image manipulation operations.
  */
@@ -97,6 +119,97 @@ public:
       const ImageAsset& source,
       const PixelRectangle& sourcePixels);
 
+  /**
+   * @brief Copies pixels from multiple source images to a target image.
+   *
+   * The result is the same as calling {@link blitImage} for each blit in
+   * order, so later blits overwrite earlier ones where they overlap. However,
+   * consecutive blits that do not require scaling are done together in a
+   * single pass over the rows of the target, so that each target row is
+   * written while it is in the cache and the per-blit setup is done only once.
+   *
+   * Blits that {@link blitImage} would reject are skipped without changing any
+   * pixels.
+   *
+   * @param target The image in which to write pixels.
+   * @param blits The copies to perform.
+   * @returns True if all blits were completed successfully, or false if any of
+   * them were skipped.
+   */
+  static bool
+  compositeImages(ImageAsset& target, std::span<const ImageBlit> blits);
+
+  /**
+   * @brief Copies pixels from multiple source images to a target buffer, such
+   * as a staging buffer provided by a renderer.
+   *
+   * This behaves like the overload taking an {@link ImageAsset}, except that
+   * the target pixels are written to the given buffer.
+   *
+   * @param target The buffer in which to write pixels. It must be large enough
+   * to hold `targetHeight` rows of `targetRowStride` bytes, except that the
+   * last row may be just large enough to hold `targetWidth` pixels.
+   * @param targetRowStride The number of bytes between rows in the target.
+   * @param targetWidth The width of the target in pixels.
+   * @param targetHeight The height of the target in pixels.
+   * @param channels The number of channels in the target and in every source.
+   * @param bytesPerChannel The number of bytes per channel in the target and
+   * in every source.
+   * @param blits The copies to perform.
+   * @returns True if all blits were completed successfully, or false if any of
+   * them were skipped. If the target buffer is too small, no pixels are
+   * written and false is returned.
+   */
+  static bool compositeImages(
+      std::span<std::byte> target,
+      size_t targetRowStride,
+      int32_t targetWidth,
+      int32_t targetHeight,
+      int32_t channels,
+      int32_t bytesPerChannel,
+      std::span<const ImageBlit> blits);
+
+  /**
+   * @brief Multiplies the color channels of each pixel by its alpha channel.
+   *
+   * Only uncompressed images with one byte per channel and an alpha channel,
+   * that is, with two (luminance and alpha) or four (RGBA) channels, are
+   * supported. The alpha channel is assumed to be the last one.
+   *
+   * @param image The image to modify in place.
+   * @returns True if the image was premultiplied, or false if its format is
+   * not supported, in which case it is unchanged.
+   */
+  static bool premultiplyAlpha(ImageAsset& image);
+
+  /**
+   * @brief Converts the color channels of an image from the sRGB transfer
+   * function to linear values.
+   *
+   * Only uncompressed images with one byte per channel are supported. When the
+   * image has two or four channels, the last one is assumed to be alpha and is
+   * not modified. Because the result is also stored in one byte per channel,
+   * dark colors lose precision.
+   *
+   * @param image The image to modify in place.
+   * @returns True if the image was converted, or false if its format is not
+   * supported, in which case it is unchanged.
+   */
+  static bool convertSrgbToLinear(ImageAsset& image);
+
+  /**
+   * @brief Converts the color channels of an image from linear values to the
+   * sRGB transfer function.
+   *
+   * This is the inverse of {@link convertSrgbToLinear}, with the same
+   * requirements on the image.
+   *
+   * @param image The image to modify in place.
+   * @returns True if the image was converted, or false if its format is not
+   * supported, in which case it is unchanged.
+   */
+  static bool convertLinearToSrgb(ImageAsset& image);
+
   /**
    * @brief Saves an image to a new byte buffer in PNG format.
    *
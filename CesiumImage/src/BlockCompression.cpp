@@ -0,0 +1,331 @@
+#include <CesiumImage/BlockCompression.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumImage/Ktx2TranscodeTargets.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace CesiumImage {
+
+namespace {
+
+// The RGBA values of the 16 pixels in a 4x4 block, in row-major order.
+using BlockPixels = std::array<uint8_t, 64>;
+using Color = std::array<float, 3>;
+
+// Reads a 4x4 block of an RGBA8 image. Pixels beyond the right or bottom edge
+// of the image repeat the last column or row.
+void readBlock(
+    const std::byte* pPixels,
+    int32_t width,
+    int32_t height,
+    int32_t blockX,
+    int32_t blockY,
+    BlockPixels& block) {
+  for (int32_t j = 0; j < 4; ++j) {
+    const int32_t y = std::min(blockY * 4 + j, height - 1);
+    for (int32_t i = 0; i < 4; ++i) {
+      const int32_t x = std::min(blockX * 4 + i, width - 1);
+      const std::byte* pPixel =
+          pPixels + (size_t(y) * size_t(width) + size_t(x)) * 4;
+      const size_t offset = size_t(j * 4 + i) * 4;
+      for (size_t k = 0; k < 4; ++k) {
+        block[offset + k] = std::to_integer<uint8_t>(pPixel[k]);
+      }
+    }
+  }
+}
+
+uint16_t toRgb565(const Color& color) {
+  auto quantize = [](float value, float maximum) {
+    return uint32_t(
+        std::lround(std::clamp(value, 0.0f, 255.0f) * maximum / 255.0f));
+  };
+  return uint16_t(
+      (quantize(color[0], 31.0f) << 11) | (quantize(color[1], 63.0f) << 5) |
+      quantize(color[2], 31.0f));
+}
+
+Color fromRgb565(uint16_t value) {
+  const uint32_t r = (value >> 11) & 0x1F;
+  const uint32_t g = (value >> 5) & 0x3F;
+  const uint32_t b = value & 0x1F;
+  return Color{
+      float((r << 3) | (r >> 2)),
+      float((g << 2) | (g >> 4)),
+      float((b << 3) | (b >> 2))};
+}
+
+float distanceSquared(const Color& a, const uint8_t* pPixel) {
+  const float dr = a[0] - float(pPixel[0]);
+  const float dg = a[1] - float(pPixel[1]);
+  const float db = a[2] - float(pPixel[2]);
+  return dr * dr + dg * dg + db * db;
+}
+
+void writeLittleEndian(std::byte* pOut, uint64_t value, size_t bytes) {
+  for (size_t i = 0; i < bytes; ++i) {
+    pOut[i] = std::byte((value >> (8 * i)) & 0xFF);
+  }
+}
+
+// Encodes the RGB of a block as an 8-byte BC1 color block in four-color mode,
+// which is also the color part of a BC3 block.
+void encodeColorBlock(const BlockPixels& block, std::byte* pOut) {
+  Color mean{0.0f, 0.0f, 0.0f};
+  for (size_t i = 0; i < 16; ++i) {
+    for (size_t c = 0; c < 3; ++c) {
+      mean[c] += float(block[i * 4 + c]);
+    }
+  }
+  for (float& component : mean) {
+    component /= 16.0f;
+  }
+
+  // The covariance matrix of the colors, stored as rr, rg, rb, gg, gb, bb.
+  std::array<float, 6> covariance{};
+  for (size_t i = 0; i < 16; ++i) {
+    const float dr = float(block[i * 4]) - mean[0];
+    const float dg = float(block[i * 4 + 1]) - mean[1];
+    const float db = float(block[i * 4 + 2]) - mean[2];
+    covariance[0] += dr * dr;
+    covariance[1] += dr * dg;
+    covariance[2] += dr * db;
+    covariance[3] += dg * dg;
+    covariance[4] += dg * db;
+    covariance[5] += db * db;
+  }
+
+  // Find the principal axis of the colors with a few steps of power
+  // iteration.
+  Color axis{1.0f, 1.0f, 1.0f};
+  for (int iteration = 0; iteration < 4; ++iteration) {
+    const Color next{
+        covariance[0] * axis[0] + covariance[1] * axis[1] +
+            covariance[2] * axis[2],
+        covariance[1] * axis[0] + covariance[3] * axis[1] +
+            covariance[4] * axis[2],
+        covariance[2] * axis[0] + covariance[4] * axis[1] +
+            covariance[5] * axis[2]};
+    const float scale = std::max(
+        {std::abs(next[0]), std::abs(next[1]), std::abs(next[2])});
+    if (scale == 0.0f) {
+      break;
+    }
+    axis = Color{next[0] / scale, next[1] / scale, next[2] / scale};
+  }
+
+  // The endpoints are the colors with the extreme projections on the axis.
+  size_t minimumIndex = 0;
+  size_t maximumIndex = 0;
+  float minimumDot = std::numeric_limits<float>::max();
+  float maximumDot = std::numeric_limits<float>::lowest();
+  for (size_t i = 0; i < 16; ++i) {
+    const float dot = float(block[i * 4]) * axis[0] +
+                      float(block[i * 4 + 1]) * axis[1] +
+                      float(block[i * 4 + 2]) * axis[2];
+    if (dot < minimumDot) {
+      minimumDot = dot;
+      minimumIndex = i;
+    }
+    if (dot > maximumDot) {
+      maximumDot = dot;
+      maximumIndex = i;
+    }
+  }
+
+  // Move the endpoints slightly toward each other, so that the interpolated
+  // colors sit closer to the bulk of the pixels.
+  Color high;
+  Color low;
+  for (size_t c = 0; c < 3; ++c) {
+    const float highValue = float(block[maximumIndex * 4 + c]);
+    const float lowValue = float(block[minimumIndex * 4 + c]);
+    const float inset = (highValue - lowValue) / 16.0f;
+    high[c] = highValue - inset;
+    low[c] = lowValue + inset;
+  }
+
+  uint16_t color0 = toRgb565(high);
+  uint16_t color1 = toRgb565(low);
+
+  // Four-color mode requires color0 > color1. When the two are equal, every
+  // pixel uses color0.
+  if (color0 < color1) {
+    std::swap(color0, color1);
+  }
+
+  uint32_t indices = 0;
+  if (color0 != color1) {
+    const Color palette0 = fromRgb565(color0);
+    const Color palette1 = fromRgb565(color1);
+    std::array<Color, 4> palette{palette0, palette1, Color{}, Color{}};
+    for (size_t c = 0; c < 3; ++c) {
+      palette[2][c] = (2.0f * palette0[c] + palette1[c]) / 3.0f;
+      palette[3][c] = (palette0[c] + 2.0f * palette1[c]) / 3.0f;
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+      const uint8_t* pPixel = &block[i * 4];
+      uint32_t bestIndex = 0;
+      float bestDistance = distanceSquared(palette[0], pPixel);
+      for (uint32_t p = 1; p < 4; ++p) {
+        const float distance = distanceSquared(palette[p], pPixel);
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestIndex = p;
+        }
+      }
+      indices |= bestIndex << (2 * i);
+    }
+  }
+
+  writeLittleEndian(pOut, color0, 2);
+  writeLittleEndian(pOut + 2, color1, 2);
+  writeLittleEndian(pOut + 4, indices, 4);
+}
+
+// Encodes the alpha of a block as the 8-byte alpha part of a BC3 block, using
+// the mode with eight interpolated values.
+void encodeAlphaBlock(const BlockPixels& block, std::byte* pOut) {
+  uint8_t alpha0 = 0;
+  uint8_t alpha1 = 255;
+  for (size_t i = 0; i < 16; ++i) {
+    alpha0 = std::max(alpha0, block[i * 4 + 3]);
+    alpha1 = std::min(alpha1, block[i * 4 + 3]);
+  }
+
+  uint64_t indices = 0;
+  if (alpha0 != alpha1) {
+    std::array<int32_t, 8> palette{};
+    palette[0] = alpha0;
+    palette[1] = alpha1;
+    for (int32_t k = 2; k < 8; ++k) {
+      palette[size_t(k)] = ((8 - k) * alpha0 + (k - 1) * alpha1) / 7;
+    }
+
+    for (size_t i = 0; i < 16; ++i) {
+      const int32_t alpha = block[i * 4 + 3];
+      uint64_t bestIndex = 0;
+      int32_t bestDistance = std::abs(palette[0] - alpha);
+      for (size_t p = 1; p < 8; ++p) {
+        const int32_t distance = std::abs(palette[p] - alpha);
+        if (distance < bestDistance) {
+          bestDistance = distance;
+          bestIndex = p;
+        }
+      }
+      indices |= bestIndex << (3 * i);
+    }
+  }
+
+  pOut[0] = std::byte(alpha0);
+  pOut[1] = std::byte(alpha1);
+  writeLittleEndian(pOut + 2, indices, 6);
+}
+
+bool isOpaque(const ImageAsset& image) {
+  for (size_t i = 3; i < image.pixelData.size(); i += 4) {
+    if (image.pixelData[i] != std::byte(255)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+BlockCompressionTargets::BlockCompressionTargets(
+    const SupportedGpuCompressedPixelFormats& supportedFormats) {
+  if (supportedFormats.BC1_RGB) {
+    this->opaque = GpuCompressedPixelFormat::BC1_RGB;
+  } else if (supportedFormats.BC3_RGBA) {
+    this->opaque = GpuCompressedPixelFormat::BC3_RGBA;
+  }
+
+  if (supportedFormats.BC3_RGBA) {
+    this->translucent = GpuCompressedPixelFormat::BC3_RGBA;
+  }
+}
+
+/*static*/ bool
+BlockCompression::canCompressTo(GpuCompressedPixelFormat format) noexcept {
+  return format == GpuCompressedPixelFormat::BC1_RGB ||
+         format == GpuCompressedPixelFormat::BC3_RGBA;
+}
+
+/*static*/ bool BlockCompression::compress(
+    ImageAsset& image,
+    const BlockCompressionTargets& targets) {
+  if (targets.opaque == GpuCompressedPixelFormat::NONE &&
+      targets.translucent == GpuCompressedPixelFormat::NONE) {
+    return false;
+  }
+
+  if (image.channels != 4 || image.bytesPerChannel != 1) {
+    return false;
+  }
+
+  const GpuCompressedPixelFormat format =
+      isOpaque(image) ? targets.opaque : targets.translucent;
+  return BlockCompression::compress(image, format);
+}
+
+/*static*/ bool
+BlockCompression::compress(ImageAsset& image, GpuCompressedPixelFormat format) {
+  if (!BlockCompression::canCompressTo(format)) {
+    return false;
+  }
+
+  if (image.compressedPixelFormat != GpuCompressedPixelFormat::NONE ||
+      !image.mipPositions.empty() || image.channels != 4 ||
+      image.bytesPerChannel != 1 || image.width <= 0 || image.height <= 0) {
+    return false;
+  }
+
+  if (image.pixelData.size() <
+      size_t(image.width) * size_t(image.height) * 4) {
+    return false;
+  }
+
+  const bool withAlpha = format == GpuCompressedPixelFormat::BC3_RGBA;
+  const size_t bytesPerBlock = withAlpha ? 16 : 8;
+  const int32_t blocksX = (image.width + 3) / 4;
+  const int32_t blocksY = (image.height + 3) / 4;
+
+  std::vector<std::byte> compressed(
+      size_t(blocksX) * size_t(blocksY) * bytesPerBlock);
+  std::byte* pOut = compressed.data();
+
+  BlockPixels block;
+  for (int32_t blockY = 0; blockY < blocksY; ++blockY) {
+    for (int32_t blockX = 0; blockX < blocksX; ++blockX) {
+      readBlock(
+          image.pixelData.data(),
+          image.width,
+          image.height,
+          blockX,
+          blockY,
+          block);
+      if (withAlpha) {
+        encodeAlphaBlock(block, pOut);
+        encodeColorBlock(block, pOut + 8);
+      } else {
+        encodeColorBlock(block, pOut);
+      }
+      pOut += bytesPerBlock;
+    }
+  }
+
+  image.pixelData = std::move(compressed);
+  image.compressedPixelFormat = format;
+  return true;
+}
+
+} // namespace CesiumImage
@@ -1,5 +1,7 @@
 #include <CesiumImage/ImageAsset.h>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -7,12 +9,106 @@
 
 namespace CesiumImage {
 
+namespace {
+
+// Converts pixels with a fixed number of single-byte channels. Knowing the
+// channel counts at compile time lets the compiler unroll the per-pixel loop
+// and vectorize it. The source and target may be the same buffer when
+// `TargetChannels` is less than `SourceChannels`, because each pixel is read
+// before it is written and writes never overtake reads.
+template <size_t SourceChannels, size_t TargetChannels>
+void convertChannels(
+    const std::byte* pSource,
+    std::byte* pTarget,
+    size_t pixelCount,
+    std::byte defaultValue) {
+  constexpr size_t copiedChannels = std::min(SourceChannels, TargetChannels);
+  for (size_t i = 0; i < pixelCount; ++i) {
+    std::array<std::byte, TargetChannels> pixel;
+    for (size_t j = 0; j < copiedChannels; ++j) {
+      pixel[j] = pSource[j];
+    }
+    for (size_t j = copiedChannels; j < TargetChannels; ++j) {
+      pixel[j] = defaultValue;
+    }
+    for (size_t j = 0; j < TargetChannels; ++j) {
+      pTarget[j] = pixel[j];
+    }
+    pSource += SourceChannels;
+    pTarget += TargetChannels;
+  }
+}
+
+using ConvertChannelsFunction =
+    void (*)(const std::byte*, std::byte*, size_t, std::byte);
+
+template <size_t SourceChannels>
+ConvertChannelsFunction getConvertChannels(int32_t targetChannels) {
+  switch (targetChannels) {
+  case 1:
+    return convertChannels<SourceChannels, 1>;
+  case 2:
+    return convertChannels<SourceChannels, 2>;
+  case 3:
+    return convertChannels<SourceChannels, 3>;
+  case 4:
+    return convertChannels<SourceChannels, 4>;
+  default:
+    return nullptr;
+  }
+}
+
+// Gets the specialized conversion between the given numbers of single-byte
+// channels, or nullptr if there isn't one.
+ConvertChannelsFunction
+getConvertChannels(int32_t sourceChannels, int32_t targetChannels) {
+  switch (sourceChannels) {
+  case 1:
+    return getConvertChannels<1>(targetChannels);
+  case 2:
+    return getConvertChannels<2>(targetChannels);
+  case 3:
+    return getConvertChannels<3>(targetChannels);
+  case 4:
+    return getConvertChannels<4>(targetChannels);
+  default:
+    return nullptr;
+  }
+}
+
+} // namespace
+
 void ImageAsset::changeNumberOfChannels(
     int32_t newChannels,
     std::byte defaultValue) {
   if (newChannels == this->channels) {
     // Nothing to do.
     return;
+  }
+
+  ConvertChannelsFunction convert =
+      this->bytesPerChannel == 1
+          ? getConvertChannels(this->channels, newChannels)
+          : nullptr;
+  if (convert) {
+    const size_t pixelCount = this->pixelData.size() / size_t(this->channels);
+    if (newChannels < this->channels) {
+      convert(
+          this->pixelData.data(),
+          this->pixelData.data(),
+          pixelCount,
+          defaultValue);
+      this->pixelData.resize(pixelCount * size_t(newChannels));
+    } else {
+      std::vector<std::byte> newPixelData(
+          (size_t)(newChannels * this->width * this->height));
+      convert(
+          this->pixelData.data(),
+          newPixelData.data(),
+          std::min(pixelCount, newPixelData.size() / size_t(newChannels)),
+          defaultValue);
+      this->pixelData = std::move(newPixelData);
+    }
   } else if (newChannels < this->channels) {
     // We're using fewer channels than previous, so we can perform the
     // conversion in-place.
@@ -1,9 +1,15 @@
 #include <CesiumImage/ImageAsset.h>
 #include <CesiumImage/ImageDecoder.h>
 #include <CesiumImage/ImageManipulation.h>
+#include <CesiumImage/Ktx2TranscodeTargets.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <span>
 #include <vector>
 
 #define STB_IMAGE_WRITE_STATIC
@@ -118,6 +124,165 @@ bool ImageManipulation::blitImage(
 }
 
 namespace {
+
+bool isValidBlit(
+    const ImageBlit& blit,
+    int32_t targetWidth,
+    int32_t targetHeight,
+    int32_t channels,
+    int32_t bytesPerChannel) {
+  if (blit.pSource == nullptr) {
+    return false;
+  }
+
+  const ImageAsset& source = *blit.pSource;
+  const PixelRectangle& sourcePixels = blit.sourcePixels;
+  const PixelRectangle& targetPixels = blit.targetPixels;
+
+  if (sourcePixels.x < 0 || sourcePixels.y < 0 || sourcePixels.width < 0 ||
+      sourcePixels.height < 0 ||
+      (sourcePixels.x + sourcePixels.width) > source.width ||
+      (sourcePixels.y + sourcePixels.height) > source.height) {
+    return false;
+  }
+
+  if (targetPixels.x < 0 || targetPixels.y < 0 || targetPixels.width < 0 ||
+      targetPixels.height < 0 ||
+      (targetPixels.x + targetPixels.width) > targetWidth ||
+      (targetPixels.y + targetPixels.height) > targetHeight) {
+    return false;
+  }
+
+  if (source.channels != channels ||
+      source.bytesPerChannel != bytesPerChannel) {
+    return false;
+  }
+
+  const size_t bytesPerPixel = size_t(channels * bytesPerChannel);
+  if (source.pixelData.size() <
+      size_t(source.width) * size_t(source.height) * bytesPerPixel) {
+    return false;
+  }
+
+  const bool needsScaling = sourcePixels.width != targetPixels.width ||
+                            sourcePixels.height != targetPixels.height;
+
+  // We currently only support resizing images that use 1 byte per channel.
+  return !needsScaling || bytesPerChannel == 1;
+}
+
+// One unscaled blit, ready to be copied row by row.
+struct RowCopy {
+  std::byte* pTarget;
+  const std::byte* pSource;
+  size_t sourceRowStride;
+  size_t bytesPerRow;
+  int32_t firstRow;
+  int32_t endRow;
+};
+
+// Determines whether an image stores uncompressed pixels with one byte per
+// channel, which the per-pixel kernels below require.
+bool isUncompressed8Bit(const ImageAsset& image) {
+  return image.compressedPixelFormat == GpuCompressedPixelFormat::NONE &&
+         image.mipPositions.empty() && image.bytesPerChannel == 1 &&
+         image.channels > 0 && image.width >= 0 && image.height >= 0 &&
+         image.pixelData.size() >=
+             size_t(image.width) * size_t(image.height) *
+                 size_t(image.channels);
+}
+
+// Computes round(value / 255) for value in [0, 255 * 255], without a division.
+uint8_t divideBy255(uint32_t value) {
+  value += 128;
+  return uint8_t((value + (value >> 8)) >> 8);
+}
+
+template <size_t Channels>
+void premultiplyPixels(std::byte* pPixels, size_t pixelCount) {
+  for (size_t i = 0; i < pixelCount; ++i) {
+    const uint32_t alpha = std::to_integer<uint32_t>(pPixels[Channels - 1]);
+    for (size_t j = 0; j < Channels - 1; ++j) {
+      pPixels[j] = std::byte(
+          divideBy255(std::to_integer<uint32_t>(pPixels[j]) * alpha));
+    }
+    pPixels += Channels;
+  }
+}
+
+using ByteTable = std::array<uint8_t, 256>;
+
+const ByteTable& getSrgbToLinearTable() {
+  static const ByteTable table = []() {
+    ByteTable result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+      const double srgb = double(i) / 255.0;
+      const double linear = srgb <= 0.04045
+                                ? srgb / 12.92
+                                : std::pow((srgb + 0.055) / 1.055, 2.4);
+      result[i] = uint8_t(std::lround(linear * 255.0));
+    }
+    return result;
+  }();
+  return table;
+}
+
+const ByteTable& getLinearToSrgbTable() {
+  static const ByteTable table = []() {
+    ByteTable result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+      const double linear = double(i) / 255.0;
+      const double srgb = linear <= 0.0031308
+                              ? linear * 12.92
+                              : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+      result[i] = uint8_t(std::lround(srgb * 255.0));
+    }
+    return result;
+  }();
+  return table;
+}
+
+template <size_t Channels>
+void lookUpColorChannels(
+    std::byte* pPixels,
+    size_t pixelCount,
+    const ByteTable& table) {
+  // With two or four channels, the last one is alpha and is left unchanged.
+  constexpr size_t colorChannels =
+      Channels == 2 || Channels == 4 ? Channels - 1 : Channels;
+  for (size_t i = 0; i < pixelCount; ++i) {
+    for (size_t j = 0; j < colorChannels; ++j) {
+      pPixels[j] = std::byte(table[std::to_integer<size_t>(pPixels[j])]);
+    }
+    pPixels += Channels;
+  }
+}
+
+bool lookUpColorChannels(ImageAsset& image, const ByteTable& table) {
+  if (!isUncompressed8Bit(image)) {
+    return false;
+  }
+
+  std::byte* pPixels = image.pixelData.data();
+  const size_t pixelCount = size_t(image.width) * size_t(image.height);
+  switch (image.channels) {
+  case 1:
+    lookUpColorChannels<1>(pPixels, pixelCount, table);
+    return true;
+  case 2:
+    lookUpColorChannels<2>(pPixels, pixelCount, table);
+    return true;
+  case 3:
+    lookUpColorChannels<3>(pPixels, pixelCount, table);
+    return true;
+  case 4:
+    lookUpColorChannels<4>(pPixels, pixelCount, table);
+    return true;
+  default:
+    return false;
+  }
+}
+
 void writePngToVector(void* context, void* data, int size) {
   std::vector<std::byte>* pVector =
       reinterpret_cast<std::vector<std::byte>*>(context);
@@ -127,6 +292,164 @@ void writePngToVector(void* context, void* data, int size) {
 }
 } // namespace
 
+/*static*/ bool ImageManipulation::compositeImages(
+    ImageAsset& target,
+    std::span<const ImageBlit> blits) {
+  return ImageManipulation::compositeImages(
+      std::span<std::byte>(target.pixelData),
+      size_t(target.width * target.channels * target.bytesPerChannel),
+      target.width,
+      target.height,
+      target.channels,
+      target.bytesPerChannel,
+      blits);
+}
+
+/*static*/ bool ImageManipulation::compositeImages(
+    std::span<std::byte> target,
+    size_t targetRowStride,
+    int32_t targetWidth,
+    int32_t targetHeight,
+    int32_t channels,
+    int32_t bytesPerChannel,
+    std::span<const ImageBlit> blits) {
+  if (targetWidth < 0 || targetHeight < 0 || channels <= 0 ||
+      bytesPerChannel <= 0) {
+    return false;
+  }
+
+  const size_t bytesPerPixel = size_t(channels * bytesPerChannel);
+  const size_t bytesPerTargetRow = bytesPerPixel * size_t(targetWidth);
+  if (targetRowStride < bytesPerTargetRow) {
+    return false;
+  }
+
+  if (targetHeight > 0 &&
+      target.size() <
+          size_t(targetHeight - 1) * targetRowStride + bytesPerTargetRow) {
+    return false;
+  }
+
+  bool allBlitsCompleted = true;
+  std::vector<RowCopy> copies;
+  copies.reserve(blits.size());
+
+  size_t i = 0;
+  while (i < blits.size()) {
+    // Gather the run of unscaled blits up to the next one that needs scaling.
+    copies.clear();
+    int32_t firstRow = targetHeight;
+    int32_t endRow = 0;
+
+    for (; i < blits.size(); ++i) {
+      const ImageBlit& blit = blits[i];
+      if (!isValidBlit(
+              blit,
+              targetWidth,
+              targetHeight,
+              channels,
+              bytesPerChannel)) {
+        allBlitsCompleted = false;
+        continue;
+      }
+
+      const PixelRectangle& sourcePixels = blit.sourcePixels;
+      const PixelRectangle& targetPixels = blit.targetPixels;
+      if (sourcePixels.width != targetPixels.width ||
+          sourcePixels.height != targetPixels.height) {
+        break;
+      }
+
+      if (targetPixels.width == 0 || targetPixels.height == 0) {
+        continue;
+      }
+
+      const size_t sourceRowStride =
+          bytesPerPixel * size_t(blit.pSource->width);
+      copies.emplace_back(RowCopy{
+          target.data() + size_t(targetPixels.y) * targetRowStride +
+              size_t(targetPixels.x) * bytesPerPixel,
+          blit.pSource->pixelData.data() +
+              size_t(sourcePixels.y) * sourceRowStride +
+              size_t(sourcePixels.x) * bytesPerPixel,
+          sourceRowStride,
+          size_t(targetPixels.width) * bytesPerPixel,
+          targetPixels.y,
+          targetPixels.y + targetPixels.height});
+      firstRow = std::min(firstRow, targetPixels.y);
+      endRow = std::max(endRow, targetPixels.y + targetPixels.height);
+    }
+
+    // Copy the run one target row at a time, in blit order within each row.
+    for (int32_t row = firstRow; row < endRow; ++row) {
+      for (const RowCopy& copy : copies) {
+        if (row < copy.firstRow || row >= copy.endRow) {
+          continue;
+        }
+
+        const size_t rowInCopy = size_t(row - copy.firstRow);
+        std::memcpy(
+            copy.pTarget + rowInCopy * targetRowStride,
+            copy.pSource + rowInCopy * copy.sourceRowStride,
+            copy.bytesPerRow);
+      }
+    }
+
+    if (i == blits.size()) {
+      break;
+    }
+
+    // This blit is valid but needs scaling, so use STB to do the copy / scale.
+    const ImageBlit& blit = blits[i++];
+    const PixelRectangle& sourcePixels = blit.sourcePixels;
+    const PixelRectangle& targetPixels = blit.targetPixels;
+    const size_t sourceRowStride = bytesPerPixel * size_t(blit.pSource->width);
+    const bool resized = ImageDecoder::unsafeResize(
+        blit.pSource->pixelData.data() +
+            size_t(sourcePixels.y) * sourceRowStride +
+            size_t(sourcePixels.x) * bytesPerPixel,
+        sourcePixels.width,
+        sourcePixels.height,
+        int(sourceRowStride),
+        target.data() + size_t(targetPixels.y) * targetRowStride +
+            size_t(targetPixels.x) * bytesPerPixel,
+        targetPixels.width,
+        targetPixels.height,
+        int(targetRowStride),
+        channels);
+    allBlitsCompleted = allBlitsCompleted && resized;
+  }
+
+  return allBlitsCompleted;
+}
+
+/*static*/ bool ImageManipulation::premultiplyAlpha(ImageAsset& image) {
+  if (!isUncompressed8Bit(image)) {
+    return false;
+  }
+
+  std::byte* pPixels = image.pixelData.data();
+  const size_t pixelCount = size_t(image.width) * size_t(image.height);
+  switch (image.channels) {
+  case 2:
+    premultiplyPixels<2>(pPixels, pixelCount);
+    return true;
+  case 4:
+    premultiplyPixels<4>(pPixels, pixelCount);
+    return true;
+  default:
+    return false;
+  }
+}
+
+/*static*/ bool ImageManipulation::convertSrgbToLinear(ImageAsset& image) {
+  return lookUpColorChannels(image, getSrgbToLinearTable());
+}
+
+/*static*/ bool ImageManipulation::convertLinearToSrgb(ImageAsset& image) {
+  return lookUpColorChannels(image, getLinearToSrgbTable());
+}
+
 /*static*/ void ImageManipulation::savePng(
     const ImageAsset& image,
     std::vector<std::byte>& output) {
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <CesiumImage/ImageAsset.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+namespace CesiumNativeTests {
+
+// Creates an RGBA image with the color returned by `pixel(x, y)` for each
+// pixel.
+template <typename TPixel>
+CesiumImage::ImageAsset
+createImage(int32_t width, int32_t height, TPixel&& pixel) {
+  CesiumImage::ImageAsset image;
+  image.bytesPerChannel = 1;
+  image.channels = 4;
+  image.width = width;
+  image.height = height;
+  image.pixelData.resize(size_t(width) * size_t(height) * 4);
+  for (int32_t y = 0; y < height; ++y) {
+    for (int32_t x = 0; x < width; ++x) {
+      const std::array<uint8_t, 4> rgba = pixel(x, y);
+      const size_t offset = (size_t(y) * size_t(width) + size_t(x)) * 4;
+      for (size_t c = 0; c < 4; ++c) {
+        image.pixelData[offset + c] = std::byte(rgba[c]);
+      }
+    }
+  }
+  return image;
+}
+
+// Creates an RGBA image with random pixels.
+inline CesiumImage::ImageAsset
+createRandomImage(int32_t width, int32_t height, uint32_t seed) {
+  std::default_random_engine rand(seed);
+  std::uniform_int_distribution<uint32_t> byteDist(0, 255);
+
+  CesiumImage::ImageAsset image;
+  image.bytesPerChannel = 1;
+  image.channels = 4;
+  image.width = width;
+  image.height = height;
+  image.pixelData.resize(size_t(width * height * 4));
+  for (std::byte& b : image.pixelData) {
+    b = std::byte(byteDist(rand));
+  }
+  return image;
+}
+
+} // namespace CesiumNativeTests
@@ -0,0 +1,152 @@
+#include "CreateTestImage.h"
+
+#include <CesiumImage/BlockCompression.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumImage/ImageManipulation.h>
+#include <CesiumImage/Ktx2TranscodeTargets.h>
+
+#include <doctest/doctest.h>
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+using namespace CesiumImage;
+using namespace CesiumNativeTests;
+
+TEST_CASE("BlockCompression benchmark" * doctest::skip(true)) {
+  const ImageAsset source = createImage(2048, 2048, [](int32_t x, int32_t y) {
+    return std::array<uint8_t, 4>{
+        uint8_t(x ^ y),
+        uint8_t(x + y),
+        uint8_t(x * y),
+        uint8_t(255)};
+  });
+
+  for (GpuCompressedPixelFormat format :
+       {GpuCompressedPixelFormat::BC1_RGB,
+        GpuCompressedPixelFormat::BC3_RGBA}) {
+    ImageAsset image = source;
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    BlockCompression::compress(image, format);
+    spdlog::info(
+        "Compressed {}x{} image to {} bytes in {:.2f} ms",
+        image.width,
+        image.height,
+        image.pixelData.size(),
+        std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+            std::chrono::steady_clock::now() - start)
+            .count());
+  }
+}
+
+TEST_CASE("ImageManipulation kernel benchmark" * doctest::skip(true)) {
+  const ImageAsset rgba = createRandomImage(2048, 2048, 7);
+  ImageAsset rgb = rgba;
+  rgb.changeNumberOfChannels(3);
+
+  const int iterations = 20;
+  auto runBenchmark = [&](const char* name,
+                          size_t bytesPerIteration,
+                          const std::function<void()>& kernel) {
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (int k = 0; k < iterations; ++k) {
+      kernel();
+    }
+    const double seconds =
+        std::chrono::duration_cast<std::chrono::duration<double>>(
+            std::chrono::steady_clock::now() - start)
+            .count();
+    spdlog::info(
+        "{}: {:.2f} GB/s",
+        name,
+        double(bytesPerIteration) * iterations / seconds / 1e9);
+  };
+
+  ImageAsset target = rgba;
+  runBenchmark("blitImage", rgba.pixelData.size(), [&]() {
+    ImageManipulation::blitImage(
+        target,
+        {0, 0, 2047, 2047},
+        rgba,
+        {1, 1, 2047, 2047});
+  });
+
+  runBenchmark("changeNumberOfChannels 3 to 4", rgb.pixelData.size(), [&]() {
+    ImageAsset image = rgb;
+    image.changeNumberOfChannels(4, std::byte(255));
+  });
+
+  runBenchmark("changeNumberOfChannels 4 to 3", rgba.pixelData.size(), [&]() {
+    ImageAsset image = rgba;
+    image.changeNumberOfChannels(3);
+  });
+
+  runBenchmark("premultiplyAlpha", rgba.pixelData.size(), [&]() {
+    ImageManipulation::premultiplyAlpha(target);
+  });
+
+  runBenchmark("convertSrgbToLinear", rgba.pixelData.size(), [&]() {
+    ImageManipulation::convertSrgbToLinear(target);
+  });
+
+  runBenchmark("convertLinearToSrgb", rgba.pixelData.size(), [&]() {
+    ImageManipulation::convertLinearToSrgb(target);
+  });
+}
+
+TEST_CASE(
+    "ImageManipulation::compositeImages benchmark" * doctest::skip(true)) {
+  // A 4x4 grid of 256x256 tiles composed into one target, as happens when a
+  // high-resolution raster overlay is mapped to a geometry tile.
+  std::vector<ImageAsset> sources;
+  std::vector<ImageBlit> blits;
+  sources.reserve(16);
+  for (int32_t j = 0; j < 4; ++j) {
+    for (int32_t i = 0; i < 4; ++i) {
+      sources.emplace_back(createRandomImage(256, 256, uint32_t(j * 4 + i)));
+      blits.emplace_back(ImageBlit{
+          &sources.back(),
+          {0, 0, 256, 256},
+          {i * 256, j * 256, 256, 256}});
+    }
+  }
+
+  ImageAsset target = createRandomImage(1024, 1024, 99);
+  const int iterations = 200;
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    for (const ImageBlit& blit : blits) {
+      ImageManipulation::blitImage(
+          target,
+          blit.targetPixels,
+          *blit.pSource,
+          blit.sourcePixels);
+    }
+  }
+  spdlog::info(
+      "blitImage: {:.3f} ms per target",
+      std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+          std::chrono::steady_clock::now() - start)
+              .count() /
+          iterations);
+
+  start = std::chrono::steady_clock::now();
+  for (int k = 0; k < iterations; ++k) {
+    ImageManipulation::compositeImages(target, blits);
+  }
+  spdlog::info(
+      "compositeImages: {:.3f} ms per target",
+      std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+          std::chrono::steady_clock::now() - start)
+              .count() /
+          iterations);
+}
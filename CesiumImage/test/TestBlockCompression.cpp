@@ -0,0 +1,249 @@
+#include "CreateTestImage.h"
+
+#include <CesiumImage/BlockCompression.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumImage/Ktx2TranscodeTargets.h>
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+using namespace CesiumImage;
+using namespace CesiumNativeTests;
+
+namespace {
+
+uint64_t readLittleEndian(const std::byte* pData, size_t bytes) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < bytes; ++i) {
+    result |= uint64_t(std::to_integer<uint8_t>(pData[i])) << (8 * i);
+  }
+  return result;
+}
+
+std::array<int32_t, 3> expand565(uint16_t value) {
+  const int32_t r = (value >> 11) & 0x1F;
+  const int32_t g = (value >> 5) & 0x3F;
+  const int32_t b = value & 0x1F;
+  return {(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)};
+}
+
+// A straightforward BC1 / BC3 decoder, following the format specification.
+std::vector<uint8_t> decompress(const ImageAsset& image) {
+  const bool withAlpha =
+      image.compressedPixelFormat == GpuCompressedPixelFormat::BC3_RGBA;
+  const size_t bytesPerBlock = withAlpha ? 16 : 8;
+  const int32_t blocksX = (image.width + 3) / 4;
+  const int32_t blocksY = (image.height + 3) / 4;
+  REQUIRE(
+      image.pixelData.size() ==
+      size_t(blocksX) * size_t(blocksY) * bytesPerBlock);
+
+  std::vector<uint8_t> result(size_t(image.width) * size_t(image.height) * 4);
+  const std::byte* pBlock = image.pixelData.data();
+  for (int32_t blockY = 0; blockY < blocksY; ++blockY) {
+    for (int32_t blockX = 0; blockX < blocksX; ++blockX) {
+      std::array<int32_t, 8> alphas{};
+      uint64_t alphaIndices = 0;
+      const std::byte* pColor = pBlock;
+      if (withAlpha) {
+        const int32_t a0 = std::to_integer<int32_t>(pBlock[0]);
+        const int32_t a1 = std::to_integer<int32_t>(pBlock[1]);
+        alphas[0] = a0;
+        alphas[1] = a1;
+        if (a0 > a1) {
+          for (int32_t k = 2; k < 8; ++k) {
+            alphas[size_t(k)] = ((8 - k) * a0 + (k - 1) * a1) / 7;
+          }
+        } else {
+          for (int32_t k = 2; k < 6; ++k) {
+            alphas[size_t(k)] = ((6 - k) * a0 + (k - 1) * a1) / 5;
+          }
+          alphas[6] = 0;
+          alphas[7] = 255;
+        }
+        alphaIndices = readLittleEndian(pBlock + 2, 6);
+        pColor = pBlock + 8;
+      }
+
+      const uint16_t c0 = uint16_t(readLittleEndian(pColor, 2));
+      const uint16_t c1 = uint16_t(readLittleEndian(pColor + 2, 2));
+      const uint32_t indices = uint32_t(readLittleEndian(pColor + 4, 4));
+      std::array<std::array<int32_t, 3>, 4> colors{};
+      colors[0] = expand565(c0);
+      colors[1] = expand565(c1);
+      for (size_t c = 0; c < 3; ++c) {
+        if (c0 > c1 || withAlpha) {
+          colors[2][c] = (2 * colors[0][c] + colors[1][c]) / 3;
+          colors[3][c] = (colors[0][c] + 2 * colors[1][c]) / 3;
+        } else {
+          colors[2][c] = (colors[0][c] + colors[1][c]) / 2;
+          colors[3][c] = 0;
+        }
+      }
+
+      for (int32_t j = 0; j < 4; ++j) {
+        for (int32_t i = 0; i < 4; ++i) {
+          const int32_t x = blockX * 4 + i;
+          const int32_t y = blockY * 4 + j;
+          if (x >= image.width || y >= image.height) {
+            continue;
+          }
+          const uint32_t pixel = uint32_t(j * 4 + i);
+          const size_t colorIndex = (indices >> (2 * pixel)) & 0x3;
+          const size_t offset = (size_t(y) * size_t(image.width) + size_t(x)) *
+                                4;
+          for (size_t c = 0; c < 3; ++c) {
+            result[offset + c] = uint8_t(colors[colorIndex][c]);
+          }
+          result[offset + 3] =
+              withAlpha ? uint8_t(alphas[(alphaIndices >> (3 * pixel)) & 0x7])
+                        : uint8_t(255);
+        }
+      }
+
+      pBlock += bytesPerBlock;
+    }
+  }
+
+  return result;
+}
+
+int32_t maximumError(
+    const std::vector<std::byte>& original,
+    const std::vector<uint8_t>& decoded) {
+  REQUIRE(original.size() == decoded.size());
+  int32_t result = 0;
+  for (size_t i = 0; i < original.size(); ++i) {
+    result = std::max(
+        result,
+        std::abs(std::to_integer<int32_t>(original[i]) - int32_t(decoded[i])));
+  }
+  return result;
+}
+
+} // namespace
+
+TEST_CASE("BlockCompression") {
+  SUBCASE("compresses a solid opaque image to BC1") {
+    ImageAsset image = createImage(8, 8, [](int32_t, int32_t) {
+      return std::array<uint8_t, 4>{255, 0, 0, 255};
+    });
+    const std::vector<std::byte> original = image.pixelData;
+
+    REQUIRE(
+        BlockCompression::compress(image, GpuCompressedPixelFormat::BC1_RGB));
+    CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::BC1_RGB);
+    CHECK(image.width == 8);
+    CHECK(image.height == 8);
+    CHECK(image.pixelData.size() == 4 * 8);
+    CHECK(maximumError(original, decompress(image)) == 0);
+  }
+
+  SUBCASE("compresses gradients with a bounded error") {
+    ImageAsset image = createImage(64, 64, [](int32_t x, int32_t y) {
+      return std::array<uint8_t, 4>{
+          uint8_t(x * 4),
+          uint8_t(y * 4),
+          uint8_t(255 - x * 2),
+          uint8_t(y * 4)};
+    });
+    const std::vector<std::byte> original = image.pixelData;
+
+    REQUIRE(
+        BlockCompression::compress(image, GpuCompressedPixelFormat::BC3_RGBA));
+    CHECK(image.compressedPixelFormat == GpuCompressedPixelFormat::BC3_RGBA);
+    CHECK(image.pixelData.size() == 16 * 16 * 16);
+    CHECK(maximumError(original, decompress(image)) <= 16);
+  }
+
+  SUBCASE("pads images whose dimensions are not multiples of four") {
+    ImageAsset image = createImage(7, 5, [](int32_t x, int32_t y) {
+      return std::array<uint8_t, 4>{
+          uint8_t(x * 30),
+          uint8_t(x * 30),
+          uint8_t(x * 30),
+          uint8_t(y < 2 ? 0 : 255)};
+    });
+    const std::vector<std::byte> original = image.pixelData;
+
+    REQUIRE(
+        BlockCompression::compress(image, GpuCompressedPixelFormat::BC3_RGBA));
+    CHECK(image.width == 7);
+    CHECK(image.height == 5);
+    CHECK(image.pixelData.size() == 2 * 2 * 16);
+    CHECK(maximumError(original, decompress(image)) <= 16);
+  }
+
+  SUBCASE("chooses a target by the image's opacity") {
+    BlockCompressionTargets targets;
+    targets.opaque = GpuCompressedPixelFormat::BC1_RGB;
+    targets.translucent = GpuCompressedPixelFormat::BC3_RGBA;
+
+    ImageAsset opaque = createImage(4, 4, [](int32_t, int32_t) {
+      return std::array<uint8_t, 4>{10, 20, 30, 255};
+    });
+    REQUIRE(BlockCompression::compress(opaque, targets));
+    CHECK(opaque.compressedPixelFormat == GpuCompressedPixelFormat::BC1_RGB);
+
+    ImageAsset translucent = createImage(4, 4, [](int32_t x, int32_t) {
+      return std::array<uint8_t, 4>{10, 20, 30, uint8_t(x * 60)};
+    });
+    REQUIRE(BlockCompression::compress(translucent, targets));
+    CHECK(
+        translucent.compressedPixelFormat ==
+        GpuCompressedPixelFormat::BC3_RGBA);
+
+    targets.translucent = GpuCompressedPixelFormat::NONE;
+    ImageAsset uncompressed = createImage(4, 4, [](int32_t, int32_t) {
+      return std::array<uint8_t, 4>{10, 20, 30, 128};
+    });
+    CHECK(!BlockCompression::compress(uncompressed, targets));
+    CHECK(
+        uncompressed.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+  }
+
+  SUBCASE("builds targets from the supported formats") {
+    SupportedGpuCompressedPixelFormats supported;
+    CHECK(
+        BlockCompressionTargets(supported).opaque ==
+        GpuCompressedPixelFormat::NONE);
+
+    supported.BC3_RGBA = true;
+    const BlockCompressionTargets bc3Only(supported);
+    CHECK(bc3Only.opaque == GpuCompressedPixelFormat::BC3_RGBA);
+    CHECK(bc3Only.translucent == GpuCompressedPixelFormat::BC3_RGBA);
+
+    supported.BC1_RGB = true;
+    const BlockCompressionTargets both(supported);
+    CHECK(both.opaque == GpuCompressedPixelFormat::BC1_RGB);
+    CHECK(both.translucent == GpuCompressedPixelFormat::BC3_RGBA);
+  }
+
+  SUBCASE("leaves images it cannot compress unchanged") {
+    ImageAsset image = createImage(4, 4, [](int32_t, int32_t) {
+      return std::array<uint8_t, 4>{1, 2, 3, 4};
+    });
+    CHECK(!BlockCompression::compress(
+        image,
+        GpuCompressedPixelFormat::ETC2_RGBA));
+
+    ImageAsset rgb = image;
+    rgb.changeNumberOfChannels(3);
+    const std::vector<std::byte> original = rgb.pixelData;
+    CHECK(!BlockCompression::compress(rgb, GpuCompressedPixelFormat::BC1_RGB));
+    CHECK(rgb.compressedPixelFormat == GpuCompressedPixelFormat::NONE);
+    CHECK(rgb.pixelData == original);
+
+    ImageAsset withMips = image;
+    withMips.mipPositions.emplace_back(ImageAssetMipPosition{0, 64});
+    CHECK(!BlockCompression::compress(
+        withMips,
+        GpuCompressedPixelFormat::BC1_RGB));
+  }
+}
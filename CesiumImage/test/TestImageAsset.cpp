@@ -2,6 +2,9 @@
 
 #include <doctest/doctest.h>
 
+#include <cstddef>
+#include <vector>
+
 TEST_CASE("ImageAsset::changeNumberOfChannels") {
   SUBCASE("Converts to fewer channels") {
     CesiumImage::ImageAsset asset;
@@ -61,4 +64,29 @@ TEST_CASE("ImageAsset::changeNumberOfChannels") {
     CHECK(asset.channels == 2);
     CHECK(asset.pixelData.size() == 8);
   }
+
+  SUBCASE("Converts between RGB and RGBA") {
+    CesiumImage::ImageAsset asset;
+    asset.channels = 3;
+    asset.width = 5;
+    asset.height = 3;
+    asset.bytesPerChannel = 1;
+    for (size_t i = 0; i < 5 * 3 * 3; ++i) {
+      asset.pixelData.emplace_back(std::byte(i));
+    }
+    const std::vector<std::byte> original = asset.pixelData;
+
+    asset.changeNumberOfChannels(4, std::byte{0xff});
+    REQUIRE(asset.pixelData.size() == 5 * 3 * 4);
+    for (size_t i = 0; i < 5 * 3; ++i) {
+      CHECK(asset.pixelData[i * 4] == original[i * 3]);
+      CHECK(asset.pixelData[i * 4 + 1] == original[i * 3 + 1]);
+      CHECK(asset.pixelData[i * 4 + 2] == original[i * 3 + 2]);
+      CHECK(asset.pixelData[i * 4 + 3] == std::byte{0xff});
+    }
+
+    asset.changeNumberOfChannels(3);
+    CHECK(asset.channels == 3);
+    CHECK(asset.pixelData == original);
+  }
 }
@@ -1,3 +1,5 @@
+#include "CreateTestImage.h"
+
 #include <CesiumImage/ImageAsset.h>
 #include <CesiumImage/ImageManipulation.h>
 
@@ -5,9 +7,12 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <vector>
 
 using namespace CesiumImage;
+using namespace CesiumNativeTests;
 
 TEST_CASE("ImageManipulation::unsafeBlitImage entire image") {
   size_t width = 10;
@@ -333,3 +338,181 @@ TEST_CASE("ImageManipulation::blitImage") {
     verifyTargetUnchanged();
   }
 }
+
+TEST_CASE("ImageManipulation::compositeImages") {
+  const ImageAsset blank = createRandomImage(64, 48, 1);
+  std::vector<ImageAsset> sources;
+  for (uint32_t i = 0; i < 4; ++i) {
+    sources.emplace_back(createRandomImage(32, 24, 10 + i));
+  }
+
+  // Overlapping blits, including scaled ones in the middle of the sequence,
+  // so that the order in which they are applied matters.
+  const std::vector<ImageBlit> blits{
+      {&sources[0], {0, 0, 32, 24}, {0, 0, 32, 24}},
+      {&sources[1], {0, 0, 32, 24}, {30, 0, 32, 24}},
+      {&sources[2], {4, 4, 16, 12}, {10, 10, 32, 24}},
+      {&sources[3], {0, 0, 32, 24}, {20, 20, 32, 24}},
+      {&sources[0], {8, 8, 20, 10}, {0, 30, 20, 10}},
+      {&sources[1], {0, 0, 32, 24}, {16, 12, 16, 12}},
+      {&sources[2], {1, 2, 5, 7}, {50, 40, 5, 7}}};
+
+  ImageAsset expected = blank;
+  for (const ImageBlit& blit : blits) {
+    REQUIRE(ImageManipulation::blitImage(
+        expected,
+        blit.targetPixels,
+        *blit.pSource,
+        blit.sourcePixels));
+  }
+
+  SUBCASE("matches blitImage applied in order") {
+    ImageAsset target = blank;
+    CHECK(ImageManipulation::compositeImages(target, blits));
+    CHECK(target.pixelData == expected.pixelData);
+  }
+
+  SUBCASE("writes to a buffer with a larger row stride") {
+    const size_t bytesPerRow = size_t(blank.width * 4);
+    const size_t rowStride = bytesPerRow + 12;
+    std::vector<std::byte> buffer(
+        rowStride * size_t(blank.height),
+        std::byte(0xAB));
+    for (size_t j = 0; j < size_t(blank.height); ++j) {
+      std::copy_n(
+          blank.pixelData.begin() + std::ptrdiff_t(j * bytesPerRow),
+          bytesPerRow,
+          buffer.begin() + std::ptrdiff_t(j * rowStride));
+    }
+
+    CHECK(ImageManipulation::compositeImages(
+        buffer,
+        rowStride,
+        blank.width,
+        blank.height,
+        4,
+        1,
+        blits));
+
+    for (size_t j = 0; j < size_t(blank.height); ++j) {
+      CHECK(std::equal(
+          expected.pixelData.begin() + std::ptrdiff_t(j * bytesPerRow),
+          expected.pixelData.begin() + std::ptrdiff_t((j + 1) * bytesPerRow),
+          buffer.begin() + std::ptrdiff_t(j * rowStride)));
+      CHECK(std::all_of(
+          buffer.begin() + std::ptrdiff_t(j * rowStride + bytesPerRow),
+          buffer.begin() + std::ptrdiff_t((j + 1) * rowStride),
+          [](std::byte b) { return b == std::byte(0xAB); }));
+    }
+  }
+
+  SUBCASE("skips invalid blits and reports them") {
+    std::vector<ImageBlit> withInvalid = blits;
+    withInvalid.insert(
+        withInvalid.begin() + 2,
+        ImageBlit{&sources[0], {0, 0, 32, 24}, {40, 40, 32, 24}});
+    withInvalid.push_back(ImageBlit{nullptr, {0, 0, 1, 1}, {0, 0, 1, 1}});
+
+    ImageAsset target = blank;
+    CHECK(!ImageManipulation::compositeImages(target, withInvalid));
+    CHECK(target.pixelData == expected.pixelData);
+  }
+
+  SUBCASE("does nothing when the target buffer is too small") {
+    std::vector<std::byte> buffer(100, std::byte(1));
+    CHECK(!ImageManipulation::compositeImages(
+        buffer,
+        size_t(blank.width * 4),
+        blank.width,
+        blank.height,
+        4,
+        1,
+        blits));
+    CHECK(std::all_of(buffer.begin(), buffer.end(), [](std::byte b) {
+      return b == std::byte(1);
+    }));
+  }
+}
+
+TEST_CASE("ImageManipulation::premultiplyAlpha") {
+  ImageAsset image;
+  image.bytesPerChannel = 1;
+  image.channels = 4;
+  image.width = 3;
+  image.height = 1;
+  image.pixelData = {
+      std::byte(200),
+      std::byte(100),
+      std::byte(50),
+      std::byte(255),
+      std::byte(200),
+      std::byte(100),
+      std::byte(50),
+      std::byte(128),
+      std::byte(200),
+      std::byte(100),
+      std::byte(50),
+      std::byte(0)};
+
+  REQUIRE(ImageManipulation::premultiplyAlpha(image));
+  const std::vector<std::byte> expected{
+      std::byte(200),
+      std::byte(100),
+      std::byte(50),
+      std::byte(255),
+      std::byte(100),
+      std::byte(50),
+      std::byte(25),
+      std::byte(128),
+      std::byte(0),
+      std::byte(0),
+      std::byte(0),
+      std::byte(0)};
+  CHECK(image.pixelData == expected);
+
+  SUBCASE("returns false for images without alpha") {
+    ImageAsset rgb = createRandomImage(4, 4, 1);
+    rgb.changeNumberOfChannels(3);
+    const std::vector<std::byte> original = rgb.pixelData;
+    CHECK(!ImageManipulation::premultiplyAlpha(rgb));
+    CHECK(rgb.pixelData == original);
+  }
+}
+
+TEST_CASE("ImageManipulation sRGB conversion") {
+  ImageAsset image;
+  image.bytesPerChannel = 1;
+  image.channels = 4;
+  image.width = 256;
+  image.height = 1;
+  for (size_t i = 0; i < 256; ++i) {
+    image.pixelData.insert(image.pixelData.end(), 4, std::byte(i));
+  }
+
+  REQUIRE(ImageManipulation::convertSrgbToLinear(image));
+  CHECK(image.pixelData[0] == std::byte(0));
+  CHECK(image.pixelData[4 * 128] == std::byte(55));
+  CHECK(image.pixelData[4 * 255] == std::byte(255));
+  for (size_t i = 0; i < 256; ++i) {
+    // Alpha is unchanged.
+    CHECK(image.pixelData[i * 4 + 3] == std::byte(i));
+    // The conversion is monotonic.
+    if (i > 0) {
+      CHECK(image.pixelData[i * 4] >= image.pixelData[(i - 1) * 4]);
+    }
+  }
+
+  REQUIRE(ImageManipulation::convertLinearToSrgb(image));
+  for (size_t i = 128; i < 256; ++i) {
+    // Bright colors survive the round trip almost exactly.
+    CHECK(std::abs(std::to_integer<int>(image.pixelData[i * 4]) - int(i)) <= 2);
+  }
+
+  SUBCASE("returns false for 16-bit images") {
+    ImageAsset wide = image;
+    wide.bytesPerChannel = 2;
+    wide.width = 128;
+    CHECK(!ImageManipulation::convertSrgbToLinear(wide));
+    CHECK(!ImageManipulation::convertLinearToSrgb(wide));
+  }
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <CesiumJsonWriter/JsonWriter.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CesiumJsonWriter {
+
+/**
+ * @brief Implementation of \ref JsonWriter that writes compact JSON directly
+ * into its own buffer, without going through a `rapidjson::Writer`.
+ *
+ * Each value is appended to the buffer without the nesting bookkeeping of a
+ * `rapidjson::Writer`. Calls through a `JsonWriter&`, such as those made by
+ * the glTF and tileset writers, are still dispatched virtually.
+ *
+ * Numbers are formatted with `std::to_chars`, which produces the shortest
+ * representation that reads back as the same value, so some floating-point
+ * numbers are formatted differently than by \ref JsonWriter. Floating-point
+ * numbers with an integer value are still written with a fractional part,
+ * such as `1.0`.
+ *
+ * The output is either kept in memory, like with \ref JsonWriter, or passed in
+ * chunks to a sink as it is written. `GltfWriter::writeGltfToSink` and
+ * `TilesetWriter::writeTilesetToSink` use the sink form.
+ */
+class BufferedJsonWriter final : public JsonWriter {
+public:
+  /**
+   * @brief A function that receives a chunk of the written JSON.
+   *
+   * The bytes are only valid for the duration of the call.
+   */
+  using Sink = std::function<void(std::span<const std::byte> chunk)>;
+
+  /**
+   * @brief Constructs a writer that keeps all of its output in memory, to be
+   * obtained with \ref toString, \ref toStringView, or \ref toBytes.
+   */
+  BufferedJsonWriter();
+
+  /**
+   * @brief Constructs a writer that passes its output to a sink in chunks of
+   * about the given size.
+   *
+   * Call \ref flush after writing the last value to pass the remaining output
+   * to the sink.
+   *
+   * @param sink The function that receives the chunks, in order.
+   * @param chunkSize The number of bytes after which the buffered output is
+   * passed to the sink.
+   */
+  explicit BufferedJsonWriter(Sink sink, size_t chunkSize = 65536);
+
+  bool Null() override;
+  bool Bool(bool b) override;
+  bool Int(int i) override;
+  bool Uint(unsigned int i) override;
+  bool Uint64(std::uint64_t i) override;
+  bool Int64(std::int64_t i) override;
+  bool Double(double d) override;
+  bool RawNumber(const char* str, unsigned int length, bool copy) override;
+  bool Key(std::string_view string) override;
+  bool String(std::string_view string) override;
+  bool StartObject() override;
+  bool EndObject() override;
+  bool StartArray() override;
+  bool EndArray() override;
+
+  void Primitive(std::int32_t value) override;
+  void Primitive(std::uint32_t value) override;
+  void Primitive(std::int64_t value) override;
+  void Primitive(std::uint64_t value) override;
+  void Primitive(float value) override;
+  void Primitive(double value) override;
+  void Primitive(std::nullptr_t value) override;
+  void Primitive(std::string_view string) override;
+
+  void KeyPrimitive(std::string_view keyName, std::int32_t value) override;
+  void KeyPrimitive(std::string_view keyName, std::uint32_t value) override;
+  void KeyPrimitive(std::string_view keyName, std::int64_t value) override;
+  void KeyPrimitive(std::string_view keyName, std::uint64_t value) override;
+  void KeyPrimitive(std::string_view keyName, std::string_view value) override;
+  void KeyPrimitive(std::string_view keyName, float value) override;
+  void KeyPrimitive(std::string_view keyName, double value) override;
+  void KeyPrimitive(std::string_view keyName, std::nullptr_t value) override;
+
+  void KeyArray(
+      std::string_view keyName,
+      const std::function<void(void)>& insideArray) override;
+  void KeyObject(
+      std::string_view keyName,
+      const std::function<void(void)>& insideObject) override;
+
+  /**
+   * @brief Obtains the output that has not been passed to the sink yet as a
+   * string. Without a sink, this is all of the output.
+   */
+  std::string toString() override;
+  /**
+   * @brief Obtains the output that has not been passed to the sink yet as a
+   * string_view. Without a sink, this is all of the output.
+   */
+  std::string_view toStringView() override;
+  /**
+   * @brief Obtains the output that has not been passed to the sink yet as a
+   * buffer of bytes. Without a sink, this is all of the output.
+   */
+  std::vector<std::byte> toBytes() override;
+
+  /**
+   * @brief Passes the buffered output to the sink, if there is one.
+   */
+  void flush();
+
+private:
+  void beginValue();
+  void endValue();
+  template <typename T> bool writeNumber(T value);
+  void writeString(std::string_view string);
+
+  std::string _buffer;
+  Sink _sink;
+  size_t _chunkSize;
+  bool _needsComma;
+  bool _afterKey;
+};
+} // namespace CesiumJsonWriter
@@ -287,6 +287,22 @@ public:
    */
   const std::vector<std::string>& getWarnings() const { return _warnings; }
 
+protected:
+  /**
+   * @brief Selects the constructor for subclasses that write all of their
+   * output themselves.
+   */
+  struct OwnOutput {};
+
+  /**
+   * @brief Constructs a writer for a subclass that writes all of its output
+   * itself.
+   *
+   * This does not create the `rapidjson::Writer` used by this class, so the
+   * subclass must override every function that writes or returns output.
+   */
+  explicit JsonWriter(OwnOutput) noexcept;
+
 private:
   rapidjson::StringBuffer _compactBuffer;
   std::unique_ptr<rapidjson::Writer<rapidjson::StringBuffer>> _compact;
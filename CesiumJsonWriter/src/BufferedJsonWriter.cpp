@@ -0,0 +1,324 @@
+#include <CesiumJsonWriter/BufferedJsonWriter.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CesiumJsonWriter {
+
+namespace {
+// The escape sequence for each character that must be escaped in a JSON
+// string, matching the escapes written by rapidjson, or 0 for characters that
+// are written as they are. 'u' means the character is written as \u00XX.
+constexpr char getEscape(unsigned char c) noexcept {
+  switch (c) {
+  case '"':
+    return '"';
+  case '\\':
+    return '\\';
+  case '\b':
+    return 'b';
+  case '\f':
+    return 'f';
+  case '\n':
+    return 'n';
+  case '\r':
+    return 'r';
+  case '\t':
+    return 't';
+  default:
+    return c < 0x20 ? 'u' : 0;
+  }
+}
+} // namespace
+
+BufferedJsonWriter::BufferedJsonWriter()
+    : BufferedJsonWriter(Sink(), 0) {}
+
+BufferedJsonWriter::BufferedJsonWriter(Sink sink, size_t chunkSize)
+    : JsonWriter(OwnOutput()),
+      _buffer(),
+      _sink(std::move(sink)),
+      _chunkSize(chunkSize),
+      _needsComma(false),
+      _afterKey(false) {
+  if (this->_sink) {
+    this->_buffer.reserve(this->_chunkSize + 64);
+  }
+}
+
+void BufferedJsonWriter::beginValue() {
+  if (this->_afterKey) {
+    this->_afterKey = false;
+  } else if (this->_needsComma) {
+    this->_buffer.push_back(',');
+  }
+}
+
+void BufferedJsonWriter::endValue() {
+  this->_needsComma = true;
+  if (this->_sink && this->_buffer.size() >= this->_chunkSize) {
+    this->flush();
+  }
+}
+
+template <typename T> bool BufferedJsonWriter::writeNumber(T value) {
+  this->beginValue();
+  char digits[32];
+  std::to_chars_result result =
+      std::to_chars(digits, digits + sizeof(digits), value);
+  this->_buffer.append(digits, result.ptr);
+  this->endValue();
+  return true;
+}
+
+void BufferedJsonWriter::writeString(std::string_view string) {
+  constexpr char hexDigits[] = "0123456789ABCDEF";
+
+  this->_buffer.push_back('"');
+  auto runStart = string.begin();
+  for (auto it = string.begin(); it != string.end(); ++it) {
+    const unsigned char c = static_cast<unsigned char>(*it);
+    const char escape = getEscape(c);
+    if (escape == 0) {
+      continue;
+    }
+
+    this->_buffer.append(runStart, it);
+    runStart = it + 1;
+
+    this->_buffer.push_back('\\');
+    this->_buffer.push_back(escape);
+    if (escape == 'u') {
+      this->_buffer.append("00");
+      this->_buffer.push_back(hexDigits[c >> 4]);
+      this->_buffer.push_back(hexDigits[c & 0xF]);
+    }
+  }
+  this->_buffer.append(runStart, string.end());
+  this->_buffer.push_back('"');
+}
+
+bool BufferedJsonWriter::Null() {
+  this->beginValue();
+  this->_buffer.append("null");
+  this->endValue();
+  return true;
+}
+
+bool BufferedJsonWriter::Bool(bool b) {
+  this->beginValue();
+  this->_buffer.append(b ? "true" : "false");
+  this->endValue();
+  return true;
+}
+
+bool BufferedJsonWriter::Int(int i) { return this->writeNumber(i); }
+
+bool BufferedJsonWriter::Uint(unsigned int i) { return this->writeNumber(i); }
+
+bool BufferedJsonWriter::Uint64(std::uint64_t i) {
+  return this->writeNumber(i);
+}
+
+bool BufferedJsonWriter::Int64(std::int64_t i) {
+  return this->writeNumber(i);
+}
+
+bool BufferedJsonWriter::Double(double d) {
+  // Like rapidjson, NaN and infinity cannot be written.
+  if (!std::isfinite(d)) {
+    return false;
+  }
+
+  this->beginValue();
+  char digits[32];
+  std::to_chars_result result =
+      std::to_chars(digits, digits + sizeof(digits), d);
+  this->_buffer.append(digits, result.ptr);
+
+  // Keep integer values recognizable as floating-point numbers.
+  const bool isInteger = std::none_of(digits, result.ptr, [](char c) {
+    return c == '.' || c == 'e';
+  });
+  if (isInteger) {
+    this->_buffer.append(".0");
+  }
+
+  this->endValue();
+  return true;
+}
+
+bool BufferedJsonWriter::RawNumber(
+    const char* str,
+    unsigned int length,
+    bool /*copy*/) {
+  this->beginValue();
+  this->_buffer.append(str, length);
+  this->endValue();
+  return true;
+}
+
+bool BufferedJsonWriter::String(std::string_view string) {
+  this->beginValue();
+  this->writeString(string);
+  this->endValue();
+  return true;
+}
+
+bool BufferedJsonWriter::Key(std::string_view key) {
+  this->beginValue();
+  this->writeString(key);
+  this->_buffer.push_back(':');
+  this->_afterKey = true;
+  return true;
+}
+
+bool BufferedJsonWriter::StartObject() {
+  this->beginValue();
+  this->_buffer.push_back('{');
+  this->_needsComma = false;
+  return true;
+}
+
+bool BufferedJsonWriter::EndObject() {
+  this->_buffer.push_back('}');
+  this->endValue();
+  return true;
+}
+
+bool BufferedJsonWriter::StartArray() {
+  this->beginValue();
+  this->_buffer.push_back('[');
+  this->_needsComma = false;
+  return true;
+}
+
+bool BufferedJsonWriter::EndArray() {
+  this->_buffer.push_back(']');
+  this->endValue();
+  return true;
+}
+
+void BufferedJsonWriter::Primitive(std::int32_t value) { Int(value); }
+
+void BufferedJsonWriter::Primitive(std::uint32_t value) { Uint(value); }
+
+void BufferedJsonWriter::Primitive(std::int64_t value) { Int64(value); }
+
+void BufferedJsonWriter::Primitive(std::uint64_t value) { Uint64(value); }
+
+void BufferedJsonWriter::Primitive(float value) {
+  Double(static_cast<double>(value));
+}
+
+void BufferedJsonWriter::Primitive(double value) { Double(value); }
+
+void BufferedJsonWriter::Primitive(std::nullptr_t) { Null(); }
+
+void BufferedJsonWriter::Primitive(std::string_view string) {
+  String(string);
+}
+
+// Integral
+void BufferedJsonWriter::KeyPrimitive(
+    std::string_view keyName,
+    std::int32_t value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+void BufferedJsonWriter::KeyPrimitive(
+    std::string_view keyName,
+    std::uint32_t value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+void BufferedJsonWriter::KeyPrimitive(
+    std::string_view keyName,
+    std::int64_t value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+void BufferedJsonWriter::KeyPrimitive(
+    std::string_view keyName,
+    std::uint64_t value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+void BufferedJsonWriter::KeyPrimitive(
+    std::string_view keyName,
+    std::string_view value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+// Floating Point
+void BufferedJsonWriter::KeyPrimitive(std::string_view keyName, float value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+void BufferedJsonWriter::KeyPrimitive(std::string_view keyName, double value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+// Null
+void BufferedJsonWriter::KeyPrimitive(
+    std::string_view keyName,
+    std::nullptr_t value) {
+  Key(keyName);
+  Primitive(value);
+}
+
+// Array / Objects
+void BufferedJsonWriter::KeyArray(
+    std::string_view keyName,
+    const std::function<void(void)>& insideArray) {
+  Key(keyName);
+  StartArray();
+  insideArray();
+  EndArray();
+}
+
+void BufferedJsonWriter::KeyObject(
+    std::string_view keyName,
+    const std::function<void(void)>& insideObject) {
+  Key(keyName);
+  StartObject();
+  insideObject();
+  EndObject();
+}
+
+std::string BufferedJsonWriter::toString() { return this->_buffer; }
+
+std::string_view BufferedJsonWriter::toStringView() { return this->_buffer; }
+
+std::vector<std::byte> BufferedJsonWriter::toBytes() {
+  const std::span<const std::byte> bytes =
+      std::as_bytes(std::span(this->_buffer));
+  return std::vector<std::byte>(bytes.begin(), bytes.end());
+}
+
+void BufferedJsonWriter::flush() {
+  if (!this->_sink || this->_buffer.empty()) {
+    return;
+  }
+
+  this->_sink(std::as_bytes(std::span(this->_buffer)));
+  this->_buffer.clear();
+}
+
+} // namespace CesiumJsonWriter
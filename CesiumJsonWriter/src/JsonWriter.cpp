@@ -17,6 +17,8 @@ JsonWriter::JsonWriter()
     : _compact(std::make_unique<rapidjson::Writer<rapidjson::StringBuffer>>(
           _compactBuffer)) {}
 
+JsonWriter::JsonWriter(OwnOutput) noexcept : _compact() {}
+
 bool JsonWriter::Null() { return _compact->Null(); }
 
 bool JsonWriter::Bool(bool b) { return _compact->Bool(b); }
@@ -0,0 +1,93 @@
+#include <CesiumJsonWriter/BufferedJsonWriter.h>
+#include <CesiumJsonWriter/JsonObjectWriter.h>
+#include <CesiumJsonWriter/JsonWriter.h>
+#include <CesiumUtility/JsonValue.h>
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+
+using namespace CesiumUtility;
+
+using Object = JsonValue::Object;
+using Array = JsonValue::Array;
+
+TEST_CASE("BufferedJsonWriter") {
+  SUBCASE("writes the same JSON as JsonWriter") {
+    const JsonValue value = Object{
+        {"array",
+         Array{
+             std::int64_t(-1),
+             std::uint64_t(std::numeric_limits<std::uint64_t>::max()),
+             2.5,
+             JsonValue::Null(),
+             true,
+             Object{},
+             Array{}}},
+        {"escaped \"key\"", "line\nbreak\ttab\\ \x01 /"},
+        {"nested", Object{{"unicode", "👀"}, {"empty", ""}}}};
+
+    CesiumJsonWriter::JsonWriter expected;
+    writeJsonValue(value, expected);
+
+    CesiumJsonWriter::BufferedJsonWriter writer;
+    writeJsonValue(value, writer);
+
+    CHECK(writer.toStringView() == expected.toStringView());
+    CHECK(writer.toString() == expected.toString());
+    CHECK(writer.toBytes() == expected.toBytes());
+  }
+
+  SUBCASE("writes doubles with integer values with a fractional part") {
+    CesiumJsonWriter::BufferedJsonWriter writer;
+    writer.StartArray();
+    writer.Primitive(1.0);
+    writer.Primitive(-0.0);
+    writer.Primitive(0.1);
+    writer.Primitive(1e300);
+    writer.Primitive(0.5f);
+    writer.EndArray();
+    CHECK(writer.toStringView() == "[1.0,-0.0,0.1,1e+300,0.5]");
+  }
+
+  SUBCASE("does not write NaN or infinity") {
+    CesiumJsonWriter::BufferedJsonWriter writer;
+    CHECK_FALSE(writer.Double(std::nan("")));
+    CHECK_FALSE(writer.Double(std::numeric_limits<double>::infinity()));
+    CHECK(writer.toStringView().empty());
+  }
+
+  SUBCASE("passes the output to a sink in chunks") {
+    std::string output;
+    size_t chunkCount = 0;
+    CesiumJsonWriter::BufferedJsonWriter writer(
+        [&output, &chunkCount](std::span<const std::byte> chunk) {
+          output.append(
+              reinterpret_cast<const char*>(chunk.data()),
+              chunk.size());
+          ++chunkCount;
+        },
+        16);
+
+    CesiumJsonWriter::JsonWriter expected;
+    for (CesiumJsonWriter::JsonWriter* pWriter :
+         {static_cast<CesiumJsonWriter::JsonWriter*>(&writer), &expected}) {
+      pWriter->StartArray();
+      for (int32_t i = 0; i < 100; ++i) {
+        pWriter->Primitive(i);
+      }
+      pWriter->EndArray();
+    }
+
+    CHECK(writer.toStringView().size() < 16);
+    writer.flush();
+    CHECK(writer.toStringView().empty());
+    CHECK(chunkCount > 10);
+    CHECK(output == expected.toString());
+  }
+}
@@ -107,6 +107,41 @@ public:
       bool enableWaterMask,
       const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
 
+  /**
+   * @brief Create a {@link QuantizedMeshLoadResult} from the given data,
+   * optionally without skirts.
+   *
+   * Skirts hide cracks between adjacent tiles by extending the edges of each
+   * tile downward, which adds a vertex for every edge vertex and two triangles
+   * for every edge segment. Without skirts, the indices of the vertices on
+   * each edge of the tile are instead stored in the `CESIUM_tile_edges`
+   * extension of the primitive, so that a renderer can stitch or clamp the
+   * edges itself. The western edge is sorted from south to north, the southern
+   * edge from east to west, the eastern edge from north to south, and the
+   * northern edge from west to east.
+   * The primitive still has {@link CesiumGltfContent::SkirtMeshMetadata},
+   * with the skirt heights that would have been used.
+   *
+   * @param tileID The tile ID.
+   * @param tileBoundingVolume The tile bounding volume.
+   * @param url The URL from which the data was loaded.
+   * @param data The actual tile data.
+   * @param enableWaterMask If true, will attempt to load a water mask from the
+   * quantized mesh data.
+   * @param generateSkirts If true, skirts are added to the edges of the tile.
+   * If false, the edges are described by the `CESIUM_tile_edges` extension.
+   * @param ellipsoid The ellipsoid to use for this quantized mesh.
+   * @return The {@link QuantizedMeshLoadResult}
+   */
+  static QuantizedMeshLoadResult load(
+      const CesiumGeometry::QuadtreeTileID& tileID,
+      const CesiumGeospatial::BoundingRegion& tileBoundingVolume,
+      const std::string& url,
+      const std::span<const std::byte>& data,
+      bool enableWaterMask,
+      bool generateSkirts,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+
   /**
    * @brief Parses the metadata (tile availability) from the given
    * quantized-mesh terrain tile data.
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <CesiumAsync/Future.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumQuantizedMeshTerrain/AvailabilityRectangle.h>
+#include <CesiumQuantizedMeshTerrain/Library.h>
+
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_float3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+// forward declarations
+namespace CesiumAsync {
+class AsyncSystem;
+}
+
+namespace CesiumGltf {
+struct Model;
+}
+
+namespace CesiumQuantizedMeshTerrain {
+
+/**
+ * @brief The result of writing a quantized-mesh tile with
+ * {@link QuantizedMeshWriter::write}.
+ */
+struct CESIUMQUANTIZEDMESHTERRAIN_API QuantizedMeshWriterResult {
+  /**
+   * @brief The final generated std::vector<std::byte> of the tile.
+   */
+  std::vector<std::byte> bytes;
+
+  /**
+   * @brief Errors, if any, that occurred during the write process.
+   */
+  std::vector<std::string> errors;
+
+  /**
+   * @brief Warnings, if any, that occurred during the write process.
+   */
+  std::vector<std::string> warnings;
+};
+
+/**
+ * @brief Options for how to write a quantized-mesh tile.
+ */
+struct CESIUMQUANTIZEDMESHTERRAIN_API QuantizedMeshWriterOptions {
+  /**
+   * @brief If the oct-encoded vertex normals extension should be written.
+   *
+   * If the tile has no normals, they are computed from its triangles.
+   */
+  bool writeNormals = true;
+
+  /**
+   * @brief The ellipsoid on which the tile's positions are defined.
+   */
+  CesiumGeospatial::Ellipsoid ellipsoid = CesiumGeospatial::Ellipsoid::WGS84;
+};
+
+/**
+ * @brief A terrain mesh to be written as a quantized-mesh tile.
+ */
+struct CESIUMQUANTIZEDMESHTERRAIN_API QuantizedMeshWriterTile {
+  /**
+   * @brief The rectangle covered by the tile.
+   *
+   * Positions outside of it are clamped to its edges.
+   */
+  CesiumGeospatial::GlobeRectangle rectangle =
+      CesiumGeospatial::GlobeRectangle::EMPTY;
+
+  /**
+   * @brief The position of each vertex, as longitude and latitude in radians
+   * and height above the ellipsoid in meters.
+   */
+  std::vector<glm::dvec3> positions;
+
+  /**
+   * @brief The vertex indices of each triangle, in counter-clockwise order.
+   */
+  std::vector<uint32_t> indices;
+
+  /**
+   * @brief The normal of each vertex, in the ellipsoid's Earth-centered,
+   * Earth-fixed frame, or empty to compute the normals from the triangles.
+   */
+  std::vector<glm::vec3> normals;
+
+  /**
+   * @brief The availability of the tile's descendants, written to the
+   * metadata extension.
+   *
+   * The first element lists the rectangles of available tiles one level below
+   * this tile, the second element two levels below, and so on, like
+   * {@link Layer::available}. If this is empty, the metadata extension is not
+   * written.
+   */
+  std::vector<std::vector<AvailabilityRectangle>> available;
+
+  /**
+   * @brief Creates a tile from a regular grid of heights covering the given
+   * rectangle.
+   *
+   * The grid is split into two triangles per cell.
+   *
+   * @param rectangle The rectangle covered by the grid.
+   * @param width The number of heights in each row, at least 2.
+   * @param height The number of rows, at least 2.
+   * @param heights The heights in meters, row by row from south to north, and
+   * from west to east within each row. There must be `width * height` of them.
+   * @return The tile, or a tile without vertices if the grid is too small or
+   * does not have the expected number of heights.
+   */
+  static QuantizedMeshWriterTile fromHeightGrid(
+      const CesiumGeospatial::GlobeRectangle& rectangle,
+      uint32_t width,
+      uint32_t height,
+      std::span<const float> heights);
+
+  /**
+   * @brief Creates a tile from the triangles of every primitive in the default
+   * scene of a glTF model.
+   *
+   * The positions of the vertices are transformed to the Earth-centered,
+   * Earth-fixed frame by the node transforms, the `RTC_CENTER`, the up axis,
+   * and the given transform, and then converted to longitude, latitude, and
+   * height. Primitives that are not triangle lists are ignored. Normals are
+   * kept only if every primitive has them.
+   *
+   * @param model The model.
+   * @param modelToEcefTransform The transform from the model's coordinates to
+   * the Earth-centered, Earth-fixed frame.
+   * @param rectangle The rectangle covered by the tile.
+   * @param ellipsoid The ellipsoid on which to compute the longitude, latitude,
+   * and height of each vertex.
+   * @return The tile.
+   */
+  static QuantizedMeshWriterTile fromModel(
+      const CesiumGltf::Model& model,
+      const glm::dmat4& modelToEcefTransform,
+      const CesiumGeospatial::GlobeRectangle& rectangle,
+      const CesiumGeospatial::Ellipsoid& ellipsoid CESIUM_DEFAULT_ELLIPSOID);
+};
+
+/**
+ * @brief Writes `quantized-mesh-1.0` terrain tiles.
+ *
+ * Vertices are reordered by their first use in the triangles so that the
+ * indices can be written with high-water mark encoding, which also places
+ * vertices used together close to each other.
+ */
+class CESIUMQUANTIZEDMESHTERRAIN_API QuantizedMeshWriter final {
+public:
+  /**
+   * @brief Encodes the provided tile as a quantized-mesh tile.
+   *
+   * @param tile The tile.
+   * @param options Options for how to write the tile.
+   * @return The result of writing the tile.
+   */
+  static QuantizedMeshWriterResult write(
+      const QuantizedMeshWriterTile& tile,
+      const QuantizedMeshWriterOptions& options = QuantizedMeshWriterOptions());
+
+  /**
+   * @brief Encodes many tiles in parallel, each in a worker thread.
+   *
+   * @param asyncSystem The async system whose worker threads encode the tiles.
+   * @param tiles The tiles.
+   * @param options Options for how to write the tiles.
+   * @return A future that resolves to the result of writing each tile, in the
+   * same order as the tiles.
+   */
+  static CesiumAsync::Future<std::vector<QuantizedMeshWriterResult>> write(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      std::vector<QuantizedMeshWriterTile>&& tiles,
+      const QuantizedMeshWriterOptions& options = QuantizedMeshWriterOptions());
+};
+
+} // namespace CesiumQuantizedMeshTerrain
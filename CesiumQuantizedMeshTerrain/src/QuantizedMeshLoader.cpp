@@ -18,6 +18,7 @@
 #include <CesiumGltf/Scene.h>
 #include <CesiumGltf/Texture.h>
 #include <CesiumGltfContent/SkirtMeshMetadata.h>
+#include <CesiumGltfContent/TileEdges.h>
 #include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
 #include <CesiumUtility/AttributeCompression.h>
 #include <CesiumUtility/JsonHelpers.h>
@@ -151,13 +152,37 @@ void decodeIndices(
     throw std::runtime_error("decoded buffer is too small.");
   }
 
+  // Whether a code is zero is unpredictable, so the high-water mark is
+  // advanced without a branch.
   E highest = 0;
   for (size_t i = 0; i < encoded.size(); ++i) {
-    E code = encoded[i];
-    E decodedIdx = static_cast<E>(highest - code);
-    decoded[i] = static_cast<D>(decodedIdx);
-    if (code == 0) {
-      ++highest;
+    const E code = encoded[i];
+    decoded[i] = static_cast<D>(static_cast<E>(highest - code));
+    highest = static_cast<E>(highest + static_cast<E>(code == 0));
+  }
+}
+
+// Decodes one zig-zag and delta encoded vertex attribute to the ratio of each
+// value within [0, 32767], and stores it in the given component of `ratios`.
+// Zig-zag decoding is independent for each value, so it is done a block at a
+// time in a loop the compiler can vectorize, which leaves only the running sum
+// as a sequential loop.
+void decodeZigZagDeltas(
+    const std::span<const uint16_t>& encoded,
+    std::vector<glm::dvec3>& ratios,
+    glm::length_t component) {
+  constexpr size_t blockSize = 256;
+  int32_t deltas[blockSize];
+
+  int32_t value = 0;
+  for (size_t start = 0; start < encoded.size(); start += blockSize) {
+    const size_t count = std::min(blockSize, encoded.size() - start);
+    for (size_t i = 0; i < count; ++i) {
+      deltas[i] = zigZagDecode(encoded[start + i]);
+    }
+    for (size_t i = 0; i < count; ++i) {
+      value += deltas[i];
+      ratios[start + i][component] = static_cast<double>(value) / 32767.0;
     }
   }
 }
@@ -630,6 +655,60 @@ void addSkirts(
       positionMaximums);
 }
 
+// Copies the indices of the vertices on one edge of the tile, sorted in the
+// same order in which addSkirts adds the skirt for that edge.
+template <class E, class Compare>
+std::vector<E> getSortedEdgeIndices(
+    const std::span<const std::byte>& edgeIndicesBuffer,
+    Compare compare) {
+  const std::span<const E> edgeIndices(
+      reinterpret_cast<const E*>(edgeIndicesBuffer.data()),
+      edgeIndicesBuffer.size() / sizeof(E));
+  std::vector<E> sorted(edgeIndices.begin(), edgeIndices.end());
+  std::sort(sorted.begin(), sorted.end(), compare);
+  return sorted;
+}
+
+// Stores the indices of the vertices on each edge of the tile in the
+// CESIUM_tile_edges extension of the primitive, in place of skirts.
+template <class E>
+void addTileEdges(
+    CesiumGltf::Model& model,
+    CesiumGltf::MeshPrimitive& primitive,
+    const QuantizedMeshView& meshView,
+    const std::vector<glm::dvec3>& uvsAndHeights) {
+  // West, south, east, and north, the order of the skirts in addSkirts.
+  const std::vector<E> edges[] = {
+      getSortedEdgeIndices<E>(
+          meshView.westEdgeIndicesBuffer,
+          [&uvsAndHeights](E lhs, E rhs) noexcept {
+            return uvsAndHeights[lhs].y < uvsAndHeights[rhs].y;
+          }),
+      getSortedEdgeIndices<E>(
+          meshView.southEdgeIndicesBuffer,
+          [&uvsAndHeights](E lhs, E rhs) noexcept {
+            return uvsAndHeights[lhs].x > uvsAndHeights[rhs].x;
+          }),
+      getSortedEdgeIndices<E>(
+          meshView.eastEdgeIndicesBuffer,
+          [&uvsAndHeights](E lhs, E rhs) noexcept {
+            return uvsAndHeights[lhs].y > uvsAndHeights[rhs].y;
+          }),
+      getSortedEdgeIndices<E>(
+          meshView.northEdgeIndicesBuffer,
+          [&uvsAndHeights](E lhs, E rhs) noexcept {
+            return uvsAndHeights[lhs].x < uvsAndHeights[rhs].x;
+          })};
+
+  CesiumGltfContent::TileEdges::addToPrimitive(
+      model,
+      primitive,
+      edges[0],
+      edges[1],
+      edges[2],
+      edges[3]);
+}
+
 static void decodeNormals(
     const std::span<const std::byte>& encoded,
     const std::span<float>& decoded) {
@@ -637,14 +716,16 @@ static void decodeNormals(
     throw std::runtime_error("decoded buffer is too small.");
   }
 
+  const std::vector<glm::vec3>& decodedNormals =
+      AttributeCompression::getOctDecodeTable();
   size_t normalOutputIndex = 0;
   for (size_t i = 0; i < encoded.size(); i += 2) {
-    glm::dvec3 normal = AttributeCompression::octDecode(
-        static_cast<uint8_t>(encoded[i]),
-        static_cast<uint8_t>(encoded[i + 1]));
-    decoded[normalOutputIndex++] = static_cast<float>(normal.x);
-    decoded[normalOutputIndex++] = static_cast<float>(normal.y);
-    decoded[normalOutputIndex++] = static_cast<float>(normal.z);
+    const size_t x = static_cast<uint8_t>(encoded[i]);
+    const size_t y = static_cast<uint8_t>(encoded[i + 1]);
+    const glm::vec3& normal = decodedNormals[y * 256 + x];
+    decoded[normalOutputIndex++] = normal.x;
+    decoded[normalOutputIndex++] = normal.y;
+    decoded[normalOutputIndex++] = normal.z;
   }
 }
 
@@ -730,6 +811,24 @@ QuantizedMeshMetadataResult processMetadata(
     const std::span<const std::byte>& data,
     bool enableWaterMask,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  return QuantizedMeshLoader::load(
+      tileID,
+      tileBoundingVolume,
+      url,
+      data,
+      enableWaterMask,
+      true,
+      ellipsoid);
+}
+
+/*static*/ QuantizedMeshLoadResult QuantizedMeshLoader::load(
+    const QuadtreeTileID& tileID,
+    const BoundingRegion& tileBoundingVolume,
+    const std::string& url,
+    const std::span<const std::byte>& data,
+    bool enableWaterMask,
+    bool generateSkirts,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
 
   CESIUM_TRACE("Cesium3DTilesSelection::QuantizedMeshLoader::load");
 
@@ -746,10 +845,12 @@ QuantizedMeshMetadataResult processMetadata(
   const QuantizedMeshHeader* pHeader = meshView->header;
   const uint32_t vertexCount = pHeader->vertexCount;
   const uint32_t indicesCount = meshView->triangleCount * 3;
-  const uint32_t skirtVertexCount =
+  const uint32_t edgeVertexCount =
       meshView->westEdgeIndicesCount + meshView->southEdgeIndicesCount +
       meshView->eastEdgeIndicesCount + meshView->northEdgeIndicesCount;
-  const uint32_t skirtIndicesCount = (skirtVertexCount - 4) * 6;
+  const uint32_t skirtVertexCount = generateSkirts ? edgeVertexCount : 0;
+  const uint32_t skirtIndicesCount =
+      generateSkirts ? (edgeVertexCount - 4) * 6 : 0;
 
   // decode position without skirt, but preallocate position buffer to include
   // skirt as well
@@ -781,27 +882,25 @@ QuantizedMeshMetadataResult processMetadata(
   const double east = rectangle.getEast();
   const double north = rectangle.getNorth();
 
-  int32_t u = 0;
-  int32_t v = 0;
-  int32_t height = 0;
-  std::vector<glm::dvec3> uvsAndHeights;
-  uvsAndHeights.reserve(vertexCount);
-  for (size_t i = 0; i < vertexCount; ++i) {
-    u += zigZagDecode(meshView->uBuffer[i]);
-    v += zigZagDecode(meshView->vBuffer[i]);
-    height += zigZagDecode(meshView->heightBuffer[i]);
+  std::vector<glm::dvec3> uvsAndHeights(vertexCount);
+  decodeZigZagDeltas(meshView->uBuffer, uvsAndHeights, 0);
+  decodeZigZagDeltas(meshView->vBuffer, uvsAndHeights, 1);
+  decodeZigZagDeltas(meshView->heightBuffer, uvsAndHeights, 2);
 
-    double uRatio = static_cast<double>(u) / 32767.0;
-    double vRatio = static_cast<double>(v) / 32767.0;
-    double heightRatio = static_cast<double>(height) / 32767.0;
+  std::vector<double> longitudes(vertexCount);
+  std::vector<double> latitudes(vertexCount);
+  std::vector<double> heights(vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const glm::dvec3& ratios = uvsAndHeights[i];
+    longitudes[i] = Math::lerp(west, east, ratios.x);
+    latitudes[i] = Math::lerp(south, north, ratios.y);
+    heights[i] = Math::lerp(minimumHeight, maximumHeight, ratios.z);
+  }
 
-    const double longitude = Math::lerp(west, east, uRatio);
-    const double latitude = Math::lerp(south, north, vRatio);
-    const double heightMeters =
-        Math::lerp(minimumHeight, maximumHeight, heightRatio);
+  std::vector<glm::dvec3> cartesians(vertexCount);
+  ellipsoid.cartographicToCartesian(longitudes, latitudes, heights, cartesians);
 
-    glm::dvec3 position = ellipsoid.cartographicToCartesian(
-        Cartographic(longitude, latitude, heightMeters));
+  for (glm::dvec3 position : cartesians) {
     position -= center;
     outputPositions[positionOutputIndex++] = static_cast<float>(position.x);
     outputPositions[positionOutputIndex++] = static_cast<float>(position.y);
@@ -809,8 +908,6 @@ QuantizedMeshMetadataResult processMetadata(
 
     positionMinimums = glm::min(positionMinimums, position);
     positionMaximums = glm::max(positionMaximums, position);
-
-    uvsAndHeights.emplace_back(uRatio, vRatio, heightRatio);
   }
 
   // decode normal vertices of the tile as well as its metadata without skirt
@@ -870,27 +967,29 @@ QuantizedMeshMetadataResult processMetadata(
     }
 
     // add skirt
-    addSkirts<uint32_t, uint32_t>(
-        ellipsoid,
-        center,
-        rectangle,
-        minimumHeight,
-        maximumHeight,
-        vertexCount,
-        indicesCount,
-        skirtHeight,
-        longitudeOffset,
-        latitudeOffset,
-        uvsAndHeights,
-        meshView->westEdgeIndicesBuffer,
-        meshView->southEdgeIndicesBuffer,
-        meshView->eastEdgeIndicesBuffer,
-        meshView->northEdgeIndicesBuffer,
-        outputPositions,
-        outputNormals,
-        outputIndices,
-        positionMinimums,
-        positionMaximums);
+    if (generateSkirts) {
+      addSkirts<uint32_t, uint32_t>(
+          ellipsoid,
+          center,
+          rectangle,
+          minimumHeight,
+          maximumHeight,
+          vertexCount,
+          indicesCount,
+          skirtHeight,
+          longitudeOffset,
+          latitudeOffset,
+          uvsAndHeights,
+          meshView->westEdgeIndicesBuffer,
+          meshView->southEdgeIndicesBuffer,
+          meshView->eastEdgeIndicesBuffer,
+          meshView->northEdgeIndicesBuffer,
+          outputPositions,
+          outputNormals,
+          outputIndices,
+          positionMinimums,
+          positionMaximums);
+    }
 
     indexSizeBytes = sizeof(uint32_t);
   } else {
@@ -915,27 +1014,29 @@ QuantizedMeshMetadataResult processMetadata(
             outputNormalsBuffer.size() / sizeof(float));
       }
 
-      addSkirts<uint16_t, uint16_t>(
-          ellipsoid,
-          center,
-          rectangle,
-          minimumHeight,
-          maximumHeight,
-          vertexCount,
-          indicesCount,
-          skirtHeight,
-          longitudeOffset,
-          latitudeOffset,
-          uvsAndHeights,
-          meshView->westEdgeIndicesBuffer,
-          meshView->southEdgeIndicesBuffer,
-          meshView->eastEdgeIndicesBuffer,
-          meshView->northEdgeIndicesBuffer,
-          outputPositions,
-          outputNormals,
-          outputIndices,
-          positionMinimums,
-          positionMaximums);
+      if (generateSkirts) {
+        addSkirts<uint16_t, uint16_t>(
+            ellipsoid,
+            center,
+            rectangle,
+            minimumHeight,
+            maximumHeight,
+            vertexCount,
+            indicesCount,
+            skirtHeight,
+            longitudeOffset,
+            latitudeOffset,
+            uvsAndHeights,
+            meshView->westEdgeIndicesBuffer,
+            meshView->southEdgeIndicesBuffer,
+            meshView->eastEdgeIndicesBuffer,
+            meshView->northEdgeIndicesBuffer,
+            outputPositions,
+            outputNormals,
+            outputIndices,
+            positionMinimums,
+            positionMaximums);
+      }
 
       indexSizeBytes = sizeof(uint16_t);
     } else {
@@ -954,27 +1055,29 @@ QuantizedMeshMetadataResult processMetadata(
             outputNormalsBuffer.size() / sizeof(float));
       }
 
-      addSkirts<uint16_t, uint32_t>(
-          ellipsoid,
-          center,
-          rectangle,
-          minimumHeight,
-          maximumHeight,
-          vertexCount,
-          indicesCount,
-          skirtHeight,
-          longitudeOffset,
-          latitudeOffset,
-          uvsAndHeights,
-          meshView->westEdgeIndicesBuffer,
-          meshView->southEdgeIndicesBuffer,
-          meshView->eastEdgeIndicesBuffer,
-          meshView->northEdgeIndicesBuffer,
-          outputPositions,
-          outputNormals,
-          outputIndices,
-          positionMinimums,
-          positionMaximums);
+      if (generateSkirts) {
+        addSkirts<uint16_t, uint32_t>(
+            ellipsoid,
+            center,
+            rectangle,
+            minimumHeight,
+            maximumHeight,
+            vertexCount,
+            indicesCount,
+            skirtHeight,
+            longitudeOffset,
+            latitudeOffset,
+            uvsAndHeights,
+            meshView->westEdgeIndicesBuffer,
+            meshView->southEdgeIndicesBuffer,
+            meshView->eastEdgeIndicesBuffer,
+            meshView->northEdgeIndicesBuffer,
+            outputPositions,
+            outputNormals,
+            outputIndices,
+            positionMinimums,
+            positionMaximums);
+      }
 
       indexSizeBytes = sizeof(uint32_t);
     }
@@ -1095,7 +1198,15 @@ QuantizedMeshMetadataResult processMetadata(
           ? CesiumGltf::Accessor::ComponentType::UNSIGNED_INT
           : CesiumGltf::Accessor::ComponentType::UNSIGNED_SHORT;
 
-  primitive.indices = int32_t(indicesBufferId);
+  primitive.indices = int32_t(indicesAccessorId);
+
+  if (!generateSkirts) {
+    if (meshView->indexType == QuantizedMeshIndexType::UnsignedInt) {
+      addTileEdges<uint32_t>(model, primitive, *meshView, uvsAndHeights);
+    } else {
+      addTileEdges<uint16_t>(model, primitive, *meshView, uvsAndHeights);
+    }
+  }
 
   // add skirts info to primitive extra in case we need to upsample from it
   SkirtMeshMetadata skirtMeshMetadata;
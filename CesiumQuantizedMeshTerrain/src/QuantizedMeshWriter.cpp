@@ -0,0 +1,633 @@
+#include "LayerJsonWriter.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/Future.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltf/AccessorUtility.h>
+#include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/Mesh.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltf/Node.h>
+#include <CesiumGltfContent/GltfUtilities.h>
+#include <CesiumJsonWriter/ExtensionWriterContext.h>
+#include <CesiumJsonWriter/JsonWriter.h>
+#include <CesiumQuantizedMeshTerrain/AvailabilityRectangle.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshWriter.h>
+#include <CesiumUtility/AttributeCompression.h>
+#include <CesiumUtility/Math.h>
+#include <CesiumUtility/Tracing.h>
+
+#include <glm/common.hpp>
+#include <glm/ext/matrix_double3x3.hpp>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_double4.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_uint2_sized.hpp>
+#include <glm/geometric.hpp>
+#include <glm/matrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumUtility;
+
+namespace CesiumQuantizedMeshTerrain {
+
+namespace {
+
+constexpr uint16_t maximumQuantizedValue = 32767;
+constexpr uint32_t unusedVertex = std::numeric_limits<uint32_t>::max();
+
+// The extension IDs defined by the quantized-mesh-1.0 specification.
+constexpr uint8_t octVertexNormalsExtensionID = 1;
+constexpr uint8_t metadataExtensionID = 4;
+
+uint16_t zigZagEncode(int32_t value) noexcept {
+  return static_cast<uint16_t>(
+      static_cast<uint32_t>((value << 1) ^ (value >> 31)));
+}
+
+uint16_t quantize(double value, double minimum, double range) noexcept {
+  if (!(range > 0.0)) {
+    return 0;
+  }
+  const double ratio = Math::clamp((value - minimum) / range, 0.0, 1.0);
+  return static_cast<uint16_t>(std::round(ratio * maximumQuantizedValue));
+}
+
+template <typename T> void append(std::vector<std::byte>& bytes, T value) {
+  const size_t offset = bytes.size();
+  bytes.resize(offset + sizeof(T));
+  std::memcpy(bytes.data() + offset, &value, sizeof(T));
+}
+
+template <typename T>
+void append(std::vector<std::byte>& bytes, std::span<const T> values) {
+  const size_t offset = bytes.size();
+  bytes.resize(offset + values.size_bytes());
+  if (!values.empty()) {
+    std::memcpy(bytes.data() + offset, values.data(), values.size_bytes());
+  }
+}
+
+// Encodes the values of one vertex attribute as zig-zag encoded deltas.
+void appendZigZagDeltas(
+    std::vector<std::byte>& bytes,
+    const std::vector<uint16_t>& values) {
+  std::vector<uint16_t> encoded(values.size());
+  int32_t previous = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    const int32_t value = values[i];
+    encoded[i] = zigZagEncode(value - previous);
+    previous = value;
+  }
+  append<uint16_t>(bytes, encoded);
+}
+
+// Encodes indices whose vertices are in the order of their first use. Each
+// index is written as the difference from the highest index so far plus one,
+// which is zero for every vertex used for the first time.
+template <typename E>
+void appendHighWaterMarkIndices(
+    std::vector<std::byte>& bytes,
+    const std::vector<uint32_t>& indices) {
+  std::vector<E> encoded(indices.size());
+  uint32_t highest = 0;
+  for (size_t i = 0; i < indices.size(); ++i) {
+    const uint32_t index = indices[i];
+    encoded[i] = static_cast<E>(highest - index);
+    highest += static_cast<uint32_t>(index == highest);
+  }
+  append<E>(bytes, encoded);
+}
+
+template <typename E>
+void appendEdge(
+    std::vector<std::byte>& bytes,
+    const std::vector<uint32_t>& edge) {
+  append(bytes, static_cast<uint32_t>(edge.size()));
+  std::vector<E> narrowed(edge.size());
+  for (size_t i = 0; i < edge.size(); ++i) {
+    narrowed[i] = static_cast<E>(edge[i]);
+  }
+  append<E>(bytes, narrowed);
+}
+
+// The magnitude of the horizon occlusion point along the given direction that
+// makes the point occluded exactly when the given position is, in the
+// ellipsoid-scaled frame. See
+// https://cesium.com/blog/2013/05/09/computing-the-horizon-occlusion-point/
+double computeOcclusionMagnitude(
+    const glm::dvec3& scaledPosition,
+    const glm::dvec3& scaledDirection) {
+  const double magnitudeSquared =
+      glm::max(1.0, glm::dot(scaledPosition, scaledPosition));
+  const double magnitude = std::sqrt(magnitudeSquared);
+  const glm::dvec3 direction = glm::normalize(scaledPosition);
+
+  const double cosAlpha = glm::dot(direction, scaledDirection);
+  const double sinAlpha = glm::length(glm::cross(direction, scaledDirection));
+  const double cosBeta = 1.0 / magnitude;
+  const double sinBeta = std::sqrt(magnitudeSquared - 1.0) * cosBeta;
+
+  return 1.0 / (cosAlpha * cosBeta - sinAlpha * sinBeta);
+}
+
+glm::dvec3 computeHorizonOcclusionPoint(
+    const Ellipsoid& ellipsoid,
+    const std::vector<glm::dvec3>& cartesians,
+    const glm::dvec3& center) {
+  const glm::dvec3 scaledCenter = center / ellipsoid.getRadii();
+  if (glm::dot(scaledCenter, scaledCenter) == 0.0) {
+    return glm::dvec3(0.0);
+  }
+
+  const glm::dvec3 scaledDirection = glm::normalize(scaledCenter);
+  double maximumMagnitude = 0.0;
+  for (const glm::dvec3& position : cartesians) {
+    const double magnitude = computeOcclusionMagnitude(
+        position / ellipsoid.getRadii(),
+        scaledDirection);
+    if (!(magnitude > 0.0)) {
+      // The tile is never fully below the horizon.
+      return glm::dvec3(0.0);
+    }
+    maximumMagnitude = glm::max(maximumMagnitude, magnitude);
+  }
+
+  return scaledDirection * maximumMagnitude;
+}
+
+// Computes area-weighted vertex normals from the triangles, falling back to
+// the ellipsoid's surface normal for vertices that are only used by
+// degenerate triangles.
+std::vector<glm::dvec3> computeNormals(
+    const Ellipsoid& ellipsoid,
+    const std::vector<glm::dvec3>& cartesians,
+    const std::vector<uint32_t>& indices) {
+  std::vector<glm::dvec3> normals(cartesians.size(), glm::dvec3(0.0));
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const glm::dvec3& p0 = cartesians[indices[i]];
+    const glm::dvec3& p1 = cartesians[indices[i + 1]];
+    const glm::dvec3& p2 = cartesians[indices[i + 2]];
+    const glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+    normals[indices[i]] += normal;
+    normals[indices[i + 1]] += normal;
+    normals[indices[i + 2]] += normal;
+  }
+
+  for (size_t i = 0; i < normals.size(); ++i) {
+    if (glm::dot(normals[i], normals[i]) == 0.0) {
+      normals[i] = ellipsoid.geodeticSurfaceNormal(cartesians[i]);
+    }
+  }
+
+  return normals;
+}
+
+std::string writeMetadata(
+    const std::vector<std::vector<AvailabilityRectangle>>& available) {
+  const CesiumJsonWriter::ExtensionWriterContext context;
+  CesiumJsonWriter::JsonWriter writer;
+  writer.StartObject();
+  writer.Key("available");
+  writer.StartArray();
+  for (const std::vector<AvailabilityRectangle>& level : available) {
+    writer.StartArray();
+    for (const AvailabilityRectangle& rectangle : level) {
+      AvailabilityRectangleJsonWriter::write(rectangle, writer, context);
+    }
+    writer.EndArray();
+  }
+  writer.EndArray();
+  writer.EndObject();
+  return writer.toString();
+}
+
+} // namespace
+
+/*static*/ QuantizedMeshWriterTile QuantizedMeshWriterTile::fromHeightGrid(
+    const GlobeRectangle& rectangle,
+    uint32_t width,
+    uint32_t height,
+    std::span<const float> heights) {
+  QuantizedMeshWriterTile tile;
+  tile.rectangle = rectangle;
+  if (width < 2 || height < 2 || heights.size() != size_t(width) * height) {
+    return tile;
+  }
+
+  const double west = rectangle.getWest();
+  const double south = rectangle.getSouth();
+  const double longitudeStep = rectangle.computeWidth() / double(width - 1);
+  const double latitudeStep = rectangle.computeHeight() / double(height - 1);
+
+  tile.positions.resize(heights.size());
+  for (uint32_t y = 0; y < height; ++y) {
+    const double latitude =
+        y == height - 1 ? rectangle.getNorth() : south + y * latitudeStep;
+    for (uint32_t x = 0; x < width; ++x) {
+      const double longitude =
+          x == width - 1 ? west + rectangle.computeWidth()
+                         : west + x * longitudeStep;
+      const size_t index = size_t(y) * width + x;
+      tile.positions[index] =
+          glm::dvec3(longitude, latitude, double(heights[index]));
+    }
+  }
+
+  tile.indices.reserve(size_t(width - 1) * (height - 1) * 6);
+  for (uint32_t y = 0; y + 1 < height; ++y) {
+    for (uint32_t x = 0; x + 1 < width; ++x) {
+      const uint32_t southWest = y * width + x;
+      const uint32_t southEast = southWest + 1;
+      const uint32_t northWest = southWest + width;
+      const uint32_t northEast = northWest + 1;
+      tile.indices.insert(
+          tile.indices.end(),
+          {southWest, southEast, northWest, southEast, northEast, northWest});
+    }
+  }
+
+  return tile;
+}
+
+/*static*/ QuantizedMeshWriterTile QuantizedMeshWriterTile::fromModel(
+    const Model& model,
+    const glm::dmat4& modelToEcefTransform,
+    const GlobeRectangle& rectangle,
+    const Ellipsoid& ellipsoid) {
+  QuantizedMeshWriterTile tile;
+  tile.rectangle = rectangle;
+
+  glm::dmat4 rootTransform = modelToEcefTransform;
+  rootTransform =
+      CesiumGltfContent::GltfUtilities::applyRtcCenter(model, rootTransform);
+  rootTransform = CesiumGltfContent::GltfUtilities::applyGltfUpAxisTransform(
+      model,
+      rootTransform);
+
+  bool hasNormals = true;
+  model.forEachPrimitiveInScene(
+      -1,
+      [&](const Model& gltf,
+          const Node& /*node*/,
+          const Mesh& /*mesh*/,
+          const MeshPrimitive& primitive,
+          const glm::dmat4& nodeTransform) {
+        if (primitive.mode != MeshPrimitive::Mode::TRIANGLES) {
+          return;
+        }
+
+        auto positionIt = primitive.attributes.find("POSITION");
+        if (positionIt == primitive.attributes.end()) {
+          return;
+        }
+
+        const AccessorView<glm::vec3> positions(gltf, positionIt->second);
+        if (positions.status() != AccessorViewStatus::Valid) {
+          return;
+        }
+
+        const glm::dmat4 fullTransform = rootTransform * nodeTransform;
+        const uint32_t firstVertex = uint32_t(tile.positions.size());
+        for (int64_t i = 0; i < positions.size(); ++i) {
+          const glm::dvec3 cartesian(
+              fullTransform * glm::dvec4(glm::dvec3(positions[i]), 1.0));
+          const std::optional<Cartographic> cartographic =
+              ellipsoid.cartesianToCartographic(cartesian);
+          tile.positions.emplace_back(
+              cartographic ? glm::dvec3(
+                                 cartographic->longitude,
+                                 cartographic->latitude,
+                                 cartographic->height)
+                           : glm::dvec3(0.0));
+        }
+
+        auto normalIt = primitive.attributes.find("NORMAL");
+        std::optional<AccessorView<glm::vec3>> normals;
+        if (normalIt != primitive.attributes.end()) {
+          normals.emplace(gltf, normalIt->second);
+        }
+        if (hasNormals && normals &&
+            normals->status() == AccessorViewStatus::Valid &&
+            normals->size() == positions.size()) {
+          const glm::dmat3 normalTransform =
+              glm::transpose(glm::inverse(glm::dmat3(fullTransform)));
+          for (int64_t i = 0; i < normals->size(); ++i) {
+            tile.normals.emplace_back(glm::vec3(glm::normalize(
+                normalTransform * glm::dvec3((*normals)[i]))));
+          }
+        } else {
+          hasNormals = false;
+          tile.normals.clear();
+        }
+
+        std::visit(
+            [&tile, firstVertex, &positions](auto&& indices) {
+              if constexpr (std::is_same_v<
+                                std::decay_t<decltype(indices)>,
+                                std::monostate>) {
+                for (int64_t i = 0; i + 2 < positions.size(); i += 3) {
+                  tile.indices.insert(
+                      tile.indices.end(),
+                      {firstVertex + uint32_t(i),
+                       firstVertex + uint32_t(i + 1),
+                       firstVertex + uint32_t(i + 2)});
+                }
+              } else {
+                if (indices.status() != AccessorViewStatus::Valid) {
+                  return;
+                }
+                for (int64_t i = 0; i + 2 < indices.size(); i += 3) {
+                  tile.indices.insert(
+                      tile.indices.end(),
+                      {firstVertex + uint32_t(indices[i]),
+                       firstVertex + uint32_t(indices[i + 1]),
+                       firstVertex + uint32_t(indices[i + 2])});
+                }
+              }
+            },
+            getIndexAccessorView(gltf, primitive));
+      });
+
+  return tile;
+}
+
+/*static*/ QuantizedMeshWriterResult QuantizedMeshWriter::write(
+    const QuantizedMeshWriterTile& tile,
+    const QuantizedMeshWriterOptions& options) {
+  CESIUM_TRACE("QuantizedMeshWriter::write");
+
+  QuantizedMeshWriterResult result;
+
+  const size_t vertexCount = tile.positions.size();
+  if (vertexCount == 0 || tile.indices.empty()) {
+    result.errors.emplace_back("The tile does not have any triangles.");
+    return result;
+  }
+
+  if (tile.indices.size() % 3 != 0) {
+    result.errors.emplace_back(
+        "The number of indices is not a multiple of three.");
+    return result;
+  }
+
+  if (vertexCount > std::numeric_limits<uint32_t>::max()) {
+    result.errors.emplace_back("The tile has too many vertices.");
+    return result;
+  }
+
+  if (!tile.normals.empty() && tile.normals.size() != vertexCount) {
+    result.errors.emplace_back(
+        "The number of normals does not match the number of positions.");
+    return result;
+  }
+
+  // Order the vertices by their first use, as required by the high-water mark
+  // encoding of the indices. Vertices that aren't used by any triangle go last.
+  std::vector<uint32_t> newIndices(vertexCount, unusedVertex);
+  std::vector<uint32_t> oldIndices;
+  oldIndices.reserve(vertexCount);
+  std::vector<uint32_t> indices(tile.indices.size());
+  for (size_t i = 0; i < tile.indices.size(); ++i) {
+    const uint32_t oldIndex = tile.indices[i];
+    if (oldIndex >= vertexCount) {
+      result.errors.emplace_back("An index refers to a nonexistent vertex.");
+      return result;
+    }
+    if (newIndices[oldIndex] == unusedVertex) {
+      newIndices[oldIndex] = uint32_t(oldIndices.size());
+      oldIndices.emplace_back(oldIndex);
+    }
+    indices[i] = newIndices[oldIndex];
+  }
+
+  if (oldIndices.size() < vertexCount) {
+    result.warnings.emplace_back(
+        "Some vertices are not used by any triangle.");
+    for (uint32_t i = 0; i < uint32_t(vertexCount); ++i) {
+      if (newIndices[i] == unusedVertex) {
+        newIndices[i] = uint32_t(oldIndices.size());
+        oldIndices.emplace_back(i);
+      }
+    }
+  }
+
+  // Quantize the positions within the tile's rectangle and height range.
+  const GlobeRectangle& rectangle = tile.rectangle;
+  const double west = rectangle.getWest();
+  const double south = rectangle.getSouth();
+  const double longitudeRange = rectangle.computeWidth();
+  const double latitudeRange = rectangle.computeHeight();
+
+  double minimumHeight = std::numeric_limits<double>::max();
+  double maximumHeight = std::numeric_limits<double>::lowest();
+  for (const glm::dvec3& position : tile.positions) {
+    minimumHeight = glm::min(minimumHeight, position.z);
+    maximumHeight = glm::max(maximumHeight, position.z);
+  }
+
+  // The heights are decoded relative to the range written in the header, which
+  // only has single precision.
+  const float minimumHeightFloat = static_cast<float>(minimumHeight);
+  const float maximumHeightFloat = static_cast<float>(maximumHeight);
+  const double heightRange =
+      double(maximumHeightFloat) - double(minimumHeightFloat);
+
+  std::vector<uint16_t> us(vertexCount);
+  std::vector<uint16_t> vs(vertexCount);
+  std::vector<uint16_t> hs(vertexCount);
+  std::vector<double> longitudes(vertexCount);
+  std::vector<double> latitudes(vertexCount);
+  std::vector<double> heights(vertexCount);
+  std::vector<uint32_t> westEdge;
+  std::vector<uint32_t> southEdge;
+  std::vector<uint32_t> eastEdge;
+  std::vector<uint32_t> northEdge;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const glm::dvec3& position = tile.positions[oldIndices[i]];
+
+    // Longitudes west of a rectangle crossing the antimeridian are east of it.
+    double longitude = position.x;
+    if (longitude < west && rectangle.getEast() < west) {
+      longitude += Math::TwoPi;
+    }
+
+    us[i] = quantize(longitude, west, longitudeRange);
+    vs[i] = quantize(position.y, south, latitudeRange);
+    hs[i] = quantize(position.z, double(minimumHeightFloat), heightRange);
+
+    longitudes[i] = position.x;
+    latitudes[i] = position.y;
+    heights[i] = position.z;
+
+    if (us[i] == 0) {
+      westEdge.emplace_back(uint32_t(i));
+    } else if (us[i] == maximumQuantizedValue) {
+      eastEdge.emplace_back(uint32_t(i));
+    }
+    if (vs[i] == 0) {
+      southEdge.emplace_back(uint32_t(i));
+    } else if (vs[i] == maximumQuantizedValue) {
+      northEdge.emplace_back(uint32_t(i));
+    }
+  }
+
+  std::sort(westEdge.begin(), westEdge.end(), [&vs](uint32_t a, uint32_t b) {
+    return vs[a] < vs[b];
+  });
+  std::sort(southEdge.begin(), southEdge.end(), [&us](uint32_t a, uint32_t b) {
+    return us[a] < us[b];
+  });
+  std::sort(eastEdge.begin(), eastEdge.end(), [&vs](uint32_t a, uint32_t b) {
+    return vs[a] < vs[b];
+  });
+  std::sort(northEdge.begin(), northEdge.end(), [&us](uint32_t a, uint32_t b) {
+    return us[a] < us[b];
+  });
+
+  const Ellipsoid& ellipsoid = options.ellipsoid;
+  std::vector<glm::dvec3> cartesians(vertexCount);
+  ellipsoid.cartographicToCartesian(longitudes, latitudes, heights, cartesians);
+
+  // The bounding sphere is centered in the box around the vertices, and is
+  // also used as the center of the tile.
+  glm::dvec3 minimums(std::numeric_limits<double>::max());
+  glm::dvec3 maximums(std::numeric_limits<double>::lowest());
+  for (const glm::dvec3& cartesian : cartesians) {
+    minimums = glm::min(minimums, cartesian);
+    maximums = glm::max(maximums, cartesian);
+  }
+  const glm::dvec3 center = (minimums + maximums) * 0.5;
+  double radiusSquared = 0.0;
+  for (const glm::dvec3& cartesian : cartesians) {
+    const glm::dvec3 offset = cartesian - center;
+    radiusSquared = glm::max(radiusSquared, glm::dot(offset, offset));
+  }
+
+  const glm::dvec3 horizonOcclusionPoint =
+      computeHorizonOcclusionPoint(ellipsoid, cartesians, center);
+
+  const bool use32BitIndices = vertexCount > 65536;
+  const size_t indexSizeBytes =
+      use32BitIndices ? sizeof(uint32_t) : sizeof(uint16_t);
+  const size_t edgeVertexCount =
+      westEdge.size() + southEdge.size() + eastEdge.size() + northEdge.size();
+  const std::string metadata =
+      tile.available.empty() ? std::string() : writeMetadata(tile.available);
+
+  std::vector<std::byte>& bytes = result.bytes;
+  bytes.reserve(
+      92 + vertexCount * 3 * sizeof(uint16_t) + 2 + 5 * sizeof(uint32_t) +
+      (indices.size() + edgeVertexCount) * indexSizeBytes +
+      (options.writeNormals ? 5 + vertexCount * 2 : 0) +
+      (metadata.empty() ? 0 : 9 + metadata.size()));
+
+  // header
+  append(bytes, center.x);
+  append(bytes, center.y);
+  append(bytes, center.z);
+  append(bytes, minimumHeightFloat);
+  append(bytes, maximumHeightFloat);
+  append(bytes, center.x);
+  append(bytes, center.y);
+  append(bytes, center.z);
+  append(bytes, std::sqrt(radiusSquared));
+  append(bytes, horizonOcclusionPoint.x);
+  append(bytes, horizonOcclusionPoint.y);
+  append(bytes, horizonOcclusionPoint.z);
+  append(bytes, uint32_t(vertexCount));
+
+  // vertex data
+  appendZigZagDeltas(bytes, us);
+  appendZigZagDeltas(bytes, vs);
+  appendZigZagDeltas(bytes, hs);
+
+  // indices and edges
+  if (use32BitIndices && bytes.size() % 4 != 0) {
+    // 32-bit indices are aligned to four bytes.
+    bytes.resize(bytes.size() + 2);
+  }
+  append(bytes, uint32_t(indices.size() / 3));
+  if (use32BitIndices) {
+    appendHighWaterMarkIndices<uint32_t>(bytes, indices);
+    appendEdge<uint32_t>(bytes, westEdge);
+    appendEdge<uint32_t>(bytes, southEdge);
+    appendEdge<uint32_t>(bytes, eastEdge);
+    appendEdge<uint32_t>(bytes, northEdge);
+  } else {
+    appendHighWaterMarkIndices<uint16_t>(bytes, indices);
+    appendEdge<uint16_t>(bytes, westEdge);
+    appendEdge<uint16_t>(bytes, southEdge);
+    appendEdge<uint16_t>(bytes, eastEdge);
+    appendEdge<uint16_t>(bytes, northEdge);
+  }
+
+  // extensions
+  if (options.writeNormals) {
+    std::vector<glm::dvec3> computedNormals;
+    if (tile.normals.empty()) {
+      computedNormals = computeNormals(ellipsoid, cartesians, indices);
+    }
+
+    std::vector<glm::u8vec2> encoded(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+      encoded[i] = AttributeCompression::octEncode(
+          tile.normals.empty() ? computedNormals[i]
+                               : glm::dvec3(tile.normals[oldIndices[i]]));
+    }
+
+    append(bytes, octVertexNormalsExtensionID);
+    append(bytes, uint32_t(vertexCount * 2));
+    append<glm::u8vec2>(bytes, encoded);
+  }
+
+  if (!metadata.empty()) {
+    append(bytes, metadataExtensionID);
+    append(bytes, uint32_t(sizeof(uint32_t) + metadata.size()));
+    append(bytes, uint32_t(metadata.size()));
+    append<char>(bytes, metadata);
+  }
+
+  return result;
+}
+
+/*static*/ CesiumAsync::Future<std::vector<QuantizedMeshWriterResult>>
+QuantizedMeshWriter::write(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    std::vector<QuantizedMeshWriterTile>&& tiles,
+    const QuantizedMeshWriterOptions& options) {
+  auto pTiles =
+      std::make_shared<std::vector<QuantizedMeshWriterTile>>(std::move(tiles));
+
+  std::vector<CesiumAsync::Future<QuantizedMeshWriterResult>> futures;
+  futures.reserve(pTiles->size());
+  for (size_t i = 0; i < pTiles->size(); ++i) {
+    futures.emplace_back(asyncSystem.runInWorkerThread([pTiles, i, options]() {
+      return QuantizedMeshWriter::write((*pTiles)[i], options);
+    }));
+  }
+
+  return asyncSystem.all(std::move(futures));
+}
+
+} // namespace CesiumQuantizedMeshTerrain
@@ -0,0 +1,48 @@
+#include "HeightGridTiles.h"
+
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeometry/QuadtreeTilingScheme.h>
+#include <CesiumGeometry/Rectangle.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <glm/trigonometric.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+
+namespace CesiumNativeTests {
+
+GlobeRectangle getTileRectangle(const QuadtreeTileID& tileID) {
+  const QuadtreeTilingScheme tilingScheme(
+      CesiumGeometry::Rectangle(
+          glm::radians(-180.0),
+          glm::radians(-90.0),
+          glm::radians(180.0),
+          glm::radians(90.0)),
+      2,
+      1);
+  const CesiumGeometry::Rectangle rectangle =
+      tilingScheme.tileToRectangle(tileID);
+  return GlobeRectangle(
+      rectangle.minimumX,
+      rectangle.minimumY,
+      rectangle.maximumX,
+      rectangle.maximumY);
+}
+
+std::vector<float> createHeights(uint32_t width, uint32_t height) {
+  std::vector<float> heights(size_t(width) * height);
+  for (uint32_t y = 0; y < height; ++y) {
+    for (uint32_t x = 0; x < width; ++x) {
+      heights[size_t(y) * width + x] = 100.0f + float((x * y) % 7);
+    }
+  }
+  return heights;
+}
+
+
+} // namespace CesiumNativeTests
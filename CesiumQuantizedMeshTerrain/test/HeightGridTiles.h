@@ -0,0 +1,19 @@
+#pragma once
+
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace CesiumNativeTests {
+
+// Gets the rectangle of a tile in the geographic tiling scheme with two root
+// tiles that quantized-mesh terrain uses.
+CesiumGeospatial::GlobeRectangle
+getTileRectangle(const CesiumGeometry::QuadtreeTileID& tileID);
+
+// Creates a row-major grid of heights that vary from sample to sample.
+std::vector<float> createHeights(uint32_t width, uint32_t height);
+
+} // namespace CesiumNativeTests
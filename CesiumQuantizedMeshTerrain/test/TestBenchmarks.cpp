@@ -0,0 +1,135 @@
+#include "HeightGridTiles.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/ITaskProcessor.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/SimpleTaskProcessor.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumNativeTests/readFile.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshWriter.h>
+
+#include <doctest/doctest.h>
+#include <glm/trigonometric.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumQuantizedMeshTerrain;
+
+namespace {
+double timeWritingTiles(
+    const std::shared_ptr<ITaskProcessor>& pTaskProcessor,
+    const std::vector<QuantizedMeshWriterTile>& tiles,
+    int iterations) {
+  AsyncSystem asyncSystem(pTaskProcessor);
+
+  std::chrono::steady_clock::duration total{};
+  for (int i = 0; i < iterations; ++i) {
+    std::vector<QuantizedMeshWriterTile> copy = tiles;
+    auto start = std::chrono::steady_clock::now();
+    std::vector<QuantizedMeshWriterResult> results =
+        QuantizedMeshWriter::write(asyncSystem, std::move(copy)).wait();
+    total += std::chrono::steady_clock::now() - start;
+    REQUIRE(results.size() == tiles.size());
+  }
+
+  return std::chrono::duration<double>(total).count() / double(iterations);
+}
+} // namespace
+
+TEST_CASE("Benchmark loading quantized mesh tiles" * doctest::skip(true)) {
+  constexpr int iterations = 50;
+
+  // Every quantized-mesh tile in the test data, which are real terrain tiles
+  // of different sizes and with different extensions.
+  std::vector<std::vector<std::byte>> tiles;
+  std::filesystem::path testDataPath = Cesium3DTilesSelection_TEST_DATA_DIR;
+  for (const std::filesystem::directory_entry& entry :
+       std::filesystem::recursive_directory_iterator(
+           testDataPath / "CesiumTerrainTileJson")) {
+    if (entry.path().extension() == ".terrain") {
+      tiles.emplace_back(readFile(entry.path()));
+    }
+  }
+  REQUIRE(!tiles.empty());
+
+  const QuadtreeTileID tileID(0, 0, 0);
+  const BoundingRegion boundingVolume(
+      GlobeRectangle(
+          glm::radians(-180.0),
+          glm::radians(-90.0),
+          0.0,
+          glm::radians(90.0)),
+      -1000.0,
+      9000.0,
+      Ellipsoid::WGS84);
+
+  size_t vertexCount = 0;
+  std::chrono::steady_clock::duration total{};
+  for (int i = 0; i < iterations; ++i) {
+    for (const std::vector<std::byte>& tile : tiles) {
+      auto start = std::chrono::steady_clock::now();
+      QuantizedMeshLoadResult result =
+          QuantizedMeshLoader::load(tileID, boundingVolume, "url", tile, true);
+      total += std::chrono::steady_clock::now() - start;
+      REQUIRE(result.model);
+
+      const Accessor& positions = result.model->accessors[size_t(
+          result.model->meshes[0].primitives[0].attributes.at("POSITION"))];
+      vertexCount += size_t(positions.count);
+    }
+  }
+
+  const double seconds = std::chrono::duration<double>(total).count();
+  std::cout << "Loaded " << tiles.size() << " quantized mesh tiles in "
+            << seconds * 1000.0 / double(iterations) << "ms ("
+            << double(vertexCount) / seconds << " vertices/sec)" << std::endl;
+}
+
+TEST_CASE("Benchmark writing quantized mesh tiles" * doctest::skip(true)) {
+  constexpr uint32_t tileCount = 256;
+  constexpr uint32_t gridSize = 65;
+  constexpr int iterations = 5;
+
+  std::vector<QuantizedMeshWriterTile> tiles;
+  tiles.reserve(tileCount);
+  const std::vector<float> heights = createHeights(gridSize, gridSize);
+  for (uint32_t i = 0; i < tileCount; ++i) {
+    tiles.emplace_back(QuantizedMeshWriterTile::fromHeightGrid(
+        getTileRectangle(QuadtreeTileID(12, i % 64, i / 64)),
+        gridSize,
+        gridSize,
+        heights));
+  }
+
+  const double sequentialSeconds = timeWritingTiles(
+      std::make_shared<CesiumNativeTests::SimpleTaskProcessor>(),
+      tiles,
+      iterations);
+  const double parallelSeconds = timeWritingTiles(
+      std::make_shared<CesiumNativeTests::ThreadTaskProcessor>(),
+      tiles,
+      iterations);
+
+  std::cout << "Wrote " << tileCount << " tiles of " << gridSize << "x"
+            << gridSize << " heights at " << tileCount / sequentialSeconds
+            << " tiles/s on one thread and " << tileCount / parallelSeconds
+            << " tiles/s on worker threads" << std::endl;
+}
@@ -5,13 +5,16 @@
 #include <CesiumGeospatial/BoundingRegion.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGltf/Accessor.h>
 #include <CesiumGltf/AccessorView.h>
 #include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/ExtensionCesiumTileEdges.h>
 #include <CesiumGltf/Mesh.h>
 #include <CesiumGltf/MeshPrimitive.h>
 #include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/SkirtMeshMetadata.h>
 #include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
 #include <CesiumUtility/Math.h>
 
@@ -38,6 +41,7 @@ using namespace Cesium3DTilesContent;
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
 using namespace CesiumGltf;
+using namespace CesiumGltfContent;
 using namespace CesiumQuantizedMeshTerrain;
 using namespace CesiumUtility;
 
@@ -1082,6 +1086,109 @@ TEST_CASE("Test converting quantized mesh to gltf with skirt") {
   }
 }
 
+TEST_CASE("Test converting quantized mesh to gltf without skirts") {
+  registerAllTileContentTypes();
+
+  CesiumGeometry::Rectangle rectangle(
+      glm::radians(-180.0),
+      glm::radians(-90.0),
+      glm::radians(180.0),
+      glm::radians(90.0));
+  QuadtreeTilingScheme tilingScheme(rectangle, 2, 1);
+
+  uint32_t verticesWidth = 4;
+  uint32_t verticesHeight = 3;
+  QuadtreeTileID tileID(10, 0, 0);
+  CesiumGeometry::Rectangle tileRectangle =
+      tilingScheme.tileToRectangle(tileID);
+  BoundingRegion boundingVolume = BoundingRegion(
+      GlobeRectangle(
+          tileRectangle.minimumX,
+          tileRectangle.minimumY,
+          tileRectangle.maximumX,
+          tileRectangle.maximumY),
+      0.0,
+      0.0,
+      Ellipsoid::WGS84);
+  QuantizedMesh<uint16_t> quantizedMesh = createGridQuantizedMesh<uint16_t>(
+      boundingVolume,
+      verticesWidth,
+      verticesHeight);
+
+  std::vector<std::byte> quantizedMeshBin =
+      convertQuantizedMeshToBinary(quantizedMesh);
+  std::span<const std::byte> data(
+      quantizedMeshBin.data(),
+      quantizedMeshBin.size());
+  QuantizedMeshLoadResult loadResult = QuantizedMeshLoader::load(
+      tileID,
+      boundingVolume,
+      "url",
+      data,
+      false,
+      false);
+  REQUIRE(!loadResult.errors.hasErrors());
+  REQUIRE(loadResult.model != std::nullopt);
+
+  checkGltfSanity(*loadResult.model);
+
+  const Model& model = *loadResult.model;
+  const MeshPrimitive& primitive = model.meshes.front().primitives.front();
+
+  // Only the grid itself is in the mesh.
+  AccessorView<uint16_t> indices(model, primitive.indices);
+  REQUIRE(indices.status() == AccessorViewStatus::Valid);
+  CHECK(indices.size() == int64_t(quantizedMesh.vertexData.indices.size()));
+
+  AccessorView<glm::vec3> positions(model, primitive.attributes.at("POSITION"));
+  REQUIRE(positions.status() == AccessorViewStatus::Valid);
+  CHECK(positions.size() == int64_t(verticesWidth * verticesHeight));
+
+  // The edges are stored instead, sorted in the order of the skirts.
+  const ExtensionCesiumTileEdges* pTileEdges =
+      primitive.getExtension<ExtensionCesiumTileEdges>();
+  REQUIRE(pTileEdges);
+  CHECK(model.isExtensionUsed(ExtensionCesiumTileEdges::ExtensionName));
+
+  AccessorView<uint16_t> west(model, pTileEdges->left);
+  AccessorView<uint16_t> south(model, pTileEdges->bottom);
+  AccessorView<uint16_t> east(model, pTileEdges->right);
+  AccessorView<uint16_t> north(model, pTileEdges->top);
+  REQUIRE(west.status() == AccessorViewStatus::Valid);
+  REQUIRE(south.status() == AccessorViewStatus::Valid);
+  REQUIRE(east.status() == AccessorViewStatus::Valid);
+  REQUIRE(north.status() == AccessorViewStatus::Valid);
+  CHECK(west.size() == int64_t(verticesHeight));
+  CHECK(south.size() == int64_t(verticesWidth));
+  CHECK(east.size() == int64_t(verticesHeight));
+  CHECK(north.size() == int64_t(verticesWidth));
+
+  // Vertex i of the grid is in column i % width and row i / width.
+  for (int64_t i = 1; i < west.size(); ++i) {
+    CHECK(west[i - 1] / verticesWidth < west[i] / verticesWidth);
+  }
+  for (int64_t i = 1; i < south.size(); ++i) {
+    CHECK(south[i - 1] % verticesWidth > south[i] % verticesWidth);
+  }
+  for (int64_t i = 1; i < east.size(); ++i) {
+    CHECK(east[i - 1] / verticesWidth > east[i] / verticesWidth);
+  }
+  for (int64_t i = 1; i < north.size(); ++i) {
+    CHECK(north[i - 1] % verticesWidth < north[i] % verticesWidth);
+  }
+
+  // The skirt metadata is still there for upsampling.
+  std::optional<SkirtMeshMetadata> skirtMeshMetadata =
+      SkirtMeshMetadata::parseFromGltfExtras(primitive.extras);
+  REQUIRE(skirtMeshMetadata);
+  CHECK(
+      skirtMeshMetadata->noSkirtIndicesCount ==
+      uint32_t(quantizedMesh.vertexData.indices.size()));
+  CHECK(
+      skirtMeshMetadata->noSkirtVerticesCount ==
+      verticesWidth * verticesHeight);
+}
+
 TEST_CASE("Test converting ill-formed quantized mesh") {
   registerAllTileContentTypes();
 
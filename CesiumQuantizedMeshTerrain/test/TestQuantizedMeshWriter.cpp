@@ -0,0 +1,245 @@
+#include "HeightGridTiles.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeometry/QuadtreeTileRectangularRange.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltf/ExtensionCesiumTileEdges.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumQuantizedMeshTerrain/AvailabilityRectangle.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshLoader.h>
+#include <CesiumQuantizedMeshTerrain/QuantizedMeshWriter.h>
+#include <CesiumUtility/Math.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/geometric.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace CesiumAsync;
+using namespace CesiumGeometry;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumQuantizedMeshTerrain;
+using namespace CesiumUtility;
+
+namespace {
+// Checks that a position was decoded to within the quantization error.
+void checkPosition(const glm::dvec3& actual, const glm::dvec3& expected) {
+  CHECK(Math::equalsEpsilon(actual.x, expected.x, 0.0, Math::Epsilon6));
+  CHECK(Math::equalsEpsilon(actual.y, expected.y, 0.0, Math::Epsilon6));
+  CHECK(Math::equalsEpsilon(actual.z, expected.z, 0.0, 0.1));
+}
+
+// Writes the tile, loads it without skirts, and reads its triangles back.
+QuantizedMeshWriterTile roundTrip(
+    const QuadtreeTileID& tileID,
+    const QuantizedMeshWriterTile& tile,
+    QuantizedMeshLoadResult& loadResult) {
+  const QuantizedMeshWriterResult writeResult =
+      QuantizedMeshWriter::write(tile);
+  REQUIRE(writeResult.errors.empty());
+  REQUIRE(!writeResult.bytes.empty());
+
+  loadResult = QuantizedMeshLoader::load(
+      tileID,
+      BoundingRegion(tile.rectangle, 0.0, 0.0, Ellipsoid::WGS84),
+      "url",
+      writeResult.bytes,
+      false,
+      false);
+  REQUIRE(!loadResult.errors.hasErrors());
+  REQUIRE(loadResult.model);
+
+  return QuantizedMeshWriterTile::fromModel(
+      *loadResult.model,
+      glm::dmat4(1.0),
+      tile.rectangle);
+}
+
+void checkGridRoundTrip(uint32_t width, uint32_t height) {
+  const QuadtreeTileID tileID(10, 0, 0);
+  const GlobeRectangle rectangle = getTileRectangle(tileID);
+  const std::vector<float> heights = createHeights(width, height);
+  const QuantizedMeshWriterTile tile = QuantizedMeshWriterTile::fromHeightGrid(
+      rectangle,
+      width,
+      height,
+      heights);
+  REQUIRE(tile.positions.size() == heights.size());
+  REQUIRE(tile.indices.size() == size_t(width - 1) * (height - 1) * 6);
+
+  QuantizedMeshLoadResult loadResult;
+  const QuantizedMeshWriterTile loaded = roundTrip(tileID, tile, loadResult);
+  REQUIRE(loaded.positions.size() == tile.positions.size());
+  CHECK(loaded.indices.size() == tile.indices.size());
+  CHECK(loaded.normals.size() == tile.positions.size());
+
+  // The vertices are reordered, so find each one in the grid.
+  const double longitudeStep = rectangle.computeWidth() / double(width - 1);
+  const double latitudeStep = rectangle.computeHeight() / double(height - 1);
+  std::vector<bool> found(heights.size(), false);
+  for (size_t i = 0; i < loaded.positions.size(); ++i) {
+    const glm::dvec3& position = loaded.positions[i];
+    const auto x = uint32_t(
+        std::round((position.x - rectangle.getWest()) / longitudeStep));
+    const auto y = uint32_t(
+        std::round((position.y - rectangle.getSouth()) / latitudeStep));
+    REQUIRE(x < width);
+    REQUIRE(y < height);
+
+    const size_t index = size_t(y) * width + x;
+    CHECK(!found[index]);
+    found[index] = true;
+    checkPosition(position, tile.positions[index]);
+
+    const glm::dvec3 surfaceNormal = Ellipsoid::WGS84.geodeticSurfaceNormal(
+        Cartographic(position.x, position.y, 0.0));
+    CHECK(glm::dot(glm::dvec3(loaded.normals[i]), surfaceNormal) > 0.99);
+  }
+
+  const ExtensionCesiumTileEdges* pTileEdges =
+      loadResult.model->meshes[0]
+          .primitives[0]
+          .getExtension<ExtensionCesiumTileEdges>();
+  REQUIRE(pTileEdges);
+  const Model& model = *loadResult.model;
+  CHECK(model.accessors[size_t(pTileEdges->left)].count == int64_t(height));
+  CHECK(model.accessors[size_t(pTileEdges->bottom)].count == int64_t(width));
+  CHECK(model.accessors[size_t(pTileEdges->right)].count == int64_t(height));
+  CHECK(model.accessors[size_t(pTileEdges->top)].count == int64_t(width));
+}
+} // namespace
+
+TEST_CASE("QuantizedMeshWriter") {
+  SUBCASE("round trips a height grid with 16-bit indices") {
+    checkGridRoundTrip(33, 17);
+  }
+
+  SUBCASE("round trips a height grid with 32-bit indices") {
+    checkGridRoundTrip(300, 300);
+  }
+
+  SUBCASE("keeps the triangles of a mesh whose vertices are out of order") {
+    const QuadtreeTileID tileID(10, 0, 0);
+    QuantizedMeshWriterTile tile;
+    tile.rectangle = getTileRectangle(tileID);
+    const double west = tile.rectangle.getWest();
+    const double south = tile.rectangle.getSouth();
+    const double east = tile.rectangle.getEast();
+    const double north = tile.rectangle.getNorth();
+    tile.positions = {
+        glm::dvec3(west, south, 10.0),
+        glm::dvec3(east, south, 20.0),
+        glm::dvec3(east, north, 30.0),
+        glm::dvec3(west, north, 40.0)};
+    tile.indices = {3, 1, 2, 3, 0, 1};
+
+    QuantizedMeshLoadResult loadResult;
+    const QuantizedMeshWriterTile loaded = roundTrip(tileID, tile, loadResult);
+    REQUIRE(loaded.indices.size() == tile.indices.size());
+    for (size_t i = 0; i < tile.indices.size(); ++i) {
+      checkPosition(
+          loaded.positions[loaded.indices[i]],
+          tile.positions[tile.indices[i]]);
+    }
+  }
+
+  SUBCASE("writes the availability of descendants") {
+    const QuadtreeTileID tileID(3, 2, 1);
+    QuantizedMeshWriterTile tile = QuantizedMeshWriterTile::fromHeightGrid(
+        getTileRectangle(tileID),
+        2,
+        2,
+        std::vector<float>{0.0f, 1.0f, 2.0f, 3.0f});
+
+    AvailabilityRectangle& level4 =
+        tile.available.emplace_back().emplace_back();
+    level4.startX = 4;
+    level4.startY = 2;
+    level4.endX = 5;
+    level4.endY = 3;
+    AvailabilityRectangle& level5 =
+        tile.available.emplace_back().emplace_back();
+    level5.startX = 8;
+    level5.startY = 4;
+    level5.endX = 11;
+    level5.endY = 7;
+
+    const QuantizedMeshWriterResult writeResult =
+        QuantizedMeshWriter::write(tile);
+    REQUIRE(writeResult.errors.empty());
+
+    const QuantizedMeshMetadataResult metadata =
+        QuantizedMeshLoader::loadMetadata(writeResult.bytes, tileID);
+    CHECK(!metadata.errors.hasErrors());
+    REQUIRE(metadata.availability.size() == 2);
+    CHECK(metadata.availability[0].level == 4);
+    CHECK(metadata.availability[0].minimumX == 4);
+    CHECK(metadata.availability[0].minimumY == 2);
+    CHECK(metadata.availability[0].maximumX == 5);
+    CHECK(metadata.availability[0].maximumY == 3);
+    CHECK(metadata.availability[1].level == 5);
+    CHECK(metadata.availability[1].minimumX == 8);
+    CHECK(metadata.availability[1].maximumY == 7);
+  }
+
+  SUBCASE("reports invalid tiles") {
+    QuantizedMeshWriterTile tile = QuantizedMeshWriterTile::fromHeightGrid(
+        getTileRectangle(QuadtreeTileID(0, 0, 0)),
+        3,
+        3,
+        std::vector<float>(8, 0.0f));
+    CHECK(tile.positions.empty());
+    CHECK(!QuantizedMeshWriter::write(tile).errors.empty());
+
+    tile.positions.resize(3, glm::dvec3(0.0));
+    tile.indices = {0, 1, 3};
+    CHECK(!QuantizedMeshWriter::write(tile).errors.empty());
+
+    tile.positions.resize(4, glm::dvec3(0.0));
+    tile.indices = {0, 1, 2};
+    const QuantizedMeshWriterResult result = QuantizedMeshWriter::write(tile);
+    CHECK(result.errors.empty());
+    CHECK(result.warnings.size() == 1);
+  }
+
+  SUBCASE("writes many tiles in parallel") {
+    AsyncSystem asyncSystem(
+        std::make_shared<CesiumNativeTests::ThreadTaskProcessor>());
+
+    std::vector<QuantizedMeshWriterTile> tiles;
+    for (uint32_t x = 0; x < 4; ++x) {
+      tiles.emplace_back(QuantizedMeshWriterTile::fromHeightGrid(
+          getTileRectangle(QuadtreeTileID(10, x, 0)),
+          9,
+          9,
+          createHeights(9, 9)));
+    }
+
+    std::vector<QuantizedMeshWriterResult> expected;
+    for (const QuantizedMeshWriterTile& tile : tiles) {
+      expected.emplace_back(QuantizedMeshWriter::write(tile));
+    }
+
+    std::vector<QuantizedMeshWriterResult> results =
+        QuantizedMeshWriter::write(asyncSystem, std::move(tiles)).wait();
+    REQUIRE(results.size() == expected.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      CHECK(results[i].errors.empty());
+      CHECK(results[i].bytes == expected[i].bytes);
+    }
+  }
+}
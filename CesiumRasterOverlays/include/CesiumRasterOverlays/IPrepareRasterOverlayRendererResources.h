@@ -3,6 +3,8 @@
 #include <CesiumRasterOverlays/Library.h>
 
 #include <any>
+#include <cstddef>
+#include <span>
 
 namespace CesiumImage {
 struct ImageAsset;
@@ -23,6 +25,33 @@ namespace CesiumRasterOverlays {
  */
 class CESIUMRASTEROVERLAYS_API IPrepareRasterOverlayRendererResources {
 public:
+  /**
+   * @brief Provides a buffer into which Cesium Native can compose a raster
+   * overlay tile image directly, such as a mapped GPU staging buffer.
+   *
+   * This method is invoked in the load thread when a tile image is about to be
+   * composed from multiple source images. If it returns a buffer, the pixels
+   * are written to that buffer as tightly-packed rows, top row first, instead
+   * of to the image's `pixelData`, which is left empty. The same image
+   * instance is later passed to {@link prepareRasterInLoadThread}.
+   *
+   * The default implementation returns an empty span, so the pixels are
+   * written to the image's `pixelData` as usual.
+   *
+   * @param image The image that is about to be composed. Its `width`,
+   * `height`, `channels`, and `bytesPerChannel` are already set.
+   * @param rendererOptions Renderer options associated with the raster overlay tile from {@link RasterOverlayOptions::rendererOptions}.
+   * @returns A buffer of at least `width * height * channels *
+   * bytesPerChannel` bytes, which must remain valid at least until
+   * {@link prepareRasterInLoadThread} is called with the same image, or an
+   * empty span to use the image's `pixelData`. A smaller buffer is ignored.
+   */
+  virtual std::span<std::byte> getRasterStagingBuffer(
+      [[maybe_unused]] const CesiumImage::ImageAsset& image,
+      [[maybe_unused]] const std::any& rendererOptions) {
+    return {};
+  }
+
   /**
    * @brief Prepares a raster overlay tile.
    *
@@ -12,6 +12,7 @@
 #include <CesiumUtility/Result.h>
 #include <CesiumUtility/SharedAsset.h>
 
+#include <any>
 #include <list>
 #include <memory>
 #include <optional>
@@ -168,7 +169,10 @@ private:
   static LoadedRasterOverlayImage combineImages(
       const CesiumGeometry::Rectangle& targetRectangle,
       const CesiumGeospatial::Projection& projection,
-      std::vector<CesiumUtility::ResultPointer<LoadedQuadtreeImage>>&& images);
+      std::vector<CesiumUtility::ResultPointer<LoadedQuadtreeImage>>&& images,
+      const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+          pPrepareRendererResources,
+      const std::any& rendererOptions);
 
   uint32_t _minimumLevel;
   uint32_t _maximumLevel;
@@ -3,6 +3,7 @@
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumImage/BlockCompression.h>
 #include <CesiumImage/Ktx2TranscodeTargets.h>
 #include <CesiumRasterOverlays/Library.h>
 #include <CesiumRasterOverlays/RasterOverlayLoadFailureDetails.h>
@@ -84,6 +85,20 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayOptions {
    */
   CesiumImage::Ktx2TranscodeTargets ktx2TranscodeTargets;
 
+  /**
+   * @brief The gpu-compressed pixel formats into which this overlay's tile
+   * images are compressed on the CPU before they are handed to
+   * {@link IPrepareRasterOverlayRendererResources::prepareRasterInLoadThread}.
+   *
+   * Block-compressed images use a quarter (BC3) or an eighth (BC1) of the
+   * memory of uncompressed RGBA images, which is reflected in the overlay's
+   * reported tile data bytes. By default, images are not compressed. To enable
+   * compression, construct this from the formats supported by the client's
+   * GPU. Images that are already compressed, or that the client asked to be
+   * composed directly in a staging buffer, are never compressed.
+   */
+  CesiumImage::BlockCompressionTargets blockCompressionTargets;
+
   /**
    * @brief A callback function that is invoked when a raster overlay resource
    * fails to load.
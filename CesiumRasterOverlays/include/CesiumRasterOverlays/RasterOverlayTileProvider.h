@@ -71,6 +71,13 @@ struct CESIUMRASTEROVERLAYS_API LoadedRasterOverlayImage {
    */
   bool moreDetailAvailable = false;
 
+  /**
+   * @brief Whether the image's pixels were written to a buffer provided by
+   * {@link IPrepareRasterOverlayRendererResources::getRasterStagingBuffer}
+   * instead of to its `pixelData`.
+   */
+  bool pixelsInStagingBuffer = false;
+
   /**
    * @brief Returns the size of this `LoadedRasterOverlayImage` in bytes.
    */
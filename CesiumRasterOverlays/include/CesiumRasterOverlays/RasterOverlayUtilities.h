@@ -8,10 +8,15 @@
 
 #include <glm/fwd.hpp>
 
+#include <array>
 #include <optional>
 #include <string_view>
 #include <vector>
 
+namespace CesiumAsync {
+class AsyncSystem;
+}
+
 namespace CesiumGltf {
 struct Model;
 }
@@ -92,6 +97,47 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
           DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
       int32_t firstTextureCoordinateID = 0);
 
+  /**
+   * @brief Creates texture coordinates for mapping {@link RasterOverlay} tiles
+   * to a glTF model, using worker threads to help with large primitives.
+   *
+   * This produces the same result as the overload without an
+   * {@link CesiumAsync::AsyncSystem}. The vertices of each primitive are
+   * processed in batches, and when a primitive has more than one batch, worker
+   * threads are asked to process some of them. The calling thread processes
+   * batches, too, and waits for the others to finish before returning, so this
+   * may be called from a worker thread.
+   *
+   * @param asyncSystem The async system used to start worker tasks.
+   * @param gltf The glTF model.
+   * @param modelToEcefTransform The transformation of this glTF to ECEF
+   * coordinates.
+   * @param globeRectangle The rectangle that all projected vertex positions are
+   * expected to lie within. If this parameter is std::nullopt, it is computed
+   * from the vertices.
+   * @param projections The projections for which to generate texture
+   * coordinates.
+   * @param invertVCoordinate True if the V texture coordinate should be
+   * inverted so that it is 1.0 at the Southern end of the rectangle and 0.0 at
+   * the Northern end.
+   * @param textureCoordinateAttributeBaseName The base name to use for the
+   * texture coordinate attributes, without a number on the end.
+   * @param firstTextureCoordinateID The texture coordinate ID of the first
+   * projection.
+   * @return The details of the generated texture coordinates.
+   */
+  static std::optional<RasterOverlayDetails>
+  createRasterOverlayTextureCoordinates(
+      const CesiumAsync::AsyncSystem& asyncSystem,
+      CesiumGltf::Model& gltf,
+      const glm::dmat4& modelToEcefTransform,
+      const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
+      std::vector<CesiumGeospatial::Projection>&& projections,
+      bool invertVCoordinate = false,
+      const std::string_view& textureCoordinateAttributeBaseName =
+          DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+      int32_t firstTextureCoordinateID = 0);
+
   /**
    * @brief Creates a new glTF model from one of the quadtree children of the
    * given parent model.
@@ -129,6 +175,43 @@ struct CESIUMRASTEROVERLAYS_API RasterOverlayUtilities {
       const CesiumGeospatial::Ellipsoid& ellipsoid =
           CesiumGeospatial::Ellipsoid::WGS84);
 
+  /**
+   * @brief Creates new glTF models for all four quadtree children of the given
+   * parent model at once.
+   *
+   * The result is the same as calling {@link upsampleGltfForRasterOverlays}
+   * for each of the four children, but the parent model is traversed only
+   * once. Each parent triangle is read a single time and is clipped only
+   * against the quadrants that it overlaps, which makes this considerably
+   * faster when more than one child is needed.
+   *
+   * @param parentModel The parent model to upsample.
+   * @param parentTileID The quadtree tile ID of the parent model. The children
+   * have the IDs of the parent's quadtree children.
+   * @param hasInvertedVCoordinate True if the V texture coordinate has 0.0 as
+   * the Northern-most coordinate; False if the V texture coordinate has 0.0 as
+   * the Southern-most coordiante.
+   * @param textureCoordinateAttributeBaseName The base name of the attribute
+   * that holds the projected texture coordinates. See
+   * {@link upsampleGltfForRasterOverlays}.
+   * @param textureCoordinateIndex The index of the texture coordinate set to
+   * use.
+   * @param ellipsoid The {@link CesiumGeospatial::Ellipsoid}.
+   * @return The upsampled models of the southwest, southeast, northwest, and
+   * northeast children, in that order. A model is `std::nullopt` if the child
+   * contains no geometry.
+   */
+  static std::array<std::optional<CesiumGltf::Model>, 4>
+  upsampleGltfForRasterOverlayChildren(
+      const CesiumGltf::Model& parentModel,
+      const CesiumGeometry::QuadtreeTileID& parentTileID,
+      bool hasInvertedVCoordinate = false,
+      const std::string_view& textureCoordinateAttributeBaseName =
+          DEFAULT_TEXTURE_COORDINATE_BASE_NAME,
+      int32_t textureCoordinateIndex = 0,
+      const CesiumGeospatial::Ellipsoid& ellipsoid =
+          CesiumGeospatial::Ellipsoid::WGS84);
+
   /**
    * @brief Computes the desired screen pixels for a raster overlay texture.
    *
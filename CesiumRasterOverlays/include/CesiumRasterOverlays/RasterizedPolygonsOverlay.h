@@ -2,6 +2,7 @@
 
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumRasterOverlays/Library.h>
@@ -61,6 +62,15 @@ public:
     return this->_polygons;
   }
 
+  /**
+   * @brief Gets a spatial index over the polygons, used to quickly determine
+   * whether rectangles are inside or outside of them.
+   */
+  const CesiumGeospatial::CartographicPolygonIndex&
+  getPolygonIndex() const noexcept {
+    return *this->_pPolygonIndex;
+  }
+
   /**
    * @brief Gets the value of the `invertSelection` value passed to the
    * constructor.
@@ -76,6 +86,8 @@ public:
 
 private:
   std::vector<CesiumGeospatial::CartographicPolygon> _polygons;
+  std::shared_ptr<const CesiumGeospatial::CartographicPolygonIndex>
+      _pPolygonIndex;
   bool _invertSelection;
   CesiumGeospatial::Ellipsoid _ellipsoid;
   CesiumGeospatial::Projection _projection;
@@ -2,6 +2,7 @@
 #include <CesiumAsync/SharedFuture.h>
 #include <CesiumGeometry/Rectangle.h>
 #include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumImage/BlockCompression.h>
 #include <CesiumImage/ImageAsset.h>
 #include <CesiumRasterOverlays/ActivatedRasterOverlay.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
@@ -179,7 +180,8 @@ struct LoadResult {
  * `LoadResult` with the state `RasterOverlayTile::LoadState::Failed` will be
  * returned.
  *
- * Otherwise, the image data will be passed to
+ * Otherwise, the image is compressed according to `blockCompressionTargets`,
+ * its data will be passed to
  * `IPrepareRasterOverlayRendererResources::prepareRasterInLoadThread`, and the
  * function will return a `LoadResult` with the image, the prepared renderer
  * resources, and the state `RasterOverlayTile::LoadState::Loaded`.
@@ -189,6 +191,7 @@ struct LoadResult {
  * @param pLogger The logger
  * @param loadedImage The `LoadedRasterOverlayImage`
  * @param rendererOptions Renderer options
+ * @param blockCompressionTargets The formats to compress the image to
  * @return The `LoadResult`
  */
 LoadResult createLoadResultFromLoadedImage(
@@ -196,7 +199,8 @@ LoadResult createLoadResultFromLoadedImage(
         pPrepareRendererResources,
     const std::shared_ptr<spdlog::logger>& pLogger,
     LoadedRasterOverlayImage&& loadedImage,
-    const std::any& rendererOptions) {
+    const std::any& rendererOptions,
+    const CesiumImage::BlockCompressionTargets& blockCompressionTargets) {
   if (!loadedImage.pImage) {
     loadedImage.errorList.logError(pLogger, "Failed to load image for tile");
     LoadResult result;
@@ -222,12 +226,17 @@ LoadResult createLoadResultFromLoadedImage(
   const int64_t requiredBytes =
       static_cast<int64_t>(image.width) * image.height * bytesPerPixel;
   if (image.width > 0 && image.height > 0 &&
-      image.pixelData.size() >= static_cast<size_t>(requiredBytes)) {
+      (loadedImage.pixelsInStagingBuffer ||
+       image.pixelData.size() >= static_cast<size_t>(requiredBytes))) {
     CESIUM_TRACE(
         "Prepare Raster " + std::to_string(image.width) + "x" +
         std::to_string(image.height) + "x" + std::to_string(image.channels) +
         "x" + std::to_string(image.bytesPerChannel));
 
+    if (!loadedImage.pixelsInStagingBuffer) {
+      CesiumImage::BlockCompression::compress(image, blockCompressionTargets);
+    }
+
     void* pRendererResources = nullptr;
     if (pPrepareRendererResources) {
       pRendererResources = pPrepareRendererResources->prepareRasterInLoadThread(
@@ -277,13 +286,16 @@ ActivatedRasterOverlay::doLoad(RasterOverlayTile& tile, bool isThrottledLoad) {
           [pPrepareRendererResources =
                this->_pTileProvider->getPrepareRendererResources(),
            pLogger = this->_pTileProvider->getLogger(),
-           rendererOptions = this->_pOverlay->getOptions().rendererOptions](
+           rendererOptions = this->_pOverlay->getOptions().rendererOptions,
+           blockCompressionTargets =
+               this->_pOverlay->getOptions().blockCompressionTargets](
               LoadedRasterOverlayImage&& loadedImage) {
             return createLoadResultFromLoadedImage(
                 pPrepareRendererResources,
                 pLogger,
                 std::move(loadedImage),
-                rendererOptions);
+                rendererOptions,
+                blockCompressionTargets);
           })
       .thenInMainThread(
           [thiz, pTile, isThrottledLoad](LoadResult&& result) noexcept {
@@ -8,6 +8,7 @@
 #include <CesiumGeometry/Rectangle.h>
 #include <CesiumGeospatial/Projection.h>
 #include <CesiumImage/ImageManipulation.h>
+#include <CesiumRasterOverlays/IPrepareRasterOverlayRendererResources.h>
 #include <CesiumRasterOverlays/QuadtreeRasterOverlayTileProvider.h>
 #include <CesiumRasterOverlays/RasterOverlay.h>
 #include <CesiumRasterOverlays/RasterOverlayTile.h>
@@ -22,12 +23,14 @@
 #include <glm/ext/vector_double2.hpp>
 
 #include <algorithm>
+#include <any>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <optional>
+#include <span>
 #include <utility>
 #include <vector>
 
@@ -411,12 +414,12 @@ PixelRectangle computePixelRectangle(
   return PixelRectangle{x, y, maxX - x, maxY - y};
 }
 
-// Copy part of a source image to part of a target image.
+// Computes the copy of part of a source image to part of a target image.
 // The two rectangles are the extents of each image, and the part of the
 // source image where the source subset rectangle overlaps the target
 // rectangle is copied to the target image.
-void blitImage(
-    ImageAsset& target,
+std::optional<ImageBlit> computeBlit(
+    const ImageAsset& target,
     const Rectangle& targetRectangle,
     const ImageAsset& source,
     const Rectangle& sourceRectangle,
@@ -426,15 +429,13 @@ void blitImage(
       targetRectangle.computeIntersection(sourceToCopy);
   if (!overlap) {
     // No overlap, nothing to do.
-    return;
+    return std::nullopt;
   }
 
-  const PixelRectangle targetPixels =
-      computePixelRectangle(target, targetRectangle, *overlap);
-  const PixelRectangle sourcePixels =
-      computePixelRectangle(source, sourceRectangle, *overlap);
-
-  ImageManipulation::blitImage(target, targetPixels, source, sourcePixels);
+  return ImageBlit{
+      &source,
+      computePixelRectangle(source, sourceRectangle, *overlap),
+      computePixelRectangle(target, targetRectangle, *overlap)};
 }
 
 } // namespace
@@ -453,7 +454,10 @@ QuadtreeRasterOverlayTileProvider::loadTileImage(
       .all(std::move(tiles))
       .thenInWorkerThread(
           [projection = this->getProjection(),
-           rectangle = overlayTile.getRectangle()](
+           rectangle = overlayTile.getRectangle(),
+           pPrepareRendererResources = this->getPrepareRendererResources(),
+           rendererOptions =
+               overlayTile.getOverlay().getOptions().rendererOptions](
               std::vector<ResultPointer<LoadedQuadtreeImage>>&& images) {
             // This set of images is only "useful" if at least one actually has
             // image data, and that image data is _not_ from an ancestor. We can
@@ -490,7 +494,9 @@ QuadtreeRasterOverlayTileProvider::loadTileImage(
             return QuadtreeRasterOverlayTileProvider::combineImages(
                 rectangle,
                 projection,
-                std::move(images));
+                std::move(images),
+                pPrepareRendererResources,
+                rendererOptions);
           });
 }
 
@@ -620,7 +626,10 @@ QuadtreeRasterOverlayTileProvider::measureCombinedImage(
 QuadtreeRasterOverlayTileProvider::combineImages(
     const Rectangle& targetRectangle,
     const Projection& /* projection */,
-    std::vector<ResultPointer<LoadedQuadtreeImage>>&& images) {
+    std::vector<ResultPointer<LoadedQuadtreeImage>>&& images,
+    const std::shared_ptr<IPrepareRasterOverlayRendererResources>&
+        pPrepareRendererResources,
+    const std::any& rendererOptions) {
   ErrorList errors;
   for (ResultPointer<LoadedQuadtreeImage>& image : images) {
     if (image.pValue && image.pValue->pLoaded) {
@@ -658,9 +667,11 @@ QuadtreeRasterOverlayTileProvider::combineImages(
   target.channels = measurements.channels;
   target.width = measurements.widthPixels;
   target.height = measurements.heightPixels;
-  target.pixelData.resize(size_t(
-      target.width * target.height * target.channels * target.bytesPerChannel));
 
+  // Work out all of the copies up front, so that they can be done together in
+  // a single pass over the target.
+  std::vector<ImageBlit> blits;
+  blits.reserve(images.size());
   for (const auto& image : images) {
     if (!image.pValue) {
       continue;
@@ -676,14 +687,45 @@ QuadtreeRasterOverlayTileProvider::combineImages(
       result.moreDetailAvailable |= loaded.moreDetailAvailable;
     }
 
-    blitImage(
+    std::optional<ImageBlit> maybeBlit = computeBlit(
         target,
         result.rectangle,
         *loaded.pImage,
         loaded.rectangle,
         image.pValue->subset);
+    if (maybeBlit) {
+      blits.emplace_back(*maybeBlit);
+    }
+  }
+
+  // Compose directly into the renderer's staging buffer, if it provides one.
+  const size_t targetBytes = size_t(targetImageBytes);
+  std::span<std::byte> pixels;
+  if (pPrepareRendererResources) {
+    pixels = pPrepareRendererResources->getRasterStagingBuffer(
+        target,
+        rendererOptions);
   }
 
+  if (pixels.size() >= targetBytes) {
+    pixels = pixels.first(targetBytes);
+    std::fill(pixels.begin(), pixels.end(), std::byte(0));
+    target.sizeBytes = int64_t(targetBytes);
+    result.pixelsInStagingBuffer = true;
+  } else {
+    target.pixelData.resize(targetBytes);
+    pixels = target.pixelData;
+  }
+
+  ImageManipulation::compositeImages(
+      pixels,
+      size_t(target.width * target.channels * target.bytesPerChannel),
+      target.width,
+      target.height,
+      target.channels,
+      target.bytesPerChannel,
+      blits);
+
   size_t combinedCreditsCount = 0;
   for (const auto& image : images) {
     if (!image.pValue) {
@@ -714,13 +756,13 @@ QuadtreeRasterOverlayTileProvider::combineImages(
 
   // Highlight the edges in yellow to show tile boundaries.
 #if SHOW_TILE_BOUNDARIES
-  std::span<uint32_t> pixels =
-      reintepretCastSpan<uint32_t, std::byte>(result.pImage->pixelData);
+  std::span<uint32_t> boundaryPixels =
+      reintepretCastSpan<uint32_t, std::byte>(pixels);
   for (int32_t j = 0; j < result.pImage->height; ++j) {
     for (int32_t i = 0; i < result.pImage->width; ++i) {
       if (i == 0 || j == 0 || i == result.pImage->width - 1 ||
           j == result.pImage->height - 1) {
-        pixels[j * result.pImage->width + i] = 0xFF00FFFF;
+        boundaryPixels[j * result.pImage->width + i] = 0xFF00FFFF;
       }
     }
   }
@@ -1,3 +1,5 @@
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumAsync/processBatches.h>
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeometry/Rectangle.h>
 #include <CesiumGeometry/clipTriangleAtAxisAlignedThreshold.h>
@@ -10,6 +12,7 @@
 #include <CesiumGltf/AccessorView.h>
 #include <CesiumGltf/AccessorWriter.h>
 #include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/ExtensionCesiumTileEdges.h>
 #include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Image.h>
 #include <CesiumGltf/Mesh.h>
@@ -18,6 +21,7 @@
 #include <CesiumGltf/PropertyTableProperty.h>
 #include <CesiumGltfContent/GltfUtilities.h>
 #include <CesiumGltfContent/SkirtMeshMetadata.h>
+#include <CesiumGltfContent/TileEdges.h>
 #include <CesiumRasterOverlays/RasterOverlayDetails.h>
 #include <CesiumRasterOverlays/RasterOverlayUtilities.h>
 #include <CesiumUtility/Assert.h>
@@ -27,16 +31,21 @@
 #include <glm/common.hpp>
 #include <glm/detail/setup.hpp>
 #include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_double2.hpp>
 #include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_double4.hpp>
 #include <glm/ext/vector_float2.hpp>
 #include <glm/ext/vector_float3.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <limits>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -48,11 +57,25 @@ using namespace CesiumGltf;
 using namespace CesiumGltfContent;
 using namespace CesiumGeometry;
 using namespace CesiumGeospatial;
+using CesiumAsync::processBatches;
 
 namespace CesiumRasterOverlays {
 
-/*static*/ std::optional<RasterOverlayDetails>
-RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+namespace {
+
+// The number of vertices whose texture coordinates are computed together. The
+// vertices of a batch are processed one step at a time, over separate arrays
+// of coordinates, and batches are the unit of work given to worker threads.
+constexpr size_t VERTICES_PER_BATCH = 8192;
+
+// The range of the texture coordinates generated for one batch of vertices.
+struct TextureCoordinateBounds {
+  glm::dvec2 minimum{1.0, 1.0};
+  glm::dvec2 maximum{0.0, 0.0};
+};
+
+std::optional<RasterOverlayDetails> createTextureCoordinates(
+    const CesiumAsync::AsyncSystem* pAsyncSystem,
     CesiumGltf::Model& model,
     const glm::dmat4& modelToEcefTransform,
     const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
@@ -232,109 +255,153 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
           maxs.emplace_back(&uvAccessor.max);
         }
 
-        // Generate texture coordinates for each position.
-        for (int64_t positionIndex = 0; positionIndex < positionView.size();
-             ++positionIndex) {
-          // Get the ECEF position
-          const glm::vec3 position = positionView[positionIndex];
-          const glm::dvec3 positionEcef =
-              glm::dvec3(fullTransform * glm::dvec4(position, 1.0));
-
-          // Convert it to cartographic
-          const std::optional<CesiumGeospatial::Cartographic> cartographic =
-              ellipsoid.cartesianToCartographic(positionEcef);
-          if (!cartographic) {
-            for (CesiumGltf::AccessorWriter<glm::vec2>& uvWriter : uvWriters) {
-              uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
-            }
-            continue;
-          }
-
-          // exclude skirt vertices from bounds
-          if (positionIndex >= vertexBegin && positionIndex < vertexEnd) {
-            computedBounds.expandToIncludePosition(*cartographic);
+        // Transform the positions to ECEF, convert them to cartographic, and
+        // project them in batches.
+        const size_t vertexCount = size_t(positionView.size());
+        std::vector<double> longitudes(vertexCount);
+        std::vector<double> latitudes(vertexCount);
+        std::vector<double> heights(vertexCount);
+
+        const size_t batchCount =
+            (vertexCount + VERTICES_PER_BATCH - 1) / VERTICES_PER_BATCH;
+        std::vector<TextureCoordinateBounds> batchBounds(
+            batchCount * projections.size());
+
+        processBatches(pAsyncSystem, batchCount, [&](size_t batch) {
+          const size_t begin = batch * VERTICES_PER_BATCH;
+          const size_t count =
+              std::min(VERTICES_PER_BATCH, vertexCount - begin);
+
+          std::vector<double> x(count);
+          std::vector<double> y(count);
+          std::vector<double> z(count);
+          for (size_t i = 0; i < count; ++i) {
+            const glm::dvec3 positionEcef = glm::dvec3(
+                fullTransform *
+                glm::dvec4(positionView[static_cast<int64_t>(begin + i)], 1.0));
+            x[i] = positionEcef.x;
+            y[i] = positionEcef.y;
+            z[i] = positionEcef.z;
           }
 
-          // Generate texture coordinates at this position for each projection
+          const std::span<double> batchLongitudes =
+              std::span(longitudes).subspan(begin, count);
+          const std::span<double> batchLatitudes =
+              std::span(latitudes).subspan(begin, count);
+          ellipsoid.cartesianToCartographic(
+              x,
+              y,
+              z,
+              batchLongitudes,
+              batchLatitudes,
+              std::span(heights).subspan(begin, count));
+
+          // Generate texture coordinates for each projection, reusing the X
+          // and Y arrays for the projected positions.
           for (size_t projectionIndex = 0; projectionIndex < projections.size();
                ++projectionIndex) {
             const CesiumGeospatial::Projection& projection =
                 projections[projectionIndex];
             const CesiumGeometry::Rectangle& rectangle =
                 rectangles[projectionIndex];
+            CesiumGltf::AccessorWriter<glm::vec2>& uvWriter =
+                uvWriters[projectionIndex];
+            TextureCoordinateBounds& uvBounds =
+                batchBounds[batch * projections.size() + projectionIndex];
+
+            projectPositions(projection, batchLongitudes, batchLatitudes, x, y);
+
+            for (size_t i = 0; i < count; ++i) {
+              const size_t vertexIndex = begin + i;
+              const int64_t positionIndex = int64_t(vertexIndex);
+              const double longitude = longitudes[vertexIndex];
+              if (std::isnan(longitude)) {
+                uvWriter[positionIndex] = glm::dvec2(0.0, 0.0);
+                continue;
+              }
 
-            // Project it with the raster overlay's projection
-            glm::dvec3 projectedPosition =
-                projectPosition(projection, cartographic.value());
-
-            double longitude = cartographic.value().longitude;
-            const double latitude = cartographic.value().latitude;
-            const double ellipsoidHeight = cartographic.value().height;
-
-            // If the position is near the anti-meridian and the projected
-            // position is outside the expected range, try using the equivalent
-            // longitude on the other side of the anti-meridian to see if that
-            // gets us closer.
-            if (glm::abs(
-                    glm::abs(cartographic.value().longitude) -
-                    CesiumUtility::Math::OnePi) <
-                    CesiumUtility::Math::Epsilon5 &&
-                (projectedPosition.x < rectangle.minimumX ||
-                 projectedPosition.x > rectangle.maximumX ||
-                 projectedPosition.y < rectangle.minimumY ||
-                 projectedPosition.y > rectangle.maximumY)) {
-              const double testLongitude = longitude + longitude < 0.0
-                                               ? CesiumUtility::Math::TwoPi
-                                               : -CesiumUtility::Math::TwoPi;
-              const glm::dvec3 projectedPosition2 = projectPosition(
-                  projection,
-                  CesiumGeospatial::Cartographic(
-                      testLongitude,
-                      latitude,
-                      ellipsoidHeight));
-
-              const double distance1 = rectangle.computeSignedDistance(
-                  glm::dvec2(projectedPosition));
-              const double distance2 = rectangle.computeSignedDistance(
-                  glm::dvec2(projectedPosition2));
-
-              if (distance2 < distance1) {
-                projectedPosition = projectedPosition2;
-                longitude = testLongitude;
+              glm::dvec2 projectedPosition(x[i], y[i]);
+
+              // If the position is near the anti-meridian and the projected
+              // position is outside the expected range, try using the
+              // equivalent longitude on the other side of the anti-meridian to
+              // see if that gets us closer.
+              if (glm::abs(glm::abs(longitude) - CesiumUtility::Math::OnePi) <
+                      CesiumUtility::Math::Epsilon5 &&
+                  (projectedPosition.x < rectangle.minimumX ||
+                   projectedPosition.x > rectangle.maximumX ||
+                   projectedPosition.y < rectangle.minimumY ||
+                   projectedPosition.y > rectangle.maximumY)) {
+                const double testLongitude = longitude + longitude < 0.0
+                                                 ? CesiumUtility::Math::TwoPi
+                                                 : -CesiumUtility::Math::TwoPi;
+                const glm::dvec2 projectedPosition2 =
+                    glm::dvec2(projectPosition(
+                        projection,
+                        CesiumGeospatial::Cartographic(
+                            testLongitude,
+                            latitudes[vertexIndex],
+                            heights[vertexIndex])));
+
+                const double distance1 =
+                    rectangle.computeSignedDistance(projectedPosition);
+                const double distance2 =
+                    rectangle.computeSignedDistance(projectedPosition2);
+
+                if (distance2 < distance1) {
+                  projectedPosition = projectedPosition2;
+                }
               }
-            }
 
-            // Scale to (0.0, 0.0) at the (minimumX, minimumY) corner, and
-            // (1.0, 1.0) at the (maximumX, maximumY) corner. The coordinates
-            // should stay inside these bounds if the input rectangle actually
-            // bounds the vertices, but we'll clamp to be safe.
-            glm::vec2 uv(
-                CesiumUtility::Math::clamp(
-                    (projectedPosition.x - rectangle.minimumX) /
-                        rectangle.computeWidth(),
-                    0.0,
-                    1.0),
-                CesiumUtility::Math::clamp(
-                    (projectedPosition.y - rectangle.minimumY) /
-                        rectangle.computeHeight(),
-                    0.0,
-                    1.0));
-
-            if (invertVCoordinate) {
-              uv.y = 1.0f - uv.y;
-            }
+              // Scale to (0.0, 0.0) at the (minimumX, minimumY) corner, and
+              // (1.0, 1.0) at the (maximumX, maximumY) corner. The coordinates
+              // should stay inside these bounds if the input rectangle actually
+              // bounds the vertices, but we'll clamp to be safe.
+              glm::vec2 uv(
+                  CesiumUtility::Math::clamp(
+                      (projectedPosition.x - rectangle.minimumX) /
+                          rectangle.computeWidth(),
+                      0.0,
+                      1.0),
+                  CesiumUtility::Math::clamp(
+                      (projectedPosition.y - rectangle.minimumY) /
+                          rectangle.computeHeight(),
+                      0.0,
+                      1.0));
+
+              if (invertVCoordinate) {
+                uv.y = 1.0f - uv.y;
+              }
 
-            mins[projectionIndex]->at(0) =
-                glm::min(mins[projectionIndex]->at(0), double(uv.x));
-            mins[projectionIndex]->at(1) =
-                glm::min(mins[projectionIndex]->at(1), double(uv.y));
-            maxs[projectionIndex]->at(0) =
-                glm::max(maxs[projectionIndex]->at(0), double(uv.x));
-            maxs[projectionIndex]->at(1) =
-                glm::max(maxs[projectionIndex]->at(1), double(uv.y));
-            uvWriters[projectionIndex][positionIndex] = uv;
+              uvBounds.minimum = glm::min(uvBounds.minimum, glm::dvec2(uv));
+              uvBounds.maximum = glm::max(uvBounds.maximum, glm::dvec2(uv));
+              uvWriter[positionIndex] = uv;
+            }
           }
+        });
+
+        for (size_t i = 0; i < batchBounds.size(); ++i) {
+          const size_t projectionIndex = i % projections.size();
+          std::vector<double>& minimum = *mins[projectionIndex];
+          std::vector<double>& maximum = *maxs[projectionIndex];
+          minimum[0] = glm::min(minimum[0], batchBounds[i].minimum.x);
+          minimum[1] = glm::min(minimum[1], batchBounds[i].minimum.y);
+          maximum[0] = glm::max(maximum[0], batchBounds[i].maximum.x);
+          maximum[1] = glm::max(maximum[1], batchBounds[i].maximum.y);
         }
+
+        // exclude skirt vertices from bounds
+        const size_t boundsBegin =
+            std::min(size_t(std::max(vertexBegin, int64_t(0))), vertexCount);
+        const size_t boundsEnd = std::clamp(
+            size_t(std::max(vertexEnd, int64_t(0))),
+            boundsBegin,
+            vertexCount);
+        const size_t boundsCount = boundsEnd - boundsBegin;
+        computedBounds.expandToIncludePositions(
+            std::span(longitudes).subspan(boundsBegin, boundsCount),
+            std::span(latitudes).subspan(boundsBegin, boundsCount),
+            std::span(heights).subspan(boundsBegin, boundsCount));
       };
 
   model.forEachPrimitiveInScene(-1, createTextureCoordinatesForPrimitive);
@@ -345,6 +412,49 @@ RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
       computedBounds.toRegion(ellipsoid)};
 }
 
+} // namespace
+
+/*static*/ std::optional<RasterOverlayDetails>
+RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+    CesiumGltf::Model& model,
+    const glm::dmat4& modelToEcefTransform,
+    const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
+    std::vector<CesiumGeospatial::Projection>&& projections,
+    bool invertVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t firstTextureCoordinateID) {
+  return createTextureCoordinates(
+      nullptr,
+      model,
+      modelToEcefTransform,
+      globeRectangle,
+      std::move(projections),
+      invertVCoordinate,
+      textureCoordinateAttributeBaseName,
+      firstTextureCoordinateID);
+}
+
+/*static*/ std::optional<RasterOverlayDetails>
+RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+    const CesiumAsync::AsyncSystem& asyncSystem,
+    CesiumGltf::Model& model,
+    const glm::dmat4& modelToEcefTransform,
+    const std::optional<CesiumGeospatial::GlobeRectangle>& globeRectangle,
+    std::vector<CesiumGeospatial::Projection>&& projections,
+    bool invertVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t firstTextureCoordinateID) {
+  return createTextureCoordinates(
+      &asyncSystem,
+      model,
+      modelToEcefTransform,
+      globeRectangle,
+      std::move(projections),
+      invertVCoordinate,
+      textureCoordinateAttributeBaseName,
+      firstTextureCoordinateID);
+}
+
 namespace {
 struct EdgeVertex {
   uint32_t index;
@@ -358,12 +468,19 @@ struct EdgeIndices {
   std::vector<EdgeVertex> north;
 };
 
-bool upsamplePrimitiveForRasterOverlays(
+// A child model being upsampled from a parent primitive, along with the copy
+// of that primitive in the child.
+struct UpsampleTarget {
+  Model* pModel;
+  MeshPrimitive* pPrimitive;
+  CesiumGeometry::UpsampledQuadtreeNode childID;
+  // Set to true if the primitive is kept in the child.
+  bool keep;
+};
+
+void upsamplePrimitiveForRasterOverlays(
     const Model& parentModel,
-    Model& model,
-    Mesh& mesh,
-    MeshPrimitive& primitive,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
+    std::span<UpsampleTarget> targets,
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
@@ -411,19 +528,41 @@ void addSkirt(
     int32_t positionAttributeIndex,
     const CesiumGeospatial::Ellipsoid& ellipsoid);
 
+// The indices of the vertices on each edge of a child, in the order in which
+// their skirts are added.
+struct SortedEdgeIndices {
+  std::vector<uint32_t> west;
+  std::vector<uint32_t> south;
+  std::vector<uint32_t> east;
+  std::vector<uint32_t> north;
+};
+
+// Computes the skirt heights of a child from those of its parent.
+void computeSkirtHeights(
+    CesiumGeometry::UpsampledQuadtreeNode childID,
+    SkirtMeshMetadata& currentSkirt,
+    const SkirtMeshMetadata& parentSkirt);
+
+SortedEdgeIndices
+sortEdgeIndices(EdgeIndices& edgeIndices, bool hasInvertedVCoordinate);
+
 void addSkirts(
     std::vector<float>& output,
     std::vector<uint32_t>& indices,
     std::vector<FloatVertexAttribute>& attributes,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
-    SkirtMeshMetadata& currentSkirt,
-    const SkirtMeshMetadata& parentSkirt,
-    EdgeIndices& edgeIndices,
+    const SkirtMeshMetadata& skirt,
+    const SortedEdgeIndices& edgeIndices,
     int64_t vertexSizeFloats,
     int32_t positionAttributeIndex,
-    bool hasInvertedVCoordinate,
     const CesiumGeospatial::Ellipsoid& ellipsoid);
 
+// Stores the edges of a child in the CESIUM_tile_edges extension of its
+// primitive, for children of tiles that have no skirts.
+void addTileEdges(
+    Model& model,
+    MeshPrimitive& primitive,
+    const SortedEdgeIndices& edgeIndices);
+
 bool isWestChild(CesiumGeometry::UpsampledQuadtreeNode childID) noexcept {
   return (childID.tileID.x % 2) == 0;
 }
@@ -515,17 +654,12 @@ private:
   AccessorViewStatus viewStatus;
 };
 
-} // namespace
-
-/*static*/ std::optional<Model>
-RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+// Creates a child model that is a copy of the parent model, except for the
+// buffers, bufferViews, and accessors, which will be rewritten as each
+// primitive is upsampled.
+Model createUpsampledModel(
     const Model& parentModel,
-    UpsampledQuadtreeNode childID,
-    bool hasInvertedVCoordinate,
-    const std::string_view& textureCoordinateAttributeBaseName,
-    int32_t textureCoordinateIndex,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  CESIUM_TRACE("upsampleGltfForRasterOverlays");
+    CesiumGeometry::UpsampledQuadtreeNode childID) {
   Model result;
 
   // Copy the entire parent model except for the buffers, bufferViews, and
@@ -571,18 +705,46 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
     nameIt->second = name;
   }
 
-  bool containsPrimitives = false;
+  return result;
+}
+
+// Upsamples the parent model for each of the given children in a single pass
+// over the parent's primitives.
+std::vector<std::optional<Model>> upsampleChildModels(
+    const Model& parentModel,
+    std::span<const CesiumGeometry::UpsampledQuadtreeNode> childIDs,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  std::vector<Model> models;
+  std::vector<UpsampleTarget> targets;
+  models.reserve(childIDs.size());
+  targets.reserve(childIDs.size());
+  for (const CesiumGeometry::UpsampledQuadtreeNode& childID : childIDs) {
+    models.emplace_back(createUpsampledModel(parentModel, childID));
+    targets.emplace_back(UpsampleTarget{nullptr, nullptr, childID, false});
+  }
+
+  std::vector<size_t> removedPrimitives(childIDs.size());
 
-  for (Mesh& mesh : result.meshes) {
-    for (size_t i = 0; i < mesh.primitives.size(); ++i) {
-      MeshPrimitive& primitive = mesh.primitives[i];
+  for (size_t meshIndex = 0; meshIndex < parentModel.meshes.size();
+       ++meshIndex) {
+    std::fill(removedPrimitives.begin(), removedPrimitives.end(), size_t(0));
 
-      bool keep = upsamplePrimitiveForRasterOverlays(
+    const size_t primitiveCount =
+        parentModel.meshes[meshIndex].primitives.size();
+    for (size_t i = 0; i < primitiveCount; ++i) {
+      for (size_t c = 0; c < targets.size(); ++c) {
+        Mesh& mesh = models[c].meshes[meshIndex];
+        targets[c].pModel = &models[c];
+        targets[c].pPrimitive = &mesh.primitives[i - removedPrimitives[c]];
+        targets[c].keep = false;
+      }
+
+      upsamplePrimitiveForRasterOverlays(
           parentModel,
-          result,
-          mesh,
-          primitive,
-          childID,
+          targets,
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
@@ -590,16 +752,85 @@ RasterOverlayUtilities::upsampleGltfForRasterOverlays(
 
       // We're assuming here that nothing references primitives by index, so we
       // can remove them without any drama.
-      if (!keep) {
-        mesh.primitives.erase(mesh.primitives.begin() + ptrdiff_t(i));
-        --i;
+      for (size_t c = 0; c < targets.size(); ++c) {
+        if (!targets[c].keep) {
+          std::vector<MeshPrimitive>& primitives =
+              models[c].meshes[meshIndex].primitives;
+          primitives.erase(
+              primitives.begin() + ptrdiff_t(i - removedPrimitives[c]));
+          ++removedPrimitives[c];
+        }
       }
-      containsPrimitives |= !mesh.primitives.empty();
     }
   }
 
-  return containsPrimitives ? std::make_optional<Model>(std::move(result))
-                            : std::nullopt;
+  std::vector<std::optional<Model>> result;
+  result.reserve(models.size());
+  for (Model& model : models) {
+    const bool containsPrimitives = std::any_of(
+        model.meshes.begin(),
+        model.meshes.end(),
+        [](const Mesh& mesh) { return !mesh.primitives.empty(); });
+    result.emplace_back(
+        containsPrimitives ? std::make_optional<Model>(std::move(model))
+                           : std::nullopt);
+  }
+
+  return result;
+}
+
+} // namespace
+
+/*static*/ std::optional<Model>
+RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+    const Model& parentModel,
+    UpsampledQuadtreeNode childID,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("upsampleGltfForRasterOverlays");
+  std::vector<std::optional<Model>> results = upsampleChildModels(
+      parentModel,
+      std::span<const UpsampledQuadtreeNode>(&childID, 1),
+      hasInvertedVCoordinate,
+      textureCoordinateAttributeBaseName,
+      textureCoordinateIndex,
+      ellipsoid);
+  return std::move(results[0]);
+}
+
+/*static*/ std::array<std::optional<Model>, 4>
+RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+    const Model& parentModel,
+    const QuadtreeTileID& parentTileID,
+    bool hasInvertedVCoordinate,
+    const std::string_view& textureCoordinateAttributeBaseName,
+    int32_t textureCoordinateIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("upsampleGltfForRasterOverlayChildren");
+  const QuadtreeTileID sw(
+      parentTileID.level + 1,
+      parentTileID.x * 2,
+      parentTileID.y * 2);
+  const std::array<UpsampledQuadtreeNode, 4> childIDs{
+      UpsampledQuadtreeNode{sw},
+      UpsampledQuadtreeNode{QuadtreeTileID(sw.level, sw.x + 1, sw.y)},
+      UpsampledQuadtreeNode{QuadtreeTileID(sw.level, sw.x, sw.y + 1)},
+      UpsampledQuadtreeNode{QuadtreeTileID(sw.level, sw.x + 1, sw.y + 1)}};
+
+  std::vector<std::optional<Model>> results = upsampleChildModels(
+      parentModel,
+      childIDs,
+      hasInvertedVCoordinate,
+      textureCoordinateAttributeBaseName,
+      textureCoordinateIndex,
+      ellipsoid);
+  return {
+      std::move(results[0]),
+      std::move(results[1]),
+      std::move(results[2]),
+      std::move(results[3])};
 }
 
 /*static*/ glm::dvec2 RasterOverlayUtilities::computeDesiredScreenPixels(
@@ -1113,187 +1344,214 @@ bool upsamplePointsPrimitiveForRasterOverlays(
   return true;
 }
 
+// The state of one child while its triangles are upsampled from a parent
+// primitive.
+struct UpsampledTriangles {
+  size_t vertexBufferIndex = 0;
+  size_t vertexBufferViewIndex = 0;
+  size_t indexBufferIndex = 0;
+  size_t indexBufferViewIndex = 0;
+  std::vector<FloatVertexAttribute> attributes;
+  int64_t vertexSizeFloats = 0;
+  int32_t positionAttributeIndex = -1;
+  bool keepAboveU = false;
+  bool keepAboveV = false;
+
+  // Maps old (parentModel) vertex indices to new (model) vertex indices.
+  std::vector<uint32_t> vertexMap;
+  std::vector<float> newVertexFloats;
+  std::vector<uint32_t> indices;
+  EdgeIndices edgeIndices;
+};
+
 template <class TIndex>
-bool upsampleTrianglesPrimitiveForRasterOverlays(
+void upsampleTrianglesPrimitiveForRasterOverlays(
     const Model& parentModel,
-    Model& model,
-    Mesh& /*mesh*/,
-    MeshPrimitive& primitive,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
+    std::span<UpsampleTarget> targets,
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   CESIUM_TRACE("upsampleTrianglesPrimitiveForRasterOverlays");
 
-  // Add up the per-vertex size of all attributes and create buffers,
-  // bufferViews, and accessors
-  std::vector<FloatVertexAttribute> attributes;
-  attributes.reserve(primitive.attributes.size());
+  // Every target's primitive starts as a copy of the same parent primitive.
+  const MeshPrimitive& parentPrimitive = *targets[0].pPrimitive;
+  const int32_t parentIndices = parentPrimitive.indices;
 
-  const size_t vertexBufferIndex = model.buffers.size();
-  model.buffers.emplace_back();
-
-  const size_t vertexBufferViewIndex = model.bufferViews.size();
-  model.bufferViews.emplace_back();
-
-  const size_t indexBufferIndex = model.buffers.size();
-  model.buffers.emplace_back();
-
-  const size_t indexBufferViewIndex = model.bufferViews.size();
-  model.bufferViews.emplace_back();
-
-  BufferView& vertexBufferView = model.bufferViews[vertexBufferViewIndex];
-  vertexBufferView.buffer = static_cast<int>(vertexBufferIndex);
-  vertexBufferView.target = BufferView::Target::ARRAY_BUFFER;
+  // check if the primitive has skirts
+  std::optional<SkirtMeshMetadata> parentSkirtMeshMetadata =
+      SkirtMeshMetadata::parseFromGltfExtras(parentPrimitive.extras);
 
-  BufferView& indexBufferView = model.bufferViews[indexBufferViewIndex];
-  indexBufferView.buffer = static_cast<int>(indexBufferIndex);
-  indexBufferView.target = BufferView::Target::ELEMENT_ARRAY_BUFFER;
+  // A parent loaded without skirts stores its edges instead, and so must its
+  // children.
+  const bool parentHasTileEdges =
+      parentPrimitive.getExtension<ExtensionCesiumTileEdges>() != nullptr;
 
-  int64_t vertexSizeFloats = 0;
   int64_t positionAttributeCount = 0;
   int32_t uvAccessorIndex = -1;
-  int32_t positionAttributeIndex = -1;
-
-  std::vector<std::string> toRemove;
 
   std::string textureCoordinateName =
       std::string(textureCoordinateAttributeBaseName) +
       std::to_string(textureCoordinateIndex);
 
-  for (std::pair<const std::string, int>& attribute : primitive.attributes) {
-    if (attribute.first.starts_with(textureCoordinateAttributeBaseName)) {
-      if (uvAccessorIndex == -1) {
-        if (attribute.first == textureCoordinateName) {
-          uvAccessorIndex = attribute.second;
-        }
-      }
-      // Do not include textureCoordinateName (e.g., TEXCOORD_* or
-      // _CESIUMOVERLAY_*), it will be generated later.
-      toRemove.push_back(attribute.first);
-      continue;
-    }
+  std::vector<UpsampledTriangles> children(targets.size());
+  for (size_t childIndex = 0; childIndex < targets.size(); ++childIndex) {
+    Model& model = *targets[childIndex].pModel;
+    MeshPrimitive& primitive = *targets[childIndex].pPrimitive;
+    UpsampledTriangles& child = children[childIndex];
 
-    if (attribute.second < 0 ||
-        attribute.second >= static_cast<int>(parentModel.accessors.size())) {
-      toRemove.push_back(attribute.first);
-      continue;
-    }
+    // Add up the per-vertex size of all attributes and create buffers,
+    // bufferViews, and accessors
+    std::vector<FloatVertexAttribute>& attributes = child.attributes;
+    attributes.reserve(primitive.attributes.size());
 
-    const Accessor& accessor =
-        parentModel.accessors[static_cast<size_t>(attribute.second)];
-    if (accessor.bufferView < 0 ||
-        accessor.bufferView >=
-            static_cast<int>(parentModel.bufferViews.size())) {
-      toRemove.push_back(attribute.first);
-      continue;
-    }
+    child.vertexBufferIndex = model.buffers.size();
+    model.buffers.emplace_back();
 
-    const BufferView& bufferView =
-        parentModel.bufferViews[static_cast<size_t>(accessor.bufferView)];
-    if (bufferView.buffer < 0 ||
-        bufferView.buffer >= static_cast<int>(parentModel.buffers.size())) {
-      toRemove.push_back(attribute.first);
-      continue;
-    }
+    child.vertexBufferViewIndex = model.bufferViews.size();
+    model.bufferViews.emplace_back();
 
-    const Buffer& buffer =
-        parentModel.buffers[static_cast<size_t>(bufferView.buffer)];
+    child.indexBufferIndex = model.buffers.size();
+    model.buffers.emplace_back();
 
-    const int64_t accessorByteStride = accessor.computeByteStride(parentModel);
-    const int64_t accessorComponentElements =
-        accessor.computeNumberOfComponents();
-    if (accessor.componentType != Accessor::ComponentType::FLOAT) {
-      // Can only interpolate floating point vertex attributes
-      toRemove.push_back(attribute.first);
-      continue;
-    }
+    child.indexBufferViewIndex = model.bufferViews.size();
+    model.bufferViews.emplace_back();
 
-    attribute.second = static_cast<int>(model.accessors.size());
-    model.accessors.emplace_back();
-    Accessor& newAccessor = model.accessors.back();
-    newAccessor.bufferView = static_cast<int>(vertexBufferViewIndex);
-    newAccessor.byteOffset = vertexSizeFloats * int64_t(sizeof(float));
-    newAccessor.componentType = Accessor::ComponentType::FLOAT;
-    newAccessor.type = accessor.type;
+    BufferView& vertexBufferView =
+        model.bufferViews[child.vertexBufferViewIndex];
+    vertexBufferView.buffer = static_cast<int>(child.vertexBufferIndex);
+    vertexBufferView.target = BufferView::Target::ARRAY_BUFFER;
 
-    vertexSizeFloats += accessorComponentElements;
+    BufferView& indexBufferView = model.bufferViews[child.indexBufferViewIndex];
+    indexBufferView.buffer = static_cast<int>(child.indexBufferIndex);
+    indexBufferView.target = BufferView::Target::ELEMENT_ARRAY_BUFFER;
 
-    attributes.push_back(FloatVertexAttribute{
-        buffer.cesium.data,
-        bufferView.byteOffset + accessor.byteOffset,
-        accessorByteStride,
-        accessorComponentElements,
-        attribute.second,
-        std::vector<double>(
-            static_cast<size_t>(accessorComponentElements),
-            std::numeric_limits<double>::max()),
-        std::vector<double>(
-            static_cast<size_t>(accessorComponentElements),
-            std::numeric_limits<double>::lowest()),
-    });
+    std::vector<std::string> toRemove;
+
+    for (std::pair<const std::string, int>& attribute : primitive.attributes) {
+      if (attribute.first.starts_with(textureCoordinateAttributeBaseName)) {
+        if (uvAccessorIndex == -1) {
+          if (attribute.first == textureCoordinateName) {
+            uvAccessorIndex = attribute.second;
+          }
+        }
+        // Do not include textureCoordinateName (e.g., TEXCOORD_* or
+        // _CESIUMOVERLAY_*), it will be generated later.
+        toRemove.push_back(attribute.first);
+        continue;
+      }
+
+      if (attribute.second < 0 ||
+          attribute.second >= static_cast<int>(parentModel.accessors.size())) {
+        toRemove.push_back(attribute.first);
+        continue;
+      }
+
+      const Accessor& accessor =
+          parentModel.accessors[static_cast<size_t>(attribute.second)];
+      if (accessor.bufferView < 0 ||
+          accessor.bufferView >=
+              static_cast<int>(parentModel.bufferViews.size())) {
+        toRemove.push_back(attribute.first);
+        continue;
+      }
+
+      const BufferView& bufferView =
+          parentModel.bufferViews[static_cast<size_t>(accessor.bufferView)];
+      if (bufferView.buffer < 0 ||
+          bufferView.buffer >= static_cast<int>(parentModel.buffers.size())) {
+        toRemove.push_back(attribute.first);
+        continue;
+      }
 
-    // get position to be used to create skirts later
-    if (attribute.first == "POSITION") {
-      positionAttributeIndex = int32_t(attributes.size() - 1);
-      positionAttributeCount = accessor.count;
+      const Buffer& buffer =
+          parentModel.buffers[static_cast<size_t>(bufferView.buffer)];
+
+      const int64_t accessorByteStride =
+          accessor.computeByteStride(parentModel);
+      const int64_t accessorComponentElements =
+          accessor.computeNumberOfComponents();
+      if (accessor.componentType != Accessor::ComponentType::FLOAT) {
+        // Can only interpolate floating point vertex attributes
+        toRemove.push_back(attribute.first);
+        continue;
+      }
+
+      attribute.second = static_cast<int>(model.accessors.size());
+      model.accessors.emplace_back();
+      Accessor& newAccessor = model.accessors.back();
+      newAccessor.bufferView = static_cast<int>(child.vertexBufferViewIndex);
+      newAccessor.byteOffset = child.vertexSizeFloats * int64_t(sizeof(float));
+      newAccessor.componentType = Accessor::ComponentType::FLOAT;
+      newAccessor.type = accessor.type;
+
+      child.vertexSizeFloats += accessorComponentElements;
+
+      attributes.push_back(FloatVertexAttribute{
+          buffer.cesium.data,
+          bufferView.byteOffset + accessor.byteOffset,
+          accessorByteStride,
+          accessorComponentElements,
+          attribute.second,
+          std::vector<double>(
+              static_cast<size_t>(accessorComponentElements),
+              std::numeric_limits<double>::max()),
+          std::vector<double>(
+              static_cast<size_t>(accessorComponentElements),
+              std::numeric_limits<double>::lowest()),
+      });
+
+      // get position to be used to create skirts later
+      if (attribute.first == "POSITION") {
+        child.positionAttributeIndex = int32_t(attributes.size() - 1);
+        positionAttributeCount = accessor.count;
+      }
     }
-  }
 
-  if (uvAccessorIndex == -1) {
-    // We don't know how to divide this primitive, so just remove it.
-    return false;
-  }
+    if (uvAccessorIndex == -1) {
+      // We don't know how to divide this primitive, so just remove it.
+      return;
+    }
 
-  for (const std::string& attribute : toRemove) {
-    primitive.attributes.erase(attribute);
-  }
+    for (const std::string& attribute : toRemove) {
+      primitive.attributes.erase(attribute);
+    }
 
-  const bool keepAboveU = !isWestChild(childID);
-  const bool keepAboveV = !isSouthChild(childID);
+    child.keepAboveU = !isWestChild(targets[childIndex].childID);
+    child.keepAboveV = !isSouthChild(targets[childIndex].childID);
+  }
 
   const AccessorView<glm::vec2> uvView(parentModel, uvAccessorIndex);
   const IndicesViewRemapper<TIndex> indicesView(
       parentModel,
-      primitive,
-      primitive.indices,
+      parentPrimitive,
+      parentIndices,
       positionAttributeCount);
 
   if (uvView.status() != AccessorViewStatus::Valid ||
       indicesView.status() != AccessorViewStatus::Valid) {
-    return false;
+    return;
   }
 
-  // check if the primitive has skirts
   int64_t indicesBegin = 0;
   int64_t indicesCount = indicesView.size();
-  std::optional<SkirtMeshMetadata> parentSkirtMeshMetadata =
-      SkirtMeshMetadata::parseFromGltfExtras(primitive.extras);
   const bool hasSkirt = (parentSkirtMeshMetadata != std::nullopt) &&
-                        (positionAttributeIndex != -1);
+                        (children[0].positionAttributeIndex != -1);
   if (hasSkirt) {
     indicesBegin = parentSkirtMeshMetadata->noSkirtIndicesBegin;
     indicesCount = parentSkirtMeshMetadata->noSkirtIndicesCount;
   }
 
+  for (UpsampledTriangles& child : children) {
+    child.vertexMap.assign(
+        size_t(uvView.size()),
+        std::numeric_limits<uint32_t>::max());
+  }
+
   std::vector<uint32_t> clipVertexToIndices;
   std::vector<CesiumGeometry::TriangleClipVertex> clippedA;
   std::vector<CesiumGeometry::TriangleClipVertex> clippedB;
 
-  // Maps old (parentModel) vertex indices to new (model) vertex indices.
-  std::vector<uint32_t> vertexMap(
-      size_t(uvView.size()),
-      std::numeric_limits<uint32_t>::max());
-
-  // std::vector<unsigned char> newVertexBuffer(vertexSizeFloats *
-  // sizeof(float)); std::span<float>
-  // newVertexFloats(reinterpret_cast<float*>(newVertexBuffer.data()),
-  // newVertexBuffer.size() / sizeof(float));
-  std::vector<float> newVertexFloats;
-  std::vector<uint32_t> indices;
-  EdgeIndices edgeIndices;
-
   for (int64_t i = indicesBegin; i < indicesBegin + indicesCount; i += 3) {
     TIndex i0 = indicesView[i];
     TIndex i1 = indicesView[i + 1];
@@ -1303,89 +1561,70 @@ bool upsampleTrianglesPrimitiveForRasterOverlays(
     const glm::vec2 uv1 = uvView[i1];
     const glm::vec2 uv2 = uvView[i2];
 
-    // Clip this triangle against the East-West boundary
-    clippedA.clear();
-    clipTriangleAtAxisAlignedThreshold(
-        0.5,
-        keepAboveU,
-        static_cast<int>(i0),
-        static_cast<int>(i1),
-        static_cast<int>(i2),
-        uv0.x,
-        uv1.x,
-        uv2.x,
-        clippedA);
-
-    if (clippedA.size() < 3) {
-      // No part of this triangle is inside the target tile.
-      continue;
-    }
+    const float minimumU = std::min({uv0.x, uv1.x, uv2.x});
+    const float maximumU = std::max({uv0.x, uv1.x, uv2.x});
+    const float minimumV = std::min({uv0.y, uv1.y, uv2.y});
+    const float maximumV = std::max({uv0.y, uv1.y, uv2.y});
+
+    for (UpsampledTriangles& child : children) {
+      const bool keepAboveU = child.keepAboveU;
+      const bool keepAboveV = child.keepAboveV;
+      const bool clipAboveV =
+          hasInvertedVCoordinate ? !keepAboveV : keepAboveV;
+
+      // Skip quadrants that this triangle does not reach. The clipping below
+      // would discard the triangle anyway.
+      if (keepAboveU ? maximumU < 0.5f : minimumU > 0.5f) {
+        continue;
+      }
+      if (clipAboveV ? maximumV < 0.5f : minimumV > 0.5f) {
+        continue;
+      }
 
-    // Clip the first clipped triange against the North-South boundary
-    clipVertexToIndices.clear();
-    clippedB.clear();
-    clipTriangleAtAxisAlignedThreshold(
-        0.5,
-        hasInvertedVCoordinate ? !keepAboveV : keepAboveV,
-        ~0,
-        ~1,
-        ~2,
-        getVertexValue(uvView, clippedA[0]).y,
-        getVertexValue(uvView, clippedA[1]).y,
-        getVertexValue(uvView, clippedA[2]).y,
-        clippedB);
-
-    // Add the clipped triangle or quad, if any
-    addClippedPolygon(
-        newVertexFloats,
-        indices,
-        attributes,
-        vertexMap,
-        clipVertexToIndices,
-        clippedA,
-        clippedB);
-    if (hasSkirt) {
-      addEdge(
-          edgeIndices,
-          0.5,
+      // Clip this triangle against the East-West boundary
+      clippedA.clear();
+      clipTriangleAtAxisAlignedThreshold(
           0.5,
           keepAboveU,
-          keepAboveV,
-          hasInvertedVCoordinate,
-          uvView,
-          clipVertexToIndices,
-          clippedA,
-          clippedB);
-    }
+          static_cast<int>(i0),
+          static_cast<int>(i1),
+          static_cast<int>(i2),
+          uv0.x,
+          uv1.x,
+          uv2.x,
+          clippedA);
+
+      if (clippedA.size() < 3) {
+        // No part of this triangle is inside the target tile.
+        continue;
+      }
 
-    // If the East-West clip yielded a quad (rather than a triangle), clip the
-    // second triangle of the quad, too.
-    if (clippedA.size() > 3) {
+      // Clip the first clipped triange against the North-South boundary
       clipVertexToIndices.clear();
       clippedB.clear();
       clipTriangleAtAxisAlignedThreshold(
           0.5,
-          hasInvertedVCoordinate ? !keepAboveV : keepAboveV,
+          clipAboveV,
           ~0,
+          ~1,
           ~2,
-          ~3,
           getVertexValue(uvView, clippedA[0]).y,
+          getVertexValue(uvView, clippedA[1]).y,
           getVertexValue(uvView, clippedA[2]).y,
-          getVertexValue(uvView, clippedA[3]).y,
           clippedB);
 
       // Add the clipped triangle or quad, if any
       addClippedPolygon(
-          newVertexFloats,
-          indices,
-          attributes,
-          vertexMap,
+          child.newVertexFloats,
+          child.indices,
+          child.attributes,
+          child.vertexMap,
           clipVertexToIndices,
           clippedA,
           clippedB);
       if (hasSkirt) {
         addEdge(
-            edgeIndices,
+            child.edgeIndices,
             0.5,
             0.5,
             keepAboveU,
@@ -1396,89 +1635,164 @@ bool upsampleTrianglesPrimitiveForRasterOverlays(
             clippedA,
             clippedB);
       }
-    }
-  }
 
-  // create mesh with skirt
-  std::optional<SkirtMeshMetadata> skirtMeshMetadata;
-  if (hasSkirt) {
-    skirtMeshMetadata = std::make_optional<SkirtMeshMetadata>();
-    skirtMeshMetadata->noSkirtIndicesBegin = 0;
-    skirtMeshMetadata->noSkirtIndicesCount =
-        static_cast<uint32_t>(indices.size());
-    skirtMeshMetadata->noSkirtVerticesBegin = 0;
-    skirtMeshMetadata->noSkirtVerticesCount =
-        uint32_t(newVertexFloats.size() / size_t(vertexSizeFloats));
-    skirtMeshMetadata->meshCenter = parentSkirtMeshMetadata->meshCenter;
-    addSkirts(
-        newVertexFloats,
-        indices,
-        attributes,
-        childID,
-        *skirtMeshMetadata,
-        *parentSkirtMeshMetadata,
-        edgeIndices,
-        vertexSizeFloats,
-        positionAttributeIndex,
-        hasInvertedVCoordinate,
-        ellipsoid);
-  }
+      // If the East-West clip yielded a quad (rather than a triangle), clip
+      // the second triangle of the quad, too.
+      if (clippedA.size() > 3) {
+        clipVertexToIndices.clear();
+        clippedB.clear();
+        clipTriangleAtAxisAlignedThreshold(
+            0.5,
+            clipAboveV,
+            ~0,
+            ~2,
+            ~3,
+            getVertexValue(uvView, clippedA[0]).y,
+            getVertexValue(uvView, clippedA[2]).y,
+            getVertexValue(uvView, clippedA[3]).y,
+            clippedB);
 
-  if (newVertexFloats.empty() || indices.empty()) {
-    return false;
+        // Add the clipped triangle or quad, if any
+        addClippedPolygon(
+            child.newVertexFloats,
+            child.indices,
+            child.attributes,
+            child.vertexMap,
+            clipVertexToIndices,
+            clippedA,
+            clippedB);
+        if (hasSkirt) {
+          addEdge(
+              child.edgeIndices,
+              0.5,
+              0.5,
+              keepAboveU,
+              keepAboveV,
+              hasInvertedVCoordinate,
+              uvView,
+              clipVertexToIndices,
+              clippedA,
+              clippedB);
+        }
+      }
+    }
   }
 
-  // Update the accessor vertex counts and min/max values
-  const int64_t numberOfVertices =
-      int64_t(newVertexFloats.size()) / vertexSizeFloats;
-  for (const FloatVertexAttribute& attribute : attributes) {
-    Accessor& accessor =
-        model.accessors[static_cast<size_t>(attribute.accessorIndex)];
-    accessor.count = numberOfVertices;
-    accessor.min = attribute.minimums;
-    accessor.max = attribute.maximums;
-  }
+  for (size_t childIndex = 0; childIndex < targets.size(); ++childIndex) {
+    UpsampleTarget& target = targets[childIndex];
+    UpsampledTriangles& child = children[childIndex];
+    Model& model = *target.pModel;
+    MeshPrimitive& primitive = *target.pPrimitive;
+    std::vector<float>& newVertexFloats = child.newVertexFloats;
+    std::vector<uint32_t>& indices = child.indices;
 
-  // Add an accessor for the indices
-  const size_t indexAccessorIndex = model.accessors.size();
-  model.accessors.emplace_back();
-  Accessor& newIndicesAccessor = model.accessors.back();
-  newIndicesAccessor.bufferView = static_cast<int>(indexBufferViewIndex);
-  newIndicesAccessor.byteOffset = 0;
-  newIndicesAccessor.count = int64_t(indices.size());
-  newIndicesAccessor.componentType = Accessor::ComponentType::UNSIGNED_INT;
-  newIndicesAccessor.type = Accessor::Type::SCALAR;
+    // The vertex map is no longer needed, so release it before the next
+    // child's buffers are allocated.
+    child.vertexMap = {};
 
-  // Populate the buffers
-  Buffer& vertexBuffer = model.buffers[vertexBufferIndex];
-  vertexBuffer.cesium.data.resize(newVertexFloats.size() * sizeof(float));
-  float* pAsFloats = reinterpret_cast<float*>(vertexBuffer.cesium.data.data());
-  std::copy(newVertexFloats.begin(), newVertexFloats.end(), pAsFloats);
-  vertexBuffer.byteLength = vertexBufferView.byteLength =
-      int64_t(vertexBuffer.cesium.data.size());
-  vertexBufferView.byteStride = vertexSizeFloats * int64_t(sizeof(float));
+    // The copied edges of the parent don't apply to this child.
+    primitive.extensions.erase(ExtensionCesiumTileEdges::ExtensionName);
+
+    // create mesh with skirt, or with tile edges if the parent had no skirt
+    std::optional<SkirtMeshMetadata> skirtMeshMetadata;
+    std::optional<SortedEdgeIndices> sortedEdgeIndices;
+    if (hasSkirt) {
+      skirtMeshMetadata = std::make_optional<SkirtMeshMetadata>();
+      skirtMeshMetadata->noSkirtIndicesBegin = 0;
+      skirtMeshMetadata->noSkirtIndicesCount =
+          static_cast<uint32_t>(indices.size());
+      skirtMeshMetadata->noSkirtVerticesBegin = 0;
+      skirtMeshMetadata->noSkirtVerticesCount =
+          uint32_t(newVertexFloats.size() / size_t(child.vertexSizeFloats));
+      skirtMeshMetadata->meshCenter = parentSkirtMeshMetadata->meshCenter;
+      computeSkirtHeights(
+          target.childID,
+          *skirtMeshMetadata,
+          *parentSkirtMeshMetadata);
+      sortedEdgeIndices =
+          sortEdgeIndices(child.edgeIndices, hasInvertedVCoordinate);
+      if (!parentHasTileEdges) {
+        addSkirts(
+            newVertexFloats,
+            indices,
+            child.attributes,
+            *skirtMeshMetadata,
+            *sortedEdgeIndices,
+            child.vertexSizeFloats,
+            child.positionAttributeIndex,
+            ellipsoid);
+      }
+    }
 
-  Buffer& indexBuffer = model.buffers[indexBufferIndex];
-  indexBuffer.cesium.data.resize(indices.size() * sizeof(uint32_t));
-  uint32_t* pAsUint32s =
-      reinterpret_cast<uint32_t*>(indexBuffer.cesium.data.data());
-  std::copy(indices.begin(), indices.end(), pAsUint32s);
-  indexBuffer.byteLength = indexBufferView.byteLength =
-      int64_t(indexBuffer.cesium.data.size());
+    if (newVertexFloats.empty() || indices.empty()) {
+      continue;
+    }
 
-  scaleWaterMask(primitive, childID);
+    // Update the accessor vertex counts and min/max values
+    const int64_t numberOfVertices =
+        int64_t(newVertexFloats.size()) / child.vertexSizeFloats;
+    for (const FloatVertexAttribute& attribute : child.attributes) {
+      Accessor& accessor =
+          model.accessors[static_cast<size_t>(attribute.accessorIndex)];
+      accessor.count = numberOfVertices;
+      accessor.min = attribute.minimums;
+      accessor.max = attribute.maximums;
+    }
 
-  // add skirts to extras to be upsampled later if needed
-  if (hasSkirt) {
-    CesiumUtility::JsonValue::Object extras =
-        SkirtMeshMetadata::createGltfExtras(*skirtMeshMetadata);
-    extras.merge(std::move(primitive.extras));
-    primitive.extras = std::move(extras);
-  }
+    // Add an accessor for the indices
+    const size_t indexAccessorIndex = model.accessors.size();
+    model.accessors.emplace_back();
+    Accessor& newIndicesAccessor = model.accessors.back();
+    newIndicesAccessor.bufferView =
+        static_cast<int>(child.indexBufferViewIndex);
+    newIndicesAccessor.byteOffset = 0;
+    newIndicesAccessor.count = int64_t(indices.size());
+    newIndicesAccessor.componentType = Accessor::ComponentType::UNSIGNED_INT;
+    newIndicesAccessor.type = Accessor::Type::SCALAR;
+
+    // Populate the buffers
+    BufferView& vertexBufferView =
+        model.bufferViews[child.vertexBufferViewIndex];
+    Buffer& vertexBuffer = model.buffers[child.vertexBufferIndex];
+    vertexBuffer.cesium.data.resize(newVertexFloats.size() * sizeof(float));
+    float* pAsFloats =
+        reinterpret_cast<float*>(vertexBuffer.cesium.data.data());
+    std::copy(newVertexFloats.begin(), newVertexFloats.end(), pAsFloats);
+    vertexBuffer.byteLength = vertexBufferView.byteLength =
+        int64_t(vertexBuffer.cesium.data.size());
+    vertexBufferView.byteStride =
+        child.vertexSizeFloats * int64_t(sizeof(float));
+
+    BufferView& indexBufferView = model.bufferViews[child.indexBufferViewIndex];
+    Buffer& indexBuffer = model.buffers[child.indexBufferIndex];
+    indexBuffer.cesium.data.resize(indices.size() * sizeof(uint32_t));
+    uint32_t* pAsUint32s =
+        reinterpret_cast<uint32_t*>(indexBuffer.cesium.data.data());
+    std::copy(indices.begin(), indices.end(), pAsUint32s);
+    indexBuffer.byteLength = indexBufferView.byteLength =
+        int64_t(indexBuffer.cesium.data.size());
+
+    // Release the working copies now that they're in the buffers.
+    newVertexFloats = {};
+    indices = {};
+
+    scaleWaterMask(primitive, target.childID);
+
+    if (parentHasTileEdges && sortedEdgeIndices) {
+      addTileEdges(model, primitive, *sortedEdgeIndices);
+    }
 
-  primitive.indices = static_cast<int>(indexAccessorIndex);
+    // add skirts to extras to be upsampled later if needed
+    if (hasSkirt) {
+      CesiumUtility::JsonValue::Object extras =
+          SkirtMeshMetadata::createGltfExtras(*skirtMeshMetadata);
+      extras.merge(std::move(primitive.extras));
+      primitive.extras = std::move(extras);
+    }
 
-  return true;
+    primitive.indices = static_cast<int>(indexAccessorIndex);
+    target.keep = true;
+  }
 }
 
 uint32_t getOrCreateVertex(
@@ -1704,21 +2018,10 @@ void addSkirt(
   }
 }
 
-void addSkirts(
-    std::vector<float>& output,
-    std::vector<uint32_t>& indices,
-    std::vector<FloatVertexAttribute>& attributes,
+void computeSkirtHeights(
     CesiumGeometry::UpsampledQuadtreeNode childID,
     SkirtMeshMetadata& currentSkirt,
-    const SkirtMeshMetadata& parentSkirt,
-    EdgeIndices& edgeIndices,
-    int64_t vertexSizeFloats,
-    int32_t positionAttributeIndex,
-    bool hasInvertedVCoordinate,
-    const CesiumGeospatial::Ellipsoid& ellipsoid) {
-  CESIUM_TRACE("addSkirts");
-
-  const glm::dvec3 center = currentSkirt.meshCenter;
+    const SkirtMeshMetadata& parentSkirt) {
   double shortestSkirtHeight =
       glm::min(parentSkirt.skirtWestHeight, parentSkirt.skirtEastHeight);
   shortestSkirtHeight =
@@ -1726,171 +2029,188 @@ void addSkirts(
   shortestSkirtHeight =
       glm::min(shortestSkirtHeight, parentSkirt.skirtNorthHeight);
 
-  // west
+  // The edges shared with the parent keep its skirt heights.
   if (isWestChild(childID)) {
     currentSkirt.skirtWestHeight = parentSkirt.skirtWestHeight;
   } else {
     currentSkirt.skirtWestHeight = shortestSkirtHeight * 0.5;
   }
 
-  std::vector<uint32_t> sortEdgeIndices(edgeIndices.west.size());
+  if (isSouthChild(childID)) {
+    currentSkirt.skirtSouthHeight = parentSkirt.skirtSouthHeight;
+  } else {
+    currentSkirt.skirtSouthHeight = shortestSkirtHeight * 0.5;
+  }
+
+  if (!isWestChild(childID)) {
+    currentSkirt.skirtEastHeight = parentSkirt.skirtEastHeight;
+  } else {
+    currentSkirt.skirtEastHeight = shortestSkirtHeight * 0.5;
+  }
+
+  if (!isSouthChild(childID)) {
+    currentSkirt.skirtNorthHeight = parentSkirt.skirtNorthHeight;
+  } else {
+    currentSkirt.skirtNorthHeight = shortestSkirtHeight * 0.5;
+  }
+}
+
+SortedEdgeIndices
+sortEdgeIndices(EdgeIndices& edgeIndices, bool hasInvertedVCoordinate) {
+  const auto getIndex = [](const EdgeVertex& v) { return v.index; };
+  SortedEdgeIndices result;
+
+  // west
   std::sort(
       edgeIndices.west.begin(),
       edgeIndices.west.end(),
       [](const EdgeVertex& lhs, const EdgeVertex& rhs) {
         return lhs.uv.y < rhs.uv.y;
       });
+  result.west.resize(edgeIndices.west.size());
   std::transform(
       edgeIndices.west.begin(),
       edgeIndices.west.end(),
-      sortEdgeIndices.begin(),
-      [](const EdgeVertex& v) { return v.index; });
-  addSkirt(
-      output,
-      indices,
-      attributes,
-      sortEdgeIndices,
-      center,
-      currentSkirt.skirtWestHeight,
-      vertexSizeFloats,
-      positionAttributeIndex,
-      ellipsoid);
+      result.west.begin(),
+      getIndex);
 
   // south
-  if (isSouthChild(childID)) {
-    currentSkirt.skirtSouthHeight = parentSkirt.skirtSouthHeight;
-  } else {
-    currentSkirt.skirtSouthHeight = shortestSkirtHeight * 0.5;
-  }
-
-  sortEdgeIndices.resize(edgeIndices.south.size());
   std::sort(
       edgeIndices.south.begin(),
       edgeIndices.south.end(),
       [](const EdgeVertex& lhs, const EdgeVertex& rhs) {
         return lhs.uv.x > rhs.uv.x;
       });
+  result.south.resize(edgeIndices.south.size());
   if (hasInvertedVCoordinate) {
     std::transform(
         edgeIndices.south.rbegin(),
         edgeIndices.south.rend(),
-        sortEdgeIndices.begin(),
-        [](const EdgeVertex& v) { return v.index; });
+        result.south.begin(),
+        getIndex);
   } else {
     std::transform(
         edgeIndices.south.begin(),
         edgeIndices.south.end(),
-        sortEdgeIndices.begin(),
-        [](const EdgeVertex& v) { return v.index; });
+        result.south.begin(),
+        getIndex);
   }
 
-  addSkirt(
-      output,
-      indices,
-      attributes,
-      sortEdgeIndices,
-      center,
-      currentSkirt.skirtSouthHeight,
-      vertexSizeFloats,
-      positionAttributeIndex,
-      ellipsoid);
-
   // east
-  if (!isWestChild(childID)) {
-    currentSkirt.skirtEastHeight = parentSkirt.skirtEastHeight;
-  } else {
-    currentSkirt.skirtEastHeight = shortestSkirtHeight * 0.5;
-  }
-
-  sortEdgeIndices.resize(edgeIndices.east.size());
   std::sort(
       edgeIndices.east.begin(),
       edgeIndices.east.end(),
       [](const EdgeVertex& lhs, const EdgeVertex& rhs) {
         return lhs.uv.y > rhs.uv.y;
       });
+  result.east.resize(edgeIndices.east.size());
   std::transform(
       edgeIndices.east.begin(),
       edgeIndices.east.end(),
-      sortEdgeIndices.begin(),
-      [](const EdgeVertex& v) { return v.index; });
-  addSkirt(
-      output,
-      indices,
-      attributes,
-      sortEdgeIndices,
-      center,
-      currentSkirt.skirtEastHeight,
-      vertexSizeFloats,
-      positionAttributeIndex,
-      ellipsoid);
+      result.east.begin(),
+      getIndex);
 
   // north
-  if (!isSouthChild(childID)) {
-    currentSkirt.skirtNorthHeight = parentSkirt.skirtNorthHeight;
-  } else {
-    currentSkirt.skirtNorthHeight = shortestSkirtHeight * 0.5;
-  }
-
-  sortEdgeIndices.resize(edgeIndices.north.size());
   std::sort(
       edgeIndices.north.begin(),
       edgeIndices.north.end(),
       [](const EdgeVertex& lhs, const EdgeVertex& rhs) {
         return lhs.uv.x < rhs.uv.x;
       });
+  result.north.resize(edgeIndices.north.size());
   if (hasInvertedVCoordinate) {
     std::transform(
         edgeIndices.north.rbegin(),
         edgeIndices.north.rend(),
-        sortEdgeIndices.begin(),
-        [](const EdgeVertex& v) { return v.index; });
+        result.north.begin(),
+        getIndex);
   } else {
     std::transform(
         edgeIndices.north.begin(),
         edgeIndices.north.end(),
-        sortEdgeIndices.begin(),
-        [](const EdgeVertex& v) { return v.index; });
+        result.north.begin(),
+        getIndex);
   }
 
-  addSkirt(
-      output,
-      indices,
-      attributes,
-      sortEdgeIndices,
-      center,
-      currentSkirt.skirtNorthHeight,
-      vertexSizeFloats,
-      positionAttributeIndex,
-      ellipsoid);
+  return result;
 }
 
-bool upsamplePrimitiveForRasterOverlays(
-    const Model& parentModel,
+void addSkirts(
+    std::vector<float>& output,
+    std::vector<uint32_t>& indices,
+    std::vector<FloatVertexAttribute>& attributes,
+    const SkirtMeshMetadata& skirt,
+    const SortedEdgeIndices& edgeIndices,
+    int64_t vertexSizeFloats,
+    int32_t positionAttributeIndex,
+    const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  CESIUM_TRACE("addSkirts");
+
+  const std::pair<const std::vector<uint32_t>*, double> edges[] = {
+      {&edgeIndices.west, skirt.skirtWestHeight},
+      {&edgeIndices.south, skirt.skirtSouthHeight},
+      {&edgeIndices.east, skirt.skirtEastHeight},
+      {&edgeIndices.north, skirt.skirtNorthHeight}};
+  for (const auto& [pEdge, skirtHeight] : edges) {
+    addSkirt(
+        output,
+        indices,
+        attributes,
+        *pEdge,
+        skirt.meshCenter,
+        skirtHeight,
+        vertexSizeFloats,
+        positionAttributeIndex,
+        ellipsoid);
+  }
+}
+
+void addTileEdges(
     Model& model,
-    Mesh& mesh,
     MeshPrimitive& primitive,
-    CesiumGeometry::UpsampledQuadtreeNode childID,
+    const SortedEdgeIndices& edgeIndices) {
+  TileEdges::addToPrimitive(
+      model,
+      primitive,
+      edgeIndices.west,
+      edgeIndices.south,
+      edgeIndices.east,
+      edgeIndices.north);
+}
+
+void upsamplePrimitiveForRasterOverlays(
+    const Model& parentModel,
+    std::span<UpsampleTarget> targets,
     bool hasInvertedVCoordinate,
     const std::string_view& textureCoordinateAttributeBaseName,
     int32_t textureCoordinateIndex,
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
+  if (targets.empty()) {
+    return;
+  }
+
+  // Every target's primitive starts as a copy of the same parent primitive.
+  const MeshPrimitive& primitive = *targets[0].pPrimitive;
+
   if (primitive.mode == MeshPrimitive::Mode::POINTS) {
-    return upsamplePointsPrimitiveForRasterOverlays(
-        parentModel,
-        model,
-        primitive,
-        childID,
-        hasInvertedVCoordinate,
-        textureCoordinateAttributeBaseName,
-        textureCoordinateIndex);
+    for (UpsampleTarget& target : targets) {
+      target.keep = upsamplePointsPrimitiveForRasterOverlays(
+          parentModel,
+          *target.pModel,
+          *target.pPrimitive,
+          target.childID,
+          hasInvertedVCoordinate,
+          textureCoordinateAttributeBaseName,
+          textureCoordinateIndex);
+    }
+    return;
   } else if (
       primitive.mode != MeshPrimitive::Mode::TRIANGLES &&
       primitive.mode != MeshPrimitive::Mode::TRIANGLE_FAN &&
       primitive.mode != MeshPrimitive::Mode::TRIANGLE_STRIP) {
     // Not triangles, so we don't know how to divide this primitive
     // (yet). So remove it.
-    return false;
+    return;
   }
 
   if (primitive.indices < 0 ||
@@ -1898,7 +2218,7 @@ bool upsamplePrimitiveForRasterOverlays(
     const auto& positionIt = primitive.attributes.find("POSITION");
     if (positionIt == primitive.attributes.end()) {
       // No position buffer - nothing we can do here
-      return false;
+      return;
     }
 
     // No indices buffer - pick the smallest indices type that will fit all
@@ -1907,53 +2227,42 @@ bool upsamplePrimitiveForRasterOverlays(
         parentModel.getSafe(parentModel.accessors, positionIt->second);
     if (accessor.count < 1) {
       // Invalid accessor
-      return false;
+      return;
     } else if (accessor.count < 0xff) {
-      return upsampleTrianglesPrimitiveForRasterOverlays<uint8_t>(
+      upsampleTrianglesPrimitiveForRasterOverlays<uint8_t>(
           parentModel,
-          model,
-          mesh,
-          primitive,
-          childID,
+          targets,
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
           ellipsoid);
     } else if (accessor.count < 0xffff) {
-      return upsampleTrianglesPrimitiveForRasterOverlays<uint16_t>(
+      upsampleTrianglesPrimitiveForRasterOverlays<uint16_t>(
           parentModel,
-          model,
-          mesh,
-          primitive,
-          childID,
+          targets,
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
           ellipsoid);
     } else {
-      return upsampleTrianglesPrimitiveForRasterOverlays<uint32_t>(
+      upsampleTrianglesPrimitiveForRasterOverlays<uint32_t>(
           parentModel,
-          model,
-          mesh,
-          primitive,
-          childID,
+          targets,
           hasInvertedVCoordinate,
           textureCoordinateAttributeBaseName,
           textureCoordinateIndex,
           ellipsoid);
     }
+    return;
   }
 
   const Accessor& indicesAccessorGltf =
       parentModel.accessors[static_cast<size_t>(primitive.indices)];
   if (indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_BYTE) {
-    return upsampleTrianglesPrimitiveForRasterOverlays<uint8_t>(
+    upsampleTrianglesPrimitiveForRasterOverlays<uint8_t>(
         parentModel,
-        model,
-        mesh,
-        primitive,
-        childID,
+        targets,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
@@ -1961,12 +2270,9 @@ bool upsamplePrimitiveForRasterOverlays(
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_SHORT) {
-    return upsampleTrianglesPrimitiveForRasterOverlays<uint16_t>(
+    upsampleTrianglesPrimitiveForRasterOverlays<uint16_t>(
         parentModel,
-        model,
-        mesh,
-        primitive,
-        childID,
+        targets,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
@@ -1974,19 +2280,14 @@ bool upsamplePrimitiveForRasterOverlays(
   } else if (
       indicesAccessorGltf.componentType ==
       Accessor::ComponentType::UNSIGNED_INT) {
-    return upsampleTrianglesPrimitiveForRasterOverlays<uint32_t>(
+    upsampleTrianglesPrimitiveForRasterOverlays<uint32_t>(
         parentModel,
-        model,
-        mesh,
-        primitive,
-        childID,
+        targets,
         hasInvertedVCoordinate,
         textureCoordinateAttributeBaseName,
         textureCoordinateIndex,
         ellipsoid);
   }
-
-  return false;
 }
 
 // Copy a buffer view from a parent to a child. Create a new buffer on the
@@ -1,6 +1,7 @@
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/IAssetAccessor.h>
 #include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/CartographicPolygonIndex.h>
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumGeospatial/Projection.h>
@@ -19,6 +20,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -34,6 +36,7 @@ void rasterizePolygons(
     const CesiumGeospatial::GlobeRectangle& rectangle,
     const glm::dvec2& textureSize,
     const std::vector<CartographicPolygon>& cartographicPolygons,
+    const CartographicPolygonIndex& polygonIndex,
     bool invertSelection) {
 
   CesiumImage::ImageAsset& image = loaded.pImage.emplace();
@@ -50,9 +53,7 @@ void rasterizePolygons(
   }
 
   // create a 1x1 mask if the rectangle is completely inside a polygon
-  if (CartographicPolygon::rectangleIsWithinPolygons(
-          rectangle,
-          cartographicPolygons)) {
+  if (polygonIndex.rectangleIsWithinPolygons(rectangle)) {
     loaded.moreDetailAvailable = false;
     image.width = 1;
     image.height = 1;
@@ -171,6 +172,7 @@ class CESIUMRASTEROVERLAYS_API RasterizedPolygonsTileProvider final
 
 private:
   std::vector<CartographicPolygon> _polygons;
+  std::shared_ptr<const CartographicPolygonIndex> _pPolygonIndex;
   bool _invertSelection;
 
 public:
@@ -179,6 +181,7 @@ public:
       const CreateRasterOverlayTileProviderParameters& parameters,
       const CesiumGeospatial::Projection& projection,
       const std::vector<CartographicPolygon>& polygons,
+      const std::shared_ptr<const CartographicPolygonIndex>& pPolygonIndex,
       bool invertSelection)
       : RasterOverlayTileProvider(
             pCreator,
@@ -189,6 +192,7 @@ public:
                 projection,
                 CesiumGeospatial::GlobeRectangle::MAXIMUM)),
         _polygons(polygons),
+        _pPolygonIndex(pPolygonIndex),
         _invertSelection(invertSelection) {}
 
   virtual CesiumAsync::Future<LoadedRasterOverlayImage>
@@ -202,6 +206,7 @@ public:
 
     return this->getAsyncSystem().runInWorkerThread(
         [&polygons = this->_polygons,
+         pPolygonIndex = this->_pPolygonIndex,
          invertSelection = this->_invertSelection,
          projection = this->getProjection(),
          rectangle = overlayTile.getRectangle(),
@@ -217,6 +222,7 @@ public:
               tileRectangle,
               textureSize,
               polygons,
+              *pPolygonIndex,
               invertSelection);
 
           return result;
@@ -233,6 +239,7 @@ RasterizedPolygonsOverlay::RasterizedPolygonsOverlay(
     const RasterOverlayOptions& overlayOptions)
     : RasterOverlay(name, overlayOptions),
       _polygons(polygons),
+      _pPolygonIndex(std::make_shared<CartographicPolygonIndex>(polygons)),
       _invertSelection(invertSelection),
       _ellipsoid(ellipsoid),
       _projection(projection) {}
@@ -251,6 +258,7 @@ RasterizedPolygonsOverlay::createTileProvider(
                   parameters,
                   this->_projection,
                   this->_polygons,
+                  this->_pPolygonIndex,
                   this->_invertSelection)));
 }
 
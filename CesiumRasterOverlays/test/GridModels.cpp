@@ -0,0 +1,200 @@
+#include "GridModels.h"
+
+#include <CesiumGeospatial/Cartographic.h>
+#include <CesiumGeospatial/Ellipsoid.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/GlobeTransforms.h>
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumGeospatial/WebMercatorProjection.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/Mesh.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumGltfContent/SkirtMeshMetadata.h>
+
+#include <glm/ext/matrix_double4x4.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_float2.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/trigonometric.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumGltfContent;
+
+namespace CesiumNativeTests {
+
+Model createPointGridModel(uint32_t verticesPerSide, float size) {
+  std::vector<glm::vec3> positions;
+  positions.reserve(size_t(verticesPerSide) * size_t(verticesPerSide));
+  const float step = size / float(verticesPerSide - 1);
+  for (uint32_t y = 0; y < verticesPerSide; ++y) {
+    for (uint32_t x = 0; x < verticesPerSide; ++x) {
+      positions.emplace_back(
+          float(x) * step - size * 0.5f,
+          float(y) * step - size * 0.5f,
+          float((x * 7 + y * 13) % 50));
+    }
+  }
+
+  Model model;
+  Buffer& buffer = model.buffers.emplace_back();
+  buffer.cesium.data.resize(positions.size() * sizeof(glm::vec3));
+  std::memcpy(
+      buffer.cesium.data.data(),
+      positions.data(),
+      buffer.cesium.data.size());
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+  BufferView& bufferView = model.bufferViews.emplace_back();
+  bufferView.buffer = 0;
+  bufferView.byteLength = buffer.byteLength;
+
+  Accessor& accessor = model.accessors.emplace_back();
+  accessor.bufferView = 0;
+  accessor.componentType = Accessor::ComponentType::FLOAT;
+  accessor.type = Accessor::Type::VEC3;
+  accessor.count = int64_t(positions.size());
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.mode = MeshPrimitive::Mode::POINTS;
+  primitive.attributes["POSITION"] = 0;
+
+  return model;
+}
+
+glm::dmat4 createModelToEcef() {
+  return GlobeTransforms::eastNorthUpToFixedFrame(
+      Ellipsoid::WGS84.cartographicToCartesian(
+          Cartographic::fromDegrees(-75.14777, 39.95021, 200.0)),
+      Ellipsoid::WGS84);
+}
+
+std::vector<Projection> createProjections() {
+  return {
+      GeographicProjection(Ellipsoid::WGS84),
+      WebMercatorProjection(Ellipsoid::WGS84)};
+}
+
+Model createTerrainGridModel(uint32_t verticesPerSide, bool withSkirt) {
+  const Ellipsoid& ellipsoid = CesiumGeospatial::Ellipsoid::WGS84;
+  const Cartographic southwest{glm::radians(110.0), glm::radians(32.0), 0.0};
+  const double size = glm::radians(1.0);
+  const glm::dvec3 center = ellipsoid.cartographicToCartesian(Cartographic(
+      southwest.longitude + size * 0.5,
+      southwest.latitude + size * 0.5,
+      0.0));
+
+  std::vector<glm::vec3> positions;
+  std::vector<glm::vec2> uvs;
+  std::vector<uint32_t> indices;
+  const float step = 1.0f / float(verticesPerSide - 1);
+  for (uint32_t y = 0; y < verticesPerSide; ++y) {
+    for (uint32_t x = 0; x < verticesPerSide; ++x) {
+      const glm::vec2 uv(float(x) * step, float(y) * step);
+      const Cartographic position(
+          southwest.longitude + size * double(uv.x),
+          southwest.latitude + size * double(uv.y),
+          100.0 * std::sin(double(x + y)));
+      positions.emplace_back(
+          glm::vec3(ellipsoid.cartographicToCartesian(position) - center));
+      uvs.emplace_back(uv);
+    }
+  }
+  for (uint32_t y = 0; y + 1 < verticesPerSide; ++y) {
+    for (uint32_t x = 0; x + 1 < verticesPerSide; ++x) {
+      const uint32_t i = y * verticesPerSide + x;
+      indices.insert(
+          indices.end(),
+          {i,
+           i + 1,
+           i + verticesPerSide,
+           i + 1,
+           i + verticesPerSide + 1,
+           i + verticesPerSide});
+    }
+  }
+
+  Model model;
+  Buffer& buffer = model.buffers.emplace_back();
+  const size_t positionsSize = positions.size() * sizeof(glm::vec3);
+  const size_t uvsSize = uvs.size() * sizeof(glm::vec2);
+  const size_t indicesSize = indices.size() * sizeof(uint32_t);
+  buffer.cesium.data.resize(positionsSize + uvsSize + indicesSize);
+  std::memcpy(buffer.cesium.data.data(), positions.data(), positionsSize);
+  std::memcpy(buffer.cesium.data.data() + positionsSize, uvs.data(), uvsSize);
+  std::memcpy(
+      buffer.cesium.data.data() + positionsSize + uvsSize,
+      indices.data(),
+      indicesSize);
+  buffer.byteLength = int64_t(buffer.cesium.data.size());
+
+  auto addAccessor = [&model](
+                         size_t byteOffset,
+                         size_t byteLength,
+                         int64_t count,
+                         int32_t componentType,
+                         const std::string& type) {
+    BufferView& bufferView = model.bufferViews.emplace_back();
+    bufferView.buffer = 0;
+    bufferView.byteOffset = int64_t(byteOffset);
+    bufferView.byteLength = int64_t(byteLength);
+
+    Accessor& accessor = model.accessors.emplace_back();
+    accessor.bufferView = int32_t(model.bufferViews.size() - 1);
+    accessor.count = count;
+    accessor.componentType = componentType;
+    accessor.type = type;
+    return int32_t(model.accessors.size() - 1);
+  };
+
+  MeshPrimitive& primitive =
+      model.meshes.emplace_back().primitives.emplace_back();
+  primitive.mode = MeshPrimitive::Mode::TRIANGLES;
+  primitive.attributes["POSITION"] = addAccessor(
+      0,
+      positionsSize,
+      int64_t(positions.size()),
+      Accessor::ComponentType::FLOAT,
+      Accessor::Type::VEC3);
+  primitive.attributes["_CESIUMOVERLAY_0"] = addAccessor(
+      positionsSize,
+      uvsSize,
+      int64_t(uvs.size()),
+      Accessor::ComponentType::FLOAT,
+      Accessor::Type::VEC2);
+  primitive.indices = addAccessor(
+      positionsSize + uvsSize,
+      indicesSize,
+      int64_t(indices.size()),
+      Accessor::ComponentType::UNSIGNED_INT,
+      Accessor::Type::SCALAR);
+
+  if (withSkirt) {
+    SkirtMeshMetadata skirtMeshMetadata;
+    skirtMeshMetadata.noSkirtIndicesBegin = 0;
+    skirtMeshMetadata.noSkirtIndicesCount = uint32_t(indices.size());
+    skirtMeshMetadata.noSkirtVerticesBegin = 0;
+    skirtMeshMetadata.noSkirtVerticesCount = uint32_t(positions.size());
+    skirtMeshMetadata.meshCenter = center;
+    skirtMeshMetadata.skirtWestHeight = 50.0;
+    skirtMeshMetadata.skirtSouthHeight = 50.0;
+    skirtMeshMetadata.skirtEastHeight = 50.0;
+    skirtMeshMetadata.skirtNorthHeight = 50.0;
+    primitive.extras = SkirtMeshMetadata::createGltfExtras(skirtMeshMetadata);
+  }
+
+  return model;
+}
+
+} // namespace CesiumNativeTests
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumGltf/Model.h>
+
+#include <glm/ext/matrix_double4x4.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace CesiumNativeTests {
+
+// Creates a model with a single primitive whose positions form a square grid
+// of points, `size` meters on a side, in a local east-north-up frame.
+CesiumGltf::Model createPointGridModel(uint32_t verticesPerSide, float size);
+
+// Creates the transformation from the local frame of the point grid to ECEF.
+glm::dmat4 createModelToEcef();
+
+// Creates one projection of each type.
+std::vector<CesiumGeospatial::Projection> createProjections();
+
+// Creates a model with a single primitive that is a regular grid of
+// triangles, like a terrain tile, with texture coordinates spanning the tile.
+CesiumGltf::Model
+createTerrainGridModel(uint32_t verticesPerSide, bool withSkirt);
+
+} // namespace CesiumNativeTests
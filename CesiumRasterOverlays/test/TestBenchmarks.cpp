@@ -0,0 +1,111 @@
+#include "GridModels.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGeometry/QuadtreeTileID.h>
+#include <CesiumGeospatial/GeographicProjection.h>
+#include <CesiumGeospatial/Projection.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumRasterOverlays/RasterOverlayUtilities.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
+#include <spdlog/spdlog.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <variant>
+
+using namespace CesiumAsync;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+
+TEST_CASE(
+    "RasterOverlayUtilities::createRasterOverlayTextureCoordinates benchmark" *
+    doctest::skip(true)) {
+  AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+
+  const Model original = createPointGridModel(1024, 10000.0f);
+  const glm::dmat4 modelToEcef = createModelToEcef();
+  const double vertexCount = double(original.accessors[0].count);
+
+  for (const Projection& projection : createProjections()) {
+    const std::string projectionName =
+        std::holds_alternative<GeographicProjection>(projection)
+            ? "Geographic"
+            : "WebMercator";
+
+    for (bool useWorkers : {false, true}) {
+      Model model = original;
+      const std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+      if (useWorkers) {
+        RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+            asyncSystem,
+            model,
+            modelToEcef,
+            std::nullopt,
+            {projection});
+      } else {
+        RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+            model,
+            modelToEcef,
+            std::nullopt,
+            {projection});
+      }
+      const double seconds =
+          std::chrono::duration<double>(
+              std::chrono::steady_clock::now() - start)
+              .count();
+
+      spdlog::info(
+          "{} ({}): {:.2f} million vertices/sec",
+          projectionName,
+          useWorkers ? "worker threads" : "single thread",
+          vertexCount / seconds / 1.0e6);
+    }
+  }
+}
+
+TEST_CASE(
+    "upsampleGltfForRasterOverlayChildren benchmark" * doctest::skip(true)) {
+  // A quantized-mesh terrain tile typically has about 65x65 vertices.
+  const Model model = createTerrainGridModel(65, true);
+  const CesiumGeometry::QuadtreeTileID parentID(10, 300, 200);
+  const int iterations = 100;
+
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    for (uint32_t child = 0; child < 4; ++child) {
+      RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+          model,
+          CesiumGeometry::UpsampledQuadtreeNode{CesiumGeometry::QuadtreeTileID(
+              parentID.level + 1,
+              parentID.x * 2 + child % 2,
+              parentID.y * 2 + child / 2)});
+    }
+  }
+  spdlog::info(
+      "upsampleGltfForRasterOverlays: {:.1f} parent tiles per second",
+      iterations / std::chrono::duration_cast<std::chrono::duration<double>>(
+                       std::chrono::steady_clock::now() - start)
+                       .count());
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < iterations; ++i) {
+    RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+        model,
+        parentID);
+  }
+  spdlog::info(
+      "upsampleGltfForRasterOverlayChildren: {:.1f} parent tiles per second",
+      iterations / std::chrono::duration_cast<std::chrono::duration<double>>(
+                       std::chrono::steady_clock::now() - start)
+                       .count());
+}
@@ -0,0 +1,95 @@
+#include "GridModels.h"
+
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGeospatial/BoundingRegion.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumGltf/Accessor.h>
+#include <CesiumGltf/Buffer.h>
+#include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/Mesh.h>
+#include <CesiumGltf/MeshPrimitive.h>
+#include <CesiumGltf/Model.h>
+#include <CesiumNativeTests/ThreadTaskProcessor.h>
+#include <CesiumRasterOverlays/RasterOverlayDetails.h>
+#include <CesiumRasterOverlays/RasterOverlayUtilities.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/matrix_double4x4.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+using namespace CesiumAsync;
+using namespace CesiumGeospatial;
+using namespace CesiumGltf;
+using namespace CesiumNativeTests;
+using namespace CesiumRasterOverlays;
+
+TEST_CASE("RasterOverlayUtilities::createRasterOverlayTextureCoordinates "
+          "with worker threads") {
+  AsyncSystem asyncSystem(std::make_shared<ThreadTaskProcessor>());
+
+  // Large enough to be split into several batches.
+  const Model original = createPointGridModel(200, 10000.0f);
+  const glm::dmat4 modelToEcef = createModelToEcef();
+
+  Model sequential = original;
+  std::optional<RasterOverlayDetails> sequentialDetails =
+      RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          sequential,
+          modelToEcef,
+          std::nullopt,
+          createProjections(),
+          true);
+
+  Model parallel = original;
+  std::optional<RasterOverlayDetails> parallelDetails =
+      RasterOverlayUtilities::createRasterOverlayTextureCoordinates(
+          asyncSystem,
+          parallel,
+          modelToEcef,
+          std::nullopt,
+          createProjections(),
+          true);
+
+  REQUIRE(sequentialDetails);
+  REQUIRE(parallelDetails);
+
+  const GlobeRectangle& sequentialRectangle =
+      sequentialDetails->boundingRegion.getRectangle();
+  const GlobeRectangle& parallelRectangle =
+      parallelDetails->boundingRegion.getRectangle();
+  CHECK(parallelRectangle.getWest() == sequentialRectangle.getWest());
+  CHECK(parallelRectangle.getSouth() == sequentialRectangle.getSouth());
+  CHECK(parallelRectangle.getEast() == sequentialRectangle.getEast());
+  CHECK(parallelRectangle.getNorth() == sequentialRectangle.getNorth());
+  CHECK(
+      parallelDetails->boundingRegion.getMinimumHeight() ==
+      sequentialDetails->boundingRegion.getMinimumHeight());
+  CHECK(
+      parallelDetails->boundingRegion.getMaximumHeight() ==
+      sequentialDetails->boundingRegion.getMaximumHeight());
+
+  const MeshPrimitive& sequentialPrimitive =
+      sequential.meshes[0].primitives[0];
+  const MeshPrimitive& parallelPrimitive = parallel.meshes[0].primitives[0];
+  for (const char* name : {"_CESIUMOVERLAY_0", "_CESIUMOVERLAY_1"}) {
+    CAPTURE(name);
+    REQUIRE(sequentialPrimitive.attributes.contains(name));
+    REQUIRE(parallelPrimitive.attributes.contains(name));
+
+    const Accessor& sequentialAccessor = sequential.accessors[size_t(
+        sequentialPrimitive.attributes.at(name))];
+    const Accessor& parallelAccessor =
+        parallel.accessors[size_t(parallelPrimitive.attributes.at(name))];
+    CHECK(parallelAccessor.min == sequentialAccessor.min);
+    CHECK(parallelAccessor.max == sequentialAccessor.max);
+
+    const Buffer& sequentialBuffer = sequential.buffers[size_t(
+        sequential.bufferViews[size_t(sequentialAccessor.bufferView)].buffer)];
+    const Buffer& parallelBuffer = parallel.buffers[size_t(
+        parallel.bufferViews[size_t(parallelAccessor.bufferView)].buffer)];
+    CHECK(parallelBuffer.cesium.data == sequentialBuffer.cesium.data);
+  }
+}
@@ -1,3 +1,5 @@
+#include "GridModels.h"
+
 #include <CesiumGeometry/QuadtreeTileID.h>
 #include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/Ellipsoid.h>
@@ -6,6 +8,7 @@
 #include <CesiumGltf/AccessorWriter.h>
 #include <CesiumGltf/Buffer.h>
 #include <CesiumGltf/BufferView.h>
+#include <CesiumGltf/ExtensionCesiumTileEdges.h>
 #include <CesiumGltf/Mesh.h>
 #include <CesiumGltf/MeshPrimitive.h>
 #include <CesiumGltf/Node.h>
@@ -23,9 +26,12 @@
 #include <glm/gtc/epsilon.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <array>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <optional>
 #include <random>
 #include <vector>
 
@@ -36,6 +42,7 @@ using namespace CesiumGltf;
 using namespace CesiumGltfContent;
 using namespace CesiumRasterOverlays;
 using namespace CesiumGltfReader;
+using namespace CesiumNativeTests;
 
 static void checkSkirt(
     const Ellipsoid& ellipsoid,
@@ -1070,6 +1077,53 @@ TEST_CASE("upsampleGltfForRasterOverlay with UNSIGNED_SHORT indices") {
           center,
           skirtHeight * 0.5);
     }
+
+    SUBCASE("Check tile edges are upsampled instead of skirts") {
+      primitive.addExtension<ExtensionCesiumTileEdges>();
+
+      Model upsampledModel =
+          *RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+              model,
+              lowerLeft,
+              false);
+
+      REQUIRE(upsampledModel.meshes.size() == 1);
+      const Mesh& upsampledMesh = upsampledModel.meshes.back();
+
+      REQUIRE(upsampledMesh.primitives.size() == 1);
+      const MeshPrimitive& upsampledPrimitive = upsampledMesh.primitives.back();
+
+      // No skirt vertices are added.
+      AccessorView<glm::vec3> upsampledPosition(
+          upsampledModel,
+          upsampledPrimitive.attributes.at("POSITION"));
+      CHECK(upsampledPosition.size() == 7);
+
+      std::optional<SkirtMeshMetadata> upsampledSkirt =
+          SkirtMeshMetadata::parseFromGltfExtras(upsampledPrimitive.extras);
+      REQUIRE(upsampledSkirt);
+      CHECK(upsampledSkirt->noSkirtVerticesCount == 7);
+      CHECK(upsampledSkirt->skirtWestHeight == skirtHeight);
+      CHECK(upsampledSkirt->skirtEastHeight == skirtHeight * 0.5);
+
+      // The edges are in the order in which skirts would have been added.
+      const ExtensionCesiumTileEdges* pTileEdges =
+          upsampledPrimitive.getExtension<ExtensionCesiumTileEdges>();
+      REQUIRE(pTileEdges);
+      const auto getEdge = [&upsampledModel](int32_t accessor) {
+        AccessorView<uint32_t> view(upsampledModel, accessor);
+        REQUIRE(view.status() == AccessorViewStatus::Valid);
+        std::vector<uint32_t> edge;
+        for (int64_t i = 0; i < view.size(); ++i) {
+          edge.emplace_back(view[i]);
+        }
+        return edge;
+      };
+      CHECK(getEdge(pTileEdges->left) == std::vector<uint32_t>{0, 3});
+      CHECK(getEdge(pTileEdges->bottom) == std::vector<uint32_t>{1, 4, 0});
+      CHECK(getEdge(pTileEdges->right) == std::vector<uint32_t>{5, 1, 4});
+      CHECK(getEdge(pTileEdges->top) == std::vector<uint32_t>{3, 2, 6, 5});
+    }
   }
 
   SUBCASE("Check water mask properties come through on their own") {
@@ -2390,3 +2444,64 @@ TEST_CASE("upsampleGltfForRasterOverlay with random points") {
     }
   }
 }
+
+static void checkUpsampleChildren(bool withSkirt) {
+  const Model model = createTerrainGridModel(17, withSkirt);
+  const CesiumGeometry::QuadtreeTileID parentID(3, 5, 2);
+
+  std::array<std::optional<Model>, 4> children =
+      RasterOverlayUtilities::upsampleGltfForRasterOverlayChildren(
+          model,
+          parentID);
+
+  const std::array<CesiumGeometry::QuadtreeTileID, 4> childIDs{
+      CesiumGeometry::QuadtreeTileID(4, 10, 4),
+      CesiumGeometry::QuadtreeTileID(4, 11, 4),
+      CesiumGeometry::QuadtreeTileID(4, 10, 5),
+      CesiumGeometry::QuadtreeTileID(4, 11, 5)};
+
+  for (size_t i = 0; i < childIDs.size(); ++i) {
+    std::optional<Model> expected =
+        RasterOverlayUtilities::upsampleGltfForRasterOverlays(
+            model,
+            CesiumGeometry::UpsampledQuadtreeNode{childIDs[i]});
+    REQUIRE(expected);
+    REQUIRE(children[i]);
+
+    const Model& actual = *children[i];
+    REQUIRE(actual.buffers.size() == expected->buffers.size());
+    for (size_t j = 0; j < actual.buffers.size(); ++j) {
+      CHECK(actual.buffers[j].cesium.data == expected->buffers[j].cesium.data);
+    }
+
+    REQUIRE(actual.accessors.size() == expected->accessors.size());
+    for (size_t j = 0; j < actual.accessors.size(); ++j) {
+      CHECK(actual.accessors[j].count == expected->accessors[j].count);
+      CHECK(actual.accessors[j].min == expected->accessors[j].min);
+      CHECK(actual.accessors[j].max == expected->accessors[j].max);
+    }
+
+    REQUIRE(actual.meshes.size() == 1);
+    REQUIRE(actual.meshes[0].primitives.size() == 1);
+    CHECK(
+        actual.meshes[0].primitives[0].attributes ==
+        expected->meshes[0].primitives[0].attributes);
+    CHECK(
+        actual.meshes[0].primitives[0].indices ==
+        expected->meshes[0].primitives[0].indices);
+    CHECK(
+        SkirtMeshMetadata::parseFromGltfExtras(
+            actual.meshes[0].primitives[0].extras)
+            .has_value() == withSkirt);
+  }
+}
+
+TEST_CASE("upsampleGltfForRasterOverlayChildren") {
+  SUBCASE("matches upsampling each child separately") {
+    checkUpsampleChildren(false);
+  }
+
+  SUBCASE("matches upsampling each child separately with skirts") {
+    checkUpsampleChildren(true);
+  }
+}
@@ -3,8 +3,11 @@
 #include <CesiumUtility/Library.h>
 #include <CesiumUtility/Math.h>
 
+#include <glm/ext/vector_uint2_sized.hpp>
 #include <glm/glm.hpp>
 
+#include <vector>
+
 namespace CesiumUtility {
 /**
  * @brief Functions to handle compressed attributes in different formats
@@ -58,6 +61,29 @@ public:
     return AttributeCompression::octDecodeInRange(x, y, rangeMax);
   }
 
+  /**
+   * @brief Gets the decoded and normalized vector of every possible 2 byte
+   * 'oct' encoding, indexed by `y * 256 + x`.
+   *
+   * The table is built the first time it is requested. Looking up many
+   * normals in it is much faster than calling
+   * {@link AttributeCompression::octDecode} for each of them.
+   *
+   * @returns The table of 65536 decoded vectors.
+   */
+  static const std::vector<glm::vec3>& getOctDecodeTable();
+
+  /**
+   * @brief Encodes a normalized 3-component vector in 2 byte 'oct' encoding.
+   *
+   * @param vector The vector to encode. It does not need to be normalized, but
+   * it must not be zero.
+   * @returns The x and y components of the oct-encoded vector.
+   *
+   * @see AttributeCompression::octDecode
+   */
+  static glm::u8vec2 octEncode(const glm::dvec3& vector);
+
   /**
    * @brief Decodes a RGB565-encoded color to a 3-component vector
    * containing the normalized RGB values.
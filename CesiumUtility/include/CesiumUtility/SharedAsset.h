@@ -6,6 +6,7 @@
 #include <CesiumUtility/Library.h>
 
 #include <atomic>
+#include <cstdint>
 
 namespace CesiumAsync {
 
@@ -152,6 +153,9 @@ private:
 
   mutable std::atomic<std::int32_t> _referenceCount{0};
   IDepotOwningAsset<T>* _pDepot{nullptr};
+  // The index of the depot shard that owns this asset. Only meaningful when
+  // _pDepot is not nullptr.
+  std::uint32_t _depotShard{0};
   bool _isInvalidated{false};
 
   // To allow the depot to modify _pDepot.
@@ -0,0 +1,50 @@
+#include <CesiumUtility/AttributeCompression.h>
+#include <CesiumUtility/Math.h>
+
+#include <glm/common.hpp>
+#include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_uint2_sized.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CesiumUtility {
+
+const std::vector<glm::vec3>& AttributeCompression::getOctDecodeTable() {
+  static const std::vector<glm::vec3> table = []() {
+    std::vector<glm::vec3> result(size_t(256) * 256);
+    for (uint32_t y = 0; y < 256; ++y) {
+      for (uint32_t x = 0; x < 256; ++x) {
+        result[y * 256 + x] = glm::vec3(AttributeCompression::octDecode(
+            static_cast<uint8_t>(x),
+            static_cast<uint8_t>(y)));
+      }
+    }
+    return result;
+  }();
+  return table;
+}
+
+glm::u8vec2 AttributeCompression::octEncode(const glm::dvec3& vector) {
+  const double l1Norm =
+      glm::abs(vector.x) + glm::abs(vector.y) + glm::abs(vector.z);
+  if (l1Norm == 0.0) {
+    return glm::u8vec2(128, 128);
+  }
+
+  double x = vector.x / l1Norm;
+  double y = vector.y / l1Norm;
+  if (vector.z < 0.0) {
+    const double oldX = x;
+    x = (1.0 - glm::abs(y)) * Math::signNotZero(oldX);
+    y = (1.0 - glm::abs(oldX)) * Math::signNotZero(y);
+  }
+
+  return glm::u8vec2(
+      static_cast<uint8_t>(Math::toSNorm(x)),
+      static_cast<uint8_t>(Math::toSNorm(y)));
+}
+
+} // namespace CesiumUtility
@@ -3,6 +3,7 @@
 
 #include <doctest/doctest.h>
 #include <glm/ext/vector_double3.hpp>
+#include <glm/ext/vector_float3.hpp>
 #include <glm/ext/vector_uint2_sized.hpp>
 #include <glm/geometric.hpp>
 
@@ -53,6 +54,55 @@ TEST_CASE("AttributeCompression::octDecode") {
   }
 }
 
+TEST_CASE("AttributeCompression::getOctDecodeTable") {
+  const std::vector<glm::vec3>& table =
+      AttributeCompression::getOctDecodeTable();
+  REQUIRE(table.size() == 65536);
+
+  for (uint32_t y = 0; y < 256; y += 17) {
+    for (uint32_t x = 0; x < 256; x += 3) {
+      const glm::vec3 expected(AttributeCompression::octDecode(
+          static_cast<uint8_t>(x),
+          static_cast<uint8_t>(y)));
+      CHECK(table[y * 256 + x] == expected);
+    }
+  }
+}
+
+TEST_CASE("AttributeCompression::octEncode") {
+  const std::vector<glm::dvec3> input{
+      glm::dvec3(0.0, 0.0, 1.0),
+      glm::dvec3(0.0, 0.0, -1.0),
+      glm::dvec3(0.0, 1.0, 0.0),
+      glm::dvec3(0.0, -1.0, 0.0),
+      glm::dvec3(1.0, 0.0, 0.0),
+      glm::dvec3(-1.0, 0.0, 0.0),
+      glm::normalize(glm::dvec3(1.0, 1.0, 1.0)),
+      glm::normalize(glm::dvec3(1.0, -1.0, 1.0)),
+      glm::normalize(glm::dvec3(-1.0, -1.0, 1.0)),
+      glm::normalize(glm::dvec3(-1.0, 1.0, 1.0)),
+      glm::normalize(glm::dvec3(1.0, 1.0, -1.0)),
+      glm::normalize(glm::dvec3(1.0, -1.0, -1.0)),
+      glm::normalize(glm::dvec3(-1.0, -1.0, -1.0)),
+      glm::normalize(glm::dvec3(-1.0, 1.0, -1.0)),
+      glm::normalize(glm::dvec3(0.3, -0.2, 0.9)),
+  };
+
+  for (const glm::dvec3& vector : input) {
+    const glm::u8vec2 encoded = AttributeCompression::octEncode(vector);
+    const glm::dvec3 decoded =
+        AttributeCompression::octDecode(encoded.x, encoded.y);
+    CHECK(Math::equalsEpsilon(decoded, vector, Math::Epsilon1));
+  }
+
+  CHECK(
+      AttributeCompression::octEncode(glm::dvec3(0.0, 0.0, 1.0)) ==
+      glm::u8vec2(128, 128));
+  CHECK(
+      AttributeCompression::octEncode(glm::dvec3(0.0, 0.0, -1.0)) ==
+      glm::u8vec2(255, 255));
+}
+
 TEST_CASE("AttributeCompression::decodeRGB565") {
   const std::vector<uint16_t> input{
       0,
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <CesiumUtility/JsonValue.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/GeoJsonObjectTypes.h>
+#include <CesiumVectorData/Library.h>
+
+#include <glm/vec3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace CesiumVectorData {
+
+/**
+ * @brief The type of the values in a \ref GeoJsonPropertyColumn.
+ */
+enum class GeoJsonPropertyColumnType : uint8_t {
+  /** @brief Every value is a boolean. */
+  Boolean,
+  /** @brief Every value is an integer that fits in an `int64_t`. */
+  Int64,
+  /** @brief Every value is a number. */
+  Double,
+  /** @brief Every value is a string. */
+  String,
+  /** @brief The values have different types, or are objects or arrays. */
+  Json
+};
+
+/**
+ * @brief The values of one property for every feature in a
+ * \ref GeoJsonColumnarData, stored contiguously.
+ *
+ * The column's type is the narrowest type that can hold the value of every
+ * feature that has the property. Features without the property, or whose value
+ * is `null`, have no value in the column.
+ */
+class CESIUMVECTORDATA_API GeoJsonPropertyColumn {
+public:
+  /**
+   * @brief Gets the name of the property.
+   */
+  const std::string& getName() const noexcept { return this->_name; }
+
+  /**
+   * @brief Gets the type of the values in this column.
+   */
+  GeoJsonPropertyColumnType getType() const noexcept { return this->_type; }
+
+  /**
+   * @brief Returns whether the given feature has a non-null value for this
+   * property.
+   */
+  bool hasValue(size_t featureIndex) const {
+    return this->_hasValue[featureIndex];
+  }
+
+  /**
+   * @brief Gets the value of a `Boolean` column for the given feature.
+   */
+  bool getBool(size_t featureIndex) const {
+    return this->_booleans[featureIndex] != 0;
+  }
+
+  /**
+   * @brief Gets the values of an `Int64` column, with one element per feature.
+   */
+  std::span<const int64_t> getInt64Values() const noexcept {
+    return this->_int64s;
+  }
+
+  /**
+   * @brief Gets the values of a `Double` column, with one element per feature.
+   */
+  std::span<const double> getDoubleValues() const noexcept {
+    return this->_doubles;
+  }
+
+  /**
+   * @brief Gets the value of a `String` column for the given feature, or an
+   * empty string if the feature has no value.
+   */
+  std::string_view getString(size_t featureIndex) const {
+    return std::string_view(this->_stringData)
+        .substr(
+            this->_stringOffsets[featureIndex],
+            this->_stringOffsets[featureIndex + 1] -
+                this->_stringOffsets[featureIndex]);
+  }
+
+  /**
+   * @brief Gets the value for the given feature as a
+   * \ref CesiumUtility::JsonValue, whatever the type of this column.
+   *
+   * @returns The value, or `null` if the feature has no value.
+   */
+  CesiumUtility::JsonValue getJsonValue(size_t featureIndex) const;
+
+private:
+  friend class GeoJsonColumnarData;
+
+  std::string _name;
+  GeoJsonPropertyColumnType _type = GeoJsonPropertyColumnType::Boolean;
+  std::vector<bool> _hasValue;
+  std::vector<uint8_t> _booleans;
+  std::vector<int64_t> _int64s;
+  std::vector<double> _doubles;
+  std::string _stringData;
+  std::vector<uint32_t> _stringOffsets;
+  std::vector<CesiumUtility::JsonValue> _jsonValues;
+};
+
+/**
+ * @brief A geometry object within a \ref GeoJsonColumnarData.
+ *
+ * The positions of a geometry are grouped into parts and rings:
+ *
+ * - A `Point` or `MultiPoint` has one part with one ring holding its points.
+ * - A `LineString` has one part with one ring. A `MultiLineString` has one
+ * part for each line, with one ring each.
+ * - A `Polygon` has one part with one ring for each of its linear rings. A
+ * `MultiPolygon` has one part for each polygon.
+ */
+struct GeoJsonColumnarGeometry {
+  /** @brief The type of this geometry. */
+  GeoJsonObjectType type = GeoJsonObjectType::Point;
+
+  /**
+   * @brief The index of the feature containing this geometry, or -1 if it is
+   * not part of a feature.
+   */
+  int64_t featureIndex = -1;
+
+  /** @brief The index of the first part of this geometry. */
+  uint32_t firstPart = 0;
+
+  /** @brief The number of parts in this geometry. */
+  uint32_t partCount = 0;
+};
+
+/**
+ * @brief A compact, columnar copy of the geometry and feature properties of a
+ * \ref GeoJsonObject and its children.
+ *
+ * The positions of every geometry are stored in a single buffer, with offset
+ * arrays marking where each ring and part begins, and the properties of every
+ * feature are stored in one typed column per distinct property name. Compared
+ * to the \ref GeoJsonObject hierarchy, this uses much less memory and can be
+ * iterated without chasing pointers, but it cannot be modified and does not
+ * keep bounding boxes, styles, or foreign members.
+ */
+class CESIUMVECTORDATA_API GeoJsonColumnarData {
+public:
+  /**
+   * @brief Creates an empty instance.
+   */
+  GeoJsonColumnarData() = default;
+
+  /**
+   * @brief Copies the geometry and feature properties of the given object and
+   * all of its children.
+   *
+   * Geometries and features are stored in the order in which they are visited
+   * when iterating over `rootObject`.
+   *
+   * @param rootObject The object to copy.
+   */
+  explicit GeoJsonColumnarData(const GeoJsonObject& rootObject);
+
+  /**
+   * @brief Gets the geometry objects, in the order they were visited.
+   */
+  std::span<const GeoJsonColumnarGeometry> getGeometries() const noexcept {
+    return this->_geometries;
+  }
+
+  /**
+   * @brief Gets the positions of every geometry, in degrees longitude and
+   * latitude and meters height.
+   */
+  std::span<const glm::dvec3> getPositions() const noexcept {
+    return this->_positions;
+  }
+
+  /**
+   * @brief Gets the number of rings in the given part.
+   */
+  size_t getRingCount(size_t partIndex) const {
+    return this->_partOffsets[partIndex + 1] - this->_partOffsets[partIndex];
+  }
+
+  /**
+   * @brief Gets the positions of a ring within the given part.
+   *
+   * @param partIndex The index of the part.
+   * @param ringIndex The index of the ring within the part.
+   */
+  std::span<const glm::dvec3>
+  getRingPositions(size_t partIndex, size_t ringIndex) const {
+    const size_t ring = this->_partOffsets[partIndex] + ringIndex;
+    return std::span<const glm::dvec3>(this->_positions)
+        .subspan(
+            this->_ringOffsets[ring],
+            this->_ringOffsets[ring + 1] - this->_ringOffsets[ring]);
+  }
+
+  /**
+   * @brief Gets the number of features.
+   */
+  size_t getFeatureCount() const noexcept { return this->_featureIds.size(); }
+
+  /**
+   * @brief Gets the ID of the given feature.
+   */
+  const std::variant<std::monostate, std::string, int64_t>&
+  getFeatureId(size_t featureIndex) const {
+    return this->_featureIds[featureIndex];
+  }
+
+  /**
+   * @brief Gets the property columns, sorted by name.
+   */
+  std::span<const GeoJsonPropertyColumn> getProperties() const noexcept {
+    return this->_properties;
+  }
+
+  /**
+   * @brief Finds the column of the property with the given name.
+   *
+   * @returns The column, or `nullptr` if no feature has the property.
+   */
+  const GeoJsonPropertyColumn* findProperty(std::string_view name) const;
+
+  /**
+   * @brief Estimates the number of bytes of memory used by this instance,
+   * including its heap allocations.
+   *
+   * The contents of `Json` property columns are counted only by the size of
+   * their top-level values.
+   */
+  int64_t getSizeBytes() const;
+
+private:
+  std::vector<glm::dvec3> _positions;
+  std::vector<uint32_t> _ringOffsets;
+  std::vector<uint32_t> _partOffsets;
+  std::vector<GeoJsonColumnarGeometry> _geometries;
+  std::vector<std::variant<std::monostate, std::string, int64_t>> _featureIds;
+  std::vector<GeoJsonPropertyColumn> _properties;
+};
+
+} // namespace CesiumVectorData
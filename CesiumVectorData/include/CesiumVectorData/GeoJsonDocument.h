@@ -12,6 +12,7 @@
 
 #include <glm/ext/vector_double3.hpp>
 
+#include <functional>
 #include <memory>
 #include <span>
 
@@ -41,6 +42,10 @@ public:
   /**
    * @brief Attempts to parse a \ref GeoJsonDocument from the provided GeoJSON.
    *
+   * The GeoJSON is read with a streaming parser that builds each
+   * \ref GeoJsonObject directly, without first parsing the whole buffer into
+   * a JSON document.
+   *
    * @param bytes The GeoJSON data to parse.
    * @param attributions Any attributions to attach to the document.
    * @returns A \ref CesiumUtility::Result containing the parsed
@@ -50,6 +55,31 @@ public:
       const std::span<const std::byte>& bytes,
       std::vector<VectorDocumentAttribution>&& attributions = {});
 
+  /**
+   * @brief Attempts to parse a \ref GeoJsonDocument from the provided GeoJSON,
+   * passing each feature of a root `FeatureCollection` to a callback as soon
+   * as it has been parsed.
+   *
+   * The features passed to the callback are not added to the returned
+   * document, so the memory used while parsing is bounded by the size of the
+   * largest feature rather than the size of the whole document. Features are
+   * passed to the callback even if a later part of the document turns out to
+   * be invalid, in which case the returned result contains the errors. If the
+   * root object is not a `FeatureCollection`, it is returned as usual and the
+   * callback is not called.
+   *
+   * @param bytes The GeoJSON data to parse.
+   * @param onFeature The function to call with each feature.
+   * @param attributions Any attributions to attach to the document.
+   * @returns A \ref CesiumUtility::Result containing the parsed
+   * \ref GeoJsonDocument, whose root `FeatureCollection` has no features, or
+   * any errors and warnings that came up while parsing.
+   */
+  static CesiumUtility::Result<GeoJsonDocument> fromGeoJsonWithFeatureCallback(
+      const std::span<const std::byte>& bytes,
+      const std::function<void(GeoJsonObject&& feature)>& onFeature,
+      std::vector<VectorDocumentAttribution>&& attributions = {});
+
   /**
    * @brief Attempts to parse a \ref GeoJsonDocument from the provided JSON
    * document.
@@ -127,7 +157,8 @@ public:
 private:
   static CesiumUtility::Result<GeoJsonObject>
   parseGeoJson(const rapidjson::Document& doc);
-  static CesiumUtility::Result<GeoJsonObject>
-  parseGeoJson(const std::span<const std::byte>& bytes);
+  static CesiumUtility::Result<GeoJsonObject> parseGeoJson(
+      const std::span<const std::byte>& bytes,
+      const std::function<void(GeoJsonObject&&)>& onFeature);
 };
 } // namespace CesiumVectorData
\ No newline at end of file
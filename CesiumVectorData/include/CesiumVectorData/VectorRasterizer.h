@@ -10,12 +10,15 @@
 #include <CesiumUtility/Color.h>
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumUtility/ReferenceCounted.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
 #include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/VectorRasterizerPool.h>
 
 #include <blend2d.h>
 #include <blend2d/context.h>
 #include <blend2d/image.h>
 
+#include <cstddef>
 #include <span>
 
 namespace CesiumImage {
@@ -49,6 +52,54 @@ public:
       const CesiumGeospatial::Ellipsoid& ellipsoid =
           CesiumGeospatial::Ellipsoid::WGS84);
 
+  /**
+   * @brief Creates a new @ref VectorRasterizer representing the given rectangle
+   * on the globe, which draws to an image and rendering context taken from a
+   * @ref VectorRasterizerPool.
+   *
+   * The existing pixels of the destination image asset are copied into the
+   * pooled image first, so that drawing composites over them exactly as it
+   * does when drawing to the image asset directly. The result is copied back
+   * to the destination image asset when the rasterizer is finalized, and the
+   * image and context are then returned to the pool.
+   *
+   * @param bounds The bounds on the globe that this rasterizer's canvas will
+   * cover.
+   * @param imageAsset The destination image asset. This @ref
+   * CesiumImage::ImageAsset must be four channels, with
+   * only one byte per channel (RGBA32).
+   * @param pool The pool to take the image and rendering context from. It must
+   * outlive this rasterizer.
+   * @param mipLevel The mip level that the rasterizer should rasterize for the
+   * image.
+   * @param ellipsoid The ellipsoid to use.
+   */
+  VectorRasterizer(
+      const CesiumGeospatial::GlobeRectangle& bounds,
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset>& imageAsset,
+      VectorRasterizerPool& pool,
+      uint32_t mipLevel = 0,
+      const CesiumGeospatial::Ellipsoid& ellipsoid =
+          CesiumGeospatial::Ellipsoid::WGS84);
+
+  ~VectorRasterizer() noexcept;
+
+  /**
+   * @brief Moves a rasterizer. The moved-from rasterizer is left finalized.
+   */
+  VectorRasterizer(VectorRasterizer&& rhs) noexcept;
+
+  /**
+   * @brief Moves a rasterizer. If this rasterizer draws to a pooled canvas and
+   * has not been finalized, its canvas is returned to the pool without copying
+   * it to the destination image asset. The moved-from rasterizer is left
+   * finalized.
+   */
+  VectorRasterizer& operator=(VectorRasterizer&& rhs) noexcept;
+
+  VectorRasterizer(const VectorRasterizer&) = delete;
+  VectorRasterizer& operator=(const VectorRasterizer&) = delete;
+
   /**
    * @brief Draws a @ref CesiumGeospatial::CartographicPolygon to the canvas.
    *
@@ -146,6 +197,22 @@ public:
       const GeoJsonObject& geoJsonObject,
       const VectorStyle& style);
 
+  /**
+   * @brief Rasterizes every geometry in a \ref GeoJsonColumnarData to the
+   * canvas.
+   *
+   * This produces the same image as calling `drawGeoJsonObject` with the
+   * object the columnar data was created from, but walks flat position and
+   * offset buffers instead of the object hierarchy, and reuses its scratch
+   * buffers for every geometry.
+   *
+   * @param data The columnar data to draw.
+   * @param style The @ref VectorStyle to use when drawing the geometry.
+   */
+  void drawGeoJsonColumnarData(
+      const GeoJsonColumnarData& data,
+      const VectorStyle& style);
+
   /**
    * @brief Fills the entire canvas with the given color.
    *
@@ -163,12 +230,17 @@ public:
   CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> finalize();
 
 private:
+  std::byte* getImageAssetData() const;
+  size_t getImageAssetByteSize() const;
+  void releaseToPool() noexcept;
+
   CesiumGeospatial::GlobeRectangle _bounds;
   BLImage _image;
   BLContext _context;
   CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> _imageAsset;
   uint32_t _mipLevel;
   CesiumGeospatial::Ellipsoid _ellipsoid;
+  VectorRasterizerPool* _pPool = nullptr;
   bool _finalized = false;
 };
 } // namespace CesiumVectorData
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <CesiumVectorData/Library.h>
+
+#include <blend2d.h>
+#include <blend2d/context.h>
+#include <blend2d/image.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace CesiumVectorData {
+
+/**
+ * @brief Options for a @ref VectorRasterizerPool.
+ */
+struct VectorRasterizerPoolOptions {
+  /**
+   * @brief The maximum number of idle canvases kept for reuse. Canvases
+   * released while this many are already idle are destroyed.
+   */
+  size_t maximumIdleCanvases = 8;
+
+  /**
+   * @brief The number of Blend2D worker threads used to rasterize large
+   * images. When zero, every image is rasterized by the calling thread alone.
+   */
+  uint32_t threadCount = 4;
+
+  /**
+   * @brief The number of pixels an image must have to be rasterized with
+   * Blend2D's worker threads.
+   *
+   * Smaller images are rasterized by the calling thread alone, because the
+   * cost of handing draw commands to the worker threads outweighs the benefit.
+   */
+  int64_t minimumMultithreadedPixels = int64_t(1024) * 1024;
+};
+
+/**
+ * @brief A pool of Blend2D images and rendering contexts that are reused by
+ * @ref VectorRasterizer instances across tiles.
+ *
+ * A @ref VectorRasterizer created with a pool rasterizes into a pooled image
+ * rather than directly into its destination, and copies the result when it is
+ * finalized. This avoids allocating a new image for every tile, and allows
+ * large tiles to be rasterized with Blend2D's worker threads.
+ *
+ * A pool may be shared by rasterizers running in different threads.
+ */
+class CESIUMVECTORDATA_API VectorRasterizerPool {
+public:
+  /**
+   * @brief Creates a new pool.
+   *
+   * @param options The options for the pool.
+   */
+  explicit VectorRasterizerPool(
+      const VectorRasterizerPoolOptions& options = {});
+
+  /**
+   * @brief Gets the options for this pool.
+   */
+  const VectorRasterizerPoolOptions& getOptions() const noexcept {
+    return this->_options;
+  }
+
+  /**
+   * @brief Gets the number of canvases that are currently idle in this pool.
+   */
+  size_t getIdleCanvasCount() const;
+
+private:
+  friend class VectorRasterizer;
+
+  struct Canvas {
+    BLImage image;
+    BLContext context;
+  };
+
+  Canvas acquire(int32_t width, int32_t height);
+  void release(Canvas&& canvas);
+  BLContextCreateInfo createInfoFor(int32_t width, int32_t height) const;
+
+  VectorRasterizerPoolOptions _options;
+  mutable std::mutex _mutex;
+  std::vector<Canvas> _idle;
+};
+
+} // namespace CesiumVectorData
@@ -0,0 +1,365 @@
+#include <CesiumUtility/Assert.h>
+#include <CesiumUtility/JsonValue.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/GeoJsonObjectTypes.h>
+
+#include <glm/vec3.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace CesiumUtility;
+
+namespace CesiumVectorData {
+namespace {
+struct ColumnarGeometryBuilder {
+  std::vector<glm::dvec3>& positions;
+  std::vector<uint32_t>& ringOffsets;
+  std::vector<uint32_t>& partOffsets;
+  std::vector<GeoJsonColumnarGeometry>& geometries;
+  int64_t featureIndex;
+
+  void operator()(const GeoJsonPoint& point) {
+    this->begin(GeoJsonObjectType::Point);
+    this->addRing(std::span<const glm::dvec3>(&point.coordinates, 1));
+    this->endPart();
+    this->end();
+  }
+  void operator()(const GeoJsonMultiPoint& points) {
+    this->begin(GeoJsonObjectType::MultiPoint);
+    this->addRing(points.coordinates);
+    this->endPart();
+    this->end();
+  }
+  void operator()(const GeoJsonLineString& line) {
+    this->begin(GeoJsonObjectType::LineString);
+    this->addRing(line.coordinates);
+    this->endPart();
+    this->end();
+  }
+  void operator()(const GeoJsonMultiLineString& lines) {
+    this->begin(GeoJsonObjectType::MultiLineString);
+    for (const std::vector<glm::dvec3>& line : lines.coordinates) {
+      this->addRing(line);
+      this->endPart();
+    }
+    this->end();
+  }
+  void operator()(const GeoJsonPolygon& polygon) {
+    this->begin(GeoJsonObjectType::Polygon);
+    for (const std::vector<glm::dvec3>& ring : polygon.coordinates) {
+      this->addRing(ring);
+    }
+    this->endPart();
+    this->end();
+  }
+  void operator()(const GeoJsonMultiPolygon& polygons) {
+    this->begin(GeoJsonObjectType::MultiPolygon);
+    for (const std::vector<std::vector<glm::dvec3>>& polygon :
+         polygons.coordinates) {
+      for (const std::vector<glm::dvec3>& ring : polygon) {
+        this->addRing(ring);
+      }
+      this->endPart();
+    }
+    this->end();
+  }
+  void operator()(const GeoJsonFeature& /*catchAll*/) {}
+  void operator()(const GeoJsonFeatureCollection& /*catchAll*/) {}
+  void operator()(const GeoJsonGeometryCollection& /*catchAll*/) {}
+
+  void begin(GeoJsonObjectType type) {
+    this->geometries.emplace_back(GeoJsonColumnarGeometry{
+        type,
+        this->featureIndex,
+        uint32_t(this->partOffsets.size() - 1),
+        0});
+  }
+
+  void addRing(std::span<const glm::dvec3> ring) {
+    this->positions.insert(this->positions.end(), ring.begin(), ring.end());
+    this->ringOffsets.emplace_back(uint32_t(this->positions.size()));
+  }
+
+  void endPart() {
+    this->partOffsets.emplace_back(uint32_t(this->ringOffsets.size() - 1));
+  }
+
+  void end() {
+    GeoJsonColumnarGeometry& geometry = this->geometries.back();
+    geometry.partCount =
+        uint32_t(this->partOffsets.size() - 1) - geometry.firstPart;
+  }
+};
+
+bool fitsInInt64(const JsonValue& value) {
+  if (value.isInt64()) {
+    return true;
+  }
+  return value.isUint64() &&
+         value.getUint64() <=
+             uint64_t(std::numeric_limits<int64_t>::max());
+}
+
+double toDouble(const JsonValue& value) {
+  if (value.isInt64()) {
+    return double(value.getInt64());
+  }
+  if (value.isUint64()) {
+    return double(value.getUint64());
+  }
+  return value.getDouble();
+}
+
+// Tracks which column types can hold every value seen so far.
+struct ColumnTypeCandidates {
+  bool boolean = true;
+  bool int64 = true;
+  bool number = true;
+  bool string = true;
+  bool anyValue = false;
+
+  void add(const JsonValue& value) {
+    this->anyValue = true;
+    this->boolean = this->boolean && value.isBool();
+    this->int64 = this->int64 && fitsInInt64(value);
+    this->number = this->number && value.isNumber();
+    this->string = this->string && value.isString();
+  }
+
+  GeoJsonPropertyColumnType getType() const {
+    if (!this->anyValue) {
+      return GeoJsonPropertyColumnType::Json;
+    }
+    if (this->boolean) {
+      return GeoJsonPropertyColumnType::Boolean;
+    }
+    if (this->int64) {
+      return GeoJsonPropertyColumnType::Int64;
+    }
+    if (this->number) {
+      return GeoJsonPropertyColumnType::Double;
+    }
+    if (this->string) {
+      return GeoJsonPropertyColumnType::String;
+    }
+    return GeoJsonPropertyColumnType::Json;
+  }
+};
+
+template <typename T> int64_t capacityBytes(const std::vector<T>& vector) {
+  return int64_t(vector.capacity() * sizeof(T));
+}
+} // namespace
+
+JsonValue GeoJsonPropertyColumn::getJsonValue(size_t featureIndex) const {
+  if (!this->hasValue(featureIndex)) {
+    return JsonValue();
+  }
+
+  switch (this->_type) {
+  case GeoJsonPropertyColumnType::Boolean:
+    return JsonValue(this->getBool(featureIndex));
+  case GeoJsonPropertyColumnType::Int64:
+    return JsonValue(this->_int64s[featureIndex]);
+  case GeoJsonPropertyColumnType::Double:
+    return JsonValue(this->_doubles[featureIndex]);
+  case GeoJsonPropertyColumnType::String:
+    return JsonValue(std::string(this->getString(featureIndex)));
+  case GeoJsonPropertyColumnType::Json:
+    return this->_jsonValues[featureIndex];
+  }
+
+  return JsonValue();
+}
+
+GeoJsonColumnarData::GeoJsonColumnarData(const GeoJsonObject& rootObject)
+    : _positions(),
+      _ringOffsets{0},
+      _partOffsets{0},
+      _geometries(),
+      _featureIds(),
+      _properties() {
+  std::vector<const JsonValue::Object*> featureProperties;
+  const GeoJsonObject* pLastFeature = nullptr;
+
+  for (auto it = rootObject.begin(); it != rootObject.end(); ++it) {
+    const GeoJsonFeature* pFeature = it->getIf<GeoJsonFeature>();
+    if (pFeature) {
+      pLastFeature = &*it;
+      this->_featureIds.emplace_back(pFeature->id);
+      featureProperties.emplace_back(
+          pFeature->properties ? &*pFeature->properties : nullptr);
+      continue;
+    }
+
+    // Features only appear directly within a FeatureCollection, so a geometry
+    // that is part of a feature always follows its feature.
+    const GeoJsonObject* pOwner = it.getFeature();
+    CESIUM_ASSERT(pOwner == nullptr || pOwner == pLastFeature);
+    (void)pLastFeature;
+    const int64_t featureIndex =
+        pOwner ? int64_t(this->_featureIds.size()) - 1 : -1;
+
+    it->visit(ColumnarGeometryBuilder{
+        this->_positions,
+        this->_ringOffsets,
+        this->_partOffsets,
+        this->_geometries,
+        featureIndex});
+  }
+
+  // Choose the type of each column from the values of every feature. The map
+  // also sorts the columns by name.
+  std::map<std::string, ColumnTypeCandidates, std::less<>> candidates;
+  for (const JsonValue::Object* pProperties : featureProperties) {
+    if (!pProperties) {
+      continue;
+    }
+    for (const auto& [name, value] : *pProperties) {
+      ColumnTypeCandidates& column = candidates[name];
+      if (!value.isNull()) {
+        column.add(value);
+      }
+    }
+  }
+
+  const size_t featureCount = this->_featureIds.size();
+  std::map<std::string_view, size_t, std::less<>> columnIndices;
+  this->_properties.reserve(candidates.size());
+  for (const auto& [name, column] : candidates) {
+    columnIndices.emplace(name, this->_properties.size());
+
+    GeoJsonPropertyColumn& property = this->_properties.emplace_back();
+    property._name = name;
+    property._type = column.getType();
+    property._hasValue.resize(featureCount, false);
+
+    switch (property._type) {
+    case GeoJsonPropertyColumnType::Boolean:
+      property._booleans.resize(featureCount, 0);
+      break;
+    case GeoJsonPropertyColumnType::Int64:
+      property._int64s.resize(featureCount, 0);
+      break;
+    case GeoJsonPropertyColumnType::Double:
+      property._doubles.resize(featureCount, 0.0);
+      break;
+    case GeoJsonPropertyColumnType::String:
+      property._stringOffsets.reserve(featureCount + 1);
+      property._stringOffsets.emplace_back(0);
+      break;
+    case GeoJsonPropertyColumnType::Json:
+      property._jsonValues.resize(featureCount);
+      break;
+    }
+  }
+
+  for (size_t i = 0; i < featureCount; ++i) {
+    const JsonValue::Object* pProperties = featureProperties[i];
+    if (!pProperties) {
+      continue;
+    }
+
+    for (const auto& [name, value] : *pProperties) {
+      if (value.isNull()) {
+        continue;
+      }
+
+      auto columnIt = columnIndices.find(name);
+      CESIUM_ASSERT(columnIt != columnIndices.end());
+      GeoJsonPropertyColumn& property = this->_properties[columnIt->second];
+      property._hasValue[i] = true;
+
+      switch (property._type) {
+      case GeoJsonPropertyColumnType::Boolean:
+        property._booleans[i] = value.getBool() ? 1 : 0;
+        break;
+      case GeoJsonPropertyColumnType::Int64:
+        property._int64s[i] = value.isInt64() ? value.getInt64()
+                                              : int64_t(value.getUint64());
+        break;
+      case GeoJsonPropertyColumnType::Double:
+        property._doubles[i] = toDouble(value);
+        break;
+      case GeoJsonPropertyColumnType::String: {
+        // Features before this one that had no value get empty strings.
+        std::vector<uint32_t>& offsets = property._stringOffsets;
+        const uint32_t previousEnd = offsets.back();
+        offsets.resize(i + 1, previousEnd);
+        property._stringData += value.getString();
+        offsets.emplace_back(uint32_t(property._stringData.size()));
+        break;
+      }
+      case GeoJsonPropertyColumnType::Json:
+        property._jsonValues[i] = value;
+        break;
+      }
+    }
+  }
+
+  for (GeoJsonPropertyColumn& property : this->_properties) {
+    if (property._type == GeoJsonPropertyColumnType::String) {
+      std::vector<uint32_t>& offsets = property._stringOffsets;
+      const uint32_t previousEnd = offsets.back();
+      offsets.resize(featureCount + 1, previousEnd);
+    }
+  }
+}
+
+const GeoJsonPropertyColumn*
+GeoJsonColumnarData::findProperty(std::string_view name) const {
+  auto it = std::lower_bound(
+      this->_properties.begin(),
+      this->_properties.end(),
+      name,
+      [](const GeoJsonPropertyColumn& column, std::string_view value) {
+        return std::string_view(column.getName()) < value;
+      });
+  if (it == this->_properties.end() || it->getName() != name) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+int64_t GeoJsonColumnarData::getSizeBytes() const {
+  int64_t accum = int64_t(sizeof(GeoJsonColumnarData));
+  accum += capacityBytes(this->_positions);
+  accum += capacityBytes(this->_ringOffsets);
+  accum += capacityBytes(this->_partOffsets);
+  accum += capacityBytes(this->_geometries);
+  accum += capacityBytes(this->_featureIds);
+  for (const auto& id : this->_featureIds) {
+    const std::string* pString = std::get_if<std::string>(&id);
+    if (pString) {
+      accum += int64_t(pString->capacity());
+    }
+  }
+
+  accum += capacityBytes(this->_properties);
+  for (const GeoJsonPropertyColumn& property : this->_properties) {
+    accum += int64_t(property._name.capacity());
+    accum += int64_t(property._hasValue.capacity() / 8);
+    accum += capacityBytes(property._booleans);
+    accum += capacityBytes(property._int64s);
+    accum += capacityBytes(property._doubles);
+    accum += int64_t(property._stringData.capacity());
+    accum += capacityBytes(property._stringOffsets);
+    accum += capacityBytes(property._jsonValues);
+  }
+
+  return accum;
+}
+
+} // namespace CesiumVectorData
@@ -1,3 +1,5 @@
+#include "GeoJsonReader.h"
+
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumAsync/Future.h>
 #include <CesiumAsync/IAssetAccessor.h>
@@ -578,24 +580,32 @@ GeoJsonDocument::parseGeoJson(const rapidjson::Document& doc) {
       "");
 }
 
-Result<GeoJsonObject>
-GeoJsonDocument::parseGeoJson(const std::span<const std::byte>& bytes) {
-  rapidjson::Document d;
-  d.Parse(reinterpret_cast<const char*>(bytes.data()), bytes.size());
-  if (d.HasParseError()) {
-    return Result<GeoJsonObject>(ErrorList::error(fmt::format(
-        "Failed to parse GeoJSON: {} at offset {}",
-        rapidjson::GetParseError_En(d.GetParseError()),
-        d.GetErrorOffset())));
+Result<GeoJsonObject> GeoJsonDocument::parseGeoJson(
+    const std::span<const std::byte>& bytes,
+    const std::function<void(GeoJsonObject&&)>& onFeature) {
+  return readGeoJson(bytes, onFeature);
+}
+
+Result<GeoJsonDocument> GeoJsonDocument::fromGeoJson(
+    const std::span<const std::byte>& bytes,
+    std::vector<VectorDocumentAttribution>&& attributions) {
+  Result<GeoJsonObject> parseResult =
+      GeoJsonDocument::parseGeoJson(bytes, nullptr);
+  if (!parseResult.value) {
+    return Result<GeoJsonDocument>(std::move(parseResult.errors));
   }
 
-  return parseGeoJson(d);
+  return Result<GeoJsonDocument>(
+      GeoJsonDocument(std::move(*parseResult.value), std::move(attributions)),
+      std::move(parseResult.errors));
 }
 
-Result<GeoJsonDocument> GeoJsonDocument::fromGeoJson(
+Result<GeoJsonDocument> GeoJsonDocument::fromGeoJsonWithFeatureCallback(
     const std::span<const std::byte>& bytes,
+    const std::function<void(GeoJsonObject&& feature)>& onFeature,
     std::vector<VectorDocumentAttribution>&& attributions) {
-  Result<GeoJsonObject> parseResult = GeoJsonDocument::parseGeoJson(bytes);
+  Result<GeoJsonObject> parseResult =
+      GeoJsonDocument::parseGeoJson(bytes, onFeature);
   if (!parseResult.value) {
     return Result<GeoJsonDocument>(std::move(parseResult.errors));
   }
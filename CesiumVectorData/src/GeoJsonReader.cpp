@@ -0,0 +1,1339 @@
+#include "GeoJsonReader.h"
+
+#include <CesiumGeometry/AxisAlignedBox.h>
+#include <CesiumJsonReader/IJsonHandler.h>
+#include <CesiumJsonReader/JsonHandler.h>
+#include <CesiumJsonReader/JsonObjectJsonHandler.h>
+#include <CesiumUtility/Assert.h>
+#include <CesiumUtility/ErrorList.h>
+#include <CesiumUtility/JsonValue.h>
+#include <CesiumUtility/Result.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/GeoJsonObjectTypes.h>
+
+#include <fmt/format.h>
+#include <glm/ext/vector_double3.hpp>
+#include <rapidjson/error/en.h>
+#include <rapidjson/error/error.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace CesiumGeometry;
+using namespace CesiumJsonReader;
+using namespace CesiumUtility;
+
+namespace CesiumVectorData {
+
+namespace {
+
+using FeatureCallback = std::function<void(GeoJsonObject&&)>;
+
+struct Dispatcher {
+  IJsonHandler* pCurrent;
+
+  bool update(IJsonHandler* pNext) noexcept {
+    if (pNext == nullptr) {
+      return false;
+    }
+
+    this->pCurrent = pNext;
+    return true;
+  }
+
+  bool Null() { return update(pCurrent->readNull()); }
+  bool Bool(bool b) { return update(pCurrent->readBool(b)); }
+  bool Int(int i) { return update(pCurrent->readInt32(i)); }
+  bool Uint(unsigned i) { return update(pCurrent->readUint32(i)); }
+  bool Int64(int64_t i) { return update(pCurrent->readInt64(i)); }
+  bool Uint64(uint64_t i) { return update(pCurrent->readUint64(i)); }
+  bool Double(double d) { return update(pCurrent->readDouble(d)); }
+  bool RawNumber(
+      const char* /* str */,
+      size_t /* length */,
+      bool /* copy */) noexcept {
+    // This should not be called.
+    CESIUM_ASSERT(false);
+    return false;
+  }
+  bool String(const char* str, size_t length, bool /* copy */) {
+    return update(pCurrent->readString(std::string_view(str, length)));
+  }
+  bool StartObject() { return update(pCurrent->readObjectStart()); }
+  bool Key(const char* str, size_t length, bool /* copy */) {
+    return update(pCurrent->readObjectKey(std::string_view(str, length)));
+  }
+  bool EndObject(size_t /* memberCount */) {
+    return update(pCurrent->readObjectEnd());
+  }
+  bool StartArray() { return update(pCurrent->readArrayStart()); }
+  bool EndArray(size_t /* elementCount */) {
+    return update(pCurrent->readArrayEnd());
+  }
+};
+
+/**
+ * @brief The input currently being read.
+ *
+ * The members of a GeoJSON object may appear in any order, so a member whose
+ * meaning depends on the object's "type" can be read before the type is
+ * known. Such members are recorded as ranges of the input and read again once
+ * the object ends.
+ */
+struct ReadContext {
+  const char* pDocument = nullptr;
+  const char* pBegin = nullptr;
+  const rapidjson::MemoryStream* pStream = nullptr;
+
+  /**
+   * @brief Gets the position just after the most recently read token.
+   *
+   * rapidjson's iterative parser takes each token from the stream before
+   * calling the handler, so while a handler runs this is just after the token
+   * it is handling, and before any whitespace that follows. The tests of
+   * members that appear before "type" rely on this.
+   */
+  const char* current() const noexcept {
+    return this->pBegin + this->pStream->Tell();
+  }
+
+  /**
+   * @brief Gets the offset of a position in the whole input.
+   */
+  size_t offsetOf(const char* p) const noexcept {
+    return size_t(p - this->pDocument);
+  }
+};
+
+rapidjson::ParseResult
+readJson(std::string_view json, IJsonHandler& handler, ReadContext& context) {
+  rapidjson::Reader reader;
+  rapidjson::MemoryStream inputStream(json.data(), json.size());
+  Dispatcher dispatcher{&handler};
+
+  const ReadContext previousContext = context;
+  context.pBegin = json.data();
+  context.pStream = &inputStream;
+
+  // Use the same flags as `rapidjson::Document::Parse`, so that numbers are
+  // converted exactly as they are when parsing a document.
+  reader.IterativeParseInit();
+  bool success = true;
+  while (success && !reader.IterativeParseComplete()) {
+    success = reader.IterativeParseNext<rapidjson::kParseDefaultFlags>(
+        inputStream,
+        dispatcher);
+  }
+
+  context = previousContext;
+
+  return rapidjson::ParseResult(
+      reader.GetParseErrorCode(),
+      reader.GetErrorOffset());
+}
+
+/**
+ * @brief Reads a JSON value into a `JsonValue` the same way
+ * `JsonHelpers::toJsonValue` converts a rapidjson value, which stores
+ * unsigned integers as `int64_t` whenever they fit.
+ */
+class ValueJsonHandler : public JsonObjectJsonHandler {
+public:
+  virtual IJsonHandler* readUint32(uint32_t i) override {
+    return this->readInt64(int64_t(i));
+  }
+
+  virtual IJsonHandler* readUint64(uint64_t i) override {
+    if (i <= uint64_t(std::numeric_limits<int64_t>::max())) {
+      return this->readInt64(int64_t(i));
+    }
+    return JsonObjectJsonHandler::readUint64(i);
+  }
+};
+
+/**
+ * @brief A member that was read before the "type" of its object was known.
+ */
+struct DeferredMember {
+  std::string name;
+  /** @brief The value, if it is not an object or array. */
+  JsonValue scalar;
+  /** @brief The input holding the value, if it is an object or array. */
+  std::string_view json;
+};
+
+/**
+ * @brief Records the value of a @ref DeferredMember.
+ */
+class DeferredMemberJsonHandler : public JsonHandler {
+public:
+  void reset(
+      IJsonHandler* pParent,
+      DeferredMember* pMember,
+      const ReadContext* pContext) {
+    JsonHandler::reset(pParent);
+    this->_pMember = pMember;
+    this->_pContext = pContext;
+    this->_pStart = nullptr;
+    this->_depth = 0;
+  }
+
+  virtual IJsonHandler* readNull() override {
+    return this->readScalar(JsonValue::Null());
+  }
+  virtual IJsonHandler* readBool(bool b) override {
+    return this->readScalar(JsonValue(b));
+  }
+  virtual IJsonHandler* readInt32(int32_t i) override {
+    return this->readScalar(JsonValue(int64_t(i)));
+  }
+  virtual IJsonHandler* readUint32(uint32_t i) override {
+    return this->readScalar(JsonValue(uint64_t(i)));
+  }
+  virtual IJsonHandler* readInt64(int64_t i) override {
+    return this->readScalar(JsonValue(i));
+  }
+  virtual IJsonHandler* readUint64(uint64_t i) override {
+    return this->readScalar(JsonValue(i));
+  }
+  virtual IJsonHandler* readDouble(double d) override {
+    return this->readScalar(JsonValue(d));
+  }
+  virtual IJsonHandler* readString(const std::string_view& str) override {
+    return this->readScalar(JsonValue(std::string(str)));
+  }
+  virtual IJsonHandler* readObjectStart() override { return this->start(); }
+  virtual IJsonHandler* readObjectKey(const std::string_view&) override {
+    return this;
+  }
+  virtual IJsonHandler* readObjectEnd() override { return this->end(); }
+  virtual IJsonHandler* readArrayStart() override { return this->start(); }
+  virtual IJsonHandler* readArrayEnd() override { return this->end(); }
+
+private:
+  IJsonHandler* readScalar(JsonValue&& value) {
+    if (this->_depth > 0) {
+      return this;
+    }
+    this->_pMember->scalar = std::move(value);
+    return this->parent();
+  }
+
+  IJsonHandler* start() {
+    if (this->_depth++ == 0) {
+      // The opening bracket has just been read.
+      this->_pStart = this->_pContext->current() - 1;
+      CESIUM_ASSERT(*this->_pStart == '{' || *this->_pStart == '[');
+    }
+    return this;
+  }
+
+  IJsonHandler* end() {
+    if (--this->_depth > 0) {
+      return this;
+    }
+    CESIUM_ASSERT(
+        *(this->_pContext->current() - 1) == '}' ||
+        *(this->_pContext->current() - 1) == ']');
+    this->_pMember->json = std::string_view(
+        this->_pStart,
+        size_t(this->_pContext->current() - this->_pStart));
+    return this->parent();
+  }
+
+  DeferredMember* _pMember = nullptr;
+  const ReadContext* _pContext = nullptr;
+  const char* _pStart = nullptr;
+  int32_t _depth = 0;
+};
+
+/**
+ * @brief Passes a scalar `JsonValue` to a handler as if it had been read.
+ */
+struct ReplayScalarVisitor {
+  IJsonHandler& handler;
+
+  void operator()(const JsonValue::Null&) { handler.readNull(); }
+  void operator()(double d) { handler.readDouble(d); }
+  void operator()(uint64_t i) { handler.readUint64(i); }
+  void operator()(int64_t i) { handler.readInt64(i); }
+  void operator()(bool b) { handler.readBool(b); }
+  void operator()(const JsonValue::String& str) { handler.readString(str); }
+  void operator()(const JsonValue::Object&) { CESIUM_ASSERT(false); }
+  void operator()(const JsonValue::Array&) { CESIUM_ASSERT(false); }
+};
+
+enum class ObjectType {
+  Unknown,
+  Point,
+  MultiPoint,
+  LineString,
+  MultiLineString,
+  Polygon,
+  MultiPolygon,
+  GeometryCollection,
+  Feature,
+  FeatureCollection
+};
+
+ObjectType getObjectType(std::string_view type) {
+  if (type == "Point") {
+    return ObjectType::Point;
+  } else if (type == "MultiPoint") {
+    return ObjectType::MultiPoint;
+  } else if (type == "LineString") {
+    return ObjectType::LineString;
+  } else if (type == "MultiLineString") {
+    return ObjectType::MultiLineString;
+  } else if (type == "Polygon") {
+    return ObjectType::Polygon;
+  } else if (type == "MultiPolygon") {
+    return ObjectType::MultiPolygon;
+  } else if (type == "GeometryCollection") {
+    return ObjectType::GeometryCollection;
+  } else if (type == "Feature") {
+    return ObjectType::Feature;
+  } else if (type == "FeatureCollection") {
+    return ObjectType::FeatureCollection;
+  }
+  return ObjectType::Unknown;
+}
+
+// The number of nested arrays in the "coordinates" member of the given type,
+// including the arrays of the positions themselves.
+int32_t getCoordinatesDepth(ObjectType type) {
+  switch (type) {
+  case ObjectType::Point:
+    return 1;
+  case ObjectType::MultiPoint:
+  case ObjectType::LineString:
+    return 2;
+  case ObjectType::MultiLineString:
+  case ObjectType::Polygon:
+    return 3;
+  case ObjectType::MultiPolygon:
+    return 4;
+  default:
+    return 0;
+  }
+}
+
+struct Coordinates {
+  std::optional<std::string> error;
+  glm::dvec3 point{0.0};
+  std::vector<glm::dvec3> line;
+  std::vector<std::vector<glm::dvec3>> rings;
+  std::vector<std::vector<std::vector<glm::dvec3>>> polygons;
+};
+
+/**
+ * @brief Reads the "coordinates" member of a geometry directly into positions.
+ *
+ * The first problem found is reported with the same message the document
+ * parser gives, and the rest of the value is skipped.
+ */
+class CoordinatesJsonHandler : public JsonHandler {
+public:
+  void reset(
+      IJsonHandler* pParent,
+      ObjectType type,
+      std::string_view typeName,
+      Coordinates* pCoordinates) {
+    JsonHandler::reset(pParent);
+    this->_type = type;
+    this->_typeName = typeName;
+    this->_pCoordinates = pCoordinates;
+    this->_maxDepth = getCoordinatesDepth(type);
+    this->_depth = 0;
+    this->_skipDepth = 0;
+    this->_failed = false;
+    this->_positionSize = 0;
+    this->_positionIsNumeric = true;
+    this->_positions.clear();
+    this->_rings.clear();
+  }
+
+  virtual IJsonHandler* readNull() override {
+    return this->readScalar(std::nullopt);
+  }
+  virtual IJsonHandler* readBool(bool) override {
+    return this->readScalar(std::nullopt);
+  }
+  virtual IJsonHandler* readInt32(int32_t i) override {
+    return this->readScalar(double(i));
+  }
+  virtual IJsonHandler* readUint32(uint32_t i) override {
+    return this->readScalar(double(i));
+  }
+  virtual IJsonHandler* readInt64(int64_t i) override {
+    return this->readScalar(double(i));
+  }
+  virtual IJsonHandler* readUint64(uint64_t i) override {
+    return this->readScalar(double(i));
+  }
+  virtual IJsonHandler* readDouble(double d) override {
+    return this->readScalar(d);
+  }
+  virtual IJsonHandler* readString(const std::string_view&) override {
+    return this->readScalar(std::nullopt);
+  }
+
+  virtual IJsonHandler* readObjectStart() override {
+    if (this->_failed) {
+      ++this->_depth;
+    } else if (this->_skipDepth > 0) {
+      ++this->_skipDepth;
+    } else if (this->_depth == this->_maxDepth) {
+      this->skipPositionElement();
+    } else {
+      this->fail(this->getNotAnArrayError(this->_depth + 1));
+      ++this->_depth;
+    }
+    return this;
+  }
+
+  virtual IJsonHandler* readObjectKey(const std::string_view&) override {
+    return this;
+  }
+
+  virtual IJsonHandler* readObjectEnd() override {
+    if (this->_skipDepth > 0) {
+      --this->_skipDepth;
+      return this;
+    }
+
+    // Only objects skipped after a failure end here.
+    return --this->_depth == 0 ? this->parent() : this;
+  }
+
+  virtual IJsonHandler* readArrayStart() override {
+    if (this->_failed) {
+      ++this->_depth;
+    } else if (this->_skipDepth > 0) {
+      ++this->_skipDepth;
+    } else if (this->_depth == this->_maxDepth) {
+      this->skipPositionElement();
+    } else if (++this->_depth == this->_maxDepth) {
+      this->_positionSize = 0;
+      this->_positionIsNumeric = true;
+    }
+    return this;
+  }
+
+  virtual IJsonHandler* readArrayEnd() override {
+    if (this->_skipDepth > 0) {
+      --this->_skipDepth;
+      return this;
+    }
+
+    if (!this->_failed) {
+      this->finishArray();
+    }
+    return --this->_depth == 0 ? this->parent() : this;
+  }
+
+private:
+  IJsonHandler* readScalar(std::optional<double> number) {
+    if (this->_failed || this->_skipDepth > 0) {
+      return this;
+    }
+
+    if (this->_depth == this->_maxDepth) {
+      if (this->_positionSize < this->_position.size() && number) {
+        this->_position[this->_positionSize] = *number;
+      }
+      ++this->_positionSize;
+      this->_positionIsNumeric = this->_positionIsNumeric && number;
+      return this;
+    }
+
+    this->fail(this->getNotAnArrayError(this->_depth + 1));
+    return this->_depth == 0 ? this->parent() : this;
+  }
+
+  // Counts an object or array within a position, which makes the position
+  // invalid, and skips its contents.
+  void skipPositionElement() {
+    ++this->_positionSize;
+    this->_positionIsNumeric = false;
+    this->_skipDepth = 1;
+  }
+
+  // Finishes the array at the current depth, which is a position when the
+  // depth is `_maxDepth`, a list of positions one level up, and so on.
+  void finishArray() {
+    const int32_t level = this->_maxDepth - this->_depth;
+    if (level == 0) {
+      if (this->_positionSize < 2 || this->_positionSize > 3) {
+        this->fail(
+            "Position value must be an array with two or three members.");
+        return;
+      }
+      if (!this->_positionIsNumeric) {
+        this->fail("Position value must be an array of only numbers.");
+        return;
+      }
+
+      const glm::dvec3 position(
+          this->_position[0],
+          this->_position[1],
+          this->_positionSize == 3 ? this->_position[2] : 0.0);
+      if (this->_maxDepth == 1) {
+        this->_pCoordinates->point = position;
+      } else {
+        this->_positions.emplace_back(position);
+      }
+    } else if (level == 1) {
+      if (this->_maxDepth == 2) {
+        if (this->_type == ObjectType::LineString &&
+            this->_positions.size() < 2) {
+          this->fail("LineString 'coordinates' member must contain two or "
+                     "more positions.");
+          return;
+        }
+        this->_pCoordinates->line = std::move(this->_positions);
+      } else {
+        this->finishRing();
+      }
+    } else if (level == 2) {
+      if (this->_maxDepth == 3) {
+        this->_pCoordinates->rings = std::move(this->_rings);
+      } else {
+        this->_pCoordinates->polygons.emplace_back(std::move(this->_rings));
+      }
+    }
+  }
+
+  void finishRing() {
+    const bool isPolygon = this->_type != ObjectType::MultiLineString;
+    const size_t minItems = isPolygon ? 4 : 2;
+    if (this->_positions.size() < minItems) {
+      this->fail(fmt::format(
+          "{} 'coordinates' member must be an array of arrays of {} or more "
+          "positions.",
+          this->_typeName,
+          minItems));
+      return;
+    }
+
+    // Close any open polygon rings by duplicating the first position.
+    if (isPolygon && this->_positions.front() != this->_positions.back()) {
+      const glm::dvec3 first = this->_positions.front();
+      this->_positions.emplace_back(first);
+    }
+
+    this->_rings.emplace_back(std::move(this->_positions));
+  }
+
+  // Gets the error for a value that should have been the array at the given
+  // depth, where the "coordinates" member itself is depth 1.
+  std::string getNotAnArrayError(int32_t depth) const {
+    if (depth == this->_maxDepth) {
+      return "Position value must be an array.";
+    }
+
+    switch (this->_maxDepth) {
+    case 2:
+      return fmt::format(
+          "{} 'coordinates' member must be an array of positions.",
+          this->_typeName);
+    case 3:
+      return fmt::format(
+          "{} 'coordinates' member must be an array of position arrays.",
+          this->_typeName);
+    default:
+      return depth == 3 ? fmt::format(
+                              "{} 'coordinates' member must be an array of "
+                              "position arrays.",
+                              this->_typeName)
+                        : fmt::format(
+                              "{} 'coordinates' member must be an array of "
+                              "arrays of position arrays.",
+                              this->_typeName);
+    }
+  }
+
+  void fail(std::string&& error) {
+    this->_failed = true;
+    this->_pCoordinates->error = std::move(error);
+    this->_positions.clear();
+    this->_rings.clear();
+  }
+
+  ObjectType _type = ObjectType::Unknown;
+  std::string_view _typeName;
+  Coordinates* _pCoordinates = nullptr;
+  int32_t _maxDepth = 0;
+  int32_t _depth = 0;
+  int32_t _skipDepth = 0;
+  bool _failed = false;
+  std::array<double, 3> _position{};
+  size_t _positionSize = 0;
+  bool _positionIsNumeric = true;
+  std::vector<glm::dvec3> _positions;
+  std::vector<std::vector<glm::dvec3>> _rings;
+};
+
+double toDouble(const JsonValue& value) {
+  if (const double* pDouble = std::get_if<double>(&value.value)) {
+    return *pDouble;
+  } else if (const int64_t* pInt = std::get_if<int64_t>(&value.value)) {
+    return double(*pInt);
+  }
+  return double(std::get<uint64_t>(value.value));
+}
+
+Result<std::optional<AxisAlignedBox>> parseBoundingBox(const JsonValue& value) {
+  if (!value.isArray()) {
+    return Result<std::optional<AxisAlignedBox>>(
+        std::nullopt,
+        ErrorList::warning("'bbox' member must be an array."));
+  }
+
+  const JsonValue::Array& array = value.getArray();
+  const size_t size = array.size();
+  if (size != 4 && size != 6) {
+    return Result<std::optional<AxisAlignedBox>>(
+        std::nullopt,
+        ErrorList::warning(
+            "'bbox' member must be of length 4 (2D) or 6 (3D)."));
+  }
+
+  const bool allNumbers =
+      std::all_of(array.begin(), array.end(), [](const JsonValue& v) {
+        return v.isNumber();
+      });
+  if (!allNumbers) {
+    return ErrorList::warning("'bbox' member must contain only doubles.");
+  }
+
+  const double west = toDouble(array[0]);
+  const double south = toDouble(array[1]);
+  const double east = toDouble(array[size == 4 ? 2 : 3]);
+  const double north = toDouble(array[size == 4 ? 3 : 4]);
+  const double minimumHeight = size == 4 ? 0.0 : toDouble(array[2]);
+  const double maximumHeight = size == 4 ? 0.0 : toDouble(array[5]);
+
+  return Result<std::optional<AxisAlignedBox>>(
+      std::optional<AxisAlignedBox>{AxisAlignedBox(
+          std::min(west, east),
+          std::min(south, north),
+          std::min(minimumHeight, maximumHeight),
+          std::max(west, east),
+          std::max(south, north),
+          std::max(minimumHeight, maximumHeight))});
+}
+
+/**
+ * @brief Which GeoJSON objects may appear where an object is read.
+ */
+enum class Expectation {
+  Any,
+  FeatureGeometry,
+  FeatureCollectionFeature,
+  GeometryCollectionGeometry
+};
+
+bool isExpected(Expectation expectation, const std::string& type) {
+  switch (expectation) {
+  case Expectation::FeatureGeometry:
+  case Expectation::GeometryCollectionGeometry:
+    return type != "Feature" && type != "FeatureCollection";
+  case Expectation::FeatureCollectionFeature:
+    return type == "Feature";
+  default:
+    return true;
+  }
+}
+
+const char* getExpectedMessage(Expectation expectation) {
+  switch (expectation) {
+  case Expectation::FeatureGeometry:
+    return "GeoJSON Feature 'geometry' member may only contain GeoJSON "
+           "Geometry objects";
+  case Expectation::GeometryCollectionGeometry:
+    return "GeoJSON GeometryCollection 'geometries' member may only contain "
+           "GeoJSON Geometry objects";
+  case Expectation::FeatureCollectionFeature:
+    return "GeoJSON FeatureCollection 'features' member may only contain "
+           "Feature objects";
+  default:
+    return "";
+  }
+}
+
+/**
+ * @brief Reads a GeoJSON object and, recursively, the objects within it.
+ *
+ * Known members are converted as they are read, so the only JSON kept in
+ * memory is the value of each foreign member and of each Feature's
+ * "properties". The object itself is validated once it ends, in the same
+ * order and with the same messages as the document parser.
+ */
+class GeoJsonObjectJsonHandler : public JsonHandler {
+public:
+  explicit GeoJsonObjectJsonHandler(ReadContext& context) noexcept
+      : JsonHandler(), _pContext(&context) {}
+
+  void reset(
+      IJsonHandler* pParent,
+      std::optional<Result<GeoJsonObject>>* pResult,
+      Expectation expectation,
+      const FeatureCallback* pOnFeature) {
+    JsonHandler::reset(pParent);
+    this->_pResult = pResult;
+    this->_expectation = expectation;
+    this->_pOnFeature = pOnFeature;
+    this->_started = false;
+    this->_pending = Pending::None;
+    this->_type.reset();
+    this->_objectType = ObjectType::Unknown;
+    this->_seenMembers = 0;
+    this->_deferred.clear();
+    this->_deferredErrors = ErrorList();
+    this->_bbox.reset();
+    this->_id.reset();
+    this->_properties.reset();
+    this->_foreignMembers.clear();
+    this->_hasCoordinates = false;
+    this->_coordinates = Coordinates();
+    this->_geometry = GeometryState::Missing;
+    this->_geometryResult.reset();
+    this->_hasChildren = false;
+    this->_childrenIsArray = false;
+    this->_inChildren = false;
+    this->_hasNonObjectChild = false;
+    this->_childResult.reset();
+    this->_children.clear();
+    this->_childErrors = ErrorList();
+  }
+
+  virtual IJsonHandler* readNull() override {
+    return this->readScalar(true, nullptr);
+  }
+  virtual IJsonHandler* readBool(bool) override {
+    return this->readScalar(false, nullptr);
+  }
+  virtual IJsonHandler* readInt32(int32_t) override {
+    return this->readScalar(false, nullptr);
+  }
+  virtual IJsonHandler* readUint32(uint32_t) override {
+    return this->readScalar(false, nullptr);
+  }
+  virtual IJsonHandler* readInt64(int64_t) override {
+    return this->readScalar(false, nullptr);
+  }
+  virtual IJsonHandler* readUint64(uint64_t) override {
+    return this->readScalar(false, nullptr);
+  }
+  virtual IJsonHandler* readDouble(double) override {
+    return this->readScalar(false, nullptr);
+  }
+  virtual IJsonHandler* readString(const std::string_view& str) override {
+    return this->readScalar(false, &str);
+  }
+
+  virtual IJsonHandler* readObjectStart() override {
+    if (!this->_started) {
+      this->_started = true;
+      return this;
+    }
+
+    if (this->_pending == Pending::Geometry) {
+      this->_pending = Pending::None;
+      this->_geometry = GeometryState::Object;
+      return this->readChild(
+          &this->_geometryResult,
+          Expectation::FeatureGeometry);
+    }
+
+    if (this->_inChildren) {
+      this->finishChild();
+      if (this->_hasNonObjectChild) {
+        // The collection is already invalid, so its remaining children don't
+        // matter.
+        return this->ignoreAndContinue()->readObjectStart();
+      }
+      return this->readChild(
+          &this->_childResult,
+          this->_objectType == ObjectType::FeatureCollection
+              ? Expectation::FeatureCollectionFeature
+              : Expectation::GeometryCollectionGeometry);
+    }
+
+    this->readScalar(false, nullptr);
+    return this->ignoreAndContinue()->readObjectStart();
+  }
+
+  virtual IJsonHandler* readObjectKey(const std::string_view& str) override {
+    return this->readMember(str, false);
+  }
+
+  virtual IJsonHandler* readObjectEnd() override {
+    this->readDeferredMembers();
+    *this->_pResult = this->finish();
+    return this->parent();
+  }
+
+  virtual IJsonHandler* readArrayStart() override {
+    if (this->_pending == Pending::Children) {
+      this->_pending = Pending::None;
+      this->_childrenIsArray = true;
+      this->_inChildren = true;
+      return this;
+    }
+
+    this->readScalar(false, nullptr);
+    return this->ignoreAndContinue()->readArrayStart();
+  }
+
+  virtual IJsonHandler* readArrayEnd() override {
+    if (!this->_inChildren) {
+      return nullptr;
+    }
+
+    this->finishChild();
+    this->_inChildren = false;
+    return this;
+  }
+
+private:
+  /**
+   * @brief A member value that this handler reads itself, rather than handing
+   * to another handler.
+   */
+  enum class Pending { None, Type, Geometry, Children };
+
+  enum class GeometryState { Missing, Null, Invalid, Object };
+
+  // Members whose meaning depends on the type of the object.
+  static constexpr uint8_t COORDINATES = 1;
+  static constexpr uint8_t GEOMETRY = 2;
+  static constexpr uint8_t FEATURES = 4;
+  static constexpr uint8_t GEOMETRIES = 8;
+
+  static uint8_t getTypedMember(std::string_view name) {
+    if (name == "coordinates") {
+      return COORDINATES;
+    } else if (name == "geometry") {
+      return GEOMETRY;
+    } else if (name == "features") {
+      return FEATURES;
+    } else if (name == "geometries") {
+      return GEOMETRIES;
+    }
+    return 0;
+  }
+
+  // Whether the object can possibly be read successfully, given its type.
+  bool isTypeValid() const {
+    return this->_type && !this->_type->empty() &&
+           isExpected(this->_expectation, *this->_type);
+  }
+
+  IJsonHandler* readMember(std::string_view name, bool isDeferred) {
+    if (name == "type") {
+      if (this->_type) {
+        return this->ignoreAndContinue();
+      }
+      this->_pending = Pending::Type;
+      return this;
+    }
+
+    // Skip the rest of an object that will be rejected anyway.
+    if (this->_type && !this->isTypeValid()) {
+      return this->ignoreAndContinue();
+    }
+
+    if (name == "bbox") {
+      return this->readValue(this->_bbox);
+    } else if (name == "id") {
+      return this->readValue(this->_id);
+    } else if (name == "properties") {
+      return this->readValue(this->_properties);
+    }
+
+    const uint8_t typedMember = getTypedMember(name);
+    if (typedMember != 0) {
+      if (!isDeferred) {
+        if ((this->_seenMembers & typedMember) != 0) {
+          return this->ignoreAndContinue();
+        }
+        this->_seenMembers = uint8_t(this->_seenMembers | typedMember);
+      }
+
+      if (!this->_type) {
+        DeferredMember& member = this->_deferred.emplace_back();
+        member.name = name;
+        this->_deferredHandler.reset(this, &member, this->_pContext);
+        return &this->_deferredHandler;
+      }
+
+      const int32_t coordinatesDepth = getCoordinatesDepth(this->_objectType);
+      if (typedMember == COORDINATES &&
+          (coordinatesDepth > 0 || this->_objectType == ObjectType::Unknown)) {
+        this->_hasCoordinates = true;
+        if (coordinatesDepth == 0) {
+          return this->ignoreAndContinue();
+        }
+        this->_coordinatesHandler.reset(
+            this,
+            this->_objectType,
+            *this->_type,
+            &this->_coordinates);
+        return &this->_coordinatesHandler;
+      } else if (
+          typedMember == GEOMETRY &&
+          this->_objectType == ObjectType::Feature) {
+        this->_pending = Pending::Geometry;
+        return this;
+      } else if (
+          (typedMember == FEATURES &&
+           this->_objectType == ObjectType::FeatureCollection) ||
+          (typedMember == GEOMETRIES &&
+           this->_objectType == ObjectType::GeometryCollection)) {
+        this->_hasChildren = true;
+        this->_pending = Pending::Children;
+        return this;
+      }
+    }
+
+    // Anything else is a foreign member. As with a document, the first of
+    // several members with the same name wins.
+    auto [it, inserted] = this->_foreignMembers.try_emplace(std::string(name));
+    if (!inserted) {
+      return this->ignoreAndContinue();
+    }
+    this->_valueHandler.reset(this, &it->second);
+    return &this->_valueHandler;
+  }
+
+  IJsonHandler* readValue(std::optional<JsonValue>& value) {
+    if (value) {
+      return this->ignoreAndContinue();
+    }
+    this->_valueHandler.reset(this, &value.emplace());
+    return &this->_valueHandler;
+  }
+
+  // Handles a value that is not a GeoJSON object, or any value that is not
+  // valid where it appears.
+  IJsonHandler* readScalar(bool isNull, const std::string_view* pString) {
+    switch (this->_pending) {
+    case Pending::Type:
+      this->_type = pString ? std::string(*pString) : std::string();
+      this->_objectType = getObjectType(*this->_type);
+      break;
+    case Pending::Geometry:
+      this->_geometry = isNull ? GeometryState::Null : GeometryState::Invalid;
+      break;
+    case Pending::Children:
+      this->_childrenIsArray = false;
+      break;
+    case Pending::None:
+      if (!this->_inChildren) {
+        return nullptr;
+      }
+      this->finishChild();
+      this->_hasNonObjectChild = true;
+      break;
+    }
+
+    this->_pending = Pending::None;
+    return this;
+  }
+
+  IJsonHandler* readChild(
+      std::optional<Result<GeoJsonObject>>* pResult,
+      Expectation expectation) {
+    if (!this->_pChild) {
+      this->_pChild =
+          std::make_unique<GeoJsonObjectJsonHandler>(*this->_pContext);
+    }
+    this->_pChild->reset(this, pResult, expectation, nullptr);
+    return this->_pChild->readObjectStart();
+  }
+
+  // Adds the most recently read child of a collection, if any.
+  void finishChild() {
+    if (!this->_childResult) {
+      return;
+    }
+
+    Result<GeoJsonObject>& result = *this->_childResult;
+    this->_childErrors.merge(std::move(result.errors));
+    if (result.value) {
+      if (this->_pOnFeature && *this->_pOnFeature &&
+          this->_objectType == ObjectType::FeatureCollection) {
+        (*this->_pOnFeature)(std::move(*result.value));
+      } else {
+        this->_children.emplace_back(std::move(*result.value));
+      }
+    }
+
+    this->_childResult.reset();
+  }
+
+  // Reads the members that appeared before the object's type.
+  void readDeferredMembers() {
+    if (this->_deferred.empty() || !this->isTypeValid()) {
+      return;
+    }
+
+    for (const DeferredMember& member : this->_deferred) {
+      IJsonHandler* pHandler = this->readMember(member.name, true);
+      if (member.json.empty()) {
+        std::visit(ReplayScalarVisitor{*pHandler}, member.scalar.value);
+      } else {
+        const rapidjson::ParseResult result =
+            readJson(member.json, *pHandler, *this->_pContext);
+        if (result.IsError()) {
+          this->_deferredErrors.emplaceError(fmt::format(
+              "Failed to parse GeoJSON member '{}': {} at offset {}",
+              member.name,
+              rapidjson::GetParseError_En(result.Code()),
+              this->_pContext->offsetOf(member.json.data()) +
+                  result.Offset()));
+        }
+      }
+    }
+
+    this->_deferred.clear();
+  }
+
+  Result<GeoJsonObject> finish() {
+    if (!this->_type || this->_type->empty()) {
+      return Result<GeoJsonObject>(
+          ErrorList::error("GeoJSON object missing required 'type' field."));
+    }
+
+    if (!isExpected(this->_expectation, *this->_type)) {
+      return Result<GeoJsonObject>(ErrorList::error(fmt::format(
+          "{}, found {}.",
+          getExpectedMessage(this->_expectation),
+          *this->_type)));
+    }
+
+    if (this->_deferredErrors.hasErrors()) {
+      return Result<GeoJsonObject>(std::move(this->_deferredErrors));
+    }
+
+    ErrorList errorList;
+    std::optional<AxisAlignedBox> boundingBox;
+    if (this->_bbox) {
+      Result<std::optional<AxisAlignedBox>> regionResult =
+          parseBoundingBox(*this->_bbox);
+      errorList.merge(std::move(regionResult.errors));
+      if (regionResult.value) {
+        boundingBox = std::move(*regionResult.value);
+      }
+    }
+
+    if (this->_objectType == ObjectType::Feature) {
+      return this->finishFeature(std::move(boundingBox), std::move(errorList));
+    }
+
+    // "id" and "properties" are only known members of a Feature.
+    if (this->_id) {
+      this->_foreignMembers.try_emplace("id", std::move(*this->_id));
+    }
+    if (this->_properties) {
+      this->_foreignMembers.try_emplace(
+          "properties",
+          std::move(*this->_properties));
+    }
+
+    if (this->_objectType == ObjectType::FeatureCollection) {
+      if (!this->_hasChildren) {
+        return Result<GeoJsonObject>(
+            ErrorList::error("FeatureCollection must have 'features' member."));
+      }
+      if (!this->_childrenIsArray) {
+        return Result<GeoJsonObject>(
+            ErrorList::error("FeatureCollection 'features' member must be an "
+                             "array of features."));
+      }
+      if (this->_hasNonObjectChild) {
+        return Result<GeoJsonObject>(
+            ErrorList::error("FeatureCollection 'features' member must contain "
+                             "only GeoJSON objects."));
+      }
+
+      errorList.merge(std::move(this->_childErrors));
+      if (errorList.hasErrors()) {
+        return Result<GeoJsonObject>(std::move(errorList));
+      }
+
+      return Result<GeoJsonObject>(
+          GeoJsonObject{GeoJsonFeatureCollection{
+              std::move(this->_children),
+              boundingBox,
+              std::move(this->_foreignMembers)}},
+          std::move(errorList));
+    } else if (this->_objectType == ObjectType::GeometryCollection) {
+      if (!this->_hasChildren || !this->_childrenIsArray) {
+        return Result<GeoJsonObject>(ErrorList::error(
+            "GeometryCollection requires array 'geometries' member."));
+      }
+      if (this->_hasNonObjectChild) {
+        return Result<GeoJsonObject>(
+            ErrorList::error("GeometryCollection 'geometries' member must "
+                             "contain only GeoJSON objects."));
+      }
+
+      errorList.merge(std::move(this->_childErrors));
+      if (errorList.hasErrors()) {
+        return Result<GeoJsonObject>(std::move(errorList));
+      }
+
+      return Result<GeoJsonObject>(
+          GeoJsonObject{GeoJsonGeometryCollection{
+              std::move(this->_children),
+              boundingBox,
+              std::move(this->_foreignMembers)}},
+          std::move(errorList));
+    }
+
+    if (!this->_hasCoordinates) {
+      return Result<GeoJsonObject>(
+          ErrorList::error("'coordinates' member required."));
+    }
+
+    if (this->_objectType == ObjectType::Unknown) {
+      return Result<GeoJsonObject>(ErrorList::error(
+          fmt::format("Unknown GeoJSON object type: '{}'", *this->_type)));
+    }
+
+    if (this->_coordinates.error) {
+      return Result<GeoJsonObject>(
+          ErrorList::error(std::move(*this->_coordinates.error)));
+    }
+
+    return Result<GeoJsonObject>(
+        this->createGeometry(std::move(boundingBox)),
+        std::move(errorList));
+  }
+
+  Result<GeoJsonObject> finishFeature(
+      std::optional<AxisAlignedBox>&& boundingBox,
+      ErrorList&& errorList) {
+    std::variant<std::monostate, std::string, int64_t> id = std::monostate();
+    if (this->_id) {
+      JsonValue& idValue = *this->_id;
+      if (const int64_t* pInt = std::get_if<int64_t>(&idValue.value)) {
+        id = *pInt;
+      } else if (const double* pDouble = std::get_if<double>(&idValue.value)) {
+        // Store as string - hopefully people won't be using floating point IDs
+        // anyways.
+        id = std::to_string(*pDouble);
+      } else if (
+          std::string* pString = std::get_if<std::string>(&idValue.value)) {
+        id = std::move(*pString);
+      } else {
+        return Result<GeoJsonObject>(ErrorList::error(
+            "Feature 'id' member must be either a string or a number."));
+      }
+    }
+
+    std::unique_ptr<GeoJsonObject> geometry = nullptr;
+    switch (this->_geometry) {
+    case GeometryState::Missing:
+      errorList.emplaceWarning("Feature must have a 'geometry' member.");
+      break;
+    case GeometryState::Invalid:
+      return Result<GeoJsonObject>(ErrorList::error(
+          "Feature 'geometry' member must be either an object or null."));
+    case GeometryState::Object:
+      if (!this->_geometryResult->value) {
+        return std::move(*this->_geometryResult);
+      }
+      geometry = std::make_unique<GeoJsonObject>(
+          std::move(*this->_geometryResult->value));
+      break;
+    case GeometryState::Null:
+      break;
+    }
+
+    std::optional<JsonValue::Object> properties = std::nullopt;
+    if (!this->_properties) {
+      errorList.emplaceWarning("Feature must have a 'properties' member.");
+    } else if (!this->_properties->isNull()) {
+      JsonValue::Object* pObject =
+          std::get_if<JsonValue::Object>(&this->_properties->value);
+      if (!pObject) {
+        return Result<GeoJsonObject>(ErrorList::error(
+            "Feature 'properties' member must be either an object or null."));
+      }
+      properties = std::move(*pObject);
+    }
+
+    return Result<GeoJsonObject>(
+        GeoJsonObject{GeoJsonFeature{
+            std::move(id),
+            std::move(geometry),
+            std::move(properties),
+            std::move(boundingBox),
+            std::move(this->_foreignMembers)}},
+        std::move(errorList));
+  }
+
+  GeoJsonObject createGeometry(std::optional<AxisAlignedBox>&& boundingBox) {
+    Coordinates& coordinates = this->_coordinates;
+    JsonValue::Object& foreignMembers = this->_foreignMembers;
+    switch (this->_objectType) {
+    case ObjectType::Point:
+      return GeoJsonObject{GeoJsonPoint{
+          coordinates.point,
+          std::move(boundingBox),
+          std::move(foreignMembers)}};
+    case ObjectType::MultiPoint:
+      return GeoJsonObject{GeoJsonMultiPoint{
+          std::move(coordinates.line),
+          std::move(boundingBox),
+          std::move(foreignMembers)}};
+    case ObjectType::LineString:
+      return GeoJsonObject{GeoJsonLineString{
+          std::move(coordinates.line),
+          std::move(boundingBox),
+          std::move(foreignMembers)}};
+    case ObjectType::MultiLineString:
+      return GeoJsonObject{GeoJsonMultiLineString{
+          std::move(coordinates.rings),
+          std::move(boundingBox),
+          std::move(foreignMembers)}};
+    case ObjectType::Polygon:
+      return GeoJsonObject{GeoJsonPolygon{
+          std::move(coordinates.rings),
+          std::move(boundingBox),
+          std::move(foreignMembers)}};
+    default:
+      return GeoJsonObject{GeoJsonMultiPolygon{
+          std::move(coordinates.polygons),
+          std::move(boundingBox),
+          std::move(foreignMembers)}};
+    }
+  }
+
+  ReadContext* _pContext;
+  std::optional<Result<GeoJsonObject>>* _pResult = nullptr;
+  Expectation _expectation = Expectation::Any;
+  const FeatureCallback* _pOnFeature = nullptr;
+
+  bool _started = false;
+  Pending _pending = Pending::None;
+  std::optional<std::string> _type;
+  ObjectType _objectType = ObjectType::Unknown;
+  uint8_t _seenMembers = 0;
+  std::vector<DeferredMember> _deferred;
+  ErrorList _deferredErrors;
+
+  std::optional<JsonValue> _bbox;
+  std::optional<JsonValue> _id;
+  std::optional<JsonValue> _properties;
+  JsonValue::Object _foreignMembers;
+
+  bool _hasCoordinates = false;
+  Coordinates _coordinates;
+
+  GeometryState _geometry = GeometryState::Missing;
+  std::optional<Result<GeoJsonObject>> _geometryResult;
+
+  bool _hasChildren = false;
+  bool _childrenIsArray = false;
+  bool _inChildren = false;
+  bool _hasNonObjectChild = false;
+  std::optional<Result<GeoJsonObject>> _childResult;
+  std::vector<GeoJsonObject> _children;
+  ErrorList _childErrors;
+
+  ValueJsonHandler _valueHandler;
+  DeferredMemberJsonHandler _deferredHandler;
+  CoordinatesJsonHandler _coordinatesHandler;
+  std::unique_ptr<GeoJsonObjectJsonHandler> _pChild;
+};
+
+/**
+ * @brief Receives the root value, which must be a GeoJSON object.
+ */
+class RootJsonHandler : public JsonHandler {
+public:
+  RootJsonHandler(ReadContext& context, const FeatureCallback& onFeature)
+      : JsonHandler(), _object(context), _onFeature(onFeature) {
+    this->reset(this);
+  }
+
+  std::optional<Result<GeoJsonObject>> result;
+
+  virtual IJsonHandler* readNull() override { return this; }
+  virtual IJsonHandler* readBool(bool) override { return this; }
+  virtual IJsonHandler* readInt32(int32_t) override { return this; }
+  virtual IJsonHandler* readUint32(uint32_t) override { return this; }
+  virtual IJsonHandler* readInt64(int64_t) override { return this; }
+  virtual IJsonHandler* readUint64(uint64_t) override { return this; }
+  virtual IJsonHandler* readDouble(double) override { return this; }
+  virtual IJsonHandler* readString(const std::string_view&) override {
+    return this;
+  }
+  virtual IJsonHandler* readObjectStart() override {
+    this->_object.reset(
+        this,
+        &this->result,
+        Expectation::Any,
+        &this->_onFeature);
+    return this->_object.readObjectStart();
+  }
+  virtual IJsonHandler* readArrayStart() override {
+    return this->ignoreAndContinue()->readArrayStart();
+  }
+
+  virtual void
+  reportWarning(const std::string&, std::vector<std::string>&&) override {}
+
+private:
+  GeoJsonObjectJsonHandler _object;
+  const FeatureCallback& _onFeature;
+};
+
+} // namespace
+
+Result<GeoJsonObject> readGeoJson(
+    const std::span<const std::byte>& bytes,
+    const FeatureCallback& onFeature) {
+  ReadContext context;
+  RootJsonHandler handler(context, onFeature);
+
+  const std::string_view json(
+      reinterpret_cast<const char*>(bytes.data()),
+      bytes.size());
+  context.pDocument = json.data();
+  const rapidjson::ParseResult parseResult = readJson(json, handler, context);
+  if (parseResult.IsError()) {
+    return Result<GeoJsonObject>(ErrorList::error(fmt::format(
+        "Failed to parse GeoJSON: {} at offset {}",
+        rapidjson::GetParseError_En(parseResult.Code()),
+        parseResult.Offset())));
+  }
+
+  if (!handler.result) {
+    return Result<GeoJsonObject>(
+        ErrorList::error("GeoJSON must contain a JSON object."));
+  }
+
+  return std::move(*handler.result);
+}
+
+} // namespace CesiumVectorData
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <CesiumUtility/Result.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+
+#include <cstddef>
+#include <functional>
+#include <span>
+
+namespace CesiumVectorData {
+
+/**
+ * @brief Reads GeoJSON with a SAX parser, building each \ref GeoJsonObject
+ * directly from the parser's events instead of from an intermediate JSON
+ * document.
+ *
+ * The errors and warnings are the same as those produced when parsing a
+ * `rapidjson::Document`, regardless of the order in which the members of each
+ * object appear.
+ *
+ * @param bytes The GeoJSON data to read.
+ * @param onFeature If not empty, each feature of a root `FeatureCollection` is
+ * passed to this function as soon as it has been read, rather than being
+ * added to the collection.
+ * @returns The root object, or the errors and warnings that came up while
+ * reading it.
+ */
+CesiumUtility::Result<GeoJsonObject> readGeoJson(
+    const std::span<const std::byte>& bytes,
+    const std::function<void(GeoJsonObject&&)>& onFeature);
+
+} // namespace CesiumVectorData
@@ -26,6 +26,7 @@
 #include <CesiumUtility/ErrorList.h>
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumUtility/JsonValue.h>
+#include <CesiumUtility/Math.h>
 #include <CesiumVectorData/GeoJsonDocument.h>
 #include <CesiumVectorData/GeoJsonObject.h>
 #include <CesiumVectorData/GeoJsonObjectTypes.h>
@@ -142,12 +143,14 @@ const std::string& offsetGltfType(size_t size) {
 struct GltfConverterImpl {
   const GeoJsonDocument& geoJson;
   Model model;
-  // Accumulated as the data is traversed, then used to transform coordinates
-  // into a local frame.
-  BoundingRegionBuilder regionBuilder;
   glm::dmat4 enuToFixedFrame;
   CesiumGeospatial::Ellipsoid ellipsoid;
-  std::vector<glm::dvec3> globalCoordinates;
+  // The cartographic coordinates of every vertex in the document, in radians
+  // and meters, accumulated as the data is traversed. They are converted to
+  // cartesian and transformed into a local frame in a single batch.
+  std::vector<double> longitudes;
+  std::vector<double> latitudes;
+  std::vector<double> heights;
   // The feature ID that is associated with each vertex in the document. The
   // contents will be stored in the resulting glTF, but the values may be
   // translated to 32 bit floats.
@@ -185,12 +188,11 @@ struct GltfConverterImpl {
     gltfFeatureIds[nullptr] = 0;
     geoJsonFeatures.push_back(nullptr);
   }
+  size_t coordinateCount() const { return this->longitudes.size(); }
   void addGeoJsonCoordinate(const glm::dvec3& coord, uint32_t featureId) {
-    Cartographic cesiumCoord =
-        Cartographic::fromDegrees(coord.x, coord.y, coord.z);
-    this->regionBuilder.expandToIncludePosition(cesiumCoord);
-    this->globalCoordinates.push_back(
-        this->ellipsoid.cartographicToCartesian(cesiumCoord));
+    this->longitudes.push_back(Math::degreesToRadians(coord.x));
+    this->latitudes.push_back(Math::degreesToRadians(coord.y));
+    this->heights.push_back(coord.z);
     this->featureIds.push_back(featureId);
   }
   int32_t finalizeLines();
@@ -222,7 +224,7 @@ struct GltfConverterImpl {
       const std::vector<glm::dvec3>& lineStringCoords,
       const GeoJsonObject* pFeature) {
     std::vector<uint32_t> stringIndices = lineStringToLines(
-        this->globalCoordinates.size(),
+        this->coordinateCount(),
         lineStringCoords.size());
     this->lines.elements.insert(
         this->lines.elements.end(),
@@ -250,7 +252,7 @@ struct GltfConverterImpl {
 
   void
   processPolygon(const Polygon& polygonRings, const GeoJsonObject* pFeature) {
-    uint32_t elementBase = uint32_t(this->globalCoordinates.size());
+    uint32_t elementBase = uint32_t(this->coordinateCount());
     uint32_t featureId = getFeatureId(pFeature, this->polys);
     for (const PolygonRing& contour : polygonRings) {
       // The last coordinate is identical to the first.
@@ -281,7 +283,7 @@ struct GltfConverterImpl {
   void
   processPoint(const glm::dvec3& cartoDegrees, const GeoJsonObject* pFeature) {
     uint32_t featureId = getFeatureId(pFeature, this->points);
-    this->points.elements.push_back(uint32_t(this->globalCoordinates.size()));
+    this->points.elements.push_back(uint32_t(this->coordinateCount()));
     addGeoJsonCoordinate(cartoDegrees, featureId);
   }
 
@@ -712,7 +714,12 @@ int32_t GltfConverterImpl::finalizePoints() {
 }
 
 void GltfConverterImpl::preparePositions() {
-  BoundingRegion coordsRegion = this->regionBuilder.toRegion();
+  BoundingRegionBuilder regionBuilder;
+  regionBuilder.expandToIncludePositions(
+      this->longitudes,
+      this->latitudes,
+      this->heights);
+  BoundingRegion coordsRegion = regionBuilder.toRegion(this->ellipsoid);
   Cartographic centroid = coordsRegion.getRectangle().computeCenter();
   centroid.height =
       (coordsRegion.getMinimumHeight() + coordsRegion.getMaximumHeight()) / 2.0;
@@ -720,14 +727,20 @@ void GltfConverterImpl::preparePositions() {
   this->enuToFixedFrame = GlobeTransforms::eastNorthUpToFixedFrame(
       ellipsoid.cartographicToCartesian(centroid));
   glm::dmat4 toLocal = inverse(this->enuToFixedFrame);
+  size_t numCoords = this->coordinateCount();
+  std::vector<glm::dvec3> globalCoordinates(numCoords);
+  this->ellipsoid.cartographicToCartesian(
+      this->longitudes,
+      this->latitudes,
+      this->heights,
+      globalCoordinates);
   this->positionBufferIndex = int32_t(this->model.buffers.size());
   Buffer& positionBuffer = this->model.buffers.emplace_back();
-  size_t numCoords = this->globalCoordinates.size();
   positionBuffer.cesium.data.resize(sizeof(glm::vec3) * numCoords);
   glm::vec3* const pPosition32Base =
       reinterpret_cast<glm::vec3*>(positionBuffer.cesium.data.data());
   glm::vec3* pPosition32 = pPosition32Base;
-  for (const auto& position : this->globalCoordinates) {
+  for (const auto& position : globalCoordinates) {
     glm::dvec3 localPosition = glm::dvec3(toLocal * glm::dvec4(position, 1.0));
     // Convert to float
     *pPosition32++ =
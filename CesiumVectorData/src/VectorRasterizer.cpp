@@ -7,9 +7,11 @@
 #include <CesiumUtility/Color.h>
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumUtility/Math.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
 #include <CesiumVectorData/GeoJsonObject.h>
 #include <CesiumVectorData/GeoJsonObjectTypes.h>
 #include <CesiumVectorData/VectorRasterizer.h>
+#include <CesiumVectorData/VectorRasterizerPool.h>
 #include <CesiumVectorData/VectorStyle.h>
 
 // blend2d.h not used directly, but if we don't include it the other blend2d
@@ -18,14 +20,19 @@
 #include <blend2d/context.h>
 #include <blend2d/format.h>
 #include <blend2d/geometry.h>
+#include <blend2d/image.h>
 #include <blend2d/path.h>
 #include <blend2d/rgba.h>
 #include <glm/ext/vector_double2.hpp>
+#include <glm/vec3.hpp>
 
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <span>
+#include <utility>
 #include <vector>
 
 using namespace CesiumGeospatial;
@@ -63,6 +70,107 @@ void setStrokeWidth(
 template <typename T> size_t seedForObject(const T& object, size_t base) {
   return base ^ reinterpret_cast<size_t>(&object);
 }
+
+BLPoint degreesToPoint(
+    const glm::dvec3& position,
+    const GlobeRectangle& rect,
+    const BLContext& context) {
+  return radiansToPoint(
+      CesiumUtility::Math::degreesToRadians(position.x),
+      CesiumUtility::Math::degreesToRadians(position.y),
+      rect,
+      context);
+}
+
+// Adds a closed ring of positions in degrees to the path, in reverse order.
+void addRingToPath(
+    BLPath& path,
+    std::span<const glm::dvec3> ring,
+    const GlobeRectangle& bounds,
+    const BLContext& context) {
+  if (ring.empty()) {
+    return;
+  }
+
+  auto it = ring.rbegin();
+  auto end = ring.rend();
+
+  path.moveTo(degreesToPoint(*it, bounds, context));
+  ++it;
+
+  for (; it != end; ++it) {
+    path.lineTo(degreesToPoint(*it, bounds, context));
+  }
+
+  path.close();
+}
+
+void fillAndStrokePath(
+    BLContext& context,
+    const Ellipsoid& ellipsoid,
+    const GlobeRectangle& bounds,
+    const BLPath& path,
+    const PolygonStyle& style,
+    size_t seed) {
+  if (style.fill) {
+    context.fillPath(
+        path,
+        BLRgba32(style.fill->getColor(seed ^ 13).toRgba32()));
+  }
+
+  if (style.outline) {
+    setStrokeWidth(context, *style.outline, ellipsoid, bounds);
+
+    context.strokePath(
+        path,
+        BLRgba32(style.outline->getColor(seed ^ 31).toRgba32()));
+  }
+}
+
+void strokePolylineInDegrees(
+    BLContext& context,
+    const Ellipsoid& ellipsoid,
+    const GlobeRectangle& bounds,
+    std::span<const glm::dvec3> points,
+    const LineStyle& style,
+    size_t seed,
+    std::vector<BLPoint>& vertices) {
+  vertices.clear();
+  vertices.reserve(points.size());
+
+  for (const glm::dvec3& vertex : points) {
+    vertices.emplace_back(degreesToPoint(vertex, bounds, context));
+  }
+
+  setStrokeWidth(context, style, ellipsoid, bounds);
+
+  context.strokePolyline(
+      vertices.data(),
+      vertices.size(),
+      BLRgba32(style.getColor(seed ^ 31).toRgba32()));
+}
+
+// Blend2D writes in BGRA whereas ImageAsset is RGBA.
+// We need to swap the channels to fix the values.
+// Blend2D provides BLPixelConverter for these sorts of operations, which
+// should be faster because it has SIMD support. But the current
+// implementation seems to perform well as-is, likely thanks to the
+// compiler's vectorization.
+void convertBgraToRgba(
+    const std::byte* pSource,
+    std::byte* pDestination,
+    size_t size) {
+  for (size_t i = 0; i < size; i += 4) {
+    // We need to turn BGRA to RGBA, but this is little endian so it's really
+    // ARGB to ABGR.
+    uint32_t pixel;
+    std::memcpy(&pixel, pSource + i, sizeof(pixel));
+    const uint32_t newPixel =
+        (pixel & 0xff000000) | ((pixel & 0x00ff0000) >> 16) |
+        (pixel & 0x0000ff00) | ((pixel & 0x000000ff) << 16);
+    std::memcpy(pDestination + i, &newPixel, sizeof(newPixel));
+  }
+}
 } // namespace
 
 VectorRasterizer::VectorRasterizer(
@@ -75,7 +183,8 @@ VectorRasterizer::VectorRasterizer(
       _context(),
       _imageAsset(imageAsset),
       _mipLevel(mipLevel),
-      _ellipsoid(ellipsoid) {
+      _ellipsoid(ellipsoid),
+      _pPool(nullptr) {
   CESIUM_ASSERT(this->_imageAsset->channels == 4);
   CESIUM_ASSERT(this->_imageAsset->bytesPerChannel == 1);
   CESIUM_ASSERT(
@@ -85,11 +194,7 @@ VectorRasterizer::VectorRasterizer(
       std::max(this->_imageAsset->width >> this->_mipLevel, 1);
   const int32_t imageHeight =
       std::max(this->_imageAsset->height >> this->_mipLevel, 1);
-  std::byte* pData =
-      this->_mipLevel == 0
-          ? this->_imageAsset->pixelData.data()
-          : this->_imageAsset->pixelData.data() +
-                this->_imageAsset->mipPositions[this->_mipLevel].byteOffset;
+  std::byte* pData = this->getImageAssetData();
   this->_image.createFromData(
       imageWidth,
       imageHeight,
@@ -103,6 +208,88 @@ VectorRasterizer::VectorRasterizer(
   this->_context.setFillRule(BL_FILL_RULE_EVEN_ODD);
 }
 
+VectorRasterizer::VectorRasterizer(
+    const GlobeRectangle& bounds,
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset>& imageAsset,
+    VectorRasterizerPool& pool,
+    uint32_t mipLevel,
+    const CesiumGeospatial::Ellipsoid& ellipsoid)
+    : _bounds(bounds),
+      _image(),
+      _context(),
+      _imageAsset(imageAsset),
+      _mipLevel(mipLevel),
+      _ellipsoid(ellipsoid),
+      _pPool(&pool) {
+  CESIUM_ASSERT(this->_imageAsset->channels == 4);
+  CESIUM_ASSERT(this->_imageAsset->bytesPerChannel == 1);
+  CESIUM_ASSERT(
+      _mipLevel == 0 ||
+      this->_imageAsset->mipPositions.size() > this->_mipLevel);
+  const int32_t imageWidth =
+      std::max(this->_imageAsset->width >> this->_mipLevel, 1);
+  const int32_t imageHeight =
+      std::max(this->_imageAsset->height >> this->_mipLevel, 1);
+
+  VectorRasterizerPool::Canvas canvas = pool.acquire(imageWidth, imageHeight);
+  this->_image = std::move(canvas.image);
+  this->_context = std::move(canvas.context);
+
+  // The pooled image still holds the previous tile. Replace it with the
+  // destination's pixels, unconverted, so that drawing composites over them
+  // just as it does when drawing into the image asset directly.
+  BLImageData imageData{};
+  this->_image.makeMutable(&imageData);
+  const std::byte* pSource = this->getImageAssetData();
+  const size_t size = this->getImageAssetByteSize();
+  const size_t rowSize = size_t(imageWidth) * 4;
+  std::byte* pDestination = static_cast<std::byte*>(imageData.pixelData);
+  for (size_t offset = 0; offset + rowSize <= size; offset += rowSize) {
+    std::memcpy(pDestination, pSource + offset, rowSize);
+    pDestination += imageData.stride;
+  }
+
+  this->_context.begin(
+      this->_image,
+      pool.createInfoFor(imageWidth, imageHeight));
+  this->_context.setFillRule(BL_FILL_RULE_EVEN_ODD);
+}
+
+VectorRasterizer::~VectorRasterizer() noexcept { this->releaseToPool(); }
+
+VectorRasterizer::VectorRasterizer(VectorRasterizer&& rhs) noexcept
+    : _bounds(rhs._bounds),
+      _image(std::move(rhs._image)),
+      _context(std::move(rhs._context)),
+      _imageAsset(std::move(rhs._imageAsset)),
+      _mipLevel(rhs._mipLevel),
+      _ellipsoid(std::move(rhs._ellipsoid)),
+      _pPool(rhs._pPool),
+      _finalized(rhs._finalized) {
+  rhs._pPool = nullptr;
+  rhs._finalized = true;
+}
+
+VectorRasterizer&
+VectorRasterizer::operator=(VectorRasterizer&& rhs) noexcept {
+  if (this != &rhs) {
+    this->releaseToPool();
+
+    this->_bounds = rhs._bounds;
+    this->_image = std::move(rhs._image);
+    this->_context = std::move(rhs._context);
+    this->_imageAsset = std::move(rhs._imageAsset);
+    this->_mipLevel = rhs._mipLevel;
+    this->_ellipsoid = std::move(rhs._ellipsoid);
+    this->_pPool = rhs._pPool;
+    this->_finalized = rhs._finalized;
+
+    rhs._pPool = nullptr;
+    rhs._finalized = true;
+  }
+  return *this;
+}
+
 void VectorRasterizer::drawPolygon(
     const CesiumGeospatial::CartographicPolygon& polygon,
     const PolygonStyle& style) {
@@ -149,49 +336,16 @@ void VectorRasterizer::drawPolygon(
   BLPath path;
 
   for (const std::vector<glm::dvec3>& ring : polygon) {
-    if (ring.empty())
-      continue;
-
-    auto it = ring.rbegin();
-    auto end = ring.rend();
-
-    glm::dvec3 firstPoint = *it;
-    path.moveTo(radiansToPoint(
-        CesiumUtility::Math::degreesToRadians(firstPoint.x),
-        CesiumUtility::Math::degreesToRadians(firstPoint.y),
-        this->_bounds,
-        this->_context));
-    ++it;
-
-    for (; it != end; ++it) {
-      path.lineTo(radiansToPoint(
-          CesiumUtility::Math::degreesToRadians(it->x),
-          CesiumUtility::Math::degreesToRadians(it->y),
-          this->_bounds,
-          this->_context));
-    }
-
-    path.close();
+    addRingToPath(path, ring, this->_bounds, this->_context);
   }
 
-  if (style.fill) {
-    this->_context.fillPath(
-        path,
-        BLRgba32(style.fill->getColor(seedForObject(polygon, 13)).toRgba32()));
-  }
-
-  if (style.outline) {
-    setStrokeWidth(
-        this->_context,
-        *style.outline,
-        this->_ellipsoid,
-        this->_bounds);
-
-    this->_context.strokePath(
-        path,
-        BLRgba32(
-            style.outline->getColor(seedForObject(polygon, 31)).toRgba32()));
-  }
+  fillAndStrokePath(
+      this->_context,
+      this->_ellipsoid,
+      this->_bounds,
+      path,
+      style,
+      seedForObject(polygon, 0));
 }
 
 void VectorRasterizer::drawPolygon(
@@ -257,23 +411,14 @@ void VectorRasterizer::drawPolyline(
   }
 
   std::vector<BLPoint> vertices;
-  vertices.reserve(points.size());
-
-  for (const glm::dvec3& vertex : points) {
-    BLPoint point = radiansToPoint(
-        CesiumUtility::Math::degreesToRadians(vertex.x),
-        CesiumUtility::Math::degreesToRadians(vertex.y),
-        this->_bounds,
-        this->_context);
-    vertices.emplace_back(point);
-  }
-
-  setStrokeWidth(this->_context, style, this->_ellipsoid, this->_bounds);
-
-  this->_context.strokePolyline(
-      vertices.data(),
-      vertices.size(),
-      BLRgba32(style.getColor(seedForObject(points, 31)).toRgba32()));
+  strokePolylineInDegrees(
+      this->_context,
+      this->_ellipsoid,
+      this->_bounds,
+      points,
+      style,
+      seedForObject(points, 0),
+      vertices);
 }
 
 void VectorRasterizer::drawPolyline(
@@ -329,6 +474,28 @@ void drawPointsImpl(
     }
   }
 }
+
+void drawPointsInDegrees(
+    BLContext& context,
+    const CesiumGeospatial::Ellipsoid& ellipsoid,
+    const GlobeRectangle& bounds,
+    std::span<const glm::dvec3> points,
+    const PointStyle& style,
+    std::vector<BLPoint>& vertices,
+    std::vector<size_t>& seeds) {
+  vertices.clear();
+  vertices.reserve(points.size());
+
+  seeds.clear();
+  seeds.reserve(points.size());
+
+  for (const glm::dvec3& vertex : points) {
+    vertices.emplace_back(degreesToPoint(vertex, bounds, context));
+    seeds.emplace_back(seedForObject(vertex, 17));
+  }
+
+  drawPointsImpl(context, ellipsoid, bounds, vertices, seeds, style);
+}
 } // namespace
 
 void VectorRasterizer::drawPoints(
@@ -339,28 +506,15 @@ void VectorRasterizer::drawPoints(
   }
 
   std::vector<BLPoint> vertices;
-  vertices.reserve(points.size());
-
   std::vector<size_t> seeds;
-  seeds.reserve(points.size());
-
-  for (const glm::dvec3& vertex : points) {
-    BLPoint point = radiansToPoint(
-        CesiumUtility::Math::degreesToRadians(vertex.x),
-        CesiumUtility::Math::degreesToRadians(vertex.y),
-        this->_bounds,
-        this->_context);
-    vertices.emplace_back(point);
-    seeds.emplace_back(seedForObject(vertex, 17));
-  }
-
-  drawPointsImpl(
+  drawPointsInDegrees(
       this->_context,
       this->_ellipsoid,
       this->_bounds,
+      points,
+      style,
       vertices,
-      seeds,
-      style);
+      seeds);
 }
 
 void VectorRasterizer::drawPoints(
@@ -434,6 +588,84 @@ void VectorRasterizer::drawGeoJsonObject(
   }
 }
 
+void VectorRasterizer::drawGeoJsonColumnarData(
+    const GeoJsonColumnarData& data,
+    const VectorStyle& style) {
+  if (this->_finalized) {
+    return;
+  }
+
+  const bool drawPolygons = style.polygon.fill || style.polygon.outline;
+
+  // Reused for every part, rather than allocated for each one.
+  BLPath path;
+  std::vector<BLPoint> vertices;
+  std::vector<size_t> seeds;
+
+  for (const GeoJsonColumnarGeometry& geometry : data.getGeometries()) {
+    const size_t endPart = size_t(geometry.firstPart) + geometry.partCount;
+    for (size_t part = geometry.firstPart; part < endPart; ++part) {
+      if (data.getRingCount(part) == 0) {
+        continue;
+      }
+
+      // The address of the part's positions seeds random colors, just as the
+      // address of the coordinates vector does for `drawGeoJsonObject`.
+      const std::span<const glm::dvec3> firstRing =
+          data.getRingPositions(part, 0);
+      const size_t seed = reinterpret_cast<size_t>(firstRing.data());
+
+      switch (geometry.type) {
+      case GeoJsonObjectType::Point:
+      case GeoJsonObjectType::MultiPoint:
+        drawPointsInDegrees(
+            this->_context,
+            this->_ellipsoid,
+            this->_bounds,
+            firstRing,
+            style.point,
+            vertices,
+            seeds);
+        break;
+      case GeoJsonObjectType::LineString:
+      case GeoJsonObjectType::MultiLineString:
+        strokePolylineInDegrees(
+            this->_context,
+            this->_ellipsoid,
+            this->_bounds,
+            firstRing,
+            style.line,
+            seed,
+            vertices);
+        break;
+      case GeoJsonObjectType::Polygon:
+      case GeoJsonObjectType::MultiPolygon:
+        if (!drawPolygons) {
+          break;
+        }
+        path.clear();
+        for (size_t ring = 0; ring < data.getRingCount(part); ++ring) {
+          addRingToPath(
+              path,
+              data.getRingPositions(part, ring),
+              this->_bounds,
+              this->_context);
+        }
+        fillAndStrokePath(
+            this->_context,
+            this->_ellipsoid,
+            this->_bounds,
+            path,
+            style.polygon,
+            seed);
+        break;
+      default:
+        break;
+      }
+    }
+  }
+}
+
 void VectorRasterizer::clear(const CesiumUtility::Color& clearColor) {
   if (this->_finalized) {
     return;
@@ -450,34 +682,52 @@ VectorRasterizer::finalize() {
 
   this->_context.end();
 
-  // Blend2D writes in BGRA whereas ImageAsset is RGBA.
-  // We need to swap the channels to fix the values.
-  // Blend2D provides BLPixelConverter for these sorts of operations, which
-  // should be faster because it has SIMD support. But the current
-  // implementation seems to perform well as-is, likely thanks to the
-  // compiler's vectorization.
-  std::byte* pData =
-      this->_mipLevel == 0
-          ? this->_imageAsset->pixelData.data()
-          : this->_imageAsset->pixelData.data() +
-                this->_imageAsset->mipPositions[this->_mipLevel].byteOffset;
-  const size_t size =
-      this->_mipLevel == 0
-          ? this->_imageAsset->pixelData.size()
-          : this->_imageAsset->mipPositions[this->_mipLevel].byteSize;
-  for (size_t i = 0; i < size; i += 4) {
-    // We need to turn BGRA to RGBA, but this is little endian so it's really
-    // ARGB to ABGR.
-    uint32_t* pPixel = reinterpret_cast<uint32_t*>(pData + i);
-    const uint32_t pixel = *pPixel;
-    const uint32_t newPixel =
-        (pixel & 0xff000000) | ((pixel & 0x00ff0000) >> 16) |
-        (pixel & 0x0000ff00) | ((pixel & 0x000000ff) << 16);
-    *pPixel = newPixel;
+  std::byte* pData = this->getImageAssetData();
+  const size_t size = this->getImageAssetByteSize();
+
+  if (this->_pPool) {
+    // Copy each row out of the pooled image, whose stride may differ from the
+    // destination's, converting the pixels along the way.
+    BLImageData imageData{};
+    this->_image.getData(&imageData);
+    const size_t rowSize = size_t(imageData.size.w) * 4;
+    const std::byte* pSource =
+        static_cast<const std::byte*>(imageData.pixelData);
+    for (size_t offset = 0; offset + rowSize <= size; offset += rowSize) {
+      convertBgraToRgba(pSource, pData + offset, rowSize);
+      pSource += imageData.stride;
+    }
+
+    this->_pPool->release(
+        {std::move(this->_image), std::move(this->_context)});
+  } else {
+    convertBgraToRgba(pData, pData, size);
   }
 
   this->_finalized = true;
   return this->_imageAsset;
 }
 
+void VectorRasterizer::releaseToPool() noexcept {
+  if (this->_pPool && !this->_finalized) {
+    this->_context.end();
+    this->_pPool->release(
+        {std::move(this->_image), std::move(this->_context)});
+    this->_pPool = nullptr;
+  }
+}
+
+std::byte* VectorRasterizer::getImageAssetData() const {
+  return this->_mipLevel == 0
+             ? this->_imageAsset->pixelData.data()
+             : this->_imageAsset->pixelData.data() +
+                   this->_imageAsset->mipPositions[this->_mipLevel].byteOffset;
+}
+
+size_t VectorRasterizer::getImageAssetByteSize() const {
+  return this->_mipLevel == 0
+             ? this->_imageAsset->pixelData.size()
+             : this->_imageAsset->mipPositions[this->_mipLevel].byteSize;
+}
+
 } // namespace CesiumVectorData
@@ -0,0 +1,76 @@
+#include <CesiumVectorData/VectorRasterizerPool.h>
+
+// blend2d.h not used directly, but if we don't include it the other blend2d
+// headers will emit a warning NOLINTNEXTLINE(misc-include-cleaner)
+#include <blend2d.h>
+#include <blend2d/context.h>
+#include <blend2d/format.h>
+#include <blend2d/image.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace CesiumVectorData {
+
+VectorRasterizerPool::VectorRasterizerPool(
+    const VectorRasterizerPoolOptions& options)
+    : _options(options), _mutex(), _idle() {}
+
+size_t VectorRasterizerPool::getIdleCanvasCount() const {
+  std::scoped_lock lock(this->_mutex);
+  return this->_idle.size();
+}
+
+VectorRasterizerPool::Canvas
+VectorRasterizerPool::acquire(int32_t width, int32_t height) {
+  Canvas canvas;
+
+  {
+    std::scoped_lock lock(this->_mutex);
+    if (!this->_idle.empty()) {
+      // Prefer a canvas whose image already has the right size, which is the
+      // common case because tiles of one overlay tend to share a size.
+      auto it = this->_idle.begin();
+      for (; it != this->_idle.end(); ++it) {
+        if (it->image.width() == width && it->image.height() == height) {
+          break;
+        }
+      }
+      if (it == this->_idle.end()) {
+        it = this->_idle.end() - 1;
+      }
+
+      canvas = std::move(*it);
+      this->_idle.erase(it);
+    }
+  }
+
+  if (canvas.image.width() != width || canvas.image.height() != height) {
+    canvas.image.create(width, height, BL_FORMAT_PRGB32);
+  }
+
+  return canvas;
+}
+
+void VectorRasterizerPool::release(Canvas&& canvas) {
+  std::scoped_lock lock(this->_mutex);
+  if (this->_idle.size() < this->_options.maximumIdleCanvases) {
+    this->_idle.emplace_back(std::move(canvas));
+  }
+}
+
+BLContextCreateInfo
+VectorRasterizerPool::createInfoFor(int32_t width, int32_t height) const {
+  BLContextCreateInfo createInfo{};
+  if (this->_options.threadCount > 0 &&
+      int64_t(width) * int64_t(height) >=
+          this->_options.minimumMultithreadedPixels) {
+    createInfo.threadCount = this->_options.threadCount;
+  }
+  return createInfo;
+}
+
+} // namespace CesiumVectorData
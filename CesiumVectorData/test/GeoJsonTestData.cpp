@@ -0,0 +1,162 @@
+#include "GeoJsonTestData.h"
+
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumNativeTests/readFile.h>
+#include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/JsonValue.h>
+#include <CesiumUtility/Result.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
+#include <CesiumVectorData/GeoJsonDocument.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/GeoJsonObjectTypes.h>
+
+#include <doctest/doctest.h>
+#include <glm/common.hpp>
+#include <glm/ext/vector_double3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumUtility;
+using namespace CesiumVectorData;
+
+namespace CesiumNativeTests {
+
+namespace {
+int64_t estimateJsonValueBytes(const JsonValue& value);
+
+int64_t estimateJsonObjectBytes(const JsonValue::Object& object) {
+  int64_t accum = 0;
+  for (const auto& [key, member] : object) {
+    // Each map node also holds three pointers and a color.
+    accum += int64_t(sizeof(key) + key.capacity() + 4 * sizeof(void*));
+    accum += estimateJsonValueBytes(member);
+  }
+  return accum;
+}
+
+int64_t estimateJsonValueBytes(const JsonValue& value) {
+  int64_t accum = int64_t(sizeof(JsonValue));
+  if (value.isString()) {
+    accum += int64_t(value.getString().capacity());
+  } else if (value.isArray()) {
+    for (const JsonValue& element : value.getArray()) {
+      accum += estimateJsonValueBytes(element);
+    }
+  } else if (value.isObject()) {
+    accum += estimateJsonObjectBytes(value.getObject());
+  }
+  return accum;
+}
+} // namespace
+
+GeoJsonObject readGeoJsonObject(const std::string& fileName) {
+  Result<GeoJsonDocument> doc = GeoJsonDocument::fromGeoJson(readFile(
+      std::filesystem::path(CesiumVectorData_TEST_DATA_DIR) / "geojson" /
+      fileName));
+  REQUIRE(doc.value);
+  return std::move(doc.value->rootObject);
+}
+
+CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset>
+createImageAsset(int32_t width, int32_t height) {
+  CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset;
+  asset.emplace();
+  asset->width = width;
+  asset->height = height;
+  asset->channels = 4;
+  asset->bytesPerChannel = 1;
+  asset->pixelData.resize(
+      size_t(width) * size_t(height) * 4,
+      std::byte{255});
+  return asset;
+}
+
+GlobeRectangle computeBounds(const GeoJsonColumnarData& data) {
+  glm::dvec3 minimum(std::numeric_limits<double>::max());
+  glm::dvec3 maximum(std::numeric_limits<double>::lowest());
+  for (const glm::dvec3& position : data.getPositions()) {
+    minimum = glm::min(minimum, position);
+    maximum = glm::max(maximum, position);
+  }
+  return GlobeRectangle::fromDegrees(
+      minimum.x,
+      minimum.y,
+      maximum.x,
+      maximum.y);
+}
+
+int64_t estimateObjectBytes(const GeoJsonObject& rootObject) {
+  struct SizeVisitor {
+    int64_t operator()(const GeoJsonPoint& /*point*/) { return 0; }
+    int64_t operator()(const GeoJsonMultiPoint& points) {
+      return int64_t(points.coordinates.capacity() * sizeof(glm::dvec3));
+    }
+    int64_t operator()(const GeoJsonLineString& line) {
+      return int64_t(line.coordinates.capacity() * sizeof(glm::dvec3));
+    }
+    int64_t operator()(const GeoJsonMultiLineString& lines) {
+      int64_t accum = int64_t(
+          lines.coordinates.capacity() * sizeof(std::vector<glm::dvec3>));
+      for (const std::vector<glm::dvec3>& line : lines.coordinates) {
+        accum += int64_t(line.capacity() * sizeof(glm::dvec3));
+      }
+      return accum;
+    }
+    int64_t operator()(const GeoJsonPolygon& polygon) {
+      int64_t accum = int64_t(
+          polygon.coordinates.capacity() * sizeof(std::vector<glm::dvec3>));
+      for (const std::vector<glm::dvec3>& ring : polygon.coordinates) {
+        accum += int64_t(ring.capacity() * sizeof(glm::dvec3));
+      }
+      return accum;
+    }
+    int64_t operator()(const GeoJsonMultiPolygon& polygons) {
+      int64_t accum = int64_t(
+          polygons.coordinates.capacity() *
+          sizeof(std::vector<std::vector<glm::dvec3>>));
+      for (const std::vector<std::vector<glm::dvec3>>& polygon :
+           polygons.coordinates) {
+        accum +=
+            int64_t(polygon.capacity() * sizeof(std::vector<glm::dvec3>));
+        for (const std::vector<glm::dvec3>& ring : polygon) {
+          accum += int64_t(ring.capacity() * sizeof(glm::dvec3));
+        }
+      }
+      return accum;
+    }
+    int64_t operator()(const GeoJsonFeature& feature) {
+      int64_t accum = 0;
+      if (const std::string* pId = std::get_if<std::string>(&feature.id)) {
+        accum += int64_t(pId->capacity());
+      }
+      if (feature.properties) {
+        accum += estimateJsonObjectBytes(*feature.properties);
+      }
+      return accum;
+    }
+    int64_t operator()(const GeoJsonFeatureCollection& /*collection*/) {
+      return 0;
+    }
+    int64_t operator()(const GeoJsonGeometryCollection& /*collection*/) {
+      return 0;
+    }
+  };
+
+  int64_t accum = 0;
+  for (const GeoJsonObject& object : rootObject) {
+    accum += int64_t(sizeof(GeoJsonObject));
+    accum += object.visit(SizeVisitor{});
+  }
+  return accum;
+}
+
+} // namespace CesiumNativeTests
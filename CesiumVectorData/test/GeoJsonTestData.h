@@ -0,0 +1,29 @@
+#pragma once
+
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+
+#include <cstdint>
+#include <string>
+
+namespace CesiumNativeTests {
+
+// Reads a GeoJSON file from the geojson test data directory.
+CesiumVectorData::GeoJsonObject readGeoJsonObject(const std::string& fileName);
+
+// Creates a white RGBA image to rasterize into.
+CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset>
+createImageAsset(int32_t width, int32_t height);
+
+// Computes the rectangle enclosing all positions of the columnar data.
+CesiumGeospatial::GlobeRectangle
+computeBounds(const CesiumVectorData::GeoJsonColumnarData& data);
+
+// Estimates the memory used by a GeoJsonObject hierarchy, for comparison with
+// GeoJsonColumnarData::getSizeBytes.
+int64_t estimateObjectBytes(const CesiumVectorData::GeoJsonObject& rootObject);
+
+} // namespace CesiumNativeTests
@@ -0,0 +1,235 @@
+#include "GeoJsonTestData.h"
+
+#include <CesiumGeospatial/CartographicPolygon.h>
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumNativeTests/readFile.h>
+#include <CesiumNativeTests/writeTga.h>
+#include <CesiumUtility/Color.h>
+#include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/Math.h>
+#include <CesiumUtility/Result.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
+#include <CesiumVectorData/GeoJsonDocument.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/VectorRasterizer.h>
+#include <CesiumVectorData/VectorRasterizerPool.h>
+#include <CesiumVectorData/VectorStyle.h>
+
+#include <doctest/doctest.h>
+#include <glm/common.hpp>
+#include <glm/ext/vector_double2.hpp>
+#include <glm/ext/vector_double3.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumVectorData;
+using namespace CesiumUtility;
+using namespace CesiumNativeTests;
+
+TEST_CASE("VectorRasterizer::rasterize benchmark" * doctest::skip(true)) {
+  GlobeRectangle rect{
+      0.0,
+      0.0,
+      Math::degreesToRadians(1.0),
+      Math::degreesToRadians(1.0)};
+  std::chrono::steady_clock clock;
+  std::random_device r;
+  std::default_random_engine rand(r());
+
+  std::chrono::microseconds total(0);
+
+  CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset;
+  asset.emplace();
+  asset->width = 256;
+  asset->height = 256;
+  asset->channels = 4;
+  asset->bytesPerChannel = 1;
+  asset->pixelData.resize(
+      (size_t)(asset->width * asset->height * asset->channels *
+               asset->bytesPerChannel),
+      std::byte{255});
+
+  for (int i = 0; i < 100; i++) {
+    std::vector<CartographicPolygon> polygons;
+    std::vector<VectorStyle> styles;
+    std::uniform_real_distribution<double> uniformDist;
+    for (int j = 0; j < 1000; j++) {
+      polygons.emplace_back(std::vector<glm::dvec2>{
+          glm::dvec2(
+              Math::degreesToRadians(uniformDist(rand)),
+              Math::degreesToRadians(uniformDist(rand))),
+          glm::dvec2(
+              Math::degreesToRadians(uniformDist(rand)),
+              Math::degreesToRadians(uniformDist(rand))),
+          glm::dvec2(
+              Math::degreesToRadians(uniformDist(rand)),
+              Math::degreesToRadians(uniformDist(rand))),
+      });
+      styles.emplace_back(Color{
+          (uint8_t)(uniformDist(rand) * 255.0),
+          (uint8_t)(uniformDist(rand) * 255.0),
+          (uint8_t)(uniformDist(rand) * 255.0),
+          (uint8_t)(uniformDist(rand) * 255.0)});
+    }
+
+    std::chrono::steady_clock::time_point start = clock.now();
+
+    VectorRasterizer rasterizer(rect, asset);
+    for (size_t j = 0; j < polygons.size(); j++) {
+      rasterizer.drawPolygon(polygons[j], styles[j].polygon);
+    }
+    rasterizer.finalize();
+
+    std::chrono::microseconds time =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            clock.now() - start);
+    total += time;
+    std::cout << "rasterized 1000 triangles in " << time.count()
+              << " microseconds\n";
+    writeImageToTgaFile(
+        *asset,
+        std::filesystem::path(CESIUM_NATIVE_TEMP_DIR) / "rand.tga");
+  }
+
+  double seconds =
+      std::chrono::duration_cast<std::chrono::duration<double>>(total).count();
+  std::cout << "100 runs in " << seconds << " seconds, avg per run "
+            << (seconds / 100.0) << " seconds\n";
+}
+
+TEST_CASE(
+    "VectorRasterizer full zoom level benchmark" * doctest::skip(true)) {
+  const std::filesystem::path path =
+      std::filesystem::path(CesiumVectorData_TEST_DATA_DIR) / "geojson" /
+      "fire.json";
+  Result<GeoJsonDocument> document =
+      GeoJsonDocument::fromGeoJson(readFile(path));
+  REQUIRE(document.value);
+  const GeoJsonObject& rootObject = document.value->rootObject;
+
+  glm::dvec2 minimum(std::numeric_limits<double>::max());
+  glm::dvec2 maximum(std::numeric_limits<double>::lowest());
+  for (const std::vector<std::vector<glm::dvec3>>& polygon :
+       rootObject.polygons()) {
+    for (const std::vector<glm::dvec3>& ring : polygon) {
+      for (const glm::dvec3& point : ring) {
+        minimum = glm::min(minimum, glm::dvec2(point));
+        maximum = glm::max(maximum, glm::dvec2(point));
+      }
+    }
+  }
+
+  const VectorStyle style{Color{255, 128, 0, 255}};
+
+  // Rasterizes every tile of a zoom level covering the document, and returns
+  // the number of tiles rasterized per second.
+  const auto rasterizeZoomLevel = [&](uint32_t tilesPerSide,
+                                      int32_t tileSize,
+                                      VectorRasterizerPool* pPool) {
+    const glm::dvec2 tileExtent =
+        (maximum - minimum) / double(tilesPerSide);
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    for (uint32_t y = 0; y < tilesPerSide; ++y) {
+      for (uint32_t x = 0; x < tilesPerSide; ++x) {
+        const glm::dvec2 tileMinimum =
+            minimum + tileExtent * glm::dvec2(double(x), double(y));
+        const glm::dvec2 tileMaximum = tileMinimum + tileExtent;
+        const GlobeRectangle tileRect = GlobeRectangle::fromDegrees(
+            tileMinimum.x,
+            tileMinimum.y,
+            tileMaximum.x,
+            tileMaximum.y);
+
+        CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset =
+            createImageAsset(tileSize, tileSize);
+        if (pPool) {
+          VectorRasterizer rasterizer(tileRect, asset, *pPool);
+          rasterizer.drawGeoJsonObject(rootObject, style);
+          rasterizer.finalize();
+        } else {
+          VectorRasterizer rasterizer(tileRect, asset);
+          rasterizer.drawGeoJsonObject(rootObject, style);
+          rasterizer.finalize();
+        }
+      }
+    }
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    return double(tilesPerSide) * double(tilesPerSide) / seconds;
+  };
+
+  for (int32_t tileSize : {256, 2048}) {
+    const uint32_t tilesPerSide = tileSize == 256 ? 16 : 2;
+    VectorRasterizerPool singleThreadedPool(
+        VectorRasterizerPoolOptions{.threadCount = 0});
+    VectorRasterizerPool multiThreadedPool;
+
+    std::cout << tilesPerSide << "x" << tilesPerSide << " tiles of "
+              << tileSize << "x" << tileSize << " pixels:\n";
+    std::cout << "  without a pool: "
+              << rasterizeZoomLevel(tilesPerSide, tileSize, nullptr)
+              << " tiles/sec\n";
+    std::cout << "  with a single-threaded pool: "
+              << rasterizeZoomLevel(tilesPerSide, tileSize, &singleThreadedPool)
+              << " tiles/sec\n";
+    std::cout << "  with a multi-threaded pool: "
+              << rasterizeZoomLevel(tilesPerSide, tileSize, &multiThreadedPool)
+              << " tiles/sec\n";
+  }
+}
+
+TEST_CASE("GeoJsonColumnarData benchmark" * doctest::skip(true)) {
+  const VectorStyle style{Color{255, 128, 0, 255}};
+  constexpr int32_t iterations = 100;
+
+  for (const std::string fileName :
+       {"fire.json",
+        "photovoltaic.json",
+        "roads-seoul.geojson",
+        "ship-trajectories.json"}) {
+    const GeoJsonObject root = readGeoJsonObject(fileName);
+    const GeoJsonColumnarData data(root);
+    const GlobeRectangle rect = computeBounds(data);
+
+    const auto measure = [&](const auto& draw) {
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset =
+          createImageAsset(512, 512);
+      const std::chrono::steady_clock::time_point start =
+          std::chrono::steady_clock::now();
+      for (int32_t i = 0; i < iterations; ++i) {
+        VectorRasterizer rasterizer(rect, asset);
+        draw(rasterizer);
+        rasterizer.finalize();
+      }
+      const double seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+      return double(iterations) / seconds;
+    };
+
+    const double objectRate = measure([&](VectorRasterizer& rasterizer) {
+      rasterizer.drawGeoJsonObject(root, style);
+    });
+    const double columnarRate = measure([&](VectorRasterizer& rasterizer) {
+      rasterizer.drawGeoJsonColumnarData(data, style);
+    });
+
+    std::cout << fileName << ":\n";
+    std::cout << "  object hierarchy: ~" << estimateObjectBytes(root)
+              << " bytes, " << objectRate << " images/sec\n";
+    std::cout << "  columnar data: " << data.getSizeBytes() << " bytes, "
+              << columnarRate << " images/sec\n";
+  }
+}
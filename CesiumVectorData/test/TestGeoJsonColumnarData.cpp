@@ -0,0 +1,279 @@
+#include "GeoJsonTestData.h"
+
+#include <CesiumGeospatial/GlobeRectangle.h>
+#include <CesiumImage/ImageAsset.h>
+#include <CesiumUtility/Color.h>
+#include <CesiumUtility/IntrusivePointer.h>
+#include <CesiumUtility/JsonValue.h>
+#include <CesiumUtility/Result.h>
+#include <CesiumVectorData/GeoJsonColumnarData.h>
+#include <CesiumVectorData/GeoJsonDocument.h>
+#include <CesiumVectorData/GeoJsonObject.h>
+#include <CesiumVectorData/GeoJsonObjectTypes.h>
+#include <CesiumVectorData/VectorRasterizer.h>
+#include <CesiumVectorData/VectorStyle.h>
+
+#include <doctest/doctest.h>
+#include <glm/ext/vector_double3.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace CesiumGeospatial;
+using namespace CesiumVectorData;
+using namespace CesiumUtility;
+using namespace CesiumNativeTests;
+
+namespace {
+GeoJsonObject parseGeoJsonObject(const std::string& json) {
+  Result<GeoJsonDocument> doc =
+      GeoJsonDocument::fromGeoJson(std::span<const std::byte>(
+          reinterpret_cast<const std::byte*>(json.data()),
+          json.size()));
+  REQUIRE(doc.value);
+  return std::move(doc.value->rootObject);
+}
+} // namespace
+
+TEST_CASE("GeoJsonColumnarData") {
+  SUBCASE("stores the positions of each geometry in parts and rings") {
+    const GeoJsonObject root = parseGeoJsonObject(R"==(
+{
+  "type": "FeatureCollection",
+  "features": [
+    {
+      "type": "Feature",
+      "id": "first",
+      "geometry": { "type": "Point", "coordinates": [1, 2, 3] },
+      "properties": null
+    },
+    {
+      "type": "Feature",
+      "id": 7,
+      "geometry": {
+        "type": "Polygon",
+        "coordinates": [
+          [[0, 0], [4, 0], [4, 4], [0, 0]],
+          [[1, 1], [2, 1], [1, 2], [1, 1]]
+        ]
+      },
+      "properties": null
+    },
+    {
+      "type": "Feature",
+      "geometry": {
+        "type": "GeometryCollection",
+        "geometries": [
+          {
+            "type": "MultiLineString",
+            "coordinates": [[[5, 5], [6, 6]], [[7, 7], [8, 8], [9, 9]]]
+          },
+          { "type": "MultiPoint", "coordinates": [] }
+        ]
+      },
+      "properties": null
+    }
+  ]
+}
+    )==");
+
+    const GeoJsonColumnarData data(root);
+
+    REQUIRE(data.getFeatureCount() == 3);
+    CHECK(std::get<std::string>(data.getFeatureId(0)) == "first");
+    CHECK(std::get<int64_t>(data.getFeatureId(1)) == 7);
+    CHECK(std::holds_alternative<std::monostate>(data.getFeatureId(2)));
+
+    const std::span<const GeoJsonColumnarGeometry> geometries =
+        data.getGeometries();
+    REQUIRE(geometries.size() == 4);
+
+    CHECK(geometries[0].type == GeoJsonObjectType::Point);
+    CHECK(geometries[0].featureIndex == 0);
+    REQUIRE(geometries[0].partCount == 1);
+    REQUIRE(data.getRingCount(geometries[0].firstPart) == 1);
+    const std::span<const glm::dvec3> point =
+        data.getRingPositions(geometries[0].firstPart, 0);
+    REQUIRE(point.size() == 1);
+    CHECK(point[0] == glm::dvec3(1, 2, 3));
+
+    CHECK(geometries[1].type == GeoJsonObjectType::Polygon);
+    CHECK(geometries[1].featureIndex == 1);
+    REQUIRE(geometries[1].partCount == 1);
+    REQUIRE(data.getRingCount(geometries[1].firstPart) == 2);
+    CHECK(data.getRingPositions(geometries[1].firstPart, 0).size() == 4);
+    const std::span<const glm::dvec3> hole =
+        data.getRingPositions(geometries[1].firstPart, 1);
+    REQUIRE(hole.size() == 4);
+    CHECK(hole[1] == glm::dvec3(2, 1, 0));
+
+    // Geometries within a GeometryCollection belong to the collection's
+    // feature.
+    CHECK(geometries[2].type == GeoJsonObjectType::MultiLineString);
+    CHECK(geometries[2].featureIndex == 2);
+    REQUIRE(geometries[2].partCount == 2);
+    CHECK(data.getRingPositions(geometries[2].firstPart, 0).size() == 2);
+    const std::span<const glm::dvec3> secondLine =
+        data.getRingPositions(geometries[2].firstPart + 1, 0);
+    REQUIRE(secondLine.size() == 3);
+    CHECK(secondLine[2] == glm::dvec3(9, 9, 0));
+
+    CHECK(geometries[3].type == GeoJsonObjectType::MultiPoint);
+    CHECK(geometries[3].featureIndex == 2);
+    REQUIRE(geometries[3].partCount == 1);
+    CHECK(data.getRingPositions(geometries[3].firstPart, 0).empty());
+
+    CHECK(data.getPositions().size() == 1 + 8 + 5);
+    CHECK(data.getProperties().empty());
+  }
+
+  SUBCASE("geometry outside of a feature has no feature index") {
+    const GeoJsonObject root = parseGeoJsonObject(R"==(
+{ "type": "LineString", "coordinates": [[1, 2], [3, 4]] }
+    )==");
+
+    const GeoJsonColumnarData data(root);
+
+    CHECK(data.getFeatureCount() == 0);
+    REQUIRE(data.getGeometries().size() == 1);
+    CHECK(data.getGeometries()[0].featureIndex == -1);
+    CHECK(data.getPositions().size() == 2);
+  }
+
+  SUBCASE("stores each property in a column of the narrowest type") {
+    const GeoJsonObject root = parseGeoJsonObject(R"==(
+{
+  "type": "FeatureCollection",
+  "features": [
+    {
+      "type": "Feature",
+      "geometry": null,
+      "properties": {
+        "flag": true,
+        "count": 1,
+        "ratio": 1,
+        "name": "abc",
+        "mixed": 1,
+        "nothing": null
+      }
+    },
+    {
+      "type": "Feature",
+      "geometry": null,
+      "properties": null
+    },
+    {
+      "type": "Feature",
+      "geometry": null,
+      "properties": {
+        "flag": false,
+        "count": -5,
+        "ratio": 2.5,
+        "name": "de",
+        "mixed": "one"
+      }
+    }
+  ]
+}
+    )==");
+
+    const GeoJsonColumnarData data(root);
+    REQUIRE(data.getFeatureCount() == 3);
+    CHECK(data.getGeometries().empty());
+
+    // Columns are sorted by name.
+    const std::span<const GeoJsonPropertyColumn> properties =
+        data.getProperties();
+    REQUIRE(properties.size() == 6);
+    CHECK(properties[0].getName() == "count");
+    CHECK(properties[5].getName() == "ratio");
+    CHECK(data.findProperty("missing") == nullptr);
+
+    const GeoJsonPropertyColumn* pFlag = data.findProperty("flag");
+    REQUIRE(pFlag);
+    CHECK(pFlag->getType() == GeoJsonPropertyColumnType::Boolean);
+    CHECK(pFlag->hasValue(0));
+    CHECK(!pFlag->hasValue(1));
+    CHECK(pFlag->getBool(0));
+    CHECK(!pFlag->getBool(2));
+
+    const GeoJsonPropertyColumn* pCount = data.findProperty("count");
+    REQUIRE(pCount);
+    CHECK(pCount->getType() == GeoJsonPropertyColumnType::Int64);
+    CHECK(pCount->getInt64Values().size() == 3);
+    CHECK(pCount->getInt64Values()[0] == 1);
+    CHECK(pCount->getInt64Values()[2] == -5);
+
+    const GeoJsonPropertyColumn* pRatio = data.findProperty("ratio");
+    REQUIRE(pRatio);
+    CHECK(pRatio->getType() == GeoJsonPropertyColumnType::Double);
+    CHECK(pRatio->getDoubleValues()[0] == 1.0);
+    CHECK(pRatio->getDoubleValues()[2] == 2.5);
+
+    const GeoJsonPropertyColumn* pName = data.findProperty("name");
+    REQUIRE(pName);
+    CHECK(pName->getType() == GeoJsonPropertyColumnType::String);
+    CHECK(pName->getString(0) == "abc");
+    CHECK(pName->getString(1).empty());
+    CHECK(pName->getString(2) == "de");
+
+    const GeoJsonPropertyColumn* pMixed = data.findProperty("mixed");
+    REQUIRE(pMixed);
+    CHECK(pMixed->getType() == GeoJsonPropertyColumnType::Json);
+    CHECK(pMixed->getJsonValue(0) == JsonValue(int64_t(1)));
+    CHECK(pMixed->getJsonValue(1).isNull());
+    CHECK(pMixed->getJsonValue(2) == JsonValue(std::string("one")));
+
+    const GeoJsonPropertyColumn* pNothing = data.findProperty("nothing");
+    REQUIRE(pNothing);
+    CHECK(!pNothing->hasValue(0));
+    CHECK(pNothing->getJsonValue(0).isNull());
+
+    CHECK(pName->getJsonValue(2) == JsonValue(std::string("de")));
+    CHECK(pCount->getJsonValue(2) == JsonValue(int64_t(-5)));
+    CHECK(pFlag->getJsonValue(0) == JsonValue(true));
+  }
+
+  SUBCASE("uses less memory than the object hierarchy") {
+    const GeoJsonObject root = readGeoJsonObject("photovoltaic.json");
+    const GeoJsonColumnarData data(root);
+    CHECK(data.getSizeBytes() < estimateObjectBytes(root));
+  }
+}
+
+TEST_CASE("VectorRasterizer::drawGeoJsonColumnarData") {
+  for (const std::string fileName :
+       {"polygon-samples.geojson",
+        "line-samples.geojson",
+        "point-samples.geojson",
+        "roads-seoul.geojson"}) {
+    CAPTURE(fileName);
+
+    const GeoJsonObject root = readGeoJsonObject(fileName);
+    const GeoJsonColumnarData data(root);
+    const GlobeRectangle rect = computeBounds(data);
+    VectorStyle style{Color{255, 128, 0, 255}};
+    LineStyle outline;
+    outline.color = Color{0, 0, 255, 255};
+    style.polygon.outline = outline;
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> expected =
+        createImageAsset(256, 256);
+    VectorRasterizer objectRasterizer(rect, expected);
+    objectRasterizer.drawGeoJsonObject(root, style);
+    objectRasterizer.finalize();
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> actual =
+        createImageAsset(256, 256);
+    VectorRasterizer columnarRasterizer(rect, actual);
+    columnarRasterizer.drawGeoJsonColumnarData(data, style);
+    columnarRasterizer.finalize();
+
+    CHECK(actual->pixelData == expected->pixelData);
+  }
+}
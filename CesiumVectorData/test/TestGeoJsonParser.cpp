@@ -11,12 +11,16 @@
 #include <CesiumVectorData/GeoJsonObjectTypes.h>
 
 #include <doctest/doctest.h>
+#include <glm/ext/vector_double3.hpp>
+#include <rapidjson/document.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <span>
 #include <string>
 #include <variant>
+#include <vector>
 
 using namespace CesiumVectorData;
 using namespace CesiumUtility;
@@ -39,6 +43,63 @@ void expectParserResult(
   REQUIRE(doc.value);
   checkFunc(*doc.value);
 }
+
+// Checks that two objects have the same structure, members, and coordinates.
+void checkSameObjects(
+    const GeoJsonObject& expected,
+    const GeoJsonObject& actual) {
+  auto expectedIt = expected.begin();
+  auto actualIt = actual.begin();
+  for (; expectedIt != expected.end() && actualIt != actual.end();
+       ++expectedIt, ++actualIt) {
+    REQUIRE(actualIt->getType() == expectedIt->getType());
+    CHECK(actualIt->getForeignMembers() == expectedIt->getForeignMembers());
+    CHECK(
+        actualIt->getBoundingBox().has_value() ==
+        expectedIt->getBoundingBox().has_value());
+    const GeoJsonFeature* pExpectedFeature =
+        expectedIt->getIf<GeoJsonFeature>();
+    if (pExpectedFeature) {
+      const GeoJsonFeature& actualFeature = actualIt->get<GeoJsonFeature>();
+      CHECK(actualFeature.id == pExpectedFeature->id);
+      CHECK(actualFeature.properties == pExpectedFeature->properties);
+    }
+  }
+  CHECK(expectedIt == expected.end());
+  CHECK(actualIt == actual.end());
+
+  std::vector<glm::dvec3> expectedPoints;
+  for (const glm::dvec3& point : expected.points()) {
+    expectedPoints.emplace_back(point);
+  }
+  std::vector<glm::dvec3> actualPoints;
+  for (const glm::dvec3& point : actual.points()) {
+    actualPoints.emplace_back(point);
+  }
+  CHECK(actualPoints == expectedPoints);
+
+  std::vector<std::vector<glm::dvec3>> expectedLines;
+  for (const std::vector<glm::dvec3>& line : expected.lines()) {
+    expectedLines.emplace_back(line);
+  }
+  std::vector<std::vector<glm::dvec3>> actualLines;
+  for (const std::vector<glm::dvec3>& line : actual.lines()) {
+    actualLines.emplace_back(line);
+  }
+  CHECK(actualLines == expectedLines);
+
+  std::vector<std::vector<std::vector<glm::dvec3>>> expectedPolygons;
+  for (const std::vector<std::vector<glm::dvec3>>& polygon :
+       expected.polygons()) {
+    expectedPolygons.emplace_back(polygon);
+  }
+  std::vector<std::vector<std::vector<glm::dvec3>>> actualPolygons;
+  for (const std::vector<std::vector<glm::dvec3>>& polygon :
+       actual.polygons()) {
+    actualPolygons.emplace_back(polygon);
+  }
+  CHECK(actualPolygons == expectedPolygons);
+}
 } // namespace
 
 TEST_CASE("Parse Point primitives") {
@@ -746,4 +807,270 @@ TEST_CASE("Load GeoJSON from URL") {
   CHECK(
       result.value->rootObject.get<GeoJsonPoint>().coordinates ==
       glm::dvec3(42.3, 49.34, 11.3413));
-}
\ No newline at end of file
+}
+TEST_CASE("Parse GeoJSON members in any order") {
+  SUBCASE("Geometry with 'type' last") {
+    expectParserResult(
+        R"==(
+        {
+          "coordinates": [[[0, 0], [1, 0], [1, 1], [0, 1]]],
+          "bbox": [0, 0, 1, 1],
+          "test": [1, 2, 3],
+          "type": "Polygon"
+        }
+        )==",
+        [](const GeoJsonDocument& document) {
+          const GeoJsonPolygon* pPolygon =
+              document.rootObject.getIf<GeoJsonPolygon>();
+          REQUIRE(pPolygon);
+          REQUIRE(pPolygon->coordinates.size() == 1);
+          // The open ring is closed, just as when 'type' comes first.
+          CHECK(pPolygon->coordinates[0].size() == 5);
+          CHECK(pPolygon->coordinates[0][4] == glm::dvec3(0.0, 0.0, 0.0));
+          CHECK(pPolygon->boundingBox);
+          CHECK(
+              pPolygon->foreignMembers.at("test") ==
+              JsonValue(JsonValue::Array{1, 2, 3}));
+        });
+  }
+
+  SUBCASE("FeatureCollection with 'type' last") {
+    expectParserResult(
+        R"==(
+        {
+          "features": [
+            {
+              "geometry": { "coordinates": [1, 2], "type": "Point" },
+              "properties": { "name": "first" },
+              "coordinates": "not a geometry member",
+              "type": "Feature"
+            },
+            {
+              "type": "Feature",
+              "id": "second",
+              "geometry": null,
+              "properties": null
+            }
+          ],
+          "geometry": "foreign",
+          "type": "FeatureCollection"
+        }
+        )==",
+        [](const GeoJsonDocument& document) {
+          const GeoJsonFeatureCollection* pCollection =
+              document.rootObject.getIf<GeoJsonFeatureCollection>();
+          REQUIRE(pCollection);
+          REQUIRE(pCollection->features.size() == 2);
+          CHECK(
+              pCollection->foreignMembers.at("geometry") ==
+              JsonValue("foreign"));
+
+          const GeoJsonFeature& first =
+              pCollection->features[0].get<GeoJsonFeature>();
+          REQUIRE(first.geometry);
+          REQUIRE(first.geometry->isType<GeoJsonPoint>());
+          CHECK(
+              first.geometry->get<GeoJsonPoint>().coordinates ==
+              glm::dvec3(1.0, 2.0, 0.0));
+          CHECK(
+              first.properties ==
+              JsonValue::Object{{"name", JsonValue("first")}});
+          CHECK(
+              first.foreignMembers.at("coordinates") ==
+              JsonValue("not a geometry member"));
+
+          const GeoJsonFeature& second =
+              pCollection->features[1].get<GeoJsonFeature>();
+          CHECK(!second.geometry);
+          const std::string* pId = std::get_if<std::string>(&second.id);
+          REQUIRE(pId);
+          CHECK(*pId == "second");
+        });
+  }
+
+  SUBCASE("Errors are the same regardless of order") {
+    Result<GeoJsonDocument> doc = GeoJsonDocument::fromGeoJson(stringToBytes(
+        R"==({ "coordinates": [[[0, 0], [1, 1]]], "type": "Polygon" })=="));
+    REQUIRE(doc.errors.hasErrors());
+    CHECK(doc.errors.errors.size() == 1);
+    CHECK(
+        doc.errors.errors[0] ==
+        "Polygon 'coordinates' member must be an array of arrays of 4 or more "
+        "positions.");
+
+    doc = GeoJsonDocument::fromGeoJson(stringToBytes(
+        R"==({ "geometries": [1], "type": "GeometryCollection" })=="));
+    REQUIRE(doc.errors.hasErrors());
+    CHECK(doc.errors.errors.size() == 1);
+    CHECK(
+        doc.errors.errors[0] == "GeometryCollection 'geometries' member must "
+                                "contain only GeoJSON objects.");
+
+    doc = GeoJsonDocument::fromGeoJson(
+        stringToBytes(R"==({ "coordinates": [1, 2], "type": "Foo" })=="));
+    REQUIRE(doc.errors.hasErrors());
+    CHECK(doc.errors.errors.size() == 1);
+    CHECK(doc.errors.errors[0] == "Unknown GeoJSON object type: 'Foo'");
+  }
+}
+
+TEST_CASE("GeoJsonDocument::fromGeoJsonWithFeatureCallback") {
+  SUBCASE("Passes each feature of a FeatureCollection to the callback") {
+    const std::string json = R"==(
+      {
+        "type": "FeatureCollection",
+        "name": "collection",
+        "features": [
+          {
+            "type": "Feature",
+            "id": 1,
+            "properties": null,
+            "geometry": { "type": "Point", "coordinates": [1, 2] }
+          },
+          {
+            "type": "Feature",
+            "id": 2,
+            "properties": null,
+            "geometry": { "type": "Point", "coordinates": [3, 4] }
+          }
+        ]
+      }
+    )==";
+
+    std::vector<GeoJsonObject> features;
+    Result<GeoJsonDocument> doc =
+        GeoJsonDocument::fromGeoJsonWithFeatureCallback(
+            stringToBytes(json),
+            [&features](GeoJsonObject&& feature) {
+              features.emplace_back(std::move(feature));
+            });
+    CHECK(!doc.errors.hasErrors());
+    REQUIRE(doc.value);
+
+    const GeoJsonFeatureCollection* pCollection =
+        doc.value->rootObject.getIf<GeoJsonFeatureCollection>();
+    REQUIRE(pCollection);
+    CHECK(pCollection->features.empty());
+    CHECK(pCollection->foreignMembers.at("name") == JsonValue("collection"));
+
+    REQUIRE(features.size() == 2);
+    const int64_t* pId =
+        std::get_if<int64_t>(&features[0].get<GeoJsonFeature>().id);
+    REQUIRE(pId);
+    CHECK(*pId == 1);
+    CHECK(
+        features[1].get<GeoJsonFeature>().geometry->get<GeoJsonPoint>()
+            .coordinates == glm::dvec3(3.0, 4.0, 0.0));
+  }
+
+  SUBCASE("Other root objects are returned as usual") {
+    int32_t callCount = 0;
+    Result<GeoJsonDocument> doc =
+        GeoJsonDocument::fromGeoJsonWithFeatureCallback(
+            stringToBytes(R"==({ "type": "Point", "coordinates": [1, 2] })=="),
+            [&callCount](GeoJsonObject&&) { ++callCount; });
+    CHECK(!doc.errors.hasErrors());
+    REQUIRE(doc.value);
+    CHECK(doc.value->rootObject.isType<GeoJsonPoint>());
+    CHECK(callCount == 0);
+  }
+
+  SUBCASE("Reports errors in features") {
+    int32_t callCount = 0;
+    Result<GeoJsonDocument> doc =
+        GeoJsonDocument::fromGeoJsonWithFeatureCallback(
+            stringToBytes(R"==(
+              {
+                "type": "FeatureCollection",
+                "features": [
+                  { "type": "Feature", "geometry": null, "properties": null },
+                  { "type": "Feature", "geometry": 1, "properties": null }
+                ]
+              }
+            )=="),
+            [&callCount](GeoJsonObject&&) { ++callCount; });
+    CHECK(!doc.value);
+    REQUIRE(doc.errors.errors.size() == 1);
+    CHECK(
+        doc.errors.errors[0] ==
+        "Feature 'geometry' member must be either an object or null.");
+    CHECK(callCount == 1);
+  }
+}
+
+TEST_CASE("Streaming parser matches the JSON document parser") {
+  std::filesystem::path dir(
+      std::filesystem::path(CesiumVectorData_TEST_DATA_DIR) / "geojson");
+  for (auto& file : std::filesystem::directory_iterator(dir)) {
+    if (!file.path().extension().string().ends_with("json")) {
+      continue;
+    }
+    CAPTURE(file.path().filename().string());
+
+    const std::vector<std::byte> data = readFile(file.path());
+    rapidjson::Document document;
+    document.Parse(reinterpret_cast<const char*>(data.data()), data.size());
+    REQUIRE(!document.HasParseError());
+
+    Result<GeoJsonDocument> expected = GeoJsonDocument::fromGeoJson(document);
+    Result<GeoJsonDocument> actual = GeoJsonDocument::fromGeoJson(data);
+    REQUIRE(expected.value);
+    REQUIRE(actual.value);
+    CHECK(actual.errors.errors == expected.errors.errors);
+    CHECK(actual.errors.warnings == expected.errors.warnings);
+    checkSameObjects(expected.value->rootObject, actual.value->rootObject);
+
+    const GeoJsonFeatureCollection* pCollection =
+        expected.value->rootObject.getIf<GeoJsonFeatureCollection>();
+    if (pCollection) {
+      size_t featureIndex = 0;
+      Result<GeoJsonDocument> streamed =
+          GeoJsonDocument::fromGeoJsonWithFeatureCallback(
+              data,
+              [pCollection, &featureIndex](GeoJsonObject&& feature) {
+                REQUIRE(featureIndex < pCollection->features.size());
+                checkSameObjects(
+                    pCollection->features[featureIndex],
+                    feature);
+                ++featureIndex;
+              });
+      REQUIRE(streamed.value);
+      CHECK(featureIndex == pCollection->features.size());
+    }
+  }
+}
+
+TEST_CASE("Streaming parser slices members that appear before 'type'") {
+  const std::vector<std::string> inputs{
+      // A deferred member at the very start of the input.
+      R"==({"coordinates":[1,2],"type":"Point"})==",
+      // A deferred member that ends just before the end of the input.
+      R"==({"bbox":[0,0,1,1],"coordinates":[[0,0],[1,1]],"type":"LineString"})==",
+      // Deferred members nested in deferred members.
+      R"==({"features":[{"geometry":{"coordinates":[[[0,0],[1,0],[1,1],[0,1]]],"type":"Polygon"},"properties":null,"type":"Feature"}],"type":"FeatureCollection"})==",
+      R"==({"geometries":[{"geometries":[{"coordinates":[1,2],"type":"Point"}],"type":"GeometryCollection"}],"type":"GeometryCollection"})==",
+      // Strings with brackets and escaped quotes in deferred members.
+      R"==({"geometry":{"name":"}]\"{[","coordinates":[3,4],"type":"Point"},"properties":{"a":"]}"},"type":"Feature"})==",
+      R"==({"features":[{"type":"Feature","id":"}","properties":{"b":["]",{"c":"}"}]},"geometry":null}],"type":"FeatureCollection"})==",
+      // Whitespace around the brackets of deferred members.
+      "{ \"coordinates\" :\n\t[ [ 1 , 2 ] ,[3,4]\r\n] , \"type\": \"MultiPoint\" }",
+      "{\"geometry\":\n{\n\"coordinates\":[5,6],\"type\":\"Point\"\n}\n,"
+      "\"properties\":null,\"type\":\"Feature\"}\n"};
+
+  for (const std::string& json : inputs) {
+    CAPTURE(json);
+
+    rapidjson::Document document;
+    document.Parse(json.data(), json.size());
+    REQUIRE(!document.HasParseError());
+
+    Result<GeoJsonDocument> expected = GeoJsonDocument::fromGeoJson(document);
+    Result<GeoJsonDocument> actual =
+        GeoJsonDocument::fromGeoJson(stringToBytes(json));
+    REQUIRE(expected.value);
+    REQUIRE(actual.value);
+    CHECK(actual.errors.errors.empty());
+    CHECK(actual.errors.errors == expected.errors.errors);
+    checkSameObjects(expected.value->rootObject, actual.value->rootObject);
+  }
+}
@@ -1,3 +1,5 @@
+#include "GeoJsonTestData.h"
+
 #include <CesiumGeospatial/CartographicPolygon.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumImage/ImageAsset.h>
@@ -6,22 +8,43 @@
 #include <CesiumUtility/Color.h>
 #include <CesiumUtility/IntrusivePointer.h>
 #include <CesiumVectorData/VectorRasterizer.h>
+#include <CesiumVectorData/VectorRasterizerPool.h>
 
 #include <doctest/doctest.h>
 #include <fmt/format.h>
 #include <glm/fwd.hpp>
 
-#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <filesystem>
-#include <iostream>
-#include <random>
+#include <utility>
+#include <vector>
 
 using namespace CesiumGeospatial;
 using namespace CesiumVectorData;
 using namespace CesiumUtility;
 using namespace CesiumNativeTests;
 
+namespace {
+void drawTestScene(VectorRasterizer& rasterizer) {
+  const CartographicPolygon triangle(std::vector<glm::dvec2>{
+      glm::dvec2(Math::degreesToRadians(0.25), Math::degreesToRadians(0.25)),
+      glm::dvec2(Math::degreesToRadians(0.5), Math::degreesToRadians(0.75)),
+      glm::dvec2(Math::degreesToRadians(0.75), Math::degreesToRadians(0.25))});
+  const std::vector<glm::dvec3> polyline{
+      glm::dvec3(0.1, 0.9, 0.0),
+      glm::dvec3(0.5, 0.1, 0.0),
+      glm::dvec3(0.9, 0.9, 0.0)};
+
+  rasterizer.drawPolygon(
+      triangle,
+      VectorStyle{Color{0, 255, 255, 255}}.polygon);
+  rasterizer.drawPolyline(
+      polyline,
+      VectorStyle{Color{255, 50, 12, 128}}.line);
+}
+} // namespace
+
 TEST_CASE("VectorRasterizer::rasterize") {
   const std::filesystem::path dir(
       std::filesystem::path(CesiumVectorData_TEST_DATA_DIR) / "rasterized");
@@ -552,72 +575,177 @@ TEST_CASE("VectorRasterizer::rasterize") {
   }
 }
 
-TEST_CASE("VectorRasterizer::rasterize benchmark" * doctest::skip(true)) {
-  GlobeRectangle rect{
+TEST_CASE("VectorRasterizer with a VectorRasterizerPool") {
+  const GlobeRectangle rect{
       0.0,
       0.0,
       Math::degreesToRadians(1.0),
       Math::degreesToRadians(1.0)};
-  std::chrono::steady_clock clock;
-  std::random_device r;
-  std::default_random_engine rand(r());
-
-  std::chrono::microseconds total(0);
-
-  CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset;
-  asset.emplace();
-  asset->width = 256;
-  asset->height = 256;
-  asset->channels = 4;
-  asset->bytesPerChannel = 1;
-  asset->pixelData.resize(
-      (size_t)(asset->width * asset->height * asset->channels * asset->bytesPerChannel),
-      std::byte{255});
-
-  for (int i = 0; i < 100; i++) {
-    std::vector<CartographicPolygon> polygons;
-    std::vector<VectorStyle> styles;
-    std::uniform_real_distribution<double> uniformDist;
-    for (int j = 0; j < 1000; j++) {
-      polygons.emplace_back(std::vector<glm::dvec2>{
-          glm::dvec2(
-              Math::degreesToRadians(uniformDist(rand)),
-              Math::degreesToRadians(uniformDist(rand))),
-          glm::dvec2(
-              Math::degreesToRadians(uniformDist(rand)),
-              Math::degreesToRadians(uniformDist(rand))),
-          glm::dvec2(
-              Math::degreesToRadians(uniformDist(rand)),
-              Math::degreesToRadians(uniformDist(rand))),
-      });
-      styles.emplace_back(Color{
-          (uint8_t)(uniformDist(rand) * 255.0),
-          (uint8_t)(uniformDist(rand) * 255.0),
-          (uint8_t)(uniformDist(rand) * 255.0),
-          (uint8_t)(uniformDist(rand) * 255.0)});
+
+  SUBCASE("produces the same image as a rasterizer without a pool") {
+    VectorRasterizerPool pool;
+
+    // Rasterize several sizes, in an order that makes the pool reuse images
+    // that previously held other content.
+    for (int32_t size : {256, 128, 256, 256}) {
+      CAPTURE(size);
+
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> expected =
+          createImageAsset(size, size);
+      VectorRasterizer unpooled(rect, expected);
+      drawTestScene(unpooled);
+      unpooled.finalize();
+
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> actual =
+          createImageAsset(size, size);
+      VectorRasterizer pooled(rect, actual, pool);
+      drawTestScene(pooled);
+      pooled.finalize();
+
+      CHECK(actual->pixelData == expected->pixelData);
+      CHECK(pool.getIdleCanvasCount() == 1);
     }
+  }
 
-    std::chrono::steady_clock::time_point start = clock.now();
+  SUBCASE("rasterizes mip levels") {
+    VectorRasterizerPool pool;
 
-    VectorRasterizer rasterizer(rect, asset);
-    for (size_t j = 0; j < polygons.size(); j++) {
-      rasterizer.drawPolygon(polygons[j], styles[j].polygon);
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> expected =
+        createImageAsset(64, 64);
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> actual =
+        createImageAsset(64, 64);
+    size_t totalSize = 0;
+    for (int32_t i = 0; i < 3; i++) {
+      const size_t byteSize = size_t(64 >> i) * size_t(64 >> i) * 4;
+      expected->mipPositions.emplace_back(
+          CesiumImage::ImageAssetMipPosition{totalSize, byteSize});
+      actual->mipPositions.emplace_back(
+          CesiumImage::ImageAssetMipPosition{totalSize, byteSize});
+      totalSize += byteSize;
     }
-    rasterizer.finalize();
+    expected->pixelData.resize(totalSize, std::byte{255});
+    actual->pixelData.resize(totalSize, std::byte{255});
+
+    for (uint32_t i = 0; i < 3; i++) {
+      VectorRasterizer unpooled(rect, expected, i);
+      drawTestScene(unpooled);
+      unpooled.finalize();
+
+      VectorRasterizer pooled(rect, actual, pool, i);
+      drawTestScene(pooled);
+      pooled.finalize();
+    }
+
+    CHECK(actual->pixelData == expected->pixelData);
+  }
 
-    std::chrono::microseconds time =
-        std::chrono::duration_cast<std::chrono::microseconds>(
-            clock.now() - start);
-    total += time;
-    std::cout << "rasterized 1000 triangles in " << time.count()
-              << " microseconds\n";
-    writeImageToTgaFile(
-        *asset,
-        std::filesystem::path(CESIUM_NATIVE_TEMP_DIR) / "rand.tga");
+  SUBCASE("rasterizes large images with worker threads") {
+    VectorRasterizerPool pool(VectorRasterizerPoolOptions{
+        .maximumIdleCanvases = 8,
+        .threadCount = 2,
+        .minimumMultithreadedPixels = 0});
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> expected =
+        createImageAsset(512, 512);
+    VectorRasterizer unpooled(rect, expected);
+    drawTestScene(unpooled);
+    unpooled.finalize();
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> actual =
+        createImageAsset(512, 512);
+    VectorRasterizer pooled(rect, actual, pool);
+    drawTestScene(pooled);
+    pooled.finalize();
+
+    CHECK(actual->pixelData == expected->pixelData);
   }
 
-  double seconds =
-      std::chrono::duration_cast<std::chrono::duration<double>>(total).count();
-  std::cout << "100 runs in " << seconds << " seconds, avg per run "
-            << (seconds / 100.0) << " seconds\n";
+  SUBCASE("draws over the existing pixels of the destination") {
+    VectorRasterizerPool pool;
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> expected =
+        createImageAsset(64, 64);
+    for (size_t i = 0; i < expected->pixelData.size(); i++) {
+      expected->pixelData[i] = std::byte(i % 251);
+    }
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> actual =
+        createImageAsset(64, 64);
+    actual->pixelData = expected->pixelData;
+
+    // Leave other content in the pooled canvas first.
+    {
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> other =
+          createImageAsset(64, 64);
+      VectorRasterizer rasterizer(rect, other, pool);
+      rasterizer.clear(Color{10, 20, 30, 255});
+      rasterizer.finalize();
+    }
+
+    VectorRasterizer unpooled(rect, expected);
+    drawTestScene(unpooled);
+    unpooled.finalize();
+
+    VectorRasterizer pooled(rect, actual, pool);
+    drawTestScene(pooled);
+    pooled.finalize();
+
+    CHECK(actual->pixelData == expected->pixelData);
+  }
+
+  SUBCASE("can be moved") {
+    VectorRasterizerPool pool;
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> expected =
+        createImageAsset(32, 32);
+    VectorRasterizer unpooled(rect, expected);
+    drawTestScene(unpooled);
+    unpooled.finalize();
+
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> actual =
+        createImageAsset(32, 32);
+    VectorRasterizer pooled(rect, actual, pool);
+    drawTestScene(pooled);
+
+    VectorRasterizer moved(std::move(pooled));
+    CHECK(pool.getIdleCanvasCount() == 0);
+    moved.finalize();
+    CHECK(pool.getIdleCanvasCount() == 1);
+    CHECK(actual->pixelData == expected->pixelData);
+
+    // Assigning over an unfinalized rasterizer returns its canvas to the pool.
+    CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> other =
+        createImageAsset(32, 32);
+    VectorRasterizer first(rect, other, pool);
+    VectorRasterizer second(rect, other, pool);
+    CHECK(pool.getIdleCanvasCount() == 0);
+    first = std::move(second);
+    CHECK(pool.getIdleCanvasCount() == 1);
+    first.finalize();
+    CHECK(pool.getIdleCanvasCount() == 2);
+  }
+
+  SUBCASE("returns canvases to the pool up to the limit") {
+    VectorRasterizerPool pool(
+        VectorRasterizerPoolOptions{.maximumIdleCanvases = 2});
+
+    {
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset0 =
+          createImageAsset(16, 16);
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset1 =
+          createImageAsset(16, 16);
+      CesiumUtility::IntrusivePointer<CesiumImage::ImageAsset> asset2 =
+          createImageAsset(16, 16);
+      VectorRasterizer rasterizer0(rect, asset0, pool);
+      VectorRasterizer rasterizer1(rect, asset1, pool);
+      VectorRasterizer rasterizer2(rect, asset2, pool);
+      CHECK(pool.getIdleCanvasCount() == 0);
+
+      rasterizer0.finalize();
+      CHECK(pool.getIdleCanvasCount() == 1);
+
+      // Rasterizers that are never finalized still return their canvases.
+    }
+
+    CHECK(pool.getIdleCanvasCount() == 2);
+  }
 }
@@ -16,6 +16,7 @@
 
 #include <spdlog/fwd.h>
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -40,6 +41,26 @@ struct GeoJsonDocumentRasterOverlayOptions {
    * @brief The number of mip levels to generate.
    */
   uint32_t mipLevels = 0;
+
+  /**
+   * @brief The maximum distance, in pixels, by which the drawn lines and
+   * polygons may deviate from the original geometry.
+   *
+   * When greater than zero, simplified versions of every line and polygon are
+   * computed with the Douglas-Peucker algorithm, at a series of tolerances,
+   * when the tile provider is created. Each tile then draws the coarsest
+   * version whose tolerance is within this many of the tile's pixels, so that
+   * tiles covering large parts of a detailed document draw far fewer vertices.
+   * Polygons and holes that are smaller than the tolerance are not drawn.
+   *
+   * A value of 0.5 produces images that are nearly indistinguishable from the
+   * original geometry. When zero, the original geometry is always drawn.
+   *
+   * The simplified versions are kept in memory alongside the document. Use
+   * \ref GeoJsonDocumentRasterOverlay::computeIndexSizeBytes to measure how
+   * much memory they take for a particular document.
+   */
+  double simplificationTolerancePixels = 0.0;
 };
 
 /**
@@ -90,6 +111,23 @@ public:
       const CesiumRasterOverlays::CreateRasterOverlayTileProviderParameters&
           parameters) const override;
 
+  /**
+   * @brief Computes the approximate number of bytes used by the spatial index
+   * that a tile provider builds for a GeoJSON document, including the
+   * simplified geometry requested by
+   * \ref GeoJsonDocumentRasterOverlayOptions::simplificationTolerancePixels.
+   *
+   * The document itself is not included. The index is built in order to
+   * measure it, so this takes as long as creating a tile provider.
+   *
+   * @param document The GeoJSON document.
+   * @param options The options the overlay would be created with.
+   * @returns The size of the index in bytes.
+   */
+  static int64_t computeIndexSizeBytes(
+      const CesiumVectorData::GeoJsonDocument& document,
+      const GeoJsonDocumentRasterOverlayOptions& options);
+
 private:
   CesiumAsync::Future<std::shared_ptr<CesiumVectorData::GeoJsonDocument>>
       _documentFuture;
@@ -23,6 +23,7 @@
 #include <CesiumVectorData/GeoJsonObject.h>
 #include <CesiumVectorData/GeoJsonObjectTypes.h>
 #include <CesiumVectorData/VectorRasterizer.h>
+#include <CesiumVectorData/VectorRasterizerPool.h>
 #include <CesiumVectorData/VectorStyle.h>
 #include <CesiumVectorOverlays/GeoJsonDocumentRasterOverlay.h>
 #include <CesiumVectorOverlays/Library.h>
@@ -31,9 +32,11 @@
 #include <glm/ext/vector_double2.hpp>
 #include <glm/ext/vector_double3.hpp>
 #include <glm/ext/vector_int2.hpp>
+#include <glm/geometric.hpp>
 #include <nonstd/expected.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -52,9 +55,39 @@ using namespace CesiumRasterOverlays;
 // We won't generate any quadtree nodes past this depth.
 const uint32_t DEPTH_LIMIT = 8;
 
+// Simplified geometry is computed at tolerances that start at the size of one
+// pixel of a 256x256 tile covering the whole document, and halve up to this
+// many times.
+const uint32_t SIMPLIFICATION_LEVEL_LIMIT = 16;
+
+// A simplified version of a geometry is only kept when it has at most this
+// fraction of the vertices of the next finer version. Otherwise the finer
+// version is used in its place.
+const double SIMPLIFICATION_LEVEL_MAX_VERTEX_RATIO = 0.9;
+
 namespace CesiumVectorOverlays {
 
 namespace {
+/**
+ * @brief A simplified version of a geometry object.
+ */
+struct SimplifiedGeometry {
+  /**
+   * @brief The maximum distance, in degrees, of the simplified geometry from
+   * the original.
+   */
+  double tolerance;
+  /**
+   * @brief The number of vertices in the simplified geometry.
+   */
+  size_t vertexCount;
+  /**
+   * @brief The simplified geometry, or `std::nullopt` if the geometry is
+   * smaller than the tolerance and nothing should be drawn.
+   */
+  std::optional<GeoJsonObject> object;
+};
+
 /**
  * @brief A single geometry object in a GeoJSON file, with all the information
  * required for rendering.
@@ -77,6 +110,28 @@ struct QuadtreeGeometryData {
    * `LineWidthMode::Pixels`.
    */
   double maxLineWidthPixels = 0.0;
+  /**
+   * @brief Simplified versions of this geometry, from the coarsest to the
+   * finest. Empty if the geometry is not simplified.
+   */
+  std::vector<SimplifiedGeometry> simplified;
+
+  /**
+   * @brief Returns the coarsest version of this geometry that is within the
+   * given tolerance of the original, or `nullptr` if nothing should be drawn.
+   *
+   * @param tolerance The maximum allowed distance, in degrees, from the
+   * original geometry.
+   */
+  const GeoJsonObject* getObjectForTolerance(double tolerance) const {
+    for (const SimplifiedGeometry& simplifiedGeometry : this->simplified) {
+      if (simplifiedGeometry.tolerance <= tolerance) {
+        return simplifiedGeometry.object ? &*simplifiedGeometry.object
+                                         : nullptr;
+      }
+    }
+    return this->pObject;
+  }
 
   /**
    * @brief Calculates the size of the bounding rectangle for this geometry when
@@ -227,6 +282,12 @@ struct Quadtree {
   GlobeRectangle rectangle = GlobeRectangle::EMPTY;
   uint32_t rootId = 0;
   VectorStyle defaultStyle;
+  /**
+   * @brief The maximum distance, in pixels, that drawn geometry may deviate
+   * from the original. See
+   * \ref GeoJsonDocumentRasterOverlayOptions::simplificationTolerancePixels.
+   */
+  double simplificationTolerancePixels = 0.0;
   std::vector<QuadtreeNode> nodes;
   std::vector<QuadtreeGeometryData> data;
   /**
@@ -463,8 +524,9 @@ void addPrimitivesToData(
         geoJsonObject,
         &style,
         std::move(*rect),
-        maxLineWidthPixels};
-    data.emplace_back(primitive);
+        maxLineWidthPixels,
+        {}};
+    data.emplace_back(std::move(primitive));
   }
 
   std::visit(
@@ -472,6 +534,237 @@ void addPrimitivesToData(
       geoJsonObject->value);
 }
 
+double distanceSquaredToSegment(
+    const glm::dvec3& point,
+    const glm::dvec3& segmentStart,
+    const glm::dvec3& segmentEnd) {
+  const glm::dvec2 segment =
+      glm::dvec2(segmentEnd) - glm::dvec2(segmentStart);
+  const glm::dvec2 toPoint = glm::dvec2(point) - glm::dvec2(segmentStart);
+  const double lengthSquared = glm::dot(segment, segment);
+  const double t =
+      lengthSquared > 0.0
+          ? std::clamp(glm::dot(toPoint, segment) / lengthSquared, 0.0, 1.0)
+          : 0.0;
+  const glm::dvec2 offset = toPoint - segment * t;
+  return glm::dot(offset, offset);
+}
+
+/**
+ * @brief Simplifies a line with the Douglas-Peucker algorithm, keeping its
+ * first and last points.
+ *
+ * The simplified line is within `tolerance` of every point of the original.
+ * Distances are measured in the longitude / latitude plane, in degrees, which
+ * is the plane in which tiles are rasterized.
+ */
+std::vector<glm::dvec3>
+simplifyLine(const std::vector<glm::dvec3>& points, double tolerance) {
+  if (points.size() <= 2) {
+    return points;
+  }
+
+  const double toleranceSquared = tolerance * tolerance;
+  std::vector<bool> keep(points.size(), false);
+  keep.front() = true;
+  keep.back() = true;
+
+  // Use an explicit stack rather than recursion, because lines in large
+  // documents can have hundreds of thousands of points.
+  std::vector<std::pair<size_t, size_t>> ranges{{0, points.size() - 1}};
+  while (!ranges.empty()) {
+    const auto [first, last] = ranges.back();
+    ranges.pop_back();
+
+    double farthestDistanceSquared = 0.0;
+    size_t farthest = first;
+    for (size_t i = first + 1; i < last; ++i) {
+      const double distanceSquared =
+          distanceSquaredToSegment(points[i], points[first], points[last]);
+      if (distanceSquared > farthestDistanceSquared) {
+        farthestDistanceSquared = distanceSquared;
+        farthest = i;
+      }
+    }
+
+    if (farthestDistanceSquared > toleranceSquared) {
+      keep[farthest] = true;
+      ranges.emplace_back(first, farthest);
+      ranges.emplace_back(farthest, last);
+    }
+  }
+
+  std::vector<glm::dvec3> result;
+  for (size_t i = 0; i < points.size(); ++i) {
+    if (keep[i]) {
+      result.emplace_back(points[i]);
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Simplifies the rings of a polygon. Returns an empty polygon if the
+ * outer ring is smaller than the tolerance; holes that are smaller than the
+ * tolerance are removed.
+ */
+std::vector<std::vector<glm::dvec3>> simplifyPolygon(
+    const std::vector<std::vector<glm::dvec3>>& rings,
+    double tolerance) {
+  std::vector<std::vector<glm::dvec3>> result;
+  for (const std::vector<glm::dvec3>& ring : rings) {
+    std::vector<glm::dvec3> simplified = simplifyLine(ring, tolerance);
+    // A closed ring needs at least three distinct points plus the closing
+    // point to enclose any area.
+    if (simplified.size() < 4) {
+      if (result.empty()) {
+        return result;
+      }
+      continue;
+    }
+    result.emplace_back(std::move(simplified));
+  }
+  return result;
+}
+
+size_t countVertices(const std::vector<std::vector<glm::dvec3>>& lines) {
+  size_t count = 0;
+  for (const std::vector<glm::dvec3>& line : lines) {
+    count += line.size();
+  }
+  return count;
+}
+
+/**
+ * @brief Computes the simplified version of a line or polygon geometry object
+ * at a given tolerance, along with its number of vertices.
+ */
+struct SimplifyGeometryVisitor {
+  double tolerance;
+
+  SimplifiedGeometry operator()(const GeoJsonLineString& line) {
+    GeoJsonLineString simplified;
+    simplified.coordinates = simplifyLine(line.coordinates, tolerance);
+    const size_t vertexCount = simplified.coordinates.size();
+    return {tolerance, vertexCount, GeoJsonObject{std::move(simplified)}};
+  }
+
+  SimplifiedGeometry operator()(const GeoJsonMultiLineString& lines) {
+    GeoJsonMultiLineString simplified;
+    simplified.coordinates.reserve(lines.coordinates.size());
+    for (const std::vector<glm::dvec3>& line : lines.coordinates) {
+      simplified.coordinates.emplace_back(simplifyLine(line, tolerance));
+    }
+    const size_t vertexCount = countVertices(simplified.coordinates);
+    return {tolerance, vertexCount, GeoJsonObject{std::move(simplified)}};
+  }
+
+  SimplifiedGeometry operator()(const GeoJsonPolygon& polygon) {
+    GeoJsonPolygon simplified;
+    simplified.coordinates = simplifyPolygon(polygon.coordinates, tolerance);
+    const size_t vertexCount = countVertices(simplified.coordinates);
+    if (simplified.coordinates.empty()) {
+      return {tolerance, 0, std::nullopt};
+    }
+    return {tolerance, vertexCount, GeoJsonObject{std::move(simplified)}};
+  }
+
+  SimplifiedGeometry operator()(const GeoJsonMultiPolygon& polygons) {
+    GeoJsonMultiPolygon simplified;
+    size_t vertexCount = 0;
+    for (const std::vector<std::vector<glm::dvec3>>& polygon :
+         polygons.coordinates) {
+      std::vector<std::vector<glm::dvec3>> simplifiedPolygon =
+          simplifyPolygon(polygon, tolerance);
+      if (!simplifiedPolygon.empty()) {
+        vertexCount += countVertices(simplifiedPolygon);
+        simplified.coordinates.emplace_back(std::move(simplifiedPolygon));
+      }
+    }
+    if (simplified.coordinates.empty()) {
+      return {tolerance, 0, std::nullopt};
+    }
+    return {tolerance, vertexCount, GeoJsonObject{std::move(simplified)}};
+  }
+
+  SimplifiedGeometry operator()(const auto& /*catchAll*/) {
+    return {tolerance, 0, std::nullopt};
+  }
+};
+
+size_t countOriginalVertices(const GeoJsonObject& object) {
+  if (const GeoJsonLineString* pLine = object.getIf<GeoJsonLineString>()) {
+    return pLine->coordinates.size();
+  }
+  if (const GeoJsonMultiLineString* pLines =
+          object.getIf<GeoJsonMultiLineString>()) {
+    return countVertices(pLines->coordinates);
+  }
+  if (const GeoJsonPolygon* pPolygon = object.getIf<GeoJsonPolygon>()) {
+    return countVertices(pPolygon->coordinates);
+  }
+  if (const GeoJsonMultiPolygon* pPolygons =
+          object.getIf<GeoJsonMultiPolygon>()) {
+    size_t count = 0;
+    for (const std::vector<std::vector<glm::dvec3>>& polygon :
+         pPolygons->coordinates) {
+      count += countVertices(polygon);
+    }
+    return count;
+  }
+  // Points are not simplified.
+  return 0;
+}
+
+/**
+ * @brief Computes the simplified versions of a geometry object, from the
+ * given coarsest tolerance down to the point where simplification no longer
+ * removes at least half of the vertices.
+ *
+ * A new version is only stored when it has more than about 10% more vertices
+ * than the previous one, and the finest has at most half of the vertices of
+ * the original. All versions together therefore hold at most about six times
+ * the vertices of the original, no matter how many tolerances are tried.
+ */
+void addSimplifiedGeometry(
+    QuadtreeGeometryData& data,
+    double coarsestTolerance) {
+  const size_t originalVertexCount = countOriginalVertices(*data.pObject);
+  // Geometry this small is not worth simplifying.
+  if (originalVertexCount < 16) {
+    return;
+  }
+
+  // The vertex count of the coarsest version that the last stored version
+  // stands in for.
+  size_t groupVertexCount = 0;
+  for (uint32_t level = 0; level < SIMPLIFICATION_LEVEL_LIMIT; ++level) {
+    const double tolerance =
+        std::ldexp(coarsestTolerance, -static_cast<int>(level));
+    SimplifiedGeometry simplified =
+        std::visit(SimplifyGeometryVisitor{tolerance}, data.pObject->value);
+    if (simplified.vertexCount * 2 > originalVertexCount) {
+      break;
+    }
+
+    // A finer version also satisfies every coarser tolerance, so when it has
+    // barely more vertices than a coarser version, it replaces that version
+    // rather than being stored alongside it. Douglas-Peucker keeps a superset
+    // of the points as the tolerance shrinks, so this also merges versions
+    // that are identical.
+    if (!data.simplified.empty() &&
+        double(groupVertexCount) >=
+            SIMPLIFICATION_LEVEL_MAX_VERTEX_RATIO *
+                double(simplified.vertexCount)) {
+      data.simplified.back() = std::move(simplified);
+      continue;
+    }
+
+    groupVertexCount = simplified.vertexCount;
+    data.simplified.emplace_back(std::move(simplified));
+  }
+}
+
 uint32_t buildQuadtreeNode(
     Quadtree& tree,
     const QuadtreeTilingScheme& tilingScheme,
@@ -594,16 +887,18 @@ uint32_t buildQuadtreeNode(
 
 void buildQuadtree(
     Quadtree& tree,
-    const std::shared_ptr<GeoJsonDocument>& document,
+    const GeoJsonDocument& document,
     const VectorStyle& defaultStyle,
+    double simplificationTolerancePixels,
     const Ellipsoid& ellipsoid) {
   tree.defaultStyle = defaultStyle;
+  tree.simplificationTolerancePixels = simplificationTolerancePixels;
 
   BoundingRegionBuilder builder;
   const std::optional<VectorStyle>& rootObjectStyle =
-      document->rootObject.getStyle();
+      document.rootObject.getStyle();
   addPrimitivesToData(
-      &document->rootObject,
+      &document.rootObject,
       tree.data,
       builder,
       rootObjectStyle ? *rootObjectStyle : tree.defaultStyle,
@@ -611,6 +906,17 @@ void buildQuadtree(
 
   tree.rectangle = builder.toGlobeRectangle();
 
+  if (simplificationTolerancePixels > 0.0) {
+    const double coarsestTolerance =
+        Math::radiansToDegrees(std::max(
+            tree.rectangle.computeWidth(),
+            tree.rectangle.computeHeight())) /
+        256.0;
+    for (QuadtreeGeometryData& data : tree.data) {
+      addSimplifiedGeometry(data, coarsestTolerance);
+    }
+  }
+
   std::vector<uint32_t> dataIndices;
   dataIndices.reserve(tree.data.size());
   for (size_t i = 0; i < tree.data.size(); i++) {
@@ -633,13 +939,33 @@ void buildQuadtree(
   tree.dataNodeIndicesBegin.emplace_back((uint32_t)tree.dataIndices.size());
 }
 
+/**
+ * @brief Computes the approximate number of bytes used by a quadtree,
+ * including its simplified geometry but not the original document.
+ */
+int64_t computeQuadtreeSizeBytes(const Quadtree& tree) {
+  int64_t size = int64_t(sizeof(Quadtree));
+  size += int64_t(tree.nodes.capacity() * sizeof(QuadtreeNode));
+  size += int64_t(tree.data.capacity() * sizeof(QuadtreeGeometryData));
+  for (const QuadtreeGeometryData& data : tree.data) {
+    size += int64_t(data.simplified.capacity() * sizeof(SimplifiedGeometry));
+    for (const SimplifiedGeometry& simplified : data.simplified) {
+      size += int64_t(simplified.vertexCount * sizeof(glm::dvec3));
+    }
+  }
+  size += int64_t(tree.dataIndices.capacity() * sizeof(uint32_t));
+  size += int64_t(tree.dataNodeIndicesBegin.capacity() * sizeof(uint32_t));
+  return size;
+}
+
 void rasterizeQuadtreeNode(
     const Quadtree& tree,
     uint32_t nodeId,
     const GlobeRectangle& rectangle,
     VectorRasterizer& rasterizer,
     std::vector<bool>& primitivesRendered,
-    const glm::dvec2& halfPixelSize) {
+    const glm::dvec2& halfPixelSize,
+    double simplificationTolerance) {
   const QuadtreeNode& node = tree.nodes[nodeId];
   const GlobeRectangle scaledNodeRectangle =
       node.getRectangleScaledWithPixelSize(halfPixelSize);
@@ -657,7 +983,11 @@ void rasterizeQuadtreeNode(
       }
       primitivesRendered[dataIdx] = true;
       const QuadtreeGeometryData& data = tree.data[dataIdx];
-      rasterizer.drawGeoJsonObject(*data.pObject, *data.pStyle);
+      const GeoJsonObject* pObject =
+          data.getObjectForTolerance(simplificationTolerance);
+      if (pObject) {
+        rasterizer.drawGeoJsonObject(*pObject, *data.pStyle);
+      }
     }
   } else {
     for (size_t i = 0; i < 2; i++) {
@@ -672,7 +1002,8 @@ void rasterizeQuadtreeNode(
               rectangle,
               rasterizer,
               primitivesRendered,
-              halfPixelSize);
+              halfPixelSize,
+              simplificationTolerance);
         }
       }
     }
@@ -684,10 +1015,19 @@ void rasterizeVectorData(
     const GlobeRectangle& rectangle,
     const Quadtree& tree,
     const Ellipsoid& ellipsoid,
-    const glm::dvec2& halfPixelSize) {
+    const glm::dvec2& halfPixelSize,
+    VectorRasterizerPool& rasterizerPool) {
   // Keeps track of primitives that have already been rendered to avoid
   // re-drawing the same primitives that appear in multiple quadtree nodes.
   std::vector<bool> primitivesRendered(tree.data.size(), false);
+
+  // The distance, in degrees, that drawn geometry may deviate from the
+  // original. Use the smaller pixel dimension of the full-resolution image.
+  const double simplificationTolerance =
+      tree.simplificationTolerancePixels *
+      Math::radiansToDegrees(
+          2.0 * std::min(halfPixelSize.x, halfPixelSize.y));
+
   for (size_t i = 0;
        i < std::max(result.pImage->mipPositions.size(), (size_t)1);
        i++) {
@@ -696,6 +1036,7 @@ void rasterizeVectorData(
     VectorRasterizer rasterizer(
         rectangle,
         result.pImage,
+        rasterizerPool,
         (uint32_t)i,
         ellipsoid);
     rasterizeQuadtreeNode(
@@ -704,7 +1045,8 @@ void rasterizeVectorData(
         rectangle,
         rasterizer,
         primitivesRendered,
-        halfPixelSize);
+        halfPixelSize,
+        simplificationTolerance);
     rasterizer.finalize();
   }
 }
@@ -716,6 +1058,7 @@ class CESIUMVECTOROVERLAYS_API GeoJsonDocumentRasterOverlayTileProvider final
 private:
   std::shared_ptr<GeoJsonDocument> _pDocument;
   std::shared_ptr<Quadtree> _pTree;
+  std::shared_ptr<VectorRasterizerPool> _pRasterizerPool;
   Ellipsoid _ellipsoid;
   uint32_t _mipLevels;
 
@@ -724,7 +1067,8 @@ public:
       const IntrusivePointer<const RasterOverlay>& pCreator,
       const CreateRasterOverlayTileProviderParameters& parameters,
       const GeoJsonDocumentRasterOverlayOptions& geoJsonOptions,
-      std::shared_ptr<CesiumVectorData::GeoJsonDocument>&& pDocument)
+      std::shared_ptr<CesiumVectorData::GeoJsonDocument>&& pDocument,
+      std::shared_ptr<Quadtree>&& pTree)
       : RasterOverlayTileProvider(
             pCreator,
             parameters,
@@ -733,16 +1077,12 @@ public:
                 GeographicProjection(geoJsonOptions.ellipsoid),
                 GlobeRectangle::MAXIMUM)),
         _pDocument(std::move(pDocument)),
-        _pTree(),
+        _pTree(std::move(pTree)),
+        _pRasterizerPool(std::make_shared<VectorRasterizerPool>()),
         _ellipsoid(geoJsonOptions.ellipsoid),
         _mipLevels(geoJsonOptions.mipLevels) {
     CESIUM_ASSERT(this->_pDocument);
-    this->_pTree = std::make_shared<Quadtree>();
-    buildQuadtree(
-        *this->_pTree,
-        this->_pDocument,
-        geoJsonOptions.defaultStyle,
-        geoJsonOptions.ellipsoid);
+    CESIUM_ASSERT(this->_pTree);
   }
 
   virtual CesiumAsync::Future<LoadedRasterOverlayImage>
@@ -761,6 +1101,7 @@ public:
     return this->getAsyncSystem().runInWorkerThread(
         [pTree = this->_pTree,
          pDocument = this->_pDocument,
+         pRasterizerPool = this->_pRasterizerPool,
          ellipsoid = this->_ellipsoid,
          projection = this->getProjection(),
          rectangle = overlayTile.getRectangle(),
@@ -827,7 +1168,8 @@ public:
                 tileRectangle,
                 tree,
                 ellipsoid,
-                halfPixelSize);
+                halfPixelSize,
+                *pRasterizerPool);
           }
 
           return result;
@@ -864,12 +1206,31 @@ GeoJsonDocumentRasterOverlay::createTileProvider(
 
   IntrusivePointer<const GeoJsonDocumentRasterOverlay> thiz = this;
 
+  // Building the quadtree, and simplifying the geometry, can take a while for
+  // large documents, so do it in a worker thread.
   return std::move(
              const_cast<GeoJsonDocumentRasterOverlay*>(this)->_documentFuture)
+      .thenInWorkerThread(
+          [options = this->_options](
+              std::shared_ptr<GeoJsonDocument>&& pDocument) {
+            std::shared_ptr<Quadtree> pTree;
+            if (pDocument) {
+              pTree = std::make_shared<Quadtree>();
+              buildQuadtree(
+                  *pTree,
+                  *pDocument,
+                  options.defaultStyle,
+                  options.simplificationTolerancePixels,
+                  options.ellipsoid);
+            }
+            return std::make_pair(std::move(pDocument), std::move(pTree));
+          })
       .thenInMainThread(
-          [thiz, parameters](std::shared_ptr<GeoJsonDocument>&& pDocument)
+          [thiz, parameters](
+              std::pair<std::shared_ptr<GeoJsonDocument>,
+                        std::shared_ptr<Quadtree>>&& documentAndTree)
               -> CreateTileProviderResult {
-            if (!pDocument) {
+            if (!documentAndTree.first) {
               return nonstd::make_unexpected(RasterOverlayLoadFailureDetails{
                   .type = RasterOverlayLoadType::Unknown,
                   .pRequest = nullptr,
@@ -881,8 +1242,22 @@ GeoJsonDocumentRasterOverlay::createTileProvider(
                     thiz,
                     parameters,
                     thiz->_options,
-                    std::move(pDocument)));
+                    std::move(documentAndTree.first),
+                    std::move(documentAndTree.second)));
           });
 }
 
+/*static*/ int64_t GeoJsonDocumentRasterOverlay::computeIndexSizeBytes(
+    const GeoJsonDocument& document,
+    const GeoJsonDocumentRasterOverlayOptions& options) {
+  Quadtree tree;
+  buildQuadtree(
+      tree,
+      document,
+      options.defaultStyle,
+      options.simplificationTolerancePixels,
+      options.ellipsoid);
+  return computeQuadtreeSizeBytes(tree);
+}
+
 } // namespace CesiumVectorOverlays
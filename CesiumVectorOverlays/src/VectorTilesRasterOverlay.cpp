@@ -33,6 +33,7 @@
 #include <CesiumUtility/Result.h>
 #include <CesiumUtility/TreeTraversalState.h>
 #include <CesiumVectorData/VectorRasterizer.h>
+#include <CesiumVectorData/VectorRasterizerPool.h>
 #include <CesiumVectorData/VectorStyle.h>
 #include <CesiumVectorOverlays/VectorTilesRasterOverlay.h>
 
@@ -409,6 +410,8 @@ private:
   VectorTilesLoadRequester _loadRequester{_pSharedTileSelectionState};
   std::shared_ptr<VectorTilesPrepareRendererResources>
       _pPrepareRendererResources;
+  std::shared_ptr<CesiumVectorData::VectorRasterizerPool> _pRasterizerPool =
+      std::make_shared<CesiumVectorData::VectorRasterizerPool>();
 
 private:
   struct LoadTileImageInformation {
@@ -546,7 +549,8 @@ private:
         .thenInWorkerThread([textureSize,
                              rectangle,
                              tileRectangle,
-                             ellipsoid = this->_options.ellipsoid](
+                             ellipsoid = this->_options.ellipsoid,
+                             pRasterizerPool = this->_pRasterizerPool](
                                 LoadTileImageInformation&& loadInfo) {
           // part 4 - rasterizing the tile
           LoadedRasterOverlayImage result;
@@ -579,6 +583,7 @@ private:
             CesiumVectorData::VectorRasterizer rasterizer(
                 tileRectangle,
                 result.pImage,
+                *pRasterizerPool,
                 0,
                 ellipsoid);
 
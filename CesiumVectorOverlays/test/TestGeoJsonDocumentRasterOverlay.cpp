@@ -1,5 +1,6 @@
 #include <CesiumAsync/AsyncSystem.h>
 #include <CesiumGeospatial/BoundingRegionBuilder.h>
+#include <CesiumGeospatial/Cartographic.h>
 #include <CesiumGeospatial/GeographicProjection.h>
 #include <CesiumGeospatial/GlobeRectangle.h>
 #include <CesiumImage/ImageAsset.h>
@@ -19,6 +20,9 @@
 #include <spdlog/spdlog.h>
 
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <random>
@@ -156,6 +160,56 @@ createDocumentWithMultiPoint(const std::vector<glm::dvec3>& coordinates) {
   multiPoint.coordinates = coordinates;
   return GeoJsonDocument(GeoJsonObject{std::move(multiPoint)}, {});
 }
+
+// A line from 0 to 5 degrees longitude following a sine wave, with a small
+// zigzag that is much finer than a pixel at the tile sizes used below.
+GeoJsonLineString createDenseLineString(size_t pointCount) {
+  GeoJsonLineString lineString;
+  lineString.coordinates.reserve(pointCount);
+  for (size_t i = 0; i < pointCount; ++i) {
+    const double t = double(i) / double(pointCount - 1);
+    const double zigzag = (i % 2 == 0) ? 0.0001 : -0.0001;
+    lineString.coordinates.emplace_back(
+        5.0 * t,
+        std::sin(t * Math::TwoPi) + zigzag,
+        0.0);
+  }
+  return lineString;
+}
+
+// A closed ring approximating a circle.
+std::vector<glm::dvec3>
+createCircleRing(const glm::dvec2& center, double radius, size_t pointCount) {
+  std::vector<glm::dvec3> ring;
+  ring.reserve(pointCount + 1);
+  for (size_t i = 0; i < pointCount; ++i) {
+    const double angle = Math::TwoPi * double(i) / double(pointCount);
+    ring.emplace_back(
+        center.x + radius * std::cos(angle),
+        center.y + radius * std::sin(angle),
+        0.0);
+  }
+  ring.emplace_back(ring.front());
+  return ring;
+}
+
+// Counts the pixels whose alpha differs by more than the given threshold.
+size_t countDifferentPixels(
+    const CesiumImage::ImageAsset& a,
+    const CesiumImage::ImageAsset& b,
+    uint8_t threshold) {
+  REQUIRE(a.pixelData.size() == b.pixelData.size());
+  size_t count = 0;
+  for (size_t i = 3; i < a.pixelData.size(); i += 4) {
+    const int32_t difference = std::abs(
+        std::to_integer<int32_t>(a.pixelData[i]) -
+        std::to_integer<int32_t>(b.pixelData[i]));
+    if (difference > int32_t(threshold)) {
+      ++count;
+    }
+  }
+  return count;
+}
 } // namespace
 
 TEST_CASE(
@@ -686,3 +740,198 @@ TEST_CASE("GeoJsonDocumentRasterOverlay can render a MultiPoint") {
   // The MultiPoint's fill color should appear in the rasterized tile.
   CHECK(imageHasPixelWithColor(image, 0, 255, 0, 255));
 }
+
+TEST_CASE("GeoJsonDocumentRasterOverlay draws simplified geometry on coarse "
+          "tiles") {
+  GeoJsonDocumentRasterOverlayOptions options{
+      VectorStyle{
+          LineStyle{
+              ColorStyle{Color{255, 0, 0, 255}, ColorMode::Normal},
+              2.0,
+              LineWidthMode::Pixels},
+          PolygonStyle{
+              ColorStyle{Color{0, 255, 0, 255}, ColorMode::Normal},
+              std::nullopt}},
+      Ellipsoid::WGS84,
+      0};
+
+  const GlobeRectangle rectangle =
+      GlobeRectangle::fromDegrees(-1.0, -2.0, 6.0, 2.0);
+
+  SUBCASE("lines look the same as the original") {
+    CesiumImage::ImageAsset original = rasterizeOverlayTileFromDocument(
+        rectangle,
+        glm::dvec2(256, 256),
+        GeoJsonDocument(GeoJsonObject{createDenseLineString(20000)}, {}),
+        options);
+
+    options.simplificationTolerancePixels = 0.5;
+    CesiumImage::ImageAsset simplified = rasterizeOverlayTileFromDocument(
+        rectangle,
+        glm::dvec2(256, 256),
+        GeoJsonDocument(GeoJsonObject{createDenseLineString(20000)}, {}),
+        options);
+
+    REQUIRE(simplified.width == original.width);
+    REQUIRE(simplified.height == original.height);
+    CHECK(imageHasPixelWithColor(simplified, 255, 0, 0, 255));
+
+    // Only anti-aliased edge pixels may differ, and only slightly.
+    const size_t pixelCount =
+        size_t(simplified.width) * size_t(simplified.height);
+    CHECK(countDifferentPixels(original, simplified, 128) == 0);
+    CHECK(countDifferentPixels(original, simplified, 32) < pixelCount / 100);
+  }
+
+  SUBCASE("polygons smaller than the tolerance are not drawn") {
+    GeoJsonGeometryCollection collection;
+    collection.geometries.emplace_back(
+        GeoJsonObject{createDenseLineString(1000)});
+    GeoJsonPolygon polygon;
+    polygon.coordinates.emplace_back(
+        createCircleRing(glm::dvec2(2.5, -1.5), 0.001, 64));
+    collection.geometries.emplace_back(GeoJsonObject{std::move(polygon)});
+
+    options.simplificationTolerancePixels = 0.5;
+    CesiumImage::ImageAsset image = rasterizeOverlayTileFromDocument(
+        rectangle,
+        glm::dvec2(256, 256),
+        GeoJsonDocument(GeoJsonObject{std::move(collection)}, {}),
+        options);
+
+    CHECK(imageHasPixelWithColor(image, 255, 0, 0, 255));
+    bool hasPolygonPixel = false;
+    for (size_t i = 1; i < image.pixelData.size(); i += 4) {
+      hasPolygonPixel |= std::to_integer<uint8_t>(image.pixelData[i]) != 0;
+    }
+    CHECK(!hasPolygonPixel);
+  }
+
+  SUBCASE("simplified geometry takes a bounded amount of memory") {
+    constexpr size_t pointCount = 20000;
+    const GeoJsonDocument document(
+        GeoJsonObject{createDenseLineString(pointCount)},
+        {});
+
+    const int64_t originalSize =
+        GeoJsonDocumentRasterOverlay::computeIndexSizeBytes(document, options);
+    options.simplificationTolerancePixels = 0.5;
+    const int64_t simplifiedSize =
+        GeoJsonDocumentRasterOverlay::computeIndexSizeBytes(document, options);
+
+    // At most about six times the original vertices, plus a little
+    // bookkeeping for each simplified version.
+    CHECK(simplifiedSize > originalSize);
+    CHECK(
+        simplifiedSize - originalSize <
+        int64_t(6 * pointCount * sizeof(glm::dvec3) + 16 * 1024));
+  }
+}
+
+TEST_CASE(
+    "GeoJsonDocumentRasterOverlay simplification benchmark" *
+    doctest::skip()) {
+  const std::filesystem::path testDataPath =
+      std::filesystem::path(CesiumVectorOverlays_TEST_DATA_DIR) /
+      "vienna-streets.geojson";
+  Result<GeoJsonDocument> docResult =
+      GeoJsonDocument::fromGeoJson(readFile(testDataPath));
+  REQUIRE(docResult.value);
+
+  BoundingRegionBuilder builder;
+  for (const std::vector<glm::dvec3>& line :
+       docResult.value->rootObject.lines()) {
+    for (const glm::dvec3& point : line) {
+      builder.expandToIncludePosition(
+          Cartographic::fromDegrees(point.x, point.y, point.z));
+    }
+  }
+  const CesiumGeometry::Rectangle fullRectangle =
+      GeographicProjection(Ellipsoid::WGS84)
+          .project(builder.toGlobeRectangle());
+
+  const std::shared_ptr<GeoJsonDocument> pDocument =
+      std::make_shared<GeoJsonDocument>(std::move(*docResult.value));
+
+  const size_t tileCount = 1000;
+
+  for (double tolerance : {0.0, 0.5}) {
+    AsyncSystem asyncSystem(
+        std::make_shared<CesiumNativeTests::SimpleTaskProcessor>());
+
+    GeoJsonDocumentRasterOverlayOptions options{
+        VectorStyle{
+            LineStyle{
+                ColorStyle{Color{255, 0, 0, 255}, ColorMode::Normal},
+                2.0,
+                LineWidthMode::Pixels},
+            PolygonStyle{std::nullopt, std::nullopt}},
+        Ellipsoid::WGS84,
+        0};
+    options.simplificationTolerancePixels = tolerance;
+
+    IntrusivePointer<GeoJsonDocumentRasterOverlay> pOverlay;
+    pOverlay.emplace(asyncSystem, "overlay0", pDocument, options);
+
+    std::shared_ptr<CesiumAsync::IAssetAccessor> pAssetAccessor =
+        std::make_shared<CesiumNativeTests::SimpleAssetAccessor>(
+            std::map<
+                std::string,
+                std::shared_ptr<CesiumNativeTests::SimpleAssetRequest>>());
+
+    const std::chrono::time_point createStart =
+        std::chrono::steady_clock::now();
+    IntrusivePointer<ActivatedRasterOverlay> pActivated = pOverlay->activate(
+        RasterOverlayExternals{
+            .pAssetAccessor = pAssetAccessor,
+            .pPrepareRendererResources = nullptr,
+            .asyncSystem = asyncSystem,
+            .pCreditSystem = nullptr,
+            .pLogger = spdlog::default_logger()},
+        Ellipsoid::WGS84);
+    pActivated->getReadyEvent().waitInMainThread();
+    const std::chrono::time_point createEnd = std::chrono::steady_clock::now();
+    REQUIRE(pActivated->getTileProvider() != nullptr);
+
+    // Coarse tiles, each covering between a quarter and all of the document,
+    // are the ones that benefit from simplification.
+    std::default_random_engine rand(0xabcdabcd);
+    std::uniform_real_distribution<double> sizeDist(0.25, 1.0);
+    std::uniform_real_distribution<double> offsetDist(0.0, 1.0);
+
+    const std::chrono::time_point start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < tileCount; i++) {
+      const double width = sizeDist(rand) * fullRectangle.computeWidth();
+      const double height = sizeDist(rand) * fullRectangle.computeHeight();
+      const double x =
+          fullRectangle.minimumX +
+          offsetDist(rand) * (fullRectangle.computeWidth() - width);
+      const double y =
+          fullRectangle.minimumY +
+          offsetDist(rand) * (fullRectangle.computeHeight() - height);
+
+      IntrusivePointer<RasterOverlayTile> pTile;
+      pTile.emplace(
+          *pActivated,
+          glm::dvec2(256, 256),
+          CesiumGeometry::Rectangle{x, y, x + width, y + height});
+      pActivated->loadTile(*pTile).waitInMainThread();
+    }
+    const std::chrono::time_point end = std::chrono::steady_clock::now();
+
+    const int64_t indexSize =
+        GeoJsonDocumentRasterOverlay::computeIndexSizeBytes(
+            *pDocument,
+            options);
+
+    spdlog::info(
+        "Simplification tolerance {} pixels: created tile provider in {:.2f} "
+        "ms, index size {} bytes, {:.1f} tiles/sec",
+        tolerance,
+        std::chrono::duration<double, std::milli>(createEnd - createStart)
+            .count(),
+        indexSize,
+        double(tileCount) /
+            std::chrono::duration<double>(end - start).count());
+  }
+}